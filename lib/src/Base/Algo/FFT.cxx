@@ -117,6 +117,26 @@ FFT::NumericalComplexCollection FFT::inverseTransform(const NumericalComplexColl
 }
 
 
+/* FFT inverse transformation of the spectrum of a real sequence, the result being real */
+FFT::NumericalScalarCollection FFT::inverseTransformReal(const NumericalComplexCollection & collection) const
+{
+  return getImplementation()->inverseTransformReal(collection);
+}
+
+/* FFT transformation on complex, performed in place on each of the consecutive sequences of the given size stored in the collection */
+void FFT::transformBatch(NumericalComplexCollection & collection,
+                         const UnsignedLong size) const
+{
+  getImplementation()->transformBatch(collection, size);
+}
+
+/* FFT inverse transformation, performed in place on each of the consecutive sequences of the given size stored in the collection */
+void FFT::inverseTransformBatch(NumericalComplexCollection & collection,
+                                const UnsignedLong size) const
+{
+  getImplementation()->inverseTransformBatch(collection, size);
+}
+
 /* String converter */
 String FFT::__repr__() const
 {
@@ -105,6 +105,20 @@ public:
                                               const UnsignedLong step,
                                               const UnsignedLong last) const;
 
+  /** FFT inverse transformation of the spectrum of a real sequence, the result being real
+   * Given the hermitian sequence Z_n, compute the real sequence Y_k such that:
+   * Y_k = \frac{1}{N}\sum_{n=0}^{N-1} Z_n\exp(\frac{2i\pi kn}{N})
+   */
+  NumericalScalarCollection inverseTransformReal(const NumericalComplexCollection & collection) const;
+
+  /** FFT transformation on complex, performed in place on each of the consecutive sequences of the given size stored in the collection */
+  void transformBatch(NumericalComplexCollection & collection,
+                      const UnsignedLong size) const;
+
+  /** FFT inverse transformation, performed in place on each of the consecutive sequences of the given size stored in the collection */
+  void inverseTransformBatch(NumericalComplexCollection & collection,
+                             const UnsignedLong size) const;
+
   /** String converter */
   String __repr__() const;
 
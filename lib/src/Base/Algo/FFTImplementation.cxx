@@ -51,7 +51,10 @@ FFTImplementation * FFTImplementation::clone() const
 /* FFT transformation on real */
 FFTImplementation::NumericalComplexCollection FFTImplementation::transform(const NumericalScalarCollection & collection) const
 {
-  throw NotYetImplementedException(HERE);
+  const UnsignedLong size(collection.getSize());
+  NumericalComplexCollection complexCollection(size);
+  for (UnsignedLong i = 0; i < size; ++i) complexCollection[i] = collection[i];
+  return transform(complexCollection);
 }
 
 
@@ -101,6 +104,40 @@ FFTImplementation::NumericalComplexCollection FFTImplementation::inverseTransfor
   throw NotYetImplementedException(HERE);
 }
 
+/* FFT inverse transformation of the spectrum of a real sequence, the result being real */
+FFTImplementation::NumericalScalarCollection FFTImplementation::inverseTransformReal(const NumericalComplexCollection & collection) const
+{
+  const NumericalComplexCollection complexResult(inverseTransform(collection));
+  const UnsignedLong size(complexResult.getSize());
+  NumericalScalarCollection result(size);
+  for (UnsignedLong i = 0; i < size; ++i) result[i] = std::real(complexResult[i]);
+  return result;
+}
+
+/* FFT transformation on complex, performed in place on each of the consecutive sequences of the given size stored in the collection */
+void FFTImplementation::transformBatch(NumericalComplexCollection & collection,
+                                       const UnsignedLong size) const
+{
+  if ((size == 0) || (collection.getSize() % size != 0)) throw InvalidArgumentException(HERE) << "Error: the collection size=" << collection.getSize() << " is not a multiple of the sequence size=" << size;
+  for (UnsignedLong first = 0; first < collection.getSize(); first += size)
+    {
+      const NumericalComplexCollection result(transform(collection, first, size));
+      std::copy(result.begin(), result.end(), collection.begin() + first);
+    }
+}
+
+/* FFT inverse transformation, performed in place on each of the consecutive sequences of the given size stored in the collection */
+void FFTImplementation::inverseTransformBatch(NumericalComplexCollection & collection,
+                                              const UnsignedLong size) const
+{
+  if ((size == 0) || (collection.getSize() % size != 0)) throw InvalidArgumentException(HERE) << "Error: the collection size=" << collection.getSize() << " is not a multiple of the sequence size=" << size;
+  for (UnsignedLong first = 0; first < collection.getSize(); first += size)
+    {
+      const NumericalComplexCollection result(inverseTransform(collection, first, size));
+      std::copy(result.begin(), result.end(), collection.begin() + first);
+    }
+}
+
 /* String converter */
 String FFTImplementation::__repr__() const
 {
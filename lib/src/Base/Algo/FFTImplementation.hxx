@@ -82,6 +82,17 @@ public:
                                                       const UnsignedLong step,
                                                       const UnsignedLong last) const;
 
+  /** FFT inverse transformation of the spectrum of a real sequence, the result being real */
+  virtual NumericalScalarCollection inverseTransformReal(const NumericalComplexCollection & collection) const;
+
+  /** FFT transformation on complex, performed in place on each of the consecutive sequences of the given size stored in the collection */
+  virtual void transformBatch(NumericalComplexCollection & collection,
+                              const UnsignedLong size) const;
+
+  /** FFT inverse transformation, performed in place on each of the consecutive sequences of the given size stored in the collection */
+  virtual void inverseTransformBatch(NumericalComplexCollection & collection,
+                                     const UnsignedLong size) const;
+
   /** String converter */
   virtual String __repr__() const;
 
@@ -21,15 +21,54 @@
  *  @author schueller
  *  @date   2012-07-16 15:59:45 +0200 (Mon, 16 Jul 2012)
  */
+#include <map>
 #include "KissFFT.hxx"
 #include "Exception.hxx"
 #include "PersistentObjectFactory.hxx"
+#include "ResourceMap.hxx"
+#include "MutexLock.hxx"
 #include "kissfft.hh"
 
 BEGIN_NAMESPACE_OPENTURNS
 
 typedef kissfft<NumericalScalar> KISSFFTScalar;
 
+/* A plan gathers the factorization and the twiddle factors of the transformations of a given size and direction */
+struct KissFFTPlan
+{
+  KISSFFTScalar fft_;
+  // Twiddle factors exp(-i\pi k/size) used to split the transformation of a real sequence of size 2*size
+  KissFFT::NumericalComplexCollection halfTwiddles_;
+
+  KissFFTPlan(const UnsignedLong size,
+              const Bool inverse)
+    : fft_(size, inverse), halfTwiddles_(size)
+  {
+    for (UnsignedLong k = 0; k < size; ++k) halfTwiddles_[k] = std::polar(1.0, -M_PI * k / size);
+  }
+}; /* end struct KissFFTPlan */
+
+typedef Pointer<KissFFTPlan> KissFFTPlanPointer;
+typedef std::map<std::pair<UnsignedLong, Bool>, KissFFTPlanPointer> KissFFTPlanCache;
+
+static KissFFTPlanCache KissFFT_PlanCache_;
+static pthread_mutex_t KissFFT_PlanCacheMutex_ = PTHREAD_MUTEX_INITIALIZER;
+
+/* The plans are built once and shared by all the transformations, as they are not modified by the transformations */
+static KissFFTPlanPointer GetPlan(const UnsignedLong size,
+                                  const Bool inverse)
+{
+  MutexLock lock(KissFFT_PlanCacheMutex_);
+  const std::pair<UnsignedLong, Bool> key(size, inverse);
+  const KissFFTPlanCache::const_iterator it(KissFFT_PlanCache_.find(key));
+  if (it != KissFFT_PlanCache_.end()) return it->second;
+  // The cache is flushed when it is full
+  if (KissFFT_PlanCache_.size() >= ResourceMap::GetAsUnsignedLong("KissFFT-MaximumPlanNumber")) KissFFT_PlanCache_.clear();
+  const KissFFTPlanPointer plan(new KissFFTPlan(size, inverse));
+  KissFFT_PlanCache_[key] = plan;
+  return plan;
+}
+
 /**
  * @class KissFFT
  */
@@ -68,19 +107,37 @@ String KissFFT::__str__(const String & offset) const
 }
 
 
+/* FFT transformation on real */
+KissFFT::NumericalComplexCollection KissFFT::transform(const NumericalScalarCollection & collection) const
+{
+  const UnsignedLong size(collection.getSize());
+  // Sequences of odd size are transformed as complex sequences
+  if ((size < 2) || (size % 2 == 1)) return FFTImplementation::transform(collection);
+  const UnsignedLong halfSize(size / 2);
+  const KissFFTPlanPointer plan(GetPlan(halfSize, false));
+  // The even and odd terms are packed into the real and imaginary parts of a complex sequence of half size
+  NumericalComplexCollection packed(halfSize);
+  for (UnsignedLong m = 0; m < halfSize; ++m) packed[m] = NumericalComplex(collection[2 * m], collection[2 * m + 1]);
+  NumericalComplexCollection packedTransform(halfSize);
+  plan->fft_.transform( &packed[0] , &packedTransform[0] );
+  // The transformations of the even and odd terms are separated using the hermitian symmetry, then recombined
+  NumericalComplexCollection transformationResult(size);
+  for (UnsignedLong k = 0; k < halfSize; ++k)
+    {
+      const NumericalComplex zK(packedTransform[k]);
+      const NumericalComplex zMinusK(std::conj(packedTransform[(halfSize - k) % halfSize]));
+      const NumericalComplex evenTransform(0.5 * (zK + zMinusK));
+      const NumericalComplex oddTransform(plan->halfTwiddles_[k] * NumericalComplex(0.0, -0.5) * (zK - zMinusK));
+      transformationResult[k] = evenTransform + oddTransform;
+      transformationResult[k + halfSize] = evenTransform - oddTransform;
+    }
+  return transformationResult;
+}
+
 /* FFT transformation on complex */
 KissFFT::NumericalComplexCollection KissFFT::transform(const NumericalComplexCollection & collection) const
 {
-  // Get the size of the collection
-  const UnsignedLong fftSize(collection.getSize());
-
-  // Init of kissfft  - Boolean argument is to tell that we perform a direct transformation
-  KISSFFTScalar fft(fftSize, false);
-
-  // Allocation of memory for final result
-  NumericalComplexCollection transformationResult(fftSize);
-  fft.transform( &collection[0] , &transformationResult[0] );
-  return transformationResult;
+  return transform(collection, 0, collection.getSize());
 }
 
 /* FFT transformation on a regular complex sequence of the collection (between first and last, with elements separated by step)*/
@@ -88,49 +145,95 @@ KissFFT::NumericalComplexCollection KissFFT::transform(const NumericalComplexCol
                                                        const UnsignedLong first,
                                                        const UnsignedLong size) const
 {
-  // Init of kissfft  - Boolean argument is to tell that we perform a direct transformation
-  KISSFFTScalar fft(size, false);
+  const KissFFTPlanPointer plan(GetPlan(size, false));
 
   // Allocation of memory for final result
   NumericalComplexCollection transformationResult(size);
-  fft.transform( &collection[first] , &transformationResult[0] );
+  plan->fft_.transform( &collection[first] , &transformationResult[0] );
   return transformationResult;
 }
 
 /* FFT T transformation */
 KissFFT::NumericalComplexCollection KissFFT::inverseTransform(const NumericalComplexCollection & collection) const
 {
-  // Get the size of the collection
-  const UnsignedLong size(collection.getSize());
+  return inverseTransform(collection, 0, collection.getSize());
+}
 
-  // Init of kissfft  - Boolean argument is to tell that we perform an inverse transformation
-  KISSFFTScalar fft(size, true);
+/* FFT transformation on a regular complex sequence of the collection (between first and last, with elements separated by step)*/
+KissFFT::NumericalComplexCollection KissFFT::inverseTransform(const NumericalComplexCollection & collection,
+                                                              const UnsignedLong first,
+                                                              const UnsignedLong size) const
+{
+  const KissFFTPlanPointer plan(GetPlan(size, true));
 
   // Allocation of memory for final result
   NumericalComplexCollection transformationResult(size);
 
   // Inverse transform = transform with the opposite sign in the exponent and a 1/N factor
-  // Call inverse transformation
-  fft.transform( &collection[0] , &transformationResult[0] );
+  plan->fft_.transform( &collection[first] , &transformationResult[0] );
   const NumericalScalar alpha(1.0 / size);
   for (UnsignedLong index = 0; index < size; ++index) transformationResult[index] *= alpha;
   return transformationResult;
 }
 
-/* FFT transformation on a regular complex sequence of the collection (between first and last, with elements separated by step)*/
-KissFFT::NumericalComplexCollection KissFFT::inverseTransform(const NumericalComplexCollection & collection,
-                                                              const UnsignedLong first,
-                                                              const UnsignedLong size) const
+/* FFT inverse transformation of the spectrum of a real sequence, the result being real */
+KissFFT::NumericalScalarCollection KissFFT::inverseTransformReal(const NumericalComplexCollection & collection) const
+{
+  const UnsignedLong size(collection.getSize());
+  // Sequences of odd size are transformed as complex sequences
+  if ((size < 2) || (size % 2 == 1)) return FFTImplementation::inverseTransformReal(collection);
+  const UnsignedLong halfSize(size / 2);
+  const KissFFTPlanPointer plan(GetPlan(halfSize, true));
+  // The transformations of the even and odd terms are packed into a complex sequence of half size
+  NumericalComplexCollection packed(halfSize);
+  for (UnsignedLong k = 0; k < halfSize; ++k)
+    {
+      const NumericalComplex evenTransform(0.5 * (collection[k] + collection[k + halfSize]));
+      const NumericalComplex oddTransform(0.5 * (collection[k] - collection[k + halfSize]) * std::conj(plan->halfTwiddles_[k]));
+      packed[k] = evenTransform + NumericalComplex(0.0, 1.0) * oddTransform;
+    }
+  NumericalComplexCollection packedResult(halfSize);
+  plan->fft_.transform( &packed[0] , &packedResult[0] );
+  // The even and odd terms are the real and imaginary parts of the result
+  const NumericalScalar alpha(1.0 / halfSize);
+  NumericalScalarCollection transformationResult(size);
+  for (UnsignedLong m = 0; m < halfSize; ++m)
+    {
+      transformationResult[2 * m] = alpha * std::real(packedResult[m]);
+      transformationResult[2 * m + 1] = alpha * std::imag(packedResult[m]);
+    }
+  return transformationResult;
+}
+
+/* FFT transformation performed in place on each of the consecutive sequences of the given size */
+void KissFFT::transformBatch(NumericalComplexCollection & collection,
+                             const UnsignedLong size) const
 {
-  // Init of kissfft  - Boolean argument is true
-  KISSFFTScalar fft(size, true);
+  if ((size == 0) || (collection.getSize() % size != 0)) throw InvalidArgumentException(HERE) << "Error: the collection size=" << collection.getSize() << " is not a multiple of the sequence size=" << size;
+  const KissFFTPlanPointer plan(GetPlan(size, false));
+  // kissfft cannot transform in place, so the sequences go through a buffer shared by the whole batch
+  NumericalComplexCollection buffer(size);
+  for (UnsignedLong first = 0; first < collection.getSize(); first += size)
+    {
+      plan->fft_.transform( &collection[first] , &buffer[0] );
+      std::copy(buffer.begin(), buffer.end(), collection.begin() + first);
+    }
+}
 
-  // Allocation of memory for final result
-  NumericalComplexCollection transformationResult(size);
-  fft.transform( &collection[first] , &transformationResult[0] );
+/* FFT inverse transformation performed in place on each of the consecutive sequences of the given size */
+void KissFFT::inverseTransformBatch(NumericalComplexCollection & collection,
+                                    const UnsignedLong size) const
+{
+  if ((size == 0) || (collection.getSize() % size != 0)) throw InvalidArgumentException(HERE) << "Error: the collection size=" << collection.getSize() << " is not a multiple of the sequence size=" << size;
+  const KissFFTPlanPointer plan(GetPlan(size, true));
+  // kissfft cannot transform in place, so the sequences go through a buffer shared by the whole batch
+  NumericalComplexCollection buffer(size);
   const NumericalScalar alpha(1.0 / size);
-  for (UnsignedLong index = 0; index < size; ++index) transformationResult[index] *= alpha;
-  return transformationResult;
+  for (UnsignedLong first = 0; first < collection.getSize(); first += size)
+    {
+      plan->fft_.transform( &collection[first] , &buffer[0] );
+      for (UnsignedLong index = 0; index < size; ++index) collection[first + index] = alpha * buffer[index];
+    }
 }
 
 END_NAMESPACE_OPENTURNS
@@ -51,6 +51,9 @@ public:
   /** Virtual copy constructor */
   KissFFT * clone() const;
 
+  /** FFT transformation on real */
+  NumericalComplexCollection transform(const NumericalScalarCollection & collection) const;
+
   /** FFT transformation on complex */
   NumericalComplexCollection transform(const NumericalComplexCollection & collection) const;
 
@@ -67,6 +70,17 @@ public:
                                               const UnsignedLong first,
                                               const UnsignedLong size) const;
 
+  /** FFT inverse transformation of the spectrum of a real sequence, the result being real */
+  NumericalScalarCollection inverseTransformReal(const NumericalComplexCollection & collection) const;
+
+  /** FFT transformation performed in place on each of the consecutive sequences of the given size */
+  void transformBatch(NumericalComplexCollection & collection,
+                      const UnsignedLong size) const;
+
+  /** FFT inverse transformation performed in place on each of the consecutive sequences of the given size */
+  void inverseTransformBatch(NumericalComplexCollection & collection,
+                             const UnsignedLong size) const;
+
   /** String converter */
   String __repr__() const;
 
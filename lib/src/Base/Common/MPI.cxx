@@ -24,6 +24,7 @@
 #include <pthread.h>
 #include "Log.hxx"
 #include "MPI.hxx"
+#include "NumericalPoint.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -101,6 +102,47 @@ MPICommunicator MPICommunicator::GetCommWorld()
 #endif
 }
 
+/* Rank of the current instance in the communicator */
+UnsignedLong MPICommunicator::getRank() const
+{
+  int rank = 0;
+#ifdef HAVE_MPI
+  MPI_Comm_rank( *(p_comm_.get()), &rank );
+#endif
+  return rank;
+}
+
+/* Number of instances in the communicator */
+UnsignedLong MPICommunicator::getSize() const
+{
+  int size = 1;
+#ifdef HAVE_MPI
+  MPI_Comm_size( *(p_comm_.get()), &size );
+#endif
+  return size;
+}
+
+/* Sum the values over all the instances, the result being available on each of them */
+NumericalPoint MPICommunicator::allReduceSum(const NumericalPoint & values) const
+{
+  NumericalPoint result(values);
+#ifdef HAVE_MPI
+  const int size = values.getDimension();
+  if (size > 0) MPI_Allreduce( const_cast<NumericalScalar *>(&values[0]), &result[0], size, MPI_DOUBLE, MPI_SUM, *(p_comm_.get()) );
+#endif
+  return result;
+}
+
+/* Send the values of the root instance to all the others */
+void MPICommunicator::broadcast(NumericalPoint & values,
+                                const UnsignedLong root) const
+{
+#ifdef HAVE_MPI
+  const int size = values.getDimension();
+  if (size > 0) MPI_Bcast( &values[0], size, MPI_DOUBLE, root, *(p_comm_.get()) );
+#endif
+}
+
 
 
 
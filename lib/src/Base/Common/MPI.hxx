@@ -36,6 +36,8 @@
 
 BEGIN_NAMESPACE_OPENTURNS
 
+class NumericalPoint;
+
 /**
  * class MPICommunicator
  *
@@ -61,6 +63,21 @@ public:
   /** Return a global communicator that encompass all compute nodes */
   static MPICommunicator GetCommWorld();
 
+  /** Rank of the current instance in the communicator */
+  UnsignedLong getRank() const;
+
+  /** Number of instances in the communicator */
+  UnsignedLong getSize() const;
+
+#ifndef SWIG
+  /** Sum the values over all the instances, the result being available on each of them */
+  NumericalPoint allReduceSum(const NumericalPoint & values) const;
+
+  /** Send the values of the root instance to all the others */
+  void broadcast(NumericalPoint & values,
+                 const UnsignedLong root = 0) const;
+#endif
+
 private:
 
   Pointer<CommunicatorType> p_comm_;
@@ -203,8 +203,14 @@ Bool ResourceMap::getAsBool(String key) const
 {
   Bool value;
   String st = get( key );
+  // Booleans are written as true/false by setAsBool, but 1/0 are accepted too
   std::istringstream iss( st );
-  iss >> value;
+  iss >> std::boolalpha >> value;
+  if (iss.fail())
+    {
+      std::istringstream issNumeric( st );
+      issNumeric >> value;
+    }
   return value;
 }
 
@@ -375,6 +381,9 @@ void ResourceMap::loadDefaultConfiguration()
   // SpecFunc parameters //
   setAsNumericalScalar( "SpecFunc-Precision", 1.0e-12 );
 
+  // KissFFT parameters //
+  setAsUnsignedLong( "KissFFT-MaximumPlanNumber", 16 );
+
   // UniVariatePolynomialImplementation parameters //
   setAsUnsignedLong( "UniVariatePolynomialImplementation-SmallDegree", 400 );
 
@@ -400,6 +409,11 @@ void ResourceMap::loadDefaultConfiguration()
   setAsUnsignedLong( "GraphImplementation-DefaultWidth", 640 );
   setAsUnsignedLong( "GraphImplementation-DefaultHeight", 480 );
   setAsNumericalScalar( "GraphImplementation-DefaultLegendFontSize", 1.0 );
+  setAsBool( "GraphImplementation-UseNativeRenderer", false );
+
+  // GraphRenderer parameters //
+  setAsNumericalScalar( "GraphRenderer-FontSize", 12.0 );
+  setAsUnsignedLong( "GraphRenderer-DownsamplingThreshold", 5000 );
 
   // Contour parameters //
   setAsUnsignedLong( "Contour-DefaultLevelsNumber", 10 );
@@ -415,6 +429,7 @@ void ResourceMap::loadDefaultConfiguration()
   setAsNumericalScalar( "SQP-DefaultTau", 0.5 );
   setAsNumericalScalar( "SQP-DefaultOmega", 1.0e-4 );
   setAsNumericalScalar( "SQP-DefaultSmooth", 1.2 );
+  setAsUnsignedLong( "SQP-DefaultLineSearchBlockSize", 1 );
 
   // TNC parameters //
   setAsUnsignedLong( "TNC-DefaultMaxCGit", 50 );
@@ -428,6 +443,7 @@ void ResourceMap::loadDefaultConfiguration()
   setAsNumericalScalar( "AbdoRackwitz-DefaultTau", 0.5 );
   setAsNumericalScalar( "AbdoRackwitz-DefaultOmega", 1.0e-4 );
   setAsNumericalScalar( "AbdoRackwitz-DefaultSmooth", 1.2 );
+  setAsUnsignedLong( "AbdoRackwitz-DefaultLineSearchBlockSize", 1 );
 
   // NearestPointAlgorithmImplementation parameters //
   setAsNumericalScalar( "NearestPointAlgorithmImplementation-DefaultLevelValue", 0.0 );
@@ -455,6 +471,9 @@ void ResourceMap::loadDefaultConfiguration()
   // Compact parameters //
   setAsUnsignedLong( "Compact-DefaultHalfMaximumSize", 1024 );
 
+  // Spill parameters //
+  setAsUnsignedLong( "Spill-DefaultBlockSize", 65536 );
+
   // CorrelationAnalysis parameters //
   setAsUnsignedLong( "CorrelationAnalysis-DefaultMaximumOrder", 0 );
   setAsBool( "CorrelationAnalysis-DefaultTotalIndiceComputation", false );
@@ -476,6 +495,8 @@ void ResourceMap::loadDefaultConfiguration()
 
   // SensitivityAnalysis parameters //
   setAsUnsignedLong( "SensitivityAnalysis-DefaultBlockSize", 1 );
+  setAsUnsignedLong( "SensitivityAnalysis-DefaultBootstrapSize", 100 );
+  setAsUnsignedLong( "SensitivityAnalysis-BootstrapBlockNumber", 100 );
 
   // RandomGenerator parameters //
   setAsUnsignedLong( "RandomGenerator-InitialSeed", 0 );
@@ -487,7 +508,7 @@ void ResourceMap::loadDefaultConfiguration()
   setAsUnsignedLong( "Collection-size-visible-in-str-from", 10 );
 
   // NumericalSampleImplementation parameters
-  setAsUnsignedLong( "NumericalSampleImplementation-SmallKendallTau", 40 );
+  setAsUnsignedLong( "NumericalSampleImplementation-KendallTauInsertionSortSize", 32 );
 
   // Mesh parameters
   setAsNumericalScalar( "Mesh-SmallVolume", 1.0e-12 );
@@ -519,6 +540,10 @@ void ResourceMap::loadDefaultConfiguration()
   setAsNumericalScalar( "DirichletFactory-ParametersEpsilon", 1.0e-12 );
   setAsUnsignedLong( "DirichletFactory-MaximumIteration", 10 );
 
+  // KernelMixture parameters //
+  setAsUnsignedLong( "KernelMixture-SmallSize", 250 );
+  setAsUnsignedLong( "KernelMixture-BinNumberPerBandwidth", 32 );
+
   // KernelSmoothing parameters //
   setAsUnsignedLong( "KernelSmoothing-SmallSize", 250 );
   setAsNumericalScalar( "KernelSmoothing-CutOffPlugin", 5.0 );
@@ -526,6 +551,7 @@ void ResourceMap::loadDefaultConfiguration()
   setAsNumericalScalar( "KernelSmoothing-RelativePrecision", 1.0e-5 );
   setAsNumericalScalar( "KernelSmoothing-ResidualPrecision", 1.0e-10 );
   setAsUnsignedLong( "KernelSmoothing-MaximumIteration", 50 );
+  setAsUnsignedLong( "KernelSmoothing-BinNumber", 1024 );
 
   // LogNormal parameters //
   setAsUnsignedLong( "LogNormal-CharacteristicFunctionIntegrationNodes", 256 );
@@ -625,6 +651,7 @@ void ResourceMap::loadDefaultConfiguration()
   setAsNumericalScalar( "Simulation-DefaultMaximumCoefficientOfVariation", 1.0e-1 );
   setAsNumericalScalar( "Simulation-DefaultMaximumStandardDeviation", 0.0 );
   setAsUnsignedLong( "Simulation-DefaultBlockSize", 1 );
+  setAsUnsignedLong( "Simulation-DefaultConcurrentBlockNumber", 1 );
 
   // SimulationResultImplementation parameters //
   setAsNumericalScalar( "SimulationResultImplementation-DefaultConfidenceLevel", 0.95 );
@@ -635,6 +662,14 @@ void ResourceMap::loadDefaultConfiguration()
   // AnalyticalResult parameters //
   setAsNumericalScalar( "AnalyticalResult-DefaultWidth", 1.0 );
 
+  // SORM parameters //
+  setAsBool( "SORM-DefaultQuasiNewtonHessian", false );
+
+  // SORMResult parameters //
+  setAsUnsignedLong( "SORMResult-QuasiNewtonRefinementNumber", 5 );
+  setAsNumericalScalar( "SORMResult-QuasiNewtonRefinementStep", 1.0e-4 );
+  setAsNumericalScalar( "SORMResult-QuasiNewtonSkipThreshold", 1.0e-8 );
+
   // StrongMaximumTest parameters //
   setAsNumericalScalar( "StrongMaximumTest-DefaultDeltaPrecision", 1.0e-7 );
   setAsNumericalScalar( "StrongMaximumTest-Epsilon", 1.0e-10 );
@@ -685,6 +720,13 @@ void ResourceMap::loadDefaultConfiguration()
   // TemporalNormalProcess parameters //
   setAsNumericalScalar( "TemporalNormalProcess-StartingScaling", 1.0e-13 );
   setAsNumericalScalar( "TemporalNormalProcess-MaximalScaling", 1.0e5 );
+  setAsBool( "TemporalNormalProcess-UseCirculantEmbedding", true );
+  setAsUnsignedLong( "TemporalNormalProcess-MaximumCirculantPadding", 3 );
+  setAsNumericalScalar( "TemporalNormalProcess-CirculantEpsilon", 1.0e-10 );
+  setAsUnsignedLong( "TemporalNormalProcess-SampleBlockSize", 64 );
+
+  // ARMA parameters //
+  setAsUnsignedLong( "ARMA-SampleBlockSize", 128 );
 
   // SpectralNormalProcess parameters //
   setAsNumericalScalar( "SpectralNormalProcess-StartingScaling", 1.0e-13 );
@@ -697,6 +739,7 @@ void ResourceMap::loadDefaultConfiguration()
   setAsNumericalScalar( "WhittleFactory-DefaultMaxFun", 2000 );
   setAsNumericalScalar( "WhittleFactory-DefaultStartingPointScale", 1.0 );
   setAsNumericalScalar( "WhittleFactory-RootEpsilon", 1.0e-6);
+  setAsUnsignedLong( "WhittleFactory-MaximumNonImprovingLevels", 0 );
 
   // BoxCoxFactory parameters //
   setAsNumericalScalar( "BoxCoxFactory-DefaultRhoBeg", 0.1 );
@@ -726,6 +769,7 @@ void ResourceMap::loadDefaultConfiguration()
   setAsUnsignedLong( "ARMALikelihoodFactory-DefaultMaxFun", 10000 );
   setAsNumericalScalar( "ARMALikelihoodFactory-DefaultStartingPointScale", 1.0 );
   setAsNumericalScalar( "ARMALikelihoodFactory-RootEpsilon", 1.0e-6);
+  setAsNumericalScalar( "ARMALikelihoodFactory-KalmanSteadyStateEpsilon", 1.0e-12 );
 }
 
 /* String converter */
@@ -0,0 +1,143 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  AutomaticDifferentiation.hxx
+ *  @brief Gradients and hessians of templated functions by automatic differentiation
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_AUTOMATICDIFFERENTIATION_HXX
+#define OPENTURNS_AUTOMATICDIFFERENTIATION_HXX
+
+#include "DualNumber.hxx"
+#include "ReverseTape.hxx"
+#include "NumericalPoint.hxx"
+#include "Matrix.hxx"
+#include "SymmetricTensor.hxx"
+#include "Exception.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/**
+ * @class AutomaticDifferentiation
+ *
+ * Derivatives of a function object providing
+ *   template <class S> Collection<S> operator() (const Collection<S> & x) const
+ * The gradient is computed by the reverse mode: one recording of the function
+ * and one reverse sweep per output, whatever the input dimension. The hessian
+ * is computed by the forward mode over the reverse mode: each recording
+ * along an input direction gives the product of the hessian with this
+ * direction, so the full hessian costs a number of recordings equal to the
+ * input dimension.
+ */
+class AutomaticDifferentiation
+{
+public:
+
+  typedef ReverseTape<NumericalScalar>               Tape;
+  typedef Tape::Variable                             Variable;
+  typedef DualNumber<NumericalScalar>                Dual;
+  typedef ReverseTape<Dual>                          SecondOrderTape;
+  typedef SecondOrderTape::Variable                  SecondOrderVariable;
+
+  /** Gradient, stored as in NumericalMathGradientImplementation: inputDimension x outputDimension */
+  template <class F>
+  static Matrix Gradient(const F & function,
+                         const NumericalPoint & inP,
+                         const UnsignedLong outputDimension)
+  {
+    const UnsignedLong inputDimension(inP.getDimension());
+    Tape tape;
+    Collection<Variable> x(inputDimension);
+    for (UnsignedLong i = 0; i < inputDimension; ++i) x[i] = tape.newVariable(inP[i]);
+    const Collection<Variable> y(function(x));
+    if (y.getSize() != outputDimension) throw InvalidArgumentException(HERE) << "Error: the function returned " << y.getSize() << " values instead of " << outputDimension;
+    Matrix result(inputDimension, outputDimension);
+    for (UnsignedLong j = 0; j < outputDimension; ++j)
+      {
+        const Collection<NumericalScalar> gradient(tape.computeGradient(y[j], x));
+        for (UnsignedLong i = 0; i < inputDimension; ++i) result(i, j) = gradient[i];
+      }
+    return result;
+  }
+
+  /** Products of the hessians of all the outputs with a direction: inputDimension x outputDimension */
+  template <class F>
+  static Matrix HessianVectorProduct(const F & function,
+                                     const NumericalPoint & inP,
+                                     const NumericalPoint & direction,
+                                     const UnsignedLong outputDimension)
+  {
+    const UnsignedLong inputDimension(inP.getDimension());
+    if (direction.getDimension() != inputDimension) throw InvalidArgumentException(HERE) << "Error: the direction has a dimension=" << direction.getDimension() << " different from the input dimension=" << inputDimension;
+    Matrix result(inputDimension, outputDimension);
+    const Collection<Dual> values(directionalGradients(function, inP, direction, outputDimension));
+    for (UnsignedLong j = 0; j < outputDimension; ++j)
+      for (UnsignedLong i = 0; i < inputDimension; ++i) result(i, j) = values[i + j * inputDimension].getDerivative();
+    return result;
+  }
+
+  /** Hessian, stored as in NumericalMathHessianImplementation */
+  template <class F>
+  static SymmetricTensor Hessian(const F & function,
+                                 const NumericalPoint & inP,
+                                 const UnsignedLong outputDimension)
+  {
+    const UnsignedLong inputDimension(inP.getDimension());
+    SymmetricTensor result(inputDimension, outputDimension);
+    for (UnsignedLong k = 0; k < inputDimension; ++k)
+      {
+        NumericalPoint direction(inputDimension, 0.0);
+        direction[k] = 1.0;
+        const Collection<Dual> values(directionalGradients(function, inP, direction, outputDimension));
+        // Only the lower part is needed thanks to the symmetry
+        for (UnsignedLong j = 0; j < outputDimension; ++j)
+          for (UnsignedLong i = k; i < inputDimension; ++i) result(i, k, j) = values[i + j * inputDimension].getDerivative();
+      }
+    return result;
+  }
+
+private:
+
+  /** Gradients of all the outputs as dual numbers along the given direction */
+  template <class F>
+  static Collection<Dual> directionalGradients(const F & function,
+                                               const NumericalPoint & inP,
+                                               const NumericalPoint & direction,
+                                               const UnsignedLong outputDimension)
+  {
+    const UnsignedLong inputDimension(inP.getDimension());
+    SecondOrderTape tape;
+    Collection<SecondOrderVariable> x(inputDimension);
+    for (UnsignedLong i = 0; i < inputDimension; ++i) x[i] = tape.newVariable(Dual(inP[i], direction[i]));
+    const Collection<SecondOrderVariable> y(function(x));
+    if (y.getSize() != outputDimension) throw InvalidArgumentException(HERE) << "Error: the function returned " << y.getSize() << " values instead of " << outputDimension;
+    Collection<Dual> result(inputDimension * outputDimension);
+    for (UnsignedLong j = 0; j < outputDimension; ++j)
+      {
+        const Collection<Dual> gradient(tape.computeGradient(y[j], x));
+        for (UnsignedLong i = 0; i < inputDimension; ++i) result[i + j * inputDimension] = gradient[i];
+      }
+    return result;
+  }
+
+}; /* class AutomaticDifferentiation */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_AUTOMATICDIFFERENTIATION_HXX */
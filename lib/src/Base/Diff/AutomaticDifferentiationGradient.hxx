@@ -0,0 +1,108 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  AutomaticDifferentiationGradient.hxx
+ *  @brief Gradient of a templated function by reverse mode automatic differentiation
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_AUTOMATICDIFFERENTIATIONGRADIENT_HXX
+#define OPENTURNS_AUTOMATICDIFFERENTIATIONGRADIENT_HXX
+
+#include "NumericalMathGradientImplementation.hxx"
+#include "AutomaticDifferentiation.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/**
+ * @class AutomaticDifferentiationGradient
+ *
+ * The gradient of a function object written against a templated scalar type,
+ * see AutomaticDifferentiation. It costs a small constant times one evaluation
+ * of the function, whatever the input dimension.
+ */
+template <class TemplatedFunction>
+class AutomaticDifferentiationGradient
+  : public NumericalMathGradientImplementation
+{
+public:
+
+  /** Parameters constructor */
+  AutomaticDifferentiationGradient(const TemplatedFunction & function,
+                                   const UnsignedLong inputDimension,
+                                   const UnsignedLong outputDimension)
+    : NumericalMathGradientImplementation(),
+      function_(function),
+      inputDimension_(inputDimension),
+      outputDimension_(outputDimension)
+  {
+    // Nothing to do
+  }
+
+  /** Virtual constructor */
+  virtual AutomaticDifferentiationGradient * clone() const
+  {
+    return new AutomaticDifferentiationGradient(*this);
+  }
+
+  /** String converter */
+  virtual String __repr__() const
+  {
+    OSS oss;
+    oss << "class=AutomaticDifferentiationGradient name=" << getName()
+        << " inputDimension=" << inputDimension_
+        << " outputDimension=" << outputDimension_;
+    return oss;
+  }
+
+  /** Gradient method */
+  using NumericalMathGradientImplementation::gradient;
+  virtual Matrix gradient(const NumericalPoint & inP) const
+  {
+    if (inP.getDimension() != inputDimension_) throw InvalidArgumentException(HERE) << "Error: trying to evaluate a NumericalMathFunction with an argument of invalid dimension";
+    ++callsNumber_;
+    return AutomaticDifferentiation::Gradient(function_, inP, outputDimension_);
+  }
+
+  /** Accessor for input point dimension */
+  virtual UnsignedLong getInputDimension() const
+  {
+    return inputDimension_;
+  }
+
+  /** Accessor for output point dimension */
+  virtual UnsignedLong getOutputDimension() const
+  {
+    return outputDimension_;
+  }
+
+  /** Method save() stores the object through the StorageManager
+   *  The function object cannot be saved
+   */
+
+private:
+
+  TemplatedFunction function_;
+  UnsignedLong inputDimension_;
+  UnsignedLong outputDimension_;
+
+}; /* class AutomaticDifferentiationGradient */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_AUTOMATICDIFFERENTIATIONGRADIENT_HXX */
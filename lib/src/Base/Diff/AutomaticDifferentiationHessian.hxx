@@ -0,0 +1,117 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  AutomaticDifferentiationHessian.hxx
+ *  @brief Hessian of a templated function by forward over reverse automatic differentiation
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_AUTOMATICDIFFERENTIATIONHESSIAN_HXX
+#define OPENTURNS_AUTOMATICDIFFERENTIATIONHESSIAN_HXX
+
+#include "NumericalMathHessianImplementation.hxx"
+#include "AutomaticDifferentiation.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/**
+ * @class AutomaticDifferentiationHessian
+ *
+ * The hessian of a function object written against a templated scalar type,
+ * see AutomaticDifferentiation. A hessian-vector product costs a small
+ * constant times one evaluation of the function, the full hessian costs
+ * inputDimension such products.
+ */
+template <class TemplatedFunction>
+class AutomaticDifferentiationHessian
+  : public NumericalMathHessianImplementation
+{
+public:
+
+  /** Parameters constructor */
+  AutomaticDifferentiationHessian(const TemplatedFunction & function,
+                                  const UnsignedLong inputDimension,
+                                  const UnsignedLong outputDimension)
+    : NumericalMathHessianImplementation(),
+      function_(function),
+      inputDimension_(inputDimension),
+      outputDimension_(outputDimension)
+  {
+    // Nothing to do
+  }
+
+  /** Virtual constructor */
+  virtual AutomaticDifferentiationHessian * clone() const
+  {
+    return new AutomaticDifferentiationHessian(*this);
+  }
+
+  /** String converter */
+  virtual String __repr__() const
+  {
+    OSS oss;
+    oss << "class=AutomaticDifferentiationHessian name=" << getName()
+        << " inputDimension=" << inputDimension_
+        << " outputDimension=" << outputDimension_;
+    return oss;
+  }
+
+  /** Hessian method */
+  using NumericalMathHessianImplementation::hessian;
+  virtual SymmetricTensor hessian(const NumericalPoint & inP) const
+  {
+    if (inP.getDimension() != inputDimension_) throw InvalidArgumentException(HERE) << "Error: trying to evaluate a NumericalMathFunction with an argument of invalid dimension";
+    ++callsNumber_;
+    return AutomaticDifferentiation::Hessian(function_, inP, outputDimension_);
+  }
+
+  /** Products of the hessians of all the outputs with a direction, one column per output */
+  Matrix hessianVectorProduct(const NumericalPoint & inP,
+                              const NumericalPoint & direction) const
+  {
+    if (inP.getDimension() != inputDimension_) throw InvalidArgumentException(HERE) << "Error: trying to evaluate a NumericalMathFunction with an argument of invalid dimension";
+    return AutomaticDifferentiation::HessianVectorProduct(function_, inP, direction, outputDimension_);
+  }
+
+  /** Accessor for input point dimension */
+  virtual UnsignedLong getInputDimension() const
+  {
+    return inputDimension_;
+  }
+
+  /** Accessor for output point dimension */
+  virtual UnsignedLong getOutputDimension() const
+  {
+    return outputDimension_;
+  }
+
+  /** Method save() stores the object through the StorageManager
+   *  The function object cannot be saved
+   */
+
+private:
+
+  TemplatedFunction function_;
+  UnsignedLong inputDimension_;
+  UnsignedLong outputDimension_;
+
+}; /* class AutomaticDifferentiationHessian */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_AUTOMATICDIFFERENTIATIONHESSIAN_HXX */
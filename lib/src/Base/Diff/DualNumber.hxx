@@ -0,0 +1,367 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  DualNumber.hxx
+ *  @brief Dual numbers for the forward mode automatic differentiation
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_DUALNUMBER_HXX
+#define OPENTURNS_DUALNUMBER_HXX
+
+#include <cmath>
+#include "OTprivate.hxx"
+#include "SpecFunc.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/**
+ * @class DualNumber
+ *
+ * A dual number value + derivative * eps with eps^2 = 0. Evaluating a function
+ * written against a templated scalar type with dual numbers gives both its
+ * value and its directional derivative along the input derivatives in a single
+ * pass (forward mode automatic differentiation). The scalar type T can itself
+ * be a dual number, which gives second order derivatives.
+ * The mathematical functions are defined as friends, so they are found by
+ * argument dependent lookup and do not hide the standard ones.
+ */
+template <class T>
+class DualNumber
+{
+public:
+
+  /** Default constructor, the null constant */
+  DualNumber()
+    : value_(0.0),
+      derivative_(0.0)
+  {
+    // Nothing to do
+  }
+
+  /** Constant constructor, from any type convertible to T */
+  template <class S>
+  DualNumber(const S & value)
+    : value_(value),
+      derivative_(0.0)
+  {
+    // Nothing to do
+  }
+
+  /** Parameters constructor */
+  DualNumber(const T & value,
+             const T & derivative)
+    : value_(value),
+      derivative_(derivative)
+  {
+    // Nothing to do
+  }
+
+  /** Value accessor */
+  T getValue() const
+  {
+    return value_;
+  }
+
+  /** Derivative accessor */
+  T getDerivative() const
+  {
+    return derivative_;
+  }
+
+  void setDerivative(const T & derivative)
+  {
+    derivative_ = derivative;
+  }
+
+  /** In-place arithmetic */
+  DualNumber & operator += (const DualNumber & other)
+  {
+    value_ += other.value_;
+    derivative_ += other.derivative_;
+    return *this;
+  }
+
+  DualNumber & operator -= (const DualNumber & other)
+  {
+    value_ -= other.value_;
+    derivative_ -= other.derivative_;
+    return *this;
+  }
+
+  DualNumber & operator *= (const DualNumber & other)
+  {
+    *this = *this * other;
+    return *this;
+  }
+
+  DualNumber & operator /= (const DualNumber & other)
+  {
+    *this = *this / other;
+    return *this;
+  }
+
+  /** Arithmetic */
+  friend DualNumber operator + (const DualNumber & x)
+  {
+    return x;
+  }
+
+  friend DualNumber operator - (const DualNumber & x)
+  {
+    return DualNumber(-x.value_, -x.derivative_);
+  }
+
+  friend DualNumber operator + (const DualNumber & x,
+                                const DualNumber & y)
+  {
+    return DualNumber(x.value_ + y.value_, x.derivative_ + y.derivative_);
+  }
+
+  friend DualNumber operator - (const DualNumber & x,
+                                const DualNumber & y)
+  {
+    return DualNumber(x.value_ - y.value_, x.derivative_ - y.derivative_);
+  }
+
+  friend DualNumber operator * (const DualNumber & x,
+                                const DualNumber & y)
+  {
+    return DualNumber(x.value_ * y.value_, x.derivative_ * y.value_ + x.value_ * y.derivative_);
+  }
+
+  friend DualNumber operator / (const DualNumber & x,
+                                const DualNumber & y)
+  {
+    const T value(x.value_ / y.value_);
+    return DualNumber(value, (x.derivative_ - value * y.derivative_) / y.value_);
+  }
+
+  /** Comparisons only involve the values */
+  friend Bool operator == (const DualNumber & x,
+                           const DualNumber & y)
+  {
+    return x.value_ == y.value_;
+  }
+
+  friend Bool operator != (const DualNumber & x,
+                           const DualNumber & y)
+  {
+    return x.value_ != y.value_;
+  }
+
+  friend Bool operator < (const DualNumber & x,
+                          const DualNumber & y)
+  {
+    return x.value_ < y.value_;
+  }
+
+  friend Bool operator <= (const DualNumber & x,
+                           const DualNumber & y)
+  {
+    return x.value_ <= y.value_;
+  }
+
+  friend Bool operator > (const DualNumber & x,
+                          const DualNumber & y)
+  {
+    return x.value_ > y.value_;
+  }
+
+  friend Bool operator >= (const DualNumber & x,
+                           const DualNumber & y)
+  {
+    return x.value_ >= y.value_;
+  }
+
+  /** Elementary functions */
+  friend DualNumber sqrt(const DualNumber & x)
+  {
+    const T value(sqrt(x.value_));
+    return DualNumber(value, 0.5 * x.derivative_ / value);
+  }
+
+  friend DualNumber cbrt(const DualNumber & x)
+  {
+    const T value(cbrt(x.value_));
+    return DualNumber(value, x.derivative_ / (3.0 * value * value));
+  }
+
+  friend DualNumber exp(const DualNumber & x)
+  {
+    const T value(exp(x.value_));
+    return DualNumber(value, value * x.derivative_);
+  }
+
+  friend DualNumber log(const DualNumber & x)
+  {
+    return DualNumber(log(x.value_), x.derivative_ / x.value_);
+  }
+
+  /** Power with a constant exponent */
+  friend DualNumber pow(const DualNumber & x,
+                        const NumericalScalar exponent)
+  {
+    if (exponent == 0.0) return DualNumber(1.0);
+    return DualNumber(pow(x.value_, exponent), exponent * pow(x.value_, exponent - 1.0) * x.derivative_);
+  }
+
+  /** Power with a variable exponent */
+  friend DualNumber pow(const DualNumber & x,
+                        const DualNumber & y)
+  {
+    const T value(pow(x.value_, y.value_));
+    return DualNumber(value, y.value_ * pow(x.value_, y.value_ - 1.0) * x.derivative_ + value * log(x.value_) * y.derivative_);
+  }
+
+  friend DualNumber fabs(const DualNumber & x)
+  {
+    if (x.value_ < 0.0) return -x;
+    return x;
+  }
+
+  friend DualNumber sin(const DualNumber & x)
+  {
+    return DualNumber(sin(x.value_), cos(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber cos(const DualNumber & x)
+  {
+    return DualNumber(cos(x.value_), -sin(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber tan(const DualNumber & x)
+  {
+    const T value(tan(x.value_));
+    return DualNumber(value, (1.0 + value * value) * x.derivative_);
+  }
+
+  friend DualNumber asin(const DualNumber & x)
+  {
+    return DualNumber(asin(x.value_), x.derivative_ / sqrt(1.0 - x.value_ * x.value_));
+  }
+
+  friend DualNumber acos(const DualNumber & x)
+  {
+    return DualNumber(acos(x.value_), -x.derivative_ / sqrt(1.0 - x.value_ * x.value_));
+  }
+
+  friend DualNumber atan(const DualNumber & x)
+  {
+    return DualNumber(atan(x.value_), x.derivative_ / (1.0 + x.value_ * x.value_));
+  }
+
+  friend DualNumber sinh(const DualNumber & x)
+  {
+    return DualNumber(sinh(x.value_), cosh(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber cosh(const DualNumber & x)
+  {
+    return DualNumber(cosh(x.value_), sinh(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber tanh(const DualNumber & x)
+  {
+    const T value(tanh(x.value_));
+    return DualNumber(value, (1.0 - value * value) * x.derivative_);
+  }
+
+  friend DualNumber asinh(const DualNumber & x)
+  {
+    return DualNumber(asinh(x.value_), x.derivative_ / sqrt(x.value_ * x.value_ + 1.0));
+  }
+
+  friend DualNumber acosh(const DualNumber & x)
+  {
+    return DualNumber(acosh(x.value_), x.derivative_ / sqrt(x.value_ * x.value_ - 1.0));
+  }
+
+  friend DualNumber atanh(const DualNumber & x)
+  {
+    return DualNumber(atanh(x.value_), x.derivative_ / (1.0 - x.value_ * x.value_));
+  }
+
+  /** Special functions */
+  friend DualNumber erf(const DualNumber & x)
+  {
+    return DualNumber(erf(x.value_), M_2_SQRTPI * exp(-x.value_ * x.value_) * x.derivative_);
+  }
+
+  friend DualNumber erfc(const DualNumber & x)
+  {
+    return DualNumber(erfc(x.value_), -M_2_SQRTPI * exp(-x.value_ * x.value_) * x.derivative_);
+  }
+
+  friend DualNumber lgamma(const DualNumber & x)
+  {
+    return DualNumber(lgamma(x.value_), DiGamma(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber tgamma(const DualNumber & x)
+  {
+    const T value(tgamma(x.value_));
+    return DualNumber(value, value * DiGamma(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber j0(const DualNumber & x)
+  {
+    return DualNumber(j0(x.value_), -j1(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber j1(const DualNumber & x)
+  {
+    const T value(j1(x.value_));
+    return DualNumber(value, (j0(x.value_) - value / x.value_) * x.derivative_);
+  }
+
+  friend DualNumber y0(const DualNumber & x)
+  {
+    return DualNumber(y0(x.value_), -y1(x.value_) * x.derivative_);
+  }
+
+  friend DualNumber y1(const DualNumber & x)
+  {
+    const T value(y1(x.value_));
+    return DualNumber(value, (y0(x.value_) - value / x.value_) * x.derivative_);
+  }
+
+  /** Derivative of the log-gamma function, up to the first order in dual numbers */
+  static NumericalScalar DiGamma(const NumericalScalar x)
+  {
+    return SpecFunc::DiGamma(x);
+  }
+
+  static DualNumber<NumericalScalar> DiGamma(const DualNumber<NumericalScalar> & x)
+  {
+    return DualNumber<NumericalScalar>(SpecFunc::DiGamma(x.getValue()), SpecFunc::TriGamma(x.getValue()) * x.getDerivative());
+  }
+
+private:
+
+  /** The value */
+  T value_;
+
+  /** The derivative */
+  T derivative_;
+
+}; /* class DualNumber */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_DUALNUMBER_HXX */
@@ -5414,8 +5414,11 @@ namespace Ev3
                         // can dispense from using copy here - tmp is not used thereafter
                         // and when tmp is deleted, its subnodes are not automatically
                         // deleted unless their reference counter is zero - which won't be.
-                        ret = ret / tmp;           // g'log(f) + gf'/f
-                        ret = ret * a.Copy();        // (g'log(f) + gf'/f)(f^g)
+                        ret = ret + tmp;           // g'log(f) + gf'/f
+                        // the coefficient of the node is applied once, at the end
+                        tmp = a.Copy();
+                        tmp->SetCoeff(1.0);
+                        ret = ret * tmp;        // (g'log(f) + gf'/f)(f^g)
                       }
                   }
                 // std:cerr << "\nout case POWER\n" << std::endl;
@@ -5469,6 +5472,7 @@ namespace Ev3
                                           HELPURL);
                   }
                 ret = a.Copy();  // tan(f)
+                ret->SetCoeff(1.0);
                 ret = ret ^ two;      // tan(f)^2
                 c->One();
                 ret = ret + c;         // tan(f)^2 + 1
@@ -5520,7 +5524,7 @@ namespace Ev3
                 ret = ret ^ two;
                 c->One();
                 ret = ret + c;
-                ret = Cosh(Diff(a->GetNode(0), vi)) / ret; // f' / (f^2 + 1)
+                ret = Diff(a->GetNode(0), vi) / ret; // f' / (f^2 + 1)
                 // std:cerr << "\nout case ATAN\n" << std::endl;
                 break;
               case SINH:
@@ -5556,10 +5560,11 @@ namespace Ev3
                                           HELPURL);
                   }
                 ret = a.Copy();
+                ret->SetCoeff(1.0);
                 ret = ret ^ two;
                 c->One();
                 ret = c - ret;
-                ret = ret * Diff(a->GetNode(0), vi);    // f' * (1 - tan(f)^2)
+                ret = ret * Diff(a->GetNode(0), vi);    // f' * (1 - tanh(f)^2)
                 // std:cerr << "\nout case TANH\n" << std::endl;
                 break;
               case ASINH:
@@ -5591,7 +5596,7 @@ namespace Ev3
                 ret = ret ^ two;
                 c->One();
                 ret = ret - c;
-                ret = -Diff(a->GetNode(0), vi) / Sqrt(ret); // f' / sqrt(f^2 - 1)
+                ret = Diff(a->GetNode(0), vi) / Sqrt(ret); // f' / sqrt(f^2 - 1)
                 // std:cerr << "\nout case ACOSH\n" << std::endl;
                 break;
               case ATANH:
@@ -5607,7 +5612,7 @@ namespace Ev3
                 ret = ret ^ two;
                 c->One();
                 ret = c - ret;
-                ret = Diff(a->GetNode(0), vi) / ret;    // f' / (1 - tan(f)^2)
+                ret = Diff(a->GetNode(0), vi) / ret;    // f' / (1 - f^2)
                 // std:cerr << "\nout case ATANH\n" << std::endl;
                 break;
               case LOG2:
@@ -5679,7 +5684,10 @@ namespace Ev3
                                           HELPURL);
                   }
                 ret = Diff(a->GetNode(0), vi);
-                ret = ret * a.Copy();  // f' e^f
+                // the coefficient of the node is applied once, at the end
+                tmp = a.Copy();
+                tmp->SetCoeff(1.0);
+                ret = ret * tmp;  // f' e^f
                 // std:cerr << "\nout case EXP\n" << std::endl;
                 break;
               case ERF:
@@ -5703,7 +5711,7 @@ namespace Ev3
                                           "erfc must have exactly 1 operand",
                                           HELPURL);
                   }
-                ret = -M_2_SQRTPI * Diff(a->GetNode(0), vi) * Exp(-(a->GetCopyOfNode(0) ^ two)); // (2/sqrt(pi)) f'e^(-f^2)
+                ret = -M_2_SQRTPI * Diff(a->GetNode(0), vi) * Exp(-(a->GetCopyOfNode(0) ^ two)); // -(2/sqrt(pi)) f'e^(-f^2)
                 // std:cerr << "\nout case ERFC\n" << std::endl;
                 break;
               case SQRT:
@@ -5811,7 +5819,7 @@ namespace Ev3
                                           "abs must have exactly 1 operand",
                                           HELPURL);
                   }
-                ret = Sign(a->GetCopyOfNode(0)); // sign(f)
+                ret = Diff(a->GetNode(0), vi) * Sign(a->GetCopyOfNode(0)); // f'sign(f)
                 // std:cerr << "\nout case ABS\n" << std::endl;
                 break;
               default:
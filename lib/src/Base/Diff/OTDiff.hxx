@@ -35,5 +35,10 @@
 #include "CenteredFiniteDifferenceGradient.hxx"
 #include "CenteredFiniteDifferenceHessian.hxx"
 #include "NonCenteredFiniteDifferenceGradient.hxx"
+#include "DualNumber.hxx"
+#include "ReverseTape.hxx"
+#include "AutomaticDifferentiation.hxx"
+#include "AutomaticDifferentiationGradient.hxx"
+#include "AutomaticDifferentiationHessian.hxx"
 
 #endif /* OPENTURNS_OTDIFF_HXX */
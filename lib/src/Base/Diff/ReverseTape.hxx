@@ -0,0 +1,488 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  ReverseTape.hxx
+ *  @brief Tape and variables for the reverse mode automatic differentiation
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_REVERSETAPE_HXX
+#define OPENTURNS_REVERSETAPE_HXX
+
+#include "DualNumber.hxx"
+#include "Collection.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+template <class T> class ReverseVariable;
+
+/**
+ * @class ReverseTape
+ *
+ * The tape records each elementary operation performed on reverse variables
+ * together with its local partial derivatives. A single reverse sweep then
+ * gives the derivatives of one output with respect to all the recorded
+ * variables, at a cost that does not depend on the number of inputs.
+ * When T is a dual number, the sweep propagates the directional derivatives
+ * of the adjoints, ie the product of the hessian with the input directions.
+ * A tape is not meant to be shared between threads.
+ */
+template <class T>
+class ReverseTape
+{
+public:
+
+  typedef ReverseVariable<T> Variable;
+  typedef Collection<T>      ScalarCollection;
+
+  /** Default constructor */
+  ReverseTape()
+    : nodes_(0)
+  {
+    // Nothing to do
+  }
+
+  /** Register an independent variable */
+  Variable newVariable(const T & value)
+  {
+    return Variable(value, this, record(0, 0, 0.0, 0, 0.0));
+  }
+
+  /** Record an operation with at most two arguments, returns its index */
+  UnsignedLong record(const UnsignedLong size,
+                      const UnsignedLong firstParent,
+                      const T & firstPartial,
+                      const UnsignedLong secondParent,
+                      const T & secondPartial)
+  {
+    Node node;
+    node.size_ = size;
+    node.parents_[0] = firstParent;
+    node.parents_[1] = secondParent;
+    node.partials_[0] = firstPartial;
+    node.partials_[1] = secondPartial;
+    nodes_.add(node);
+    return nodes_.getSize() - 1;
+  }
+
+  /** Reverse sweep: derivatives of the output with respect to every recorded node */
+  ScalarCollection computeAdjoints(const Variable & output) const
+  {
+    const UnsignedLong size(nodes_.getSize());
+    ScalarCollection adjoints(size, T(0.0));
+    // A constant output does not depend on anything
+    if (output.getTape() != this) return adjoints;
+    adjoints[output.getIndex()] = T(1.0);
+    for (UnsignedLong i = output.getIndex() + 1; i > 0; --i)
+      {
+        const Node & node(nodes_[i - 1]);
+        const T adjoint(adjoints[i - 1]);
+        for (UnsignedLong k = 0; k < node.size_; ++k) adjoints[node.parents_[k]] += node.partials_[k] * adjoint;
+      }
+    return adjoints;
+  }
+
+  /** Derivatives of the output with respect to the given variables */
+  ScalarCollection computeGradient(const Variable & output,
+                                   const Collection<Variable> & variables) const
+  {
+    const ScalarCollection adjoints(computeAdjoints(output));
+    const UnsignedLong size(variables.getSize());
+    ScalarCollection gradient(size);
+    for (UnsignedLong i = 0; i < size; ++i) gradient[i] = adjoints[variables[i].getIndex()];
+    return gradient;
+  }
+
+  /** Number of recorded operations */
+  UnsignedLong getSize() const
+  {
+    return nodes_.getSize();
+  }
+
+  /** Forget all the recorded operations, invalidating the variables */
+  void clear()
+  {
+    nodes_ = NodeCollection(0);
+  }
+
+private:
+
+  struct Node
+  {
+    UnsignedLong size_;
+    UnsignedLong parents_[2];
+    T partials_[2];
+  };
+
+  typedef Collection<Node> NodeCollection;
+
+  /** The recorded operations */
+  NodeCollection nodes_;
+
+}; /* class ReverseTape */
+
+
+/**
+ * @class ReverseVariable
+ *
+ * A scalar recorded on a reverse tape. Variables without tape are constants,
+ * the operations involving only constants are not recorded.
+ */
+template <class T>
+class ReverseVariable
+{
+public:
+
+  typedef ReverseTape<T> Tape;
+
+  /** Default constructor, the null constant */
+  ReverseVariable()
+    : value_(0.0),
+      p_tape_(0),
+      index_(0)
+  {
+    // Nothing to do
+  }
+
+  /** Constant constructor, from any type convertible to T */
+  template <class S>
+  ReverseVariable(const S & value)
+    : value_(value),
+      p_tape_(0),
+      index_(0)
+  {
+    // Nothing to do
+  }
+
+  /** Parameters constructor */
+  ReverseVariable(const T & value,
+                  Tape * p_tape,
+                  const UnsignedLong index)
+    : value_(value),
+      p_tape_(p_tape),
+      index_(index)
+  {
+    // Nothing to do
+  }
+
+  /** Value accessor */
+  T getValue() const
+  {
+    return value_;
+  }
+
+  /** Tape accessor, null for constants */
+  const Tape * getTape() const
+  {
+    return p_tape_;
+  }
+
+  /** Index accessor */
+  UnsignedLong getIndex() const
+  {
+    return index_;
+  }
+
+  /** In-place arithmetic */
+  ReverseVariable & operator += (const ReverseVariable & other)
+  {
+    *this = *this + other;
+    return *this;
+  }
+
+  ReverseVariable & operator -= (const ReverseVariable & other)
+  {
+    *this = *this - other;
+    return *this;
+  }
+
+  ReverseVariable & operator *= (const ReverseVariable & other)
+  {
+    *this = *this * other;
+    return *this;
+  }
+
+  ReverseVariable & operator /= (const ReverseVariable & other)
+  {
+    *this = *this / other;
+    return *this;
+  }
+
+  /** Arithmetic */
+  friend ReverseVariable operator + (const ReverseVariable & x)
+  {
+    return x;
+  }
+
+  friend ReverseVariable operator - (const ReverseVariable & x)
+  {
+    return Unary(x, -x.value_, -1.0);
+  }
+
+  friend ReverseVariable operator + (const ReverseVariable & x,
+                                     const ReverseVariable & y)
+  {
+    return Binary(x, y, x.value_ + y.value_, 1.0, 1.0);
+  }
+
+  friend ReverseVariable operator - (const ReverseVariable & x,
+                                     const ReverseVariable & y)
+  {
+    return Binary(x, y, x.value_ - y.value_, 1.0, -1.0);
+  }
+
+  friend ReverseVariable operator * (const ReverseVariable & x,
+                                     const ReverseVariable & y)
+  {
+    return Binary(x, y, x.value_ * y.value_, y.value_, x.value_);
+  }
+
+  friend ReverseVariable operator / (const ReverseVariable & x,
+                                     const ReverseVariable & y)
+  {
+    const T value(x.value_ / y.value_);
+    return Binary(x, y, value, 1.0 / y.value_, -value / y.value_);
+  }
+
+  /** Comparisons only involve the values */
+  friend Bool operator == (const ReverseVariable & x,
+                           const ReverseVariable & y)
+  {
+    return x.value_ == y.value_;
+  }
+
+  friend Bool operator != (const ReverseVariable & x,
+                           const ReverseVariable & y)
+  {
+    return x.value_ != y.value_;
+  }
+
+  friend Bool operator < (const ReverseVariable & x,
+                          const ReverseVariable & y)
+  {
+    return x.value_ < y.value_;
+  }
+
+  friend Bool operator <= (const ReverseVariable & x,
+                           const ReverseVariable & y)
+  {
+    return x.value_ <= y.value_;
+  }
+
+  friend Bool operator > (const ReverseVariable & x,
+                          const ReverseVariable & y)
+  {
+    return x.value_ > y.value_;
+  }
+
+  friend Bool operator >= (const ReverseVariable & x,
+                           const ReverseVariable & y)
+  {
+    return x.value_ >= y.value_;
+  }
+
+  /** Elementary functions */
+  friend ReverseVariable sqrt(const ReverseVariable & x)
+  {
+    const T value(sqrt(x.value_));
+    return Unary(x, value, 0.5 / value);
+  }
+
+  friend ReverseVariable cbrt(const ReverseVariable & x)
+  {
+    const T value(cbrt(x.value_));
+    return Unary(x, value, 1.0 / (3.0 * value * value));
+  }
+
+  friend ReverseVariable exp(const ReverseVariable & x)
+  {
+    const T value(exp(x.value_));
+    return Unary(x, value, value);
+  }
+
+  friend ReverseVariable log(const ReverseVariable & x)
+  {
+    return Unary(x, log(x.value_), 1.0 / x.value_);
+  }
+
+  /** Power with a constant exponent */
+  friend ReverseVariable pow(const ReverseVariable & x,
+                             const NumericalScalar exponent)
+  {
+    if (exponent == 0.0) return ReverseVariable(1.0);
+    return Unary(x, pow(x.value_, exponent), exponent * pow(x.value_, exponent - 1.0));
+  }
+
+  /** Power with a variable exponent */
+  friend ReverseVariable pow(const ReverseVariable & x,
+                             const ReverseVariable & y)
+  {
+    const T value(pow(x.value_, y.value_));
+    // The log of the base is only needed if the exponent is recorded
+    return Binary(x, y, value, y.value_ * pow(x.value_, y.value_ - 1.0), (y.p_tape_ ? value * log(x.value_) : T(0.0)));
+  }
+
+  friend ReverseVariable fabs(const ReverseVariable & x)
+  {
+    if (x.value_ < 0.0) return -x;
+    return x;
+  }
+
+  friend ReverseVariable sin(const ReverseVariable & x)
+  {
+    return Unary(x, sin(x.value_), cos(x.value_));
+  }
+
+  friend ReverseVariable cos(const ReverseVariable & x)
+  {
+    return Unary(x, cos(x.value_), -sin(x.value_));
+  }
+
+  friend ReverseVariable tan(const ReverseVariable & x)
+  {
+    const T value(tan(x.value_));
+    return Unary(x, value, 1.0 + value * value);
+  }
+
+  friend ReverseVariable asin(const ReverseVariable & x)
+  {
+    return Unary(x, asin(x.value_), 1.0 / sqrt(1.0 - x.value_ * x.value_));
+  }
+
+  friend ReverseVariable acos(const ReverseVariable & x)
+  {
+    return Unary(x, acos(x.value_), -1.0 / sqrt(1.0 - x.value_ * x.value_));
+  }
+
+  friend ReverseVariable atan(const ReverseVariable & x)
+  {
+    return Unary(x, atan(x.value_), 1.0 / (1.0 + x.value_ * x.value_));
+  }
+
+  friend ReverseVariable sinh(const ReverseVariable & x)
+  {
+    return Unary(x, sinh(x.value_), cosh(x.value_));
+  }
+
+  friend ReverseVariable cosh(const ReverseVariable & x)
+  {
+    return Unary(x, cosh(x.value_), sinh(x.value_));
+  }
+
+  friend ReverseVariable tanh(const ReverseVariable & x)
+  {
+    const T value(tanh(x.value_));
+    return Unary(x, value, 1.0 - value * value);
+  }
+
+  friend ReverseVariable asinh(const ReverseVariable & x)
+  {
+    return Unary(x, asinh(x.value_), 1.0 / sqrt(x.value_ * x.value_ + 1.0));
+  }
+
+  friend ReverseVariable acosh(const ReverseVariable & x)
+  {
+    return Unary(x, acosh(x.value_), 1.0 / sqrt(x.value_ * x.value_ - 1.0));
+  }
+
+  friend ReverseVariable atanh(const ReverseVariable & x)
+  {
+    return Unary(x, atanh(x.value_), 1.0 / (1.0 - x.value_ * x.value_));
+  }
+
+  /** Special functions */
+  friend ReverseVariable erf(const ReverseVariable & x)
+  {
+    return Unary(x, erf(x.value_), M_2_SQRTPI * exp(-x.value_ * x.value_));
+  }
+
+  friend ReverseVariable erfc(const ReverseVariable & x)
+  {
+    return Unary(x, erfc(x.value_), -M_2_SQRTPI * exp(-x.value_ * x.value_));
+  }
+
+  friend ReverseVariable lgamma(const ReverseVariable & x)
+  {
+    return Unary(x, lgamma(x.value_), DualNumber<NumericalScalar>::DiGamma(x.value_));
+  }
+
+  friend ReverseVariable tgamma(const ReverseVariable & x)
+  {
+    const T value(tgamma(x.value_));
+    return Unary(x, value, value * DualNumber<NumericalScalar>::DiGamma(x.value_));
+  }
+
+  friend ReverseVariable j0(const ReverseVariable & x)
+  {
+    return Unary(x, j0(x.value_), -j1(x.value_));
+  }
+
+  friend ReverseVariable j1(const ReverseVariable & x)
+  {
+    const T value(j1(x.value_));
+    return Unary(x, value, j0(x.value_) - value / x.value_);
+  }
+
+  friend ReverseVariable y0(const ReverseVariable & x)
+  {
+    return Unary(x, y0(x.value_), -y1(x.value_));
+  }
+
+  friend ReverseVariable y1(const ReverseVariable & x)
+  {
+    const T value(y1(x.value_));
+    return Unary(x, value, y0(x.value_) - value / x.value_);
+  }
+
+private:
+
+  /** Record a unary operation */
+  static ReverseVariable Unary(const ReverseVariable & x,
+                               const T & value,
+                               const T & partial)
+  {
+    if (!x.p_tape_) return ReverseVariable(value);
+    return ReverseVariable(value, x.p_tape_, x.p_tape_->record(1, x.index_, partial, 0, 0.0));
+  }
+
+  /** Record a binary operation */
+  static ReverseVariable Binary(const ReverseVariable & x,
+                                const ReverseVariable & y,
+                                const T & value,
+                                const T & xPartial,
+                                const T & yPartial)
+  {
+    if (!y.p_tape_) return Unary(x, value, xPartial);
+    if (!x.p_tape_) return Unary(y, value, yPartial);
+    return ReverseVariable(value, x.p_tape_, x.p_tape_->record(2, x.index_, xPartial, y.index_, yPartial));
+  }
+
+  /** The value */
+  T value_;
+
+  /** The tape the variable is recorded on */
+  Tape * p_tape_;
+
+  /** The index of the variable on its tape */
+  UnsignedLong index_;
+
+}; /* class ReverseVariable */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_REVERSETAPE_HXX */
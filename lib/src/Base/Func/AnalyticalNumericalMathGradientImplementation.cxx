@@ -22,6 +22,7 @@
 #include "parser.h"
 #include "Log.hxx"
 #include "Os.hxx"
+#include "AutomaticDifferentiation.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -35,9 +36,11 @@ static Factory<AnalyticalNumericalMathGradientImplementation> RegisteredFactory(
 AnalyticalNumericalMathGradientImplementation::AnalyticalNumericalMathGradientImplementation()
   : NumericalMathGradientImplementation(),
     isInitialized_(false),
+    areFormulasInitialized_(false),
     isAnalytical_(true),
     inputVariables_(0),
     evaluation_(),
+    programs_(0),
     parsers_(0)
 {
   // Nothing to do
@@ -47,9 +50,11 @@ AnalyticalNumericalMathGradientImplementation::AnalyticalNumericalMathGradientIm
 AnalyticalNumericalMathGradientImplementation::AnalyticalNumericalMathGradientImplementation(const AnalyticalNumericalMathEvaluationImplementation & evaluation)
   : NumericalMathGradientImplementation(),
     isInitialized_(false),
+    areFormulasInitialized_(false),
     isAnalytical_(true),
     inputVariables_(0),
     evaluation_(evaluation),
+    programs_(0),
     parsers_(ParserCollection(0))
 {
   // Nothing to do
@@ -61,6 +66,7 @@ AnalyticalNumericalMathGradientImplementation * AnalyticalNumericalMathGradientI
 {
   AnalyticalNumericalMathGradientImplementation * result = new AnalyticalNumericalMathGradientImplementation(*this);
   result->isInitialized_ = false;
+  result->areFormulasInitialized_ = false;
   return result;
 }
 
@@ -91,7 +97,7 @@ String AnalyticalNumericalMathGradientImplementation::__str__(const String & off
   // Check that the symbolic differentiation has been done
   try
     {
-      initialize();
+      initializeFormulas();
       if (isAnalytical_)
         {
           // First, find the maximum length of the output variable names
@@ -118,7 +124,8 @@ String AnalyticalNumericalMathGradientImplementation::__str__(const String & off
     }
   catch(...)
     {
-      // Nothing to do
+      // The gradient is computed by automatic differentiation even without symbolic expression
+      if (isAnalytical_) oss << offset << "No symbolic gradient available, computed by automatic differentiation.";
     }
   if (!isAnalytical_) oss << offset << "No analytical gradient available. Try using finite difference instead.";
   return oss;
@@ -129,9 +136,23 @@ String AnalyticalNumericalMathGradientImplementation::__str__(const String & off
 void AnalyticalNumericalMathGradientImplementation::initialize() const
 {
   if (isInitialized_) return;
+  isAnalytical_ = false;
+  const UnsignedLong outputSize(evaluation_.outputVariablesNames_.getSize());
+  programs_ = AnalyticalProgramCollection(outputSize);
+  // Compile each formula for the automatic differentiation
+  for (UnsignedLong columnIndex = 0; columnIndex < outputSize; ++columnIndex) programs_[columnIndex] = AnalyticalProgram(evaluation_.formulas_[columnIndex], evaluation_.inputVariablesNames_);
+  // Everything is ok (no exception)
+  isAnalytical_ = true;
+  isInitialized_ = true;
+}
+
+/* The symbolic derivatives are only needed to print the formulas */
+void AnalyticalNumericalMathGradientImplementation::initializeFormulas() const
+{
+  if (areFormulasInitialized_) return;
+  initialize();
   try
     {
-      isAnalytical_ = false;
       const UnsignedLong inputSize(evaluation_.inputVariablesNames_.getSize());
       const UnsignedLong outputSize(evaluation_.outputVariablesNames_.getSize());
       const UnsignedLong gradientSize(inputSize * outputSize);
@@ -172,42 +193,20 @@ void AnalyticalNumericalMathGradientImplementation::initialize() const
     }
   catch(mu::Parser::exception_type & ex)
     {
-      // Here, we know that both isAnalytical_ and isInitialized_ are false
       throw InvalidArgumentException(HERE) << "Error constructing the gradient of an analytical function, message=" << ex.GetMsg() << " formula=" << ex.GetExpr() << " token=" << ex.GetToken() << " position=" << ex.GetPos();
     }
-  // Everything is ok (no exception)
-  isAnalytical_ = true;
-  isInitialized_ = true;
+  areFormulasInitialized_ = true;
 }
 
-/* Gradient */
+/* Gradient, computed by reverse mode automatic differentiation of the compiled formulas */
 Matrix AnalyticalNumericalMathGradientImplementation::gradient(const NumericalPoint & inP) const
 {
   const UnsignedLong inputDimension(getInputDimension());
   if (inP.getDimension() != inputDimension) throw InvalidArgumentException(HERE) << "Error: trying to evaluate a NumericalMathFunction with an argument of invalid dimension";
   if (!isInitialized_) initialize();
   if (!isAnalytical_) throw InternalException(HERE) << "The gradient does not have an analytical expression.";
-  for (UnsignedLong i = 0; i < inP.getDimension(); ++i) inputVariables_[i] = inP[i];
-  const UnsignedLong outputDimension(getOutputDimension());
-  Matrix out(inputDimension, outputDimension);
   ++callsNumber_;
-  try
-    {
-      UnsignedLong parserIndex(0);
-      for (UnsignedLong columnIndex = 0; columnIndex < outputDimension; ++columnIndex)
-        {
-          for (UnsignedLong rowIndex = 0; rowIndex < inputDimension; ++rowIndex)
-            {
-              out(rowIndex, columnIndex) = parsers_[parserIndex].Eval();
-              ++parserIndex;
-            }
-        }
-    }
-  catch(mu::Parser::exception_type & ex)
-    {
-      throw InternalException(HERE) << ex.GetMsg();
-    }
-  return out;
+  return AutomaticDifferentiation::Gradient(AnalyticalProgramFunction(programs_), inP, getOutputDimension());
 }
 
 /* Accessor for input point dimension */
@@ -228,7 +227,7 @@ String AnalyticalNumericalMathGradientImplementation::getFormula(const UnsignedL
 {
   const UnsignedLong inputDimension(getInputDimension());
   if ((i >= inputDimension) || (j >= getOutputDimension())) throw InvalidArgumentException(HERE) << "Error: cannot access to a formula outside of the gradient dimensions.";
-  if (!isInitialized_) initialize();
+  if (!areFormulasInitialized_) initializeFormulas();
   return parsers_[i + j * inputDimension].GetExpr();
 }
 
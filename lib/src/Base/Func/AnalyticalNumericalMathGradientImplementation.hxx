@@ -20,6 +20,7 @@
 
 #include "NumericalMathGradientImplementation.hxx"
 #include "AnalyticalNumericalMathEvaluationImplementation.hxx"
+#include "AnalyticalProgram.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -41,6 +42,7 @@ public:
   typedef AnalyticalNumericalMathEvaluationImplementation::Parser Parser;
   typedef Collection<Parser>          ParserCollection;
   typedef Collection<NumericalScalar> NumericalScalarCollection;
+  typedef Collection<AnalyticalProgram> AnalyticalProgramCollection;
 
   /** Default constructor */
   AnalyticalNumericalMathGradientImplementation();
@@ -92,11 +94,18 @@ private:
      reference associated with the variables may have change after the construction */
   void initialize() const;
 
+  /* The symbolic derivatives are only needed to print the formulas */
+  void initializeFormulas() const;
+
   mutable Bool isInitialized_;
+  mutable Bool areFormulasInitialized_;
   mutable Bool isAnalytical_;
   mutable NumericalScalarCollection inputVariables_;
   AnalyticalNumericalMathEvaluationImplementation evaluation_;
 
+  /** The formulas compiled for the automatic differentiation, one per output */
+  mutable AnalyticalProgramCollection programs_;
+
   /** A mathematical expression parser from the muParser library */
   mutable ParserCollection parsers_;
 
@@ -23,6 +23,7 @@
 #include "Log.hxx"
 #include "Exception.hxx"
 #include "Os.hxx"
+#include "AutomaticDifferentiation.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -37,9 +38,11 @@ static Factory<AnalyticalNumericalMathHessianImplementation> RegisteredFactory("
 AnalyticalNumericalMathHessianImplementation::AnalyticalNumericalMathHessianImplementation()
   : NumericalMathHessianImplementation(),
     isInitialized_(false),
+    areFormulasInitialized_(false),
     isAnalytical_(true),
     inputVariables_(0),
     evaluation_(),
+    programs_(0),
     parsers_(0)
 {
   // Nothing to do
@@ -49,9 +52,11 @@ AnalyticalNumericalMathHessianImplementation::AnalyticalNumericalMathHessianImpl
 AnalyticalNumericalMathHessianImplementation::AnalyticalNumericalMathHessianImplementation(const AnalyticalNumericalMathEvaluationImplementation & evaluation)
   : NumericalMathHessianImplementation(),
     isInitialized_(false),
+    areFormulasInitialized_(false),
     isAnalytical_(true),
     inputVariables_(0),
     evaluation_(evaluation),
+    programs_(0),
     parsers_(ParserCollection(0))
 {
   // Nothing to do
@@ -63,6 +68,7 @@ AnalyticalNumericalMathHessianImplementation * AnalyticalNumericalMathHessianImp
 {
   AnalyticalNumericalMathHessianImplementation * result = new AnalyticalNumericalMathHessianImplementation(*this);
   result->isInitialized_ = false;
+  result->areFormulasInitialized_ = false;
   return result;
 }
 
@@ -93,7 +99,7 @@ String AnalyticalNumericalMathHessianImplementation::__str__(const String & offs
   // Check that the symbolic differentiation has been done
   try
     {
-      initialize();
+      initializeFormulas();
       if (isAnalytical_)
         {
           // First, find the maximum length of the output variable names
@@ -129,7 +135,8 @@ String AnalyticalNumericalMathHessianImplementation::__str__(const String & offs
     }
   catch(...)
     {
-      // Nothing to do
+      // The hessian is computed by automatic differentiation even without symbolic expression
+      if (isAnalytical_) oss << offset << "No symbolic hessian available, computed by automatic differentiation.";
     }
   if (!isAnalytical_) oss << offset << "No analytical hessian available. Try using finite difference instead.";
   return oss;
@@ -140,9 +147,23 @@ String AnalyticalNumericalMathHessianImplementation::__str__(const String & offs
 void AnalyticalNumericalMathHessianImplementation::initialize() const
 {
   if (isInitialized_) return;
+  isAnalytical_ = false;
+  const UnsignedLong outputSize(evaluation_.outputVariablesNames_.getSize());
+  programs_ = AnalyticalProgramCollection(outputSize);
+  // Compile each formula for the automatic differentiation
+  for (UnsignedLong sheetIndex = 0; sheetIndex < outputSize; ++sheetIndex) programs_[sheetIndex] = AnalyticalProgram(evaluation_.formulas_[sheetIndex], evaluation_.inputVariablesNames_);
+  // Everything is ok (no exception)
+  isAnalytical_ = true;
+  isInitialized_ = true;
+}
+
+/* The symbolic derivatives are only needed to print the formulas */
+void AnalyticalNumericalMathHessianImplementation::initializeFormulas() const
+{
+  if (areFormulasInitialized_) return;
+  initialize();
   try
     {
-      isAnalytical_ = false;
       const UnsignedLong inputSize(evaluation_.inputVariablesNames_.getSize());
       const UnsignedLong outputSize(evaluation_.outputVariablesNames_.getSize());
       const UnsignedLong hessianSize(inputSize * (inputSize + 1) * outputSize / 2);
@@ -197,45 +218,20 @@ void AnalyticalNumericalMathHessianImplementation::initialize() const
     }
   catch(mu::Parser::exception_type & ex)
     {
-      // Here, we know that both isAnalytical_ and isInitialized_ are false
       throw InvalidArgumentException(HERE) << "Error constructing the hessian of an analytical function, message=" << ex.GetMsg() << " formula=" << ex.GetExpr() << " token=" << ex.GetToken() << " position=" << ex.GetPos();
     }
-  // Everything is ok (no exception)
-  isAnalytical_ = true;
-  isInitialized_ = true;
+  areFormulasInitialized_ = true;
 }
 
-/* Hessian */
+/* Hessian, computed by forward over reverse mode automatic differentiation of the compiled formulas */
 SymmetricTensor AnalyticalNumericalMathHessianImplementation::hessian(const NumericalPoint & inP) const
 {
   const UnsignedLong inputDimension(getInputDimension());
   if (inP.getDimension() != inputDimension) throw InvalidArgumentException(HERE) << "Error: trying to evaluate a NumericalMathFunction with an argument of invalid dimension";
   if (!isInitialized_) initialize();
   if (!isAnalytical_) throw InternalException(HERE) << "The hessian does not have an analytical expression.";
-  for (UnsignedLong i = 0; i < inP.getDimension(); ++i) inputVariables_[i] = inP[i];
-  const UnsignedLong outputDimension(getOutputDimension());
-  SymmetricTensor out(inputDimension, outputDimension);
   ++callsNumber_;
-  try
-    {
-      UnsignedLong parserIndex(0);
-      for (UnsignedLong sheetIndex = 0; sheetIndex < outputDimension; ++sheetIndex)
-        {
-          for (UnsignedLong rowIndex = 0; rowIndex < inputDimension; ++rowIndex)
-            {
-              for (UnsignedLong columnIndex = 0; columnIndex <= rowIndex; ++columnIndex)
-                {
-                  out(rowIndex, columnIndex, sheetIndex) = parsers_[parserIndex].Eval();
-                  ++parserIndex;
-                } // columnIndex
-            } // rowIndex
-        } // sheetIndex
-    }
-  catch(mu::Parser::exception_type & ex)
-    {
-      throw InternalException(HERE) << ex.GetMsg();
-    }
-  return out;
+  return AutomaticDifferentiation::Hessian(AnalyticalProgramFunction(programs_), inP, getOutputDimension());
 }
 
 /* Accessor to a specific formula */
@@ -245,7 +241,7 @@ String AnalyticalNumericalMathHessianImplementation::getFormula(const UnsignedLo
 {
   const UnsignedLong inputDimension(getInputDimension());
   if ((i >= inputDimension) || (j >= inputDimension) || (k >= getOutputDimension())) throw InvalidArgumentException(HERE) << "Error: cannot access to a formula outside of the hessian dimensions.";
-  if (!isInitialized_) initialize();
+  if (!areFormulasInitialized_) initializeFormulas();
   // Convert the 3D index into a linear index
   UnsignedLong rowIndex(i);
   UnsignedLong columnIndex(j);
@@ -0,0 +1,190 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  AnalyticalProgram.cxx
+ *  @brief Analytical formula compiled into a program evaluable with any scalar type
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#include "AnalyticalProgram.hxx"
+#include "expression.h"
+#include "parser.h"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/* Default constructor */
+AnalyticalProgram::AnalyticalProgram()
+  : instructions_(0)
+{
+  // Nothing to do
+}
+
+/* Map an Ev3 operator onto the operators of the program */
+static UnsignedLong ConvertOperator(const int ev3Operator)
+{
+  switch (ev3Operator)
+    {
+    case Ev3::SUM:
+      return AnalyticalProgram::SUM;
+    case Ev3::DIFFERENCE:
+      return AnalyticalProgram::DIFFERENCE;
+    case Ev3::PRODUCT:
+      return AnalyticalProgram::PRODUCT;
+    case Ev3::FRACTION:
+      return AnalyticalProgram::FRACTION;
+    case Ev3::POWER:
+      return AnalyticalProgram::POWER;
+    case Ev3::MINUS:
+      return AnalyticalProgram::MINUS;
+    case Ev3::SIN:
+      return AnalyticalProgram::SIN;
+    case Ev3::COS:
+      return AnalyticalProgram::COS;
+    case Ev3::TAN:
+      return AnalyticalProgram::TAN;
+    case Ev3::ASIN:
+      return AnalyticalProgram::ASIN;
+    case Ev3::ACOS:
+      return AnalyticalProgram::ACOS;
+    case Ev3::ATAN:
+      return AnalyticalProgram::ATAN;
+    case Ev3::SINH:
+      return AnalyticalProgram::SINH;
+    case Ev3::COSH:
+      return AnalyticalProgram::COSH;
+    case Ev3::TANH:
+      return AnalyticalProgram::TANH;
+    case Ev3::ASINH:
+      return AnalyticalProgram::ASINH;
+    case Ev3::ACOSH:
+      return AnalyticalProgram::ACOSH;
+    case Ev3::ATANH:
+      return AnalyticalProgram::ATANH;
+    case Ev3::LOG2:
+      return AnalyticalProgram::LOG2;
+    case Ev3::LOG10:
+      return AnalyticalProgram::LOG10;
+    case Ev3::LOG:
+    case Ev3::LN:
+      return AnalyticalProgram::LOG;
+    case Ev3::LNGAMMA:
+      return AnalyticalProgram::LNGAMMA;
+    case Ev3::GAMMA:
+      return AnalyticalProgram::GAMMA;
+    case Ev3::EXP:
+      return AnalyticalProgram::EXP;
+    case Ev3::ERF:
+      return AnalyticalProgram::ERF;
+    case Ev3::ERFC:
+      return AnalyticalProgram::ERFC;
+    case Ev3::SQRT:
+      return AnalyticalProgram::SQRT;
+    case Ev3::CBRT:
+      return AnalyticalProgram::CBRT;
+    case Ev3::BESSELJ0:
+      return AnalyticalProgram::BESSELJ0;
+    case Ev3::BESSELJ1:
+      return AnalyticalProgram::BESSELJ1;
+    case Ev3::BESSELY0:
+      return AnalyticalProgram::BESSELY0;
+    case Ev3::BESSELY1:
+      return AnalyticalProgram::BESSELY1;
+    case Ev3::SIGN:
+      return AnalyticalProgram::SIGN;
+    case Ev3::RINT:
+      return AnalyticalProgram::RINT;
+    case Ev3::ABS:
+      return AnalyticalProgram::ABS;
+    case Ev3::COT:
+      return AnalyticalProgram::COT;
+    case Ev3::COTH:
+      return AnalyticalProgram::COTH;
+    default:
+      throw InvalidArgumentException(HERE) << "Error: the Ev3 operator " << ev3Operator << " is not supported by the analytical programs";
+    }
+}
+
+/* Flatten an Ev3 expression tree into a postfix sequence of instructions */
+template <class Instruction>
+static void Compile(const Ev3::Expression & expression,
+                    Collection<Instruction> & instructions)
+{
+  Instruction instruction;
+  instruction.size_ = 0;
+  instruction.index_ = 0;
+  instruction.value_ = 0.0;
+  instruction.coefficient_ = expression->GetCoeff();
+  const int ev3Operator(expression->GetOpType());
+  if (ev3Operator == Ev3::CONST)
+    {
+      instruction.operator_ = AnalyticalProgram::CONSTANT;
+      // The value of a constant already includes its coefficient
+      instruction.value_ = expression->GetValue();
+      instruction.coefficient_ = 1.0;
+    }
+  else if (ev3Operator == Ev3::VAR)
+    {
+      instruction.operator_ = AnalyticalProgram::VARIABLE;
+      instruction.index_ = expression->GetVarIndex();
+      instruction.value_ = expression->GetExponent();
+    }
+  else
+    {
+      const UnsignedLong size(expression->GetSize());
+      if (size == 0) throw InvalidArgumentException(HERE) << "Error: the operator " << ev3Operator << " has no argument in " << expression->ToString();
+      instruction.operator_ = ConvertOperator(ev3Operator);
+      instruction.size_ = size;
+      if ((instruction.operator_ == AnalyticalProgram::POWER) && (size != 2)) throw InvalidArgumentException(HERE) << "Error: a power must have two arguments in " << expression->ToString();
+      // Powers with a constant exponent are differentiated with respect to their base only
+      if ((instruction.operator_ == AnalyticalProgram::POWER) && (expression->GetNode(1)->GetOpType() == Ev3::CONST))
+        {
+          instruction.operator_ = AnalyticalProgram::CONSTANTPOWER;
+          instruction.size_ = 1;
+          instruction.value_ = expression->GetNode(1)->GetValue();
+          Compile(expression->GetNode(0), instructions);
+        }
+      else for (UnsignedLong i = 0; i < size; ++i) Compile(expression->GetNode(i), instructions);
+      if ((instruction.size_ != 1) && (instruction.operator_ > AnalyticalProgram::CONSTANTPOWER)) throw InvalidArgumentException(HERE) << "Error: the operator " << ev3Operator << " must have one argument in " << expression->ToString();
+    }
+  instructions.add(instruction);
+}
+
+/* Parameters constructor */
+AnalyticalProgram::AnalyticalProgram(const String & formula,
+                                     const Description & inputVariablesNames)
+  : instructions_(0)
+{
+  int nerr(0);
+  Ev3::ExpressionParser ev3Parser;
+  // Initialize the variable indices in order to match the order of OpenTURNS in Ev3
+  for (UnsignedLong inputVariableIndex = 0; inputVariableIndex < inputVariablesNames.getSize(); ++inputVariableIndex) ev3Parser.SetVariableID(inputVariablesNames[inputVariableIndex], inputVariableIndex);
+  Ev3::Expression ev3Expression(ev3Parser.Parse(formula.c_str(), nerr));
+  if (nerr != 0) throw InvalidArgumentException(HERE) << "Error: cannot parse " << formula << " with Ev3.";
+  Compile(ev3Expression, instructions_);
+  // Ev3 does not know all the names understood by muParser
+  for (UnsignedLong i = 0; i < instructions_.getSize(); ++i)
+    if ((instructions_[i].operator_ == VARIABLE) && (instructions_[i].index_ >= inputVariablesNames.getSize())) throw InvalidArgumentException(HERE) << "Error: unknown variable in " << formula;
+}
+
+/* Number of elementary operations */
+UnsignedLong AnalyticalProgram::getSize() const
+{
+  return instructions_.getSize();
+}
+
+END_NAMESPACE_OPENTURNS
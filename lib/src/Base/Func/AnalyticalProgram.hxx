@@ -0,0 +1,269 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  AnalyticalProgram.hxx
+ *  @brief Analytical formula compiled into a program evaluable with any scalar type
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_ANALYTICALPROGRAM_HXX
+#define OPENTURNS_ANALYTICALPROGRAM_HXX
+
+#include "OTprivate.hxx"
+#include "Collection.hxx"
+#include "Description.hxx"
+#include "Exception.hxx"
+#include "DualNumber.hxx"
+#include "ReverseTape.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/**
+ * @class AnalyticalProgram
+ *
+ * An analytical formula parsed by Ev3 and flattened into a postfix sequence of
+ * elementary operations. The program can be evaluated with plain scalars, dual
+ * numbers or reverse variables, which gives the derivatives of the formula by
+ * automatic differentiation instead of symbolic differentiation.
+ */
+class AnalyticalProgram
+{
+public:
+
+  enum OperatorType { CONSTANT = 0, VARIABLE, SUM, DIFFERENCE, PRODUCT, FRACTION, POWER, CONSTANTPOWER,
+                      MINUS, SIN, COS, TAN, ASIN, ACOS, ATAN, SINH, COSH, TANH, ASINH, ACOSH, ATANH,
+                      LOG2, LOG10, LOG, LNGAMMA, GAMMA, EXP, ERF, ERFC, SQRT, CBRT,
+                      BESSELJ0, BESSELJ1, BESSELY0, BESSELY1, SIGN, RINT, ABS, COT, COTH
+                    };
+
+  /** Default constructor */
+  AnalyticalProgram();
+
+  /** Parameters constructor */
+  AnalyticalProgram(const String & formula,
+                    const Description & inputVariablesNames);
+
+  /** Number of elementary operations */
+  UnsignedLong getSize() const;
+
+  /** Evaluation with any scalar type */
+  template <class S>
+  S evaluate(const Collection<S> & x) const
+  {
+    const UnsignedLong size(instructions_.getSize());
+    Collection<S> stack(size);
+    UnsignedLong top(0);
+    for (UnsignedLong i = 0; i < size; ++i)
+      {
+        const Instruction & instruction(instructions_[i]);
+        S value;
+        switch (instruction.operator_)
+          {
+          case CONSTANT:
+            value = S(instruction.value_);
+            break;
+          case VARIABLE:
+            value = x[instruction.index_];
+            if (instruction.value_ != 1.0) value = pow(value, instruction.value_);
+            break;
+          case SUM:
+            top -= instruction.size_;
+            value = stack[top];
+            for (UnsignedLong k = 1; k < instruction.size_; ++k) value += stack[top + k];
+            break;
+          case DIFFERENCE:
+            top -= instruction.size_;
+            value = stack[top];
+            for (UnsignedLong k = 1; k < instruction.size_; ++k) value -= stack[top + k];
+            break;
+          case PRODUCT:
+            top -= instruction.size_;
+            value = stack[top];
+            for (UnsignedLong k = 1; k < instruction.size_; ++k) value *= stack[top + k];
+            break;
+          case FRACTION:
+            top -= instruction.size_;
+            value = stack[top];
+            for (UnsignedLong k = 1; k < instruction.size_; ++k) value /= stack[top + k];
+            break;
+          case POWER:
+            top -= 2;
+            value = pow(stack[top], stack[top + 1]);
+            break;
+          case CONSTANTPOWER:
+            --top;
+            value = pow(stack[top], instruction.value_);
+            break;
+          default:
+            // All the remaining operators are unary
+            value = evaluateUnary(instruction.operator_, stack[--top]);
+          }
+        if (instruction.coefficient_ != 1.0) value *= S(instruction.coefficient_);
+        stack[top] = value;
+        ++top;
+      }
+    return stack[0];
+  }
+
+private:
+
+  struct Instruction
+  {
+    UnsignedLong operator_;
+    UnsignedLong size_;
+    UnsignedLong index_;
+    NumericalScalar value_;
+    NumericalScalar coefficient_;
+  };
+
+  /** Value of the elementary unary operators */
+  template <class S>
+  static S evaluateUnary(const UnsignedLong op,
+                         const S & x)
+  {
+    switch (op)
+      {
+      case MINUS:
+        return -x;
+      case SIN:
+        return sin(x);
+      case COS:
+        return cos(x);
+      case TAN:
+        return tan(x);
+      case ASIN:
+        return asin(x);
+      case ACOS:
+        return acos(x);
+      case ATAN:
+        return atan(x);
+      case SINH:
+        return sinh(x);
+      case COSH:
+        return cosh(x);
+      case TANH:
+        return tanh(x);
+      case ASINH:
+        return asinh(x);
+      case ACOSH:
+        return acosh(x);
+      case ATANH:
+        return atanh(x);
+      case LOG2:
+        return log(x) / S(M_LN2);
+      case LOG10:
+        return log(x) / S(M_LN10);
+      case LOG:
+        return log(x);
+      case LNGAMMA:
+        return lgamma(x);
+      case GAMMA:
+        return tgamma(x);
+      case EXP:
+        return exp(x);
+      case ERF:
+        return erf(x);
+      case ERFC:
+        return erfc(x);
+      case SQRT:
+        return sqrt(x);
+      case CBRT:
+        return cbrt(x);
+      case BESSELJ0:
+        return j0(x);
+      case BESSELJ1:
+        return j1(x);
+      case BESSELY0:
+        return y0(x);
+      case BESSELY1:
+        return y1(x);
+      case SIGN:
+        // Piecewise constant functions have a null derivative
+        return S(x < S(0.0) ? -1.0 : (x > S(0.0) ? 1.0 : 0.0));
+      case RINT:
+        return S(rint(GetScalar(x)));
+      case ABS:
+        return fabs(x);
+      case COT:
+        return S(1.0) / tan(x);
+      case COTH:
+        return S(1.0) / tanh(x);
+      }
+    throw InternalException(HERE) << "Error: unknown operator in an analytical program";
+  }
+
+  /** Underlying scalar value of any scalar type */
+  static NumericalScalar GetScalar(const NumericalScalar x)
+  {
+    return x;
+  }
+
+  template <class T>
+  static NumericalScalar GetScalar(const DualNumber<T> & x)
+  {
+    return GetScalar(x.getValue());
+  }
+
+  template <class T>
+  static NumericalScalar GetScalar(const ReverseVariable<T> & x)
+  {
+    return GetScalar(x.getValue());
+  }
+
+  /** The postfix sequence of operations */
+  Collection<Instruction> instructions_;
+
+}; /* class AnalyticalProgram */
+
+
+/**
+ * @class AnalyticalProgramFunction
+ *
+ * A collection of analytical programs seen as a templated function, one
+ * program per output, see AutomaticDifferentiation.
+ */
+class AnalyticalProgramFunction
+{
+public:
+
+  /** Parameters constructor */
+  AnalyticalProgramFunction(const Collection<AnalyticalProgram> & programs)
+    : programs_(programs)
+  {
+    // Nothing to do
+  }
+
+  /** Evaluation with any scalar type */
+  template <class S>
+  Collection<S> operator() (const Collection<S> & x) const
+  {
+    const UnsignedLong size(programs_.getSize());
+    Collection<S> result(size);
+    for (UnsignedLong i = 0; i < size; ++i) result[i] = programs_[i].evaluate(x);
+    return result;
+  }
+
+private:
+
+  const Collection<AnalyticalProgram> & programs_;
+
+}; /* class AnalyticalProgramFunction */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_ANALYTICALPROGRAM_HXX */
@@ -22,6 +22,8 @@
 #include "Log.hxx"
 #include "WrapperData.hxx"
 #include "WrapperObject.hxx"
+#include "MutexLock.hxx"
+#include "Indices.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -41,6 +43,7 @@ ComputedNumericalMathEvaluationImplementation::ComputedNumericalMathEvaluationIm
     p_function_(0),
     p_state_(0)
 {
+  pthread_mutex_init(&bookkeepingMutex_, NULL);
   setName(name);
   const WrapperData data = file.getWrapperData();
   if (! data.isValid()) throw WrapperInternalException(HERE) << "The wrapper data are not valid";
@@ -70,6 +73,7 @@ ComputedNumericalMathEvaluationImplementation::ComputedNumericalMathEvaluationIm
     p_function_(other.p_function_),
     p_state_(0)
 {
+  pthread_mutex_init(&bookkeepingMutex_, NULL);
   if (p_function_.isNull()) throw WrapperInternalException(HERE) << "Unable to allocate wrapper";
 
   // Initialize the state into the wrapper
@@ -77,6 +81,16 @@ ComputedNumericalMathEvaluationImplementation::ComputedNumericalMathEvaluationIm
 }
 
 
+/* Default constructor, for save/load mechanism */
+ComputedNumericalMathEvaluationImplementation::ComputedNumericalMathEvaluationImplementation()
+  : NumericalMathEvaluationImplementation(),
+    p_function_(0),
+    p_state_(0)
+{
+  pthread_mutex_init(&bookkeepingMutex_, NULL);
+}
+
+
 /* Virtual constructor */
 ComputedNumericalMathEvaluationImplementation * ComputedNumericalMathEvaluationImplementation::clone() const
 {
@@ -91,6 +105,7 @@ ComputedNumericalMathEvaluationImplementation::~ComputedNumericalMathEvaluationI
 
   // Delete the state into the wrapper
   p_function_->deleteState( p_state_ );
+  pthread_mutex_destroy(&bookkeepingMutex_);
 }
 
 
@@ -141,30 +156,26 @@ ComputedNumericalMathEvaluationImplementation::operator() (const NumericalPoint
   NumericalPoint result;
   try
     {
-      // First, initialize the external code on first invocation
-      if (callsNumber_ == 0) p_function_->initialize( p_state_ );
-      // Specific code if cache is enabled
-      if (p_cache_->isEnabled())
-        {
-          CacheKeyType inKey = inP.getCollection();
-          // Execute the wrapper
-          if ( p_cache_->hasKey( inKey ) )
-            {
-              result = NumericalPoint::ImplementationType( p_cache_->find( inKey ) );
-            }
-          else
-            {
-              ++callsNumber_;
-              result = p_function_->execute( p_state_, inP );
-              CacheValueType outValue(result.getCollection());
-              p_cache_->add( inKey, outValue );
-            }
-        } // If cache is enabled
-      else
+      const CacheKeyType inKey(inP.getCollection());
+      Bool isCached(false);
+      {
+        // The bookkeeping is shared by all the threads calling the evaluation
+        MutexLock lock(bookkeepingMutex_);
+        // First, initialize the external code on first invocation
+        if (callsNumber_ == 0) p_function_->initialize( p_state_ );
+        // Specific code if cache is enabled
+        isCached = p_cache_->isEnabled() && p_cache_->hasKey( inKey );
+        if (isCached) result = NumericalPoint::ImplementationType( p_cache_->find( inKey ) );
+        else ++callsNumber_;
+      }
+      // Execute the wrapper out of the lock, so several threads can run the external code at once
+      if (!isCached) result = p_function_->execute( p_state_, inP );
+      MutexLock lock(bookkeepingMutex_);
+      if (!isCached && p_cache_->isEnabled())
         {
-          ++callsNumber_;
-          result = p_function_->execute( p_state_, inP );
-        } // Cache disabled
+          CacheValueType outValue(result.getCollection());
+          p_cache_->add( inKey, outValue );
+        }
       if (isHistoryEnabled_)
         {
           inputStrategy_.store(inP);
@@ -191,65 +202,65 @@ ComputedNumericalMathEvaluationImplementation::operator() (const NumericalSample
       const UnsignedLong size(inS.getSize());
       // The sample out will store all the results as if there was no specific action for multiple input points or already computed values
       NumericalSample result( size, getOutputDimension() );
-      // First, initialize the external code on first invocation
-      if (callsNumber_ == 0) p_function_->initialize( p_state_ );
-      // If the cache is enabled, it means that each evaluation is costly, so avoid any evaluation as much as possible
-      if (p_cache_->isEnabled())
+      // The positions of the points that have not been computed yet and their distinct values
+      Indices newIndices(0);
+      NumericalSample values( 0, inS.getDimension() );
+      Bool isCacheEnabled(false);
+      {
+        // The bookkeeping is shared by all the threads calling the evaluation
+        MutexLock lock(bookkeepingMutex_);
+        // First, initialize the external code on first invocation
+        if (callsNumber_ == 0) p_function_->initialize( p_state_ );
+        isCacheEnabled = p_cache_->isEnabled();
+        // If the cache is enabled, it means that each evaluation is costly, so avoid any evaluation as much as possible
+        if (isCacheEnabled)
+          {
+            // First, read all the points that have already been computed. They are read now because they
+            // may be flushed by the time the new points are computed
+            std::set<NumericalPoint> sortedValues;
+            for(UnsignedLong i = 0; i < size; ++i)
+              {
+                const CacheKeyType inKey(inS[i].getCollection());
+                if ( p_cache_->hasKey( inKey ) ) result[i] = NumericalPoint::ImplementationType( p_cache_->find( inKey ) );
+                else
+                  {
+                    newIndices.add( i );
+                    sortedValues.insert( inS[i] );
+                  }
+              }
+            for(std::set<NumericalPoint>::const_iterator it = sortedValues.begin(); it != sortedValues.end(); ++it) values.add( *it );
+            callsNumber_ += newIndices.getSize();
+          } // If the cache is enabled
+        else callsNumber_ += size;
+      }
+      // Execute the wrapper out of the lock, so several threads can run the external code at once
+      if (isCacheEnabled)
         {
-          // First, remove all the points that have already been computed
-          // We build a new sample without the already computed points
-          NumericalSample newIn( 0, inS.getDimension() );
-          for(UnsignedLong i = 0; i < size; ++i) if ( ! p_cache_->hasKey( inS[i].getCollection() ) ) newIn.add( inS[i] );
-          const UnsignedLong newSize(newIn.getSize());
-          // Execute the wrapper if needed
           NumericalSample newOut( 0, getOutputDimension() );
-          NumericalSample values( 0, inS.getDimension() );
-
           // If there is still something to do
-          if (newSize > 0)
-            {
-              std::set<NumericalPoint> sortedValues;
-              for(UnsignedLong i = 0; i < newSize; ++i) sortedValues.insert( newIn[i] );
-              for(std::set<NumericalPoint>::const_iterator it = sortedValues.begin(); it != sortedValues.end(); ++it) values.add( *it );
-
-              callsNumber_ += newSize;
-              newOut = p_function_->execute( p_state_, values );
-            } // If there is something to do
+          if (values.getSize() > 0) newOut = p_function_->execute( p_state_, values );
 
           // We use a secondary cache to hold the computed values
           CacheType tempCache( values.getSize() );
           tempCache.enable();
           for(UnsignedLong i = 0; i < values.getSize(); ++i) tempCache.add( values[i].getCollection(), newOut[i].getCollection() );
 
-          // We gather the computed values into a new output sample
-          for(UnsignedLong i = 0; i < size; ++i)
+          // We gather the computed values into the output sample
+          for(UnsignedLong i = 0; i < newIndices.getSize(); ++i)
             {
-              // The output values were either in the cache before the call to the evaluation operator
-              if ( p_cache_->hasKey( inS[i].getCollection() ) )
-                {
-                  result[i] = NumericalPoint::ImplementationType( p_cache_->find( inS[i].getCollection() ) );
-                }
-              // or they are in the new temporary cache that store the unique points that have been evaluated
-              else if ( tempCache.hasKey( inS[i].getCollection() ) )
-                {
-                  result[i] = NumericalPoint::ImplementationType( tempCache.find( inS[i].getCollection() ) );
-                }
-              // or something strange occured
-              else throw InternalException(HERE) << "Error in computing sample. Some values can not be retrieved from cache.";
-            } // Loop over the output sample
+              const UnsignedLong index(newIndices[i]);
+              result[index] = NumericalPoint::ImplementationType( tempCache.find( inS[index].getCollection() ) );
+            }
           // We add the computed values into the cache AFTER having read the cache because
           // older values may be flushed
-          //for(UnsignedLong i=0; i<newIn.getSize(); ++i) p_cache_->add( newIn[i], newOut[i] );
+          MutexLock lock(bookkeepingMutex_);
           p_cache_->merge( tempCache );
         } // If the cache is enabled
-      else
-        {
-          callsNumber_ += size;
-          result = p_function_->execute( p_state_, inS );
-        }
+      else result = p_function_->execute( p_state_, inS );
       // Store the computations in the history if asked for
       if (isHistoryEnabled_)
         {
+          MutexLock lock(bookkeepingMutex_);
           inputStrategy_.store(inS);
           outputStrategy_.store(result);
         }
@@ -267,7 +278,11 @@ ComputedNumericalMathEvaluationImplementation::operator() (const NumericalSample
     }
 }
 
-
+/* Tell if the evaluation can be called concurrently on the same instance */
+Bool ComputedNumericalMathEvaluationImplementation::isReentrant() const
+{
+  return true;
+}
 
 /* Accessor for input point dimension */
 UnsignedLong ComputedNumericalMathEvaluationImplementation::getInputDimension() const
@@ -29,6 +29,7 @@
 #include "Pointer.hxx"
 #include "NumericalPoint.hxx"
 #include "WrapperFile.hxx"
+#include "OTthread.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -87,6 +88,9 @@ public:
   virtual NumericalPoint operator() (const NumericalPoint & inP) const;
   virtual NumericalSample operator() (const NumericalSample & inS) const;
 
+  /** Tell if the evaluation can be called concurrently on the same instance */
+  virtual Bool isReentrant() const;
+
   /** Accessor for input point dimension */
   virtual UnsignedLong getInputDimension() const;
 
@@ -113,12 +117,15 @@ protected:
 
 private:
 
-  ComputedNumericalMathEvaluationImplementation() {};
+  ComputedNumericalMathEvaluationImplementation();
   friend class Factory<ComputedNumericalMathEvaluationImplementation>;
 
   /** A pointer to an internal structure that saves the state of the function into the wrapper */
   void * p_state_;
 
+  /** Protects the calls number, the cache and the history, the external code being executed out of it */
+  mutable pthread_mutex_t bookkeepingMutex_;
+
 }; /* class ComputedNumericalMathEvaluationImplementation */
 
 
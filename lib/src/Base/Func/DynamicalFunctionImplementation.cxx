@@ -127,7 +127,7 @@ ProcessSample DynamicalFunctionImplementation::operator() (const ProcessSample &
   // Simple loop over the evaluation operator based on time series
   // The calls number is updated by these calls
   for (UnsignedLong i = 0; i < size; ++i)
-    outSample[i] = operator()(inPS[i]);
+    outSample.setTimeSeries(i, operator()(inPS[i]));
   return outSample;
 }
 
@@ -143,6 +143,13 @@ Bool NumericalMathEvaluationImplementation::isActualImplementation() const
   return true;
 }
 
+/* Tell if the evaluation can be called concurrently on the same instance. The bookkeeping
+   of the evaluations (calls number, cache, history) is not protected by default */
+Bool NumericalMathEvaluationImplementation::isReentrant() const
+{
+  return false;
+}
+
 /* Here is the interface that all derived class must implement */
 
 /* Operator () */
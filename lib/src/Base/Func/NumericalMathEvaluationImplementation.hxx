@@ -148,6 +148,9 @@ public:
   /** Test for actual implementation */
   virtual Bool isActualImplementation() const;
 
+  /** Tell if the evaluation can be called concurrently on the same instance */
+  virtual Bool isReentrant() const;
+
   /** Operator () */
   virtual NumericalPoint operator() (const NumericalPoint & inP) const;
 
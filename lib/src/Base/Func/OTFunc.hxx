@@ -30,6 +30,7 @@
 #include "AnalyticalNumericalMathEvaluationImplementation.hxx"
 #include "AnalyticalNumericalMathGradientImplementation.hxx"
 #include "AnalyticalNumericalMathHessianImplementation.hxx"
+#include "AnalyticalProgram.hxx"
 #include "Basis.hxx"
 #include "BasisSequence.hxx"
 #include "BasisSequenceImplementation.hxx"
@@ -84,6 +85,7 @@
 #include "RestrictedGradientImplementation.hxx"
 #include "RestrictedHessianImplementation.hxx"
 #include "SpatialFunction.hxx"
+#include "TemplatedNumericalMathEvaluationImplementation.hxx"
 #include "TemporalFunction.hxx"
 #include "UniVariatePolynomial.hxx"
 #include "UniVariatePolynomialImplementation.hxx"
@@ -29,9 +29,14 @@
 # include <cstdlib>
 
 # include "Dcdflib.hxx"
+# include "MutexLock.hxx"
 
 namespace DCDFLIB
 {
+  // The scratch variables of the routines are automatic so that they can run
+  // concurrently, except the state of the reverse-communication zero bounder
+  // and finder (E0000 and E0001) shared by the cdf* routines, which take this mutex
+  static pthread_mutex_t DCDFLIB_SearchMutex_ = PTHREAD_MUTEX_INITIALIZER;
 
   //****************************************************************************
 
@@ -57,28 +62,28 @@ namespace DCDFLIB
   //    Output, double ALGDIV, the value of ln(Gamma(B)/Gamma(A+B)).
   //
   {
-    static double algdiv;
-    static double c;
+    double algdiv;
+    double c;
     static double c0 =  0.833333333333333e-01;
     static double c1 = -0.277777777760991e-02;
     static double c2 =  0.793650666825390e-03;
     static double c3 = -0.595202931351870e-03;
     static double c4 =  0.837308034031215e-03;
     static double c5 = -0.165322962780713e-02;
-    static double d;
-    static double h;
-    static double s11;
-    static double s3;
-    static double s5;
-    static double s7;
-    static double s9;
-    static double t;
-    static double T1;
-    static double u;
-    static double v;
-    static double w;
-    static double x;
-    static double x2;
+    double d;
+    double h;
+    double s11;
+    double s3;
+    double s5;
+    double s7;
+    double s9;
+    double t;
+    double T1;
+    double u;
+    double v;
+    double w;
+    double x;
+    double x2;
 
     if ( *b <= *a )
       {
@@ -218,7 +223,7 @@ namespace DCDFLIB
   //
   {
     static double g = 0.577215664901533e0;
-    static double apser, aj, bx, c, j, s, t, tol;
+    double apser, aj, bx, c, j, s, t, tol;
 
     bx = *b**x;
     t = *x - bx;
@@ -276,7 +281,7 @@ namespace DCDFLIB
     static double c3 = -0.595202931351870e-03;
     static double c4 =  0.837308034031215e-03;
     static double c5 = -0.165322962780713e-02;
-    static double bcorr, a, b, c, h, s11, s3, s5, s7, s9, t, w, x, x2;
+    double bcorr, a, b, c, h, s11, s3, s5, s7, s9, t, w, x, x2;
 
     a = fifdmin1 ( *a0, *b0 );
     b = fifdmax1 ( *a0, *b0 );
@@ -375,11 +380,11 @@ namespace DCDFLIB
     //     E1 = 2**(-3/2)
     //
     static int K3 = 1;
-    static double value;
-    static double bsum, dsum, f, h, h2, hn, j0, j1, r, r0, r1, s, sum, t, t0, t1, u, w, w0, z, z0,
+    double value;
+    double bsum, dsum, f, h, h2, hn, j0, j1, r, r0, r1, s, sum, t, t0, t1, u, w, w0, z, z0,
       z2, zn, znm1;
-    static int i, im1, imj, j, m, mm1, mmj, n, np1;
-    static double a0[21], b0[21], c[21], d[21], T1, T2;
+    int i, im1, imj, j, m, mm1, mmj, n, np1;
+    double a0[21], b0[21], c[21], d[21], T1, T2;
 
     value = 0.0e0;
     if(*a >= *b) goto S10;
@@ -490,7 +495,7 @@ namespace DCDFLIB
   //    fraction approximation for IX(A,B).
   //
   {
-    static double bfrac, alpha, an, anp1, beta, bn, bnp1, c, c0, c1, e, n, p, r, r0, s, t, w, yp1;
+    double bfrac, alpha, an, anp1, beta, bn, bnp1, c, c0, c1, e, n, p, r, r0, s, t, w, yp1;
 
     bfrac = beta_rcomp ( a, b, x, y );
 
@@ -583,9 +588,9 @@ namespace DCDFLIB
   //    was detected.
   //
   {
-    static double bm1, bp2n, cn, coef, dj, j, l, lnx, n2, nu, p, q, r, s, sum, t, t2, u, v, z;
-    static int i, n, nm1;
-    static double c[30], d[30], T1;
+    double bm1, bp2n, cn, coef, dj, j, l, lnx, n2, nu, p, q, r, s, sum, t, t2, u, v, z;
+    int i, n, nm1;
+    double c[30], d[30], T1;
 
     bm1 = *b - 0.5e0 - 0.5e0;
     nu = *a + 0.5e0 * bm1;
@@ -693,9 +698,9 @@ namespace DCDFLIB
   //
   {
     static int K1 = 1;
-    static double a0, b0, eps, lambda, t, x0, y0, z;
-    static int ierr1, ind, n;
-    static double T2, T3, T4, T5;
+    double a0, b0, eps, lambda, t, x0, y0, z;
+    int ierr1, ind, n;
+    double T2, T3, T4, T5;
     //
     //  EPS IS A MACHINE DEPENDENT CONSTANT. EPS IS THE SMALLEST
     //  NUMBER FOR WHICH 1.0 + EPS .GT. 1.0
@@ -1051,9 +1056,9 @@ namespace DCDFLIB
   //
   {
     static double e = .918938533204673e0;
-    static double value, a, b, c, h, u, v, w, z;
-    static int i, n;
-    static double T1;
+    double value, a, b, c, h, u, v, w, z;
+    int i, n;
+    double T1;
 
     a = fifdmin1(*a0, *b0);
     b = fifdmax1(*a0, *b0);
@@ -1167,8 +1172,8 @@ namespace DCDFLIB
   //    Output, double BETA_PSER, the approximate value of IX(A,B)(X).
   //
   {
-    static double bpser, a0, apb, b0, c, n, sum, t, tol, u, w, z;
-    static int i, m;
+    double bpser, a0, apb, b0, c, n, sum, t, tol, u, w, z;
+    int i, m;
 
     bpser = 0.0e0;
     if(*x == 0.0e0) return bpser;
@@ -1272,12 +1277,12 @@ namespace DCDFLIB
   //
   {
     static double Const = .398942280401433e0;
-    static double brcomp, a0, apb, b0, c, e, h, lambda, lnx, lny, t, u, v, x0, y0, z;
-    static int i, n;
+    double brcomp, a0, apb, b0, c, e, h, lambda, lnx, lny, t, u, v, x0, y0, z;
+    int i, n;
     //
     //  CONST = 1/SQRT(2*PI)
     //
-    static double T1, T2;
+    double T1, T2;
 
     brcomp = 0.0e0;
     if(*x == 0.0e0 || *y == 0.0e0) return brcomp;
@@ -1418,12 +1423,12 @@ namespace DCDFLIB
   //
   {
     static double Const = .398942280401433e0;
-    static double brcmp1, a0, apb, b0, c, e, h, lambda, lnx, lny, t, u, v, x0, y0, z;
-    static int i, n;
+    double brcmp1, a0, apb, b0, c, e, h, lambda, lnx, lny, t, u, v, x0, y0, z;
+    int i, n;
     //
     //     CONST = 1/SQRT(2*PI)
     //
-    static double T1, T2, T3, T4;
+    double T1, T2, T3, T4;
 
     a0 = fifdmin1(*a, *b);
     if(a0 >= 8.0e0) goto S130;
@@ -1566,8 +1571,8 @@ namespace DCDFLIB
   {
     static int K1 = 1;
     static int K2 = 0;
-    static double bup, ap1, apb, d, l, r, t, w;
-    static int i, k, kp1, mu, nm1;
+    double bup, ap1, apb, d, l, r, t, w;
+    int i, k, kp1, mu, nm1;
     //
     //  OBTAIN THE SCALING FACTOR EXP(-MU) AND
     //  EXP(MU)*(X**A*Y**B/BETA(A,B))/A
@@ -1822,6 +1827,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tol (1.0e-8)
 # define atol (1.0e-50)
 # define zero (1.0e-300)
@@ -1833,9 +1840,9 @@ namespace DCDFLIB
     static double K3 = 1.0e0;
     static double K8 = 0.5e0;
     static double K9 = 5.0e0;
-    static double fx, xhi, xlo, cum, ccum, xy, pq;
-    static unsigned long qhi, qleft, qporq;
-    static double T4, T5, T6, T7, T10, T11, T12, T13, T14, T15;
+    double fx, xhi, xlo, cum, ccum, xy, pq;
+    unsigned long qhi, qleft, qporq;
+    double T4, T5, T6, T7, T10, T11, T12, T13, T14, T15;
     //
     //     Check arguments
     //
@@ -2184,6 +2191,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define atol (1.0e-50)
 # define tol (1.0e-8)
 # define zero (1.0e-300)
@@ -2195,9 +2204,9 @@ namespace DCDFLIB
     static double K3 = 0.5e0;
     static double K4 = 5.0e0;
     static double K11 = 1.0e0;
-    static double fx, xhi, xlo, cum, ccum, pq, prompr;
-    static unsigned long qhi, qleft, qporq;
-    static double T5, T6, T7, T8, T9, T10, T12, T13;
+    double fx, xhi, xlo, cum, ccum, pq, prompr;
+    unsigned long qhi, qleft, qporq;
+    double T5, T6, T7, T8, T9, T10, T12, T13;
 
     //
     //     Check arguments
@@ -2546,6 +2555,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tol (1.0e-8)
 # define atol (1.0e-50)
 # define zero (1.0e-300)
@@ -2555,9 +2566,9 @@ namespace DCDFLIB
     static double K2 = 0.0e0;
     static double K4 = 0.5e0;
     static double K5 = 5.0e0;
-    static double fx, cum, ccum, pq, porq;
-    static unsigned long qhi, qleft, qporq;
-    static double T3, T6, T7, T8, T9, T10, T11;
+    double fx, cum, ccum, pq, porq;
+    unsigned long qhi, qleft, qporq;
+    double T3, T6, T7, T8, T9, T10, T11;
 
     //
     //     Check arguments
@@ -2842,6 +2853,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tent4 1.0e4
 # define tol (1.0e-8)
 # define atol (1.0e-50)
@@ -2852,9 +2865,9 @@ namespace DCDFLIB
     static double K1 = 0.0e0;
     static double K3 = 0.5e0;
     static double K4 = 5.0e0;
-    static double fx, cum, ccum;
-    static unsigned long qhi, qleft;
-    static double T2, T5, T6, T7, T8, T9, T10, T11, T12, T13;
+    double fx, cum, ccum;
+    unsigned long qhi, qleft;
+    double T2, T5, T6, T7, T8, T9, T10, T11, T12, T13;
 
     //
     //     Check arguments
@@ -3105,6 +3118,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tol (1.0e-8)
 # define atol (1.0e-50)
 # define zero (1.0e-300)
@@ -3114,9 +3129,9 @@ namespace DCDFLIB
     static double K2 = 0.0e0;
     static double K4 = 0.5e0;
     static double K5 = 5.0e0;
-    static double pq, fx, cum, ccum;
-    static unsigned long qhi, qleft, qporq;
-    static double T3, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15;
+    double pq, fx, cum, ccum;
+    unsigned long qhi, qleft, qporq;
+    double T3, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15;
 
     //
     //     Check arguments
@@ -3449,6 +3464,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tent4 1.0e4
 # define tol (1.0e-8)
 # define atol (1.0e-50)
@@ -3459,9 +3476,9 @@ namespace DCDFLIB
     static double K1 = 0.0e0;
     static double K3 = 0.5e0;
     static double K4 = 5.0e0;
-    static double fx, cum, ccum;
-    static unsigned long qhi, qleft;
-    static double T2, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16, T17;
+    double fx, cum, ccum;
+    unsigned long qhi, qleft;
+    double T2, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16, T17;
 
     //
     //     Check arguments
@@ -3753,6 +3770,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tol (1.0e-8)
 # define atol (1.0e-50)
 # define zero (1.0e-300)
@@ -3761,10 +3780,10 @@ namespace DCDFLIB
     static int K1 = 1;
     static double K5 = 0.5e0;
     static double K6 = 5.0e0;
-    static double xx, fx, xscale, cum, ccum, pq, porq;
-    static int ierr;
-    static unsigned long qhi, qleft, qporq;
-    static double T2, T3, T4, T7, T8, T9;
+    double xx, fx, xscale, cum, ccum, pq, porq;
+    int ierr;
+    unsigned long qhi, qleft, qporq;
+    double T2, T3, T4, T7, T8, T9;
 
     //
     //     Check arguments
@@ -4047,6 +4066,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tol (1.0e-8)
 # define atol (1.0e-50)
 # define inf 1.0e300
@@ -4057,9 +4078,9 @@ namespace DCDFLIB
     static double K4 = 0.5e0;
     static double K5 = 5.0e0;
     static double K11 = 1.0e0;
-    static double fx, xhi, xlo, pq, prompr, cum, ccum;
-    static unsigned long qhi, qleft, qporq;
-    static double T3, T6, T7, T8, T9, T10, T12, T13;
+    double fx, xhi, xlo, pq, prompr, cum, ccum;
+    unsigned long qhi, qleft, qporq;
+    double T3, T6, T7, T8, T9, T10, T12, T13;
 
     //
     //     Check arguments
@@ -4405,8 +4426,10 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
     static int K1 = 1;
-    static double z, pq;
+    double z, pq;
 
     //
     //     Check arguments
@@ -4582,6 +4605,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tol (1.0e-8)
 # define atol (1.0e-50)
 # define inf 1.0e300
@@ -4590,9 +4615,9 @@ namespace DCDFLIB
     static double K2 = 0.0e0;
     static double K4 = 0.5e0;
     static double K5 = 5.0e0;
-    static double fx, cum, ccum, pq;
-    static unsigned long qhi, qleft, qporq;
-    static double T3, T6, T7, T8, T9, T10;
+    double fx, cum, ccum, pq;
+    unsigned long qhi, qleft, qporq;
+    double T3, T6, T7, T8, T9, T10;
 
     //
     //     Check arguments
@@ -4834,6 +4859,8 @@ namespace DCDFLIB
   //    if STATUS is 1 or 2, this is the search bound that was exceeded.
   //
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 # define tol (1.0e-8)
 # define atol (1.0e-50)
 # define zero (1.0e-300)
@@ -4843,9 +4870,9 @@ namespace DCDFLIB
     static int K1 = 1;
     static double K4 = 0.5e0;
     static double K5 = 5.0e0;
-    static double fx, cum, ccum, pq;
-    static unsigned long qhi, qleft, qporq;
-    static double T2, T3, T6, T7, T8, T9, T10, T11;
+    double fx, cum, ccum, pq;
+    unsigned long qhi, qleft, qporq;
+    double T2, T3, T6, T7, T8, T9, T10, T11;
     //
     //     Check arguments
     //
@@ -5282,7 +5309,7 @@ namespace DCDFLIB
   //    density function and tail cumulative density function.
   //
   {
-    static int ierr;
+    int ierr;
 
     if ( *x <= 0.0 )
       {
@@ -5342,7 +5369,7 @@ namespace DCDFLIB
   //    binomial distribution.
   //
   {
-    static double T1, T2;
+    double T1, T2;
 
     if ( *s < *xn )
       {
@@ -5380,8 +5407,8 @@ namespace DCDFLIB
   //    chi-square distribution.
   //
   {
-    static double a;
-    static double xx;
+    double a;
+    double xx;
 
     a = *df * 0.5;
     xx = *x * 0.5;
@@ -5443,10 +5470,10 @@ namespace DCDFLIB
 
     static double eps = 1.0e-5;
     static int ntired = 1000;
-    static double adj, centaj, centwt, chid2, dfd2, lcntaj, lcntwt, lfact, pcent, pterm, sum,
+    double adj, centaj, centwt, chid2, dfd2, lcntaj, lcntwt, lfact, pcent, pterm, sum,
       sumadj, term, wt, xnonc;
-    static int i, icent, iterb, iterf;
-    static double T1, T2, T3;
+    int i, icent, iterb, iterf;
+    double T1, T2, T3;
 
     if(!(*x <= 0.0e0)) goto S10;
     *cum = 0.0e0;
@@ -5604,9 +5631,9 @@ namespace DCDFLIB
 # define half 0.5e0
 # define done 1.0e0
 
-    static double dsum, prod, xx, yy;
-    static int ierr;
-    static double T1, T2;
+    double dsum, prod, xx, yy;
+    int ierr;
+    double T1, T2;
 
     if(!(*f <= 0.0e0)) goto S10;
     *cum = 0.0e0;
@@ -5700,10 +5727,10 @@ namespace DCDFLIB
 # define done 1.0e0
 
     static double eps = 1.0e-4;
-    static double dsum, dummy, prod, xx, yy, adn, aup, b, betdn, betup, centwt, dnterm, sum,
+    double dsum, dummy, prod, xx, yy, adn, aup, b, betdn, betup, centwt, dnterm, sum,
       upterm, xmult, xnonc;
-    static int i, icent, ierr;
-    static double T1, T2, T3, T4, T5, T6;
+    int i, icent, ierr;
+    double T1, T2, T3, T4, T5, T6;
 
     if(!(*f <= 0.0e0)) goto S10;
     *cum = 0.0e0;
@@ -5890,7 +5917,7 @@ namespace DCDFLIB
   //    and the tail CDF.
   //
   {
-    static double T1;
+    double T1;
 
     T1 = *s + 1.e0;
     cumbet(pr, ompr, xn, &T1, cum, ccum);
@@ -6000,8 +6027,8 @@ namespace DCDFLIB
     static double zero = 0.0e0;
     static int K1 = 1;
     static int K2 = 2;
-    static int i;
-    static double del, eps, temp, x, xden, xnum, y, xsq, min;
+    int i;
+    double del, eps, temp, x, xden, xnum, y, xsq, min;
     //
     //  Machine dependent constants
     //
@@ -6117,7 +6144,7 @@ namespace DCDFLIB
   //    tail CDF.
   //
   {
-    static double chi, df;
+    double chi, df;
 
     df = 2.0e0 * (*s + 1.0e0);
     chi = 2.0e0 * *xlam;
@@ -6151,14 +6178,14 @@ namespace DCDFLIB
   //    tail CDF.
   //
   {
-    static double a;
-    static double dfptt;
+    double a;
+    double dfptt;
     static double K2 = 0.5e0;
-    static double oma;
-    static double T1;
-    static double tt;
-    static double xx;
-    static double yy;
+    double oma;
+    double T1;
+    double tt;
+    double xx;
+    double yy;
 
     tt = (*t) * (*t);
     dfptt = ( *df ) + tt;
@@ -6207,7 +6234,7 @@ namespace DCDFLIB
   //    Output, double DBETRM, the Sterling remainder.
   //
   {
-    static double dbetrm, T1, T2, T3;
+    double dbetrm, T1, T2, T3;
     //
     //     Try to sum from smallest to largest
     //
@@ -6250,7 +6277,7 @@ namespace DCDFLIB
     static double q2 = .107141568980644e+00;
     static double q3 = -.119041179760821e-01;
     static double q4 = .595130811860248e-03;
-    static double dexpm1, w;
+    double dexpm1, w;
 
     if(fabs(*x) > 0.15e0) goto S10;
     dexpm1 = *x * (((p2**x + p1)**x + 1.0e0) / ((((q4**x + q3)**x + q2)**x + q1)**x + 1.0e0));
@@ -6304,9 +6331,9 @@ namespace DCDFLIB
 # define nhalf (-0.5e0)
 # define dennor(x) (r2pi*exp(nhalf*(x)*(x)))
 
-    static double dinvnr, strtx, xcur, cum, ccum, pp, dx;
-    static int i;
-    static unsigned long qporq;
+    double dinvnr, strtx, xcur, cum, ccum, pp, dx;
+    int i;
+    unsigned long qporq;
 
     //
     //     FIND MINIMUM OF P AND Q
@@ -6446,7 +6473,7 @@ namespace DCDFLIB
         -34459425.0e0, 654729075.0e0, -13749310575.e0, 316234143225.0e0
       };
     static int K1 = 12;
-    static double dlanor, approx, correc, xx, xx2, T2;
+    double dlanor, approx, correc, xx, xx2, T2;
 
     xx = fabs(*x);
     if ( xx < 5.0e0 ) ftnstop((char *)" Argument too small in DLANOR");
@@ -6497,8 +6524,8 @@ namespace DCDFLIB
     static int K2 = 8;
     static int K3 = 9;
     static int K4 = 10;
-    static double value, b, binv, bm1, one, w, z;
-    static int emax, emin, ibeta, m;
+    double value, b, binv, bm1, one, w, z;
+    int emax, emin, ibeta, m;
 
     if(*i > 1) goto S10;
     b = ipmpar(&K1);
@@ -6651,7 +6678,7 @@ namespace DCDFLIB
         0.179644372368830573164938490016e0
       };
     static int K1 = 10;
-    static double dstrem, sterl, T2;
+    double dstrem, sterl, T2;
     //
     //    For information, here are the next 11 coefficients of the
     //    remainder term in Sterling's formula
@@ -6771,8 +6798,8 @@ namespace DCDFLIB
       };
     static double denom[4] = { 4.0e0, 96.0e0, 384.0e0, 92160.0e0 };
     static int ideg[4] = { 2, 3, 4, 5 };
-    static double dt1, denpow, sum, term, x, xp, xx;
-    static int i;
+    double dt1, denpow, sum, term, x, xp, xx;
+    int i;
 
     x = fabs(dinvnr(p, q));
     xx = x * x;
@@ -7166,6 +7193,8 @@ namespace DCDFLIB
 
   **********************************************************************/
   {
+    // The reverse-communication search keeps its state in static storage
+    OT::MutexLock lock(DCDFLIB_SearchMutex_);
 #define tent4 1.0e4
 #define tol 1.0e-8
 #define atol 1.0e-50
@@ -7174,9 +7203,9 @@ namespace DCDFLIB
 #define inf 1.0e100
     static double K3 = 0.5e0;
     static double K4 = 5.0e0;
-    static double ccum, cum, fx;
-    static unsigned long qhi, qleft;
-    static double T1, T2, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14;
+    double ccum, cum, fx;
+    unsigned long qhi, qleft;
+    double T1, T2, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14;
     /*
       ..
       .. Executable Statements ..
@@ -7360,12 +7389,12 @@ namespace DCDFLIB
 #define onep5 1.5e0
 #define conv 1.0e-7
 #define tiny 1.0e-10
-    static double alghdf, b, bb, bbcent, bcent, cent, d, dcent, dpnonc, dum1, dum2, e, ecent,
+    double alghdf, b, bb, bbcent, bcent, cent, d, dcent, dpnonc, dum1, dum2, e, ecent,
       halfdf, lambda, lnomx, lnx, omx, pnonc2, s, scent, ss, sscent, t2, term, tt, twoi, x, xi,
       xlnd, xlne;
-    static int ierr;
-    static unsigned long qrevs;
-    static double T1, T2, T3, T4, T5, T6, T7, T8, T9, T10;
+    int ierr;
+    unsigned long qrevs;
+    double T1, T2, T3, T4, T5, T6, T7, T8, T9, T10;
     /*
       ..
       .. Executable Statements ..
@@ -7843,7 +7872,7 @@ namespace DCDFLIB
         9.41537750555460e+01, 1.87114811799590e+02, 9.90191814623914e+01,
         1.80124575948747e+01
       };
-    static double erf1, ax, bot, t, top, x2;
+    double erf1, ax, bot, t, top, x2;
 
     ax = fabs(*x);
     if(ax > 0.5e0) goto S10;
@@ -7934,7 +7963,7 @@ namespace DCDFLIB
         1.80124575948747e+01
       };
     static int K1 = 1;
-    static double erfc1, ax, bot, e, t, top, w;
+    double erfc1, ax, bot, e, t, top, w;
 
     //
     //                     ABS(X) .LE. 0.5
@@ -8019,7 +8048,7 @@ namespace DCDFLIB
   //    Output, double ESUM, the value of exp ( MU + X ).
   //
   {
-    static double esum, w;
+    double esum, w;
 
     if(*x > 0.0e0) goto S10;
     if(*mu < 0) goto S20;
@@ -8068,8 +8097,8 @@ namespace DCDFLIB
   //    Output, double EVAL_POL, the value of the polynomial at X.
   //
   {
-    static double devlpl, term;
-    static int i;
+    double devlpl, term;
+    int i;
 
     term = a[*n - 1];
     for ( i = *n - 1 - 1; i >= 0; i-- )
@@ -8111,8 +8140,8 @@ namespace DCDFLIB
     static int K1 = 4;
     static int K2 = 9;
     static int K3 = 10;
-    static double exparg, lnb;
-    static int b, m;
+    double exparg, lnb;
+    int b, m;
 
     b = ipmpar(&K1);
     if(b != 2) goto S10;
@@ -8534,7 +8563,7 @@ namespace DCDFLIB
   //
   {
     static int K1 = 1;
-    static double fpser, an, c, s, t, tol;
+    double fpser, an, c, s, t, tol;
 
     fpser = 1.0e0;
     if(*a <= 1.e-3 * *eps) goto S10;
@@ -8617,7 +8646,7 @@ namespace DCDFLIB
         .118378989872749e+00, .930357293360349e-03, -.118290993445146e-01,
         .223047661158249e-02, .266505979058923e-03, -.132674909766242e-03
       };
-    static double gam1, bot, d, t, top, w, T1;
+    double gam1, bot, d, t, top, w, T1;
 
     t = *a;
     d = *a - 0.5e0;
@@ -8760,12 +8789,12 @@ namespace DCDFLIB
       };
     static int K1 = 1;
     static int K2 = 0;
-    static double a2n, a2nm1, acc, am0, amn, an, an0, apn, b2n, b2nm1, c, c0, c1, c2, c3, c4, c5, c6,
+    double a2n, a2nm1, acc, am0, amn, an, an0, apn, b2n, b2nm1, c, c0, c1, c2, c3, c4, c5, c6,
       cma, e, e0, g, h, j, l, r, rta, rtx, s, sum, t, t1, tol, twoa, u, w, x0, y, z;
-    static int i, iop, m, max, n;
-    static double wk[20], T3;
-    static int T4, T5;
-    static double T6, T7;
+    int i, iop, m, max, n;
+    double wk[20], T3;
+    int T4, T5;
+    double T6, T7;
 
     //
     //  E IS A MACHINE DEPENDENT CONSTANT. E IS THE SMALLEST
@@ -9178,10 +9207,10 @@ namespace DCDFLIB
     static int K2 = 2;
     static int K3 = 3;
     static int K8 = 0;
-    static double am1, amax, ap1, ap2, ap3, apn, b, c1, c2, c3, c4, c5, d, e, e2, eps, g, h, pn, qg, qn,
+    double am1, amax, ap1, ap2, ap3, apn, b, c1, c2, c3, c4, c5, d, e, e2, eps, g, h, pn, qg, qn,
       r, rta, s, s2, sum, t, u, w, xmax, xmin, xn, y, z;
-    static int iop;
-    static double T4, T5, T6, T7, T9;
+    int iop;
+    double T4, T5, T6, T7, T9;
 
     //
     //  E, XMIN, AND XMAX ARE MACHINE DEPENDENT CONSTANTS.
@@ -9598,7 +9627,7 @@ namespace DCDFLIB
     static double s3 = .101552187439830e+00;
     static double s4 = .713309612391000e-02;
     static double s5 = .116165475989616e-03;
-    static double gamln1, w, x;
+    double gamln1, w, x;
 
     if(*a >= 0.6e0) goto S10;
     w = ((((((p6**a + p5)**a + p4)**a + p3)**a + p2)**a + p1)**a + p0) / ((((((q6**a + q5)**a +
@@ -9651,9 +9680,9 @@ namespace DCDFLIB
     static double c4 = .837308034031215e-03;
     static double c5 = -.165322962780713e-02;
     static double d = .418938533204673e0;
-    static double gamln, t, w;
-    static int i, n;
-    static double T1;
+    double gamln, t, w;
+    int i, n;
+    double T1;
 
     if(*a > 0.8e0) goto S10;
     gamln = gamma_ln1 ( a ) - log ( *a );
@@ -9706,7 +9735,7 @@ namespace DCDFLIB
   //
   {
     static int K2 = 0;
-    static double a2n, a2nm1, am0, an, an0, b2n, b2nm1, c, cma, g, h, j, l, sum, t, tol, w, z, T1, T3;
+    double a2n, a2nm1, am0, an, an0, b2n, b2nm1, c, cma, g, h, j, l, sum, t, tol, w, z, T1, T3;
 
     if(*a**x == 0.0e0) goto S120;
     if(*a == 0.5e0) goto S100;
@@ -9935,8 +9964,8 @@ namespace DCDFLIB
       };
     static int K2 = 3;
     static int K3 = 0;
-    static double Xgamm, bot, g, lnx, s, t, top, w, x, z;
-    static int i, j, m, n, T1;
+    double Xgamm, bot, g, lnx, s, t, top, w, x, z;
+    int i, j, m, n, T1;
 
     Xgamm = 0.0e0;
     x = *a;
@@ -10067,7 +10096,7 @@ namespace DCDFLIB
   //    Output, double GSUMLN, the value of ln(Gamma(A+B)).
   //
   {
-    static double gsumln, x, T1, T2;
+    double gsumln, x, T1, T2;
 
     x = *a + *b - 2.e0;
     if(x > 0.25e0) goto S10;
@@ -10150,8 +10179,8 @@ namespace DCDFLIB
   //    Output, int IPMPAR, the value of the desired constant.
   //
   {
-    static int imach[11];
-    static int ipmpar;
+    int imach[11];
+    int ipmpar;
     //     MACHINE CONSTANTS FOR AMDAHL MACHINES.
     //
     //   imach[1] = 2;
@@ -10615,7 +10644,7 @@ namespace DCDFLIB
         0, 1, 2
       };
 
-    if ( n_data < 0 )
+    if ( *n_data < 0 )
       {
         *n_data = 0;
       }
@@ -10874,8 +10903,8 @@ namespace DCDFLIB
       };
     static int K1 = 3;
     static int K2 = 1;
-    static double psi, aug, den, sgn, upper, w, x, xmax1, xmx0, xsmall, z;
-    static int i, m, n, nq;
+    double psi, aug, den, sgn, upper, w, x, xmax1, xmx0, xsmall, z;
+    int i, m, n, nq;
     //
     //     MACHINE DEPENDENT CONSTANTS ...
     //        XMAX1  = THE SMALLEST POSITIVE FLOATING POINT CONSTANT
@@ -11100,7 +11129,7 @@ namespace DCDFLIB
   //
   {
     static double rt2pin = .398942280401433e0;
-    static double rcomp, t, t1, u;
+    double rcomp, t, t1, u;
     rcomp = 0.0e0;
     if(*a >= 20.0e0) goto S20;
     t = *a * log(*x) - *x;
@@ -11146,7 +11175,7 @@ namespace DCDFLIB
     static double q2 = .107141568980644e+00;
     static double q3 = -.119041179760821e-01;
     static double q4 = .595130811860248e-03;
-    static double rexp, w;
+    double rexp, w;
 
     if(fabs(*x) > 0.15e0) goto S10;
     rexp = *x * (((p2**x + p1)**x + 1.0e0) / ((((q4**x + q3)**x + q2)**x + q1)**x + 1.0e0));
@@ -11188,7 +11217,7 @@ namespace DCDFLIB
     static double p2 = .620886815375787e-02;
     static double q1 = -.127408923933623e+01;
     static double q2 = .354508718369557e+00;
-    static double rlog, r, t, u, w, w1;
+    double rlog, r, t, u, w, w1;
 
     if(*x < 0.61e0 || *x > 1.57e0) goto S40;
     if(*x < 0.82e0) goto S10;
@@ -11245,7 +11274,7 @@ namespace DCDFLIB
     static double p2 = .620886815375787e-02;
     static double q1 = -.127408923933623e+01;
     static double q2 = .354508718369557e+00;
-    static double rlog1, h, r, t, w, w1;
+    double rlog1, h, r, t, w, w1;
 
     if(*x < -0.39e0 || *x > 0.57e0) goto S40;
     if(*x < -0.18e0) goto S10;
@@ -11408,7 +11437,7 @@ namespace DCDFLIB
         -0.453642210148e-4
       };
     static int K1 = 5;
-    static double stvaln, sign, y, z;
+    double stvaln, sign, y, z;
 
     if(!(*p <= 0.5e0)) goto S10;
     sign = -1.0e0;
@@ -0,0 +1,135 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  TemplatedNumericalMathEvaluationImplementation.hxx
+ *  @brief Evaluation of a function object written against a templated scalar type
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_TEMPLATEDNUMERICALMATHEVALUATIONIMPLEMENTATION_HXX
+#define OPENTURNS_TEMPLATEDNUMERICALMATHEVALUATIONIMPLEMENTATION_HXX
+
+#include "NumericalMathEvaluationImplementation.hxx"
+#include "NumericalMathFunctionImplementation.hxx"
+#include "AutomaticDifferentiationGradient.hxx"
+#include "AutomaticDifferentiationHessian.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/**
+ * @class TemplatedNumericalMathEvaluationImplementation
+ *
+ * This class gives an implementation for function objects providing
+ *   template <class S> Collection<S> operator() (const Collection<S> & x) const
+ * so they can be used in NumericalMathFunctions. Such functions can be
+ * differentiated exactly by automatic differentiation, see bindTemplate().
+ */
+template <class TemplatedFunction>
+class TemplatedNumericalMathEvaluationImplementation
+  : public NumericalMathEvaluationImplementation
+{
+public:
+
+  /** Parameters constructor */
+  TemplatedNumericalMathEvaluationImplementation(const TemplatedFunction & function,
+                                                 const UnsignedLong inputDimension,
+                                                 const UnsignedLong outputDimension)
+    : NumericalMathEvaluationImplementation(),
+      function_(function),
+      inputDimension_(inputDimension),
+      outputDimension_(outputDimension)
+  {
+    // Nothing to do
+  }
+
+  /** Virtual constructor */
+  virtual TemplatedNumericalMathEvaluationImplementation * clone() const
+  {
+    return new TemplatedNumericalMathEvaluationImplementation(*this);
+  }
+
+  /** String converter */
+  virtual String __repr__() const
+  {
+    OSS oss;
+    oss << "class=TemplatedNumericalMathEvaluationImplementation name=" << getName()
+        << " inputDimension=" << inputDimension_
+        << " outputDimension=" << outputDimension_;
+    return oss;
+  }
+
+  /** Test for actual implementation */
+  virtual Bool isActualImplementation() const
+  {
+    return true;
+  }
+
+  /** Operator () */
+  using NumericalMathEvaluationImplementation::operator();
+  virtual NumericalPoint operator() (const NumericalPoint & inP) const
+  {
+    if (inP.getDimension() != inputDimension_) throw InvalidArgumentException(HERE) << "Error: trying to evaluate a NumericalMathFunction with an argument of invalid dimension";
+    ++callsNumber_;
+    const NumericalPoint result(function_(Collection<NumericalScalar>(inP)));
+    if (result.getDimension() != outputDimension_) throw InvalidArgumentException(HERE) << "Error: the function returned " << result.getDimension() << " values instead of " << outputDimension_;
+    return result;
+  }
+
+  /** Accessor for input point dimension */
+  virtual UnsignedLong getInputDimension() const
+  {
+    return inputDimension_;
+  }
+
+  /** Accessor for output point dimension */
+  virtual UnsignedLong getOutputDimension() const
+  {
+    return outputDimension_;
+  }
+
+  /** Method save() stores the object through the StorageManager
+   *  The function object cannot be saved
+   */
+
+private:
+
+  TemplatedFunction function_;
+  UnsignedLong inputDimension_;
+  UnsignedLong outputDimension_;
+
+}; /* class TemplatedNumericalMathEvaluationImplementation */
+
+
+
+/** Function with exact gradient and hessian computed by automatic differentiation */
+template <class TemplatedFunction>
+NumericalMathFunctionImplementation
+bindTemplate(const TemplatedFunction & function,
+             const UnsignedLong inputDimension,
+             const UnsignedLong outputDimension)
+{
+  return NumericalMathFunctionImplementation(new TemplatedNumericalMathEvaluationImplementation<TemplatedFunction>(function, inputDimension, outputDimension),
+                                             new AutomaticDifferentiationGradient<TemplatedFunction>(function, inputDimension, outputDimension),
+                                             new AutomaticDifferentiationHessian<TemplatedFunction>(function, inputDimension, outputDimension));
+}
+
+
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_TEMPLATEDNUMERICALMATHEVALUATIONIMPLEMENTATION_HXX */
@@ -213,15 +213,16 @@ UniVariatePolynomialImplementation UniVariatePolynomialImplementation::operator
     {
       const FFT fft;
       const UnsignedLong powerOfTwo(SpecFunc::NextPowerOfTwo(resultDimension));
-      NumericalComplexCollection leftCoefficients(powerOfTwo);
-      NumericalComplexCollection rightCoefficients(powerOfTwo);
+      // The coefficients are real, so the real transformations are used
+      FFT::NumericalScalarCollection leftCoefficients(powerOfTwo, 0.0);
+      FFT::NumericalScalarCollection rightCoefficients(powerOfTwo, 0.0);
       for (UnsignedLong i = 0; i <= leftDegree; ++i) leftCoefficients[i] = coefficients_[i];
       for (UnsignedLong i = 0; i <= rightDegree; ++i) rightCoefficients[i] = factorCoefficients[i];
-      leftCoefficients = fft.transform(leftCoefficients);
-      rightCoefficients = fft.transform(rightCoefficients);
-      for (UnsignedLong i = 0; i < powerOfTwo; ++i) leftCoefficients[i] *= rightCoefficients[i];
-      rightCoefficients = fft.inverseTransform(leftCoefficients);
-      for (UnsignedLong i = 0; i < resultDimension; ++i) resultCoefficients[i] = rightCoefficients[i].real();
+      NumericalComplexCollection leftTransform(fft.transform(leftCoefficients));
+      const NumericalComplexCollection rightTransform(fft.transform(rightCoefficients));
+      for (UnsignedLong i = 0; i < powerOfTwo; ++i) leftTransform[i] *= rightTransform[i];
+      const FFT::NumericalScalarCollection product(fft.inverseTransformReal(leftTransform));
+      for (UnsignedLong i = 0; i < resultDimension; ++i) resultCoefficients[i] = product[i];
     }
   return UniVariatePolynomialImplementation(resultCoefficients);
 } // end method operator*
@@ -32,6 +32,8 @@
 #include "Cloud.hxx"
 #include "Curve.hxx"
 #include "SpecFunc.hxx"
+#include "IdentityMatrix.hxx"
+#include "TBB.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -46,6 +48,14 @@ Mesh::Mesh(const UnsignedLong dimension)
   , simplices_()
   , volume_(0.0)
   , isAlreadyComputedVolume_(false)
+  , inverseSimplexMatrices_(0)
+  , lowerBound_(0)
+  , upperBound_(0)
+  , cellWidth_(0)
+  , cellNumbers_(0)
+  , cellStarts_(0)
+  , cellSimplices_(0)
+  , isAlreadyComputedSpatialIndex_(false)
 {
   // Build a unique standard simplex
   // First, the vertices
@@ -64,6 +74,14 @@ Mesh::Mesh(const NumericalSample & vertices,
   , simplices_(simplices)
   , volume_(0.0)
   , isAlreadyComputedVolume_(false)
+  , inverseSimplexMatrices_(0)
+  , lowerBound_(0)
+  , upperBound_(0)
+  , cellWidth_(0)
+  , cellNumbers_(0)
+  , cellStarts_(0)
+  , cellSimplices_(0)
+  , isAlreadyComputedSpatialIndex_(false)
 {
   // Nothing to do
 }
@@ -83,6 +101,7 @@ NumericalSample Mesh::getVertices() const
 void Mesh::setVertices(const NumericalSample & vertices)
 {
   vertices_ = vertices;
+  resetCache();
 }
 
 /* Vertex accessor */
@@ -96,6 +115,7 @@ void Mesh::setVertex(const UnsignedLong index,
                      const NumericalPoint & vertex)
 {
   vertices_[index] = vertex;
+  resetCache();
 }
 
 /* Simplices accessor */
@@ -107,6 +127,14 @@ Mesh::IndicesCollection Mesh::getSimplices() const
 void Mesh::setSimplices(const IndicesCollection & simplices)
 {
   simplices_ = simplices;
+  resetCache();
+}
+
+/* Reset the quantities depending on the vertices and the simplices */
+void Mesh::resetCache()
+{
+  isAlreadyComputedVolume_ = false;
+  isAlreadyComputedSpatialIndex_ = false;
 }
 
 /* Simplex accessor */
@@ -146,9 +174,7 @@ Bool Mesh::isValid() const
 /* Check if the given point is numerically inside of the closed mesh, i.e. using only the bounds part of the mesh */
 Bool Mesh::numericallyContains(const NumericalPoint & point) const
 {
-  const UnsignedLong simplicesSize(simplices_.getSize());
-  for (UnsignedLong i = 0; i < simplicesSize; ++i) if (checkPointInSimplex(point, i)) return true;
-  return false;
+  return locate(point) < simplices_.getSize();
 }
 
 /* Check if the given point is in the given simplex */
@@ -171,12 +197,242 @@ SquareMatrix Mesh::buildSimplexMatrix(const UnsignedLong index) const
 Bool Mesh::checkPointInSimplex(const NumericalPoint & point,
                                const UnsignedLong index) const
 {
-  SquareMatrix matrix(buildSimplexMatrix(index));
-  NumericalPoint v(point);
-  v.add(1.0);
-  const NumericalPoint alpha(matrix.solveLinearSystem(v, false));
-  for (UnsignedLong i = 0; i <= dimension_; ++i) if ((alpha[i] < 0.0) || (alpha[i] > 1.0)) return false;
-  return true;
+  if (index >= simplices_.getSize()) throw InvalidArgumentException(HERE) << "Error: the simplex index=" << index << " must be less than the number of simplices=" << simplices_.getSize();
+  if (!isAlreadyComputedSpatialIndex_) computeSpatialIndex();
+  NumericalPoint coordinates(dimension_ + 1);
+  return computeBarycentricCoordinates(point, index, coordinates);
+}
+
+/* Compute the barycentric coordinates of a point in a simplex using the inverse of its affine matrix
+   The coordinates solve M\alpha = (x, 1) where the columns of M are the vertices completed by 1 */
+Bool Mesh::computeBarycentricCoordinates(const NumericalPoint & point,
+                                         const UnsignedLong index,
+                                         NumericalPoint & coordinates) const
+{
+  const UnsignedLong size(dimension_ + 1);
+  UnsignedLong shift(index * size * size);
+  Bool isInside(true);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      NumericalScalar value(inverseSimplexMatrices_[shift + dimension_]);
+      for (UnsignedLong j = 0; j < dimension_; ++j) value += inverseSimplexMatrices_[shift + j] * point[j];
+      coordinates[i] = value;
+      // Written this way to reject the coordinates which are not numbers
+      isInside = isInside && (value >= 0.0) && (value <= 1.0);
+      shift += size;
+    }
+  return isInside;
+}
+
+/* Build the regular grid index of the simplices and the inverses of their affine matrices
+ * The grid covers the bounding box of the vertices with about one cell per simplex, and each
+ * simplex is registered into all the cells overlapped by its bounding box, by increasing index.
+ * A point is then located by checking only the simplices of its cell, the first one containing
+ * it being the same as the first one found by a scan of all the simplices.
+ */
+void Mesh::computeSpatialIndex() const
+{
+  const UnsignedLong simplicesSize(simplices_.getSize());
+  const UnsignedLong size(dimension_ + 1);
+  // The inverse affine matrices
+  inverseSimplexMatrices_ = NumericalPoint(simplicesSize * size * size);
+  const IdentityMatrix identity(size);
+  UnsignedLong shift(0);
+  for (UnsignedLong k = 0; k < simplicesSize; ++k)
+    {
+      SquareMatrix matrix(buildSimplexMatrix(k));
+      NumericalScalar sign(0.0);
+      // A degenerate simplex gets a constant negative first coordinate, so that it contains no point
+      if (!(matrix.computeLogAbsoluteDeterminant(sign, true) > -SpecFunc::MaxNumericalScalar))
+        {
+          inverseSimplexMatrices_[shift + dimension_] = -1.0;
+          shift += size * size;
+          continue;
+        }
+      const Matrix inverse(matrix.solveLinearSystem(identity, false));
+      for (UnsignedLong i = 0; i < size; ++i)
+        for (UnsignedLong j = 0; j < size; ++j)
+          {
+            inverseSimplexMatrices_[shift] = inverse(i, j);
+            ++shift;
+          }
+    }
+  // The grid
+  const UnsignedLong verticesSize(vertices_.getSize());
+  lowerBound_ = NumericalPoint(dimension_, SpecFunc::MaxNumericalScalar);
+  upperBound_ = NumericalPoint(dimension_, -SpecFunc::MaxNumericalScalar);
+  for (UnsignedLong i = 0; i < verticesSize; ++i)
+    for (UnsignedLong j = 0; j < dimension_; ++j)
+      {
+        lowerBound_[j] = std::min(lowerBound_[j], vertices_[i][j]);
+        upperBound_[j] = std::max(upperBound_[j], vertices_[i][j]);
+      }
+  // Cell side giving about one cell per simplex, computed over the non-flat directions
+  NumericalScalar logVolume(0.0);
+  UnsignedLong nonFlatDimension(0);
+  for (UnsignedLong j = 0; j < dimension_; ++j)
+    if (upperBound_[j] > lowerBound_[j])
+      {
+        logVolume += log(upperBound_[j] - lowerBound_[j]);
+        ++nonFlatDimension;
+      }
+  const NumericalScalar cellSide(nonFlatDimension > 0 ? exp((logVolume - log(std::max(simplicesSize, 1UL))) / nonFlatDimension) : 1.0);
+  cellWidth_ = NumericalPoint(dimension_, 1.0);
+  cellNumbers_ = Indices(dimension_, 1);
+  UnsignedLong cellsSize(1);
+  for (UnsignedLong j = 0; j < dimension_; ++j)
+    {
+      const NumericalScalar extent(upperBound_[j] - lowerBound_[j]);
+      if (extent > 0.0)
+        {
+          cellNumbers_[j] = static_cast<UnsignedLong>(std::min(ceil(extent / cellSide), std::max(1.0, 1.0 * simplicesSize)));
+          cellWidth_[j] = extent / cellNumbers_[j];
+        }
+      cellsSize *= cellNumbers_[j];
+    }
+  // Cell ranges of the bounding boxes of the simplices
+  Indices lowerCells(simplicesSize * dimension_);
+  Indices upperCells(simplicesSize * dimension_);
+  for (UnsignedLong k = 0; k < simplicesSize; ++k)
+    {
+      const Indices vertexIndices(simplices_[k]);
+      for (UnsignedLong j = 0; j < dimension_; ++j)
+        {
+          NumericalScalar minimum(vertices_[vertexIndices[0]][j]);
+          NumericalScalar maximum(minimum);
+          for (UnsignedLong i = 1; i < vertexIndices.getSize(); ++i)
+            {
+              minimum = std::min(minimum, vertices_[vertexIndices[i]][j]);
+              maximum = std::max(maximum, vertices_[vertexIndices[i]][j]);
+            }
+          lowerCells[k * dimension_ + j] = std::min(static_cast<UnsignedLong>((minimum - lowerBound_[j]) / cellWidth_[j]), cellNumbers_[j] - 1);
+          upperCells[k * dimension_ + j] = std::min(static_cast<UnsignedLong>((maximum - lowerBound_[j]) / cellWidth_[j]), cellNumbers_[j] - 1);
+        }
+    }
+  // Two passes over the cells overlapped by each simplex: first count, then fill
+  cellStarts_ = Indices(cellsSize + 1, 0);
+  cellSimplices_ = Indices(0);
+  Indices fillPositions(0);
+  for (UnsignedLong pass = 0; pass < 2; ++pass)
+    {
+      for (UnsignedLong k = 0; k < simplicesSize; ++k)
+        {
+          // Iterate over the cells of the box as an odometer
+          Indices cell(dimension_);
+          for (UnsignedLong j = 0; j < dimension_; ++j) cell[j] = lowerCells[k * dimension_ + j];
+          Bool finished(false);
+          while (!finished)
+            {
+              UnsignedLong cellIndex(0);
+              for (UnsignedLong j = dimension_; j > 0; --j) cellIndex = cellIndex * cellNumbers_[j - 1] + cell[j - 1];
+              if (pass == 0) ++cellStarts_[cellIndex + 1];
+              else
+                {
+                  cellSimplices_[fillPositions[cellIndex]] = k;
+                  ++fillPositions[cellIndex];
+                }
+              finished = true;
+              for (UnsignedLong j = 0; j < dimension_; ++j)
+                {
+                  if (cell[j] < upperCells[k * dimension_ + j])
+                    {
+                      ++cell[j];
+                      finished = false;
+                      break;
+                    }
+                  cell[j] = lowerCells[k * dimension_ + j];
+                }
+            }
+        } // Loop over the simplices
+      if (pass == 0)
+        {
+          for (UnsignedLong i = 0; i < cellsSize; ++i) cellStarts_[i + 1] += cellStarts_[i];
+          cellSimplices_ = Indices(cellStarts_[cellsSize]);
+          fillPositions = Indices(cellStarts_.begin(), cellStarts_.end() - 1);
+        }
+    } // Loop over the passes
+  isAlreadyComputedSpatialIndex_ = true;
+}
+
+/* Locate a point once the spatial index is built */
+UnsignedLong Mesh::locateWithIndex(const NumericalPoint & point,
+                                   NumericalPoint & coordinates) const
+{
+  const UnsignedLong simplicesSize(simplices_.getSize());
+  coordinates = NumericalPoint(dimension_ + 1);
+  UnsignedLong cellIndex(0);
+  for (UnsignedLong j = dimension_; j > 0; --j)
+    {
+      const NumericalScalar x(point[j - 1]);
+      // Written this way to reject the points with components which are not numbers
+      if (!((x >= lowerBound_[j - 1]) && (x <= upperBound_[j - 1]))) return simplicesSize;
+      const UnsignedLong cell(std::min(static_cast<UnsignedLong>((x - lowerBound_[j - 1]) / cellWidth_[j - 1]), cellNumbers_[j - 1] - 1));
+      cellIndex = cellIndex * cellNumbers_[j - 1] + cell;
+    }
+  for (UnsignedLong i = cellStarts_[cellIndex]; i < cellStarts_[cellIndex + 1]; ++i)
+    if (computeBarycentricCoordinates(point, cellSimplices_[i], coordinates)) return cellSimplices_[i];
+  return simplicesSize;
+}
+
+/* Get the index of the simplex containing the given point and the barycentric coordinates of the point in this simplex */
+UnsignedLong Mesh::locate(const NumericalPoint & point,
+                          NumericalPoint & coordinates) const
+{
+  if (point.getDimension() != dimension_) throw InvalidArgumentException(HERE) << "Error: expected a point of dimension=" << dimension_ << ", got dimension=" << point.getDimension();
+  if (!isAlreadyComputedSpatialIndex_) computeSpatialIndex();
+  return locateWithIndex(point, coordinates);
+}
+
+UnsignedLong Mesh::locate(const NumericalPoint & point) const
+{
+  NumericalPoint coordinates;
+  return locate(point, coordinates);
+}
+
+/* Functor locating the points of a sample */
+struct MeshLocateFunctor
+{
+  const Mesh & mesh_;
+  const NumericalSample & sample_;
+  Indices & indices_;
+  NumericalSample & coordinates_;
+
+  MeshLocateFunctor(const Mesh & mesh,
+                    const NumericalSample & sample,
+                    Indices & indices,
+                    NumericalSample & coordinates)
+    : mesh_(mesh), sample_(sample), indices_(indices), coordinates_(coordinates) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    NumericalPoint coordinates;
+    for (UnsignedLong i = r.begin(); i != r.end(); ++i)
+      {
+        indices_[i] = mesh_.locateWithIndex(sample_[i], coordinates);
+        coordinates_[i] = coordinates;
+      }
+  }
+}; /* end struct MeshLocateFunctor */
+
+/* Locate all the points of a sample */
+Indices Mesh::locate(const NumericalSample & sample,
+                     NumericalSample & coordinates) const
+{
+  if (sample.getDimension() != dimension_) throw InvalidArgumentException(HERE) << "Error: expected a sample of dimension=" << dimension_ << ", got dimension=" << sample.getDimension();
+  // The index is built before the parallel loop
+  if (!isAlreadyComputedSpatialIndex_) computeSpatialIndex();
+  const UnsignedLong size(sample.getSize());
+  Indices indices(size);
+  coordinates = NumericalSample(size, dimension_ + 1);
+  const MeshLocateFunctor functor(*this, sample, indices, coordinates);
+  TBB::ParallelFor(0, size, functor);
+  return indices;
+}
+
+Indices Mesh::locate(const NumericalSample & sample) const
+{
+  NumericalSample coordinates;
+  return locate(sample, coordinates);
 }
 
 /* Get the numerical volume of the mesh */
@@ -345,6 +601,7 @@ void Mesh::load(Advocate & adv)
   adv.loadAttribute("simplices_", simplices_);
   adv.loadAttribute("volume_", volume_);
   adv.loadAttribute("isAlreadyComputedVolume_", isAlreadyComputedVolume_);
+  isAlreadyComputedSpatialIndex_ = false;
 }
 
 END_NAMESPACE_OPENTURNS
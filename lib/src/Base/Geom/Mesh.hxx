@@ -92,6 +92,17 @@ public:
   Bool checkPointInSimplex(const NumericalPoint & point,
                            const UnsignedLong index) const;
 
+  /** Get the index of the simplex containing the given point and the barycentric coordinates of the point
+      in this simplex. The index is equal to the number of simplices if the point is outside of the mesh */
+  UnsignedLong locate(const NumericalPoint & point,
+                      NumericalPoint & coordinates) const;
+  UnsignedLong locate(const NumericalPoint & point) const;
+
+  /** Locate all the points of a sample */
+  Indices locate(const NumericalSample & sample,
+                 NumericalSample & coordinates) const;
+  Indices locate(const NumericalSample & sample) const;
+
   /** Vertices accessor */
   NumericalSample getVertices() const;
   void setVertices(const NumericalSample & vertices);
@@ -132,9 +143,26 @@ public:
 
 private:
 
+  friend struct MeshLocateFunctor;
+
   // Compute the total volume of the mesh
   void computeVolume() const;
 
+  // Build the regular grid index of the simplices and the inverses of their affine matrices
+  void computeSpatialIndex() const;
+
+  // Compute the barycentric coordinates of a point in a simplex using the inverse of its affine matrix, return true if the point is in the simplex
+  Bool computeBarycentricCoordinates(const NumericalPoint & point,
+                                     const UnsignedLong index,
+                                     NumericalPoint & coordinates) const;
+
+  // Locate a point once the spatial index is built
+  UnsignedLong locateWithIndex(const NumericalPoint & point,
+                               NumericalPoint & coordinates) const;
+
+  // Reset the quantities depending on the vertices and the simplices
+  void resetCache();
+
   // An n-D mesh is a set of vertices with a topology described by a set of simplices
   // The vertices
   NumericalSample vertices_;
@@ -147,6 +175,22 @@ private:
 
   // Flag to tell if the global volume has already been computed
   mutable Bool isAlreadyComputedVolume_;
+
+  // The inverses of the affine matrices of the simplices, stored by rows one after the other
+  mutable NumericalPoint inverseSimplexMatrices_;
+
+  // The regular grid covering the bounding box of the vertices, used to index the simplices
+  mutable NumericalPoint lowerBound_;
+  mutable NumericalPoint upperBound_;
+  mutable NumericalPoint cellWidth_;
+  mutable Indices cellNumbers_;
+
+  // The simplices overlapping the cell k are cellSimplices_[cellStarts_[k]],...,cellSimplices_[cellStarts_[k + 1] - 1]
+  mutable Indices cellStarts_;
+  mutable Indices cellSimplices_;
+
+  // Flag to tell if the spatial index has already been computed
+  mutable Bool isAlreadyComputedSpatialIndex_;
 }; /* class Mesh */
 
 } /* Namespace OpenTURNS */
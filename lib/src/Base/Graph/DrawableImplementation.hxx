@@ -216,6 +216,9 @@ public:
                                 const NumericalScalar value,
                                 const NumericalScalar alpha);
 
+  /** Convert a color name or a hexadecimal code into an RGBA quadruplet */
+  static NumericalPoint ConvertToRGBA(const String & key);
+
   /** Method save() stores the object through the StorageManager */
   void save(Advocate & adv) const;
 
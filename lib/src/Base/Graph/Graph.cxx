@@ -273,6 +273,12 @@ String Graph::getVectorial() const
   return getImplementation()->getVectorial();
 }
 
+/* The method returning absolute path of the SVG graphic file */
+String Graph::getSVG() const
+{
+  return getImplementation()->getSVG();
+}
+
 /* Get the bounding box of the whole plot */
 Graph::BoundingBox Graph::getBoundingBox() const
 {
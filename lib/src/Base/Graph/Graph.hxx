@@ -167,6 +167,9 @@ public:
   /** The method returning absolute path of the vectorial graphic file */
   String getVectorial() const;
 
+  /** The method returning absolute path of the SVG graphic file */
+  String getSVG() const;
+
   /** Get the bounding box of the whole plot */
   BoundingBox getBoundingBox() const;
 
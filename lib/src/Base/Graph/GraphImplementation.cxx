@@ -26,6 +26,7 @@
 #include <fstream>
 
 #include "GraphImplementation.hxx"
+#include "GraphRenderer.hxx"
 #include "Rfunctions.hxx"
 #include "Path.hxx"
 #include "PersistentObjectFactory.hxx"
@@ -437,10 +438,30 @@ void GraphImplementation::draw(const String & path,
   fileName_ = file;
   Format drawingFormat(format);
   // Check the needed drawingFormat. If it is invalid, ste it to ALL
-  if ((drawingFormat != ALL) && (drawingFormat != PNG) && (drawingFormat != EPS) && (drawingFormat != FIG) && (drawingFormat != PDF))
+  if ((drawingFormat != ALL) && (drawingFormat != PNG) && (drawingFormat != EPS) && (drawingFormat != FIG) && (drawingFormat != PDF) && (drawingFormat != SVG))
     {
       drawingFormat = ALL;
     }
+  // The native renderer handles the SVG format, and the PDF format if asked to or if R is not available
+  const Bool useNativeRenderer(ResourceMap::GetAsBool("GraphImplementation-UseNativeRenderer") || (ResourceMap::Get("R-executable-command") == ""));
+  if ((drawingFormat == SVG) || ((drawingFormat == PDF) && useNativeRenderer))
+    {
+      const GraphRenderer renderer(*this, width, height);
+      renderer.exportToFile(drawingFormat == SVG ? getSVG() : getPDF(), drawingFormat);
+      return;
+    }
+  // The remaining formats of ALL are left to R when it is available
+  if ((drawingFormat == ALL) && useNativeRenderer)
+    {
+      const GraphRenderer renderer(*this, width, height);
+      renderer.exportToFile(getSVG(), SVG);
+      renderer.exportToFile(getPDF(), PDF);
+      if (ResourceMap::Get("R-executable-command") == "")
+        {
+          LOGWARN(OSS() << "GraphImplementation: R is not available, only the SVG and PDF files of the graph " << fileName_ << " have been generated, the EPS, PNG and FIG files are skipped");
+          return;
+        }
+    }
   OSS rCommand;
   rCommand << makeRHeaderCommand();
   String rCoreCommand(makeRCoreCommand());
@@ -448,7 +469,7 @@ void GraphImplementation::draw(const String & path,
     {
       rCommand << "postscript(\"" << getPostscript() << "\", horizontal = FALSE, onefile = FALSE, paper = \"special\", height=" << height / 72. << ", width=" << width / 72. << ")" << "\n" << rCoreCommand << "\n" << "dev.off()" << "\n";
     }
-  if ((drawingFormat == ALL) || (drawingFormat == PDF))
+  if (((drawingFormat == ALL) && !useNativeRenderer) || (drawingFormat == PDF))
     {
       rCommand << "pdf(\"" << getPDF() << "\", onefile = FALSE, paper = \"special\", height=" << height / 72. << ", width=" << width / 72. << ")" << "\n" << rCoreCommand << "\n" << "dev.off()" << "\n";
     }
@@ -555,6 +576,20 @@ String GraphImplementation::getVectorial() const
   return vectorial;
 }
 
+/* The method returning absolute path of the SVG graphic file */
+String GraphImplementation::getSVG() const
+{
+  String svg(path_);
+  if (path_.size() > 0)
+    if ( svg.find_last_of(Os::GetDirectorySeparator()) != (svg.length() - 1) )
+      {
+        svg += Os::GetDirectorySeparator();
+        svg += Os::GetDirectorySeparator();
+      }
+  svg += fileName_ + ".svg";
+  return svg;
+}
+
 /* Get the bounding box of the whole plot */
 GraphImplementation::BoundingBox GraphImplementation::getBoundingBox() const
 {
@@ -54,7 +54,7 @@ public:
   static Description ValidLegendPositions;
   static Bool IsFirstInitialization;
 
-  enum Format { ALL = 0, PNG, EPS, FIG, PDF };
+  enum Format { ALL = 0, PNG, EPS, FIG, PDF, SVG };
   enum LogScale { NONE = 0, LOGX, LOGY, LOGXY };
 
   /** Default constructor */
@@ -171,6 +171,9 @@ public:
   /** The method returning absolute path of the vectorial graphic file */
   String getVectorial() const;
 
+  /** The method returning absolute path of the SVG graphic file */
+  String getSVG() const;
+
   /** Get the bounding box of the whole plot */
   BoundingBox getBoundingBox() const;
 
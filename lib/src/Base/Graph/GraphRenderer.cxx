@@ -0,0 +1,1218 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  GraphRenderer.cxx
+ *  @brief GraphRenderer renders graphs natively, without any call to R
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-04-18 17:56:46 +0200 (Wed, 18 Apr 2012)
+ */
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "GraphRenderer.hxx"
+#include "ResourceMap.hxx"
+#include "SpecFunc.hxx"
+#include "TBB.hxx"
+#include "Log.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+typedef std::vector<NumericalScalar> Coordinates;
+
+/* Helvetica advance widths of the printable ASCII characters, in thousandths of the font size */
+static const UnsignedLong HelveticaWidths[95] =
+{
+  278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333, 278, 278,
+  556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278, 584, 584, 584, 556,
+  1015, 667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833, 722, 778,
+  667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611, 278, 278, 278, 469, 556,
+  333, 556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833, 556, 556,
+  556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584
+};
+
+/* Approximate width of a text drawn with the given font size */
+static NumericalScalar TextWidth(const String & text,
+                                 const NumericalScalar fontSize)
+{
+  UnsignedLong width(0);
+  for (UnsignedLong i = 0; i < text.size(); ++i)
+    {
+      const unsigned char c(text[i]);
+      width += ((c >= 32) && (c < 127)) ? HelveticaWidths[c - 32] : 556;
+    }
+  return 0.001 * width * fontSize;
+}
+
+/* Format a tick value, removing the rounding noise with respect to the tick step */
+static String FormatTick(const NumericalScalar value,
+                         const NumericalScalar step)
+{
+  std::ostringstream oss;
+  oss.imbue(std::locale::classic());
+  oss << std::setprecision(6) << (std::abs(value) < 1.0e-10 * step ? 0.0 : value);
+  return oss.str();
+}
+
+/* Nice ticks covering [a, b], following the usual 1-2-5 rule */
+static Coordinates PrettyTicks(const NumericalScalar a,
+                               const NumericalScalar b,
+                               NumericalScalar & step)
+{
+  const NumericalScalar rawStep((b - a) / 5.0);
+  const NumericalScalar magnitude(pow(10.0, floor(log10(rawStep))));
+  const NumericalScalar ratio(rawStep / magnitude);
+  step = magnitude * (ratio < 1.5 ? 1.0 : (ratio < 3.0 ? 2.0 : (ratio < 7.0 ? 5.0 : 10.0)));
+  Coordinates ticks;
+  const NumericalScalar first(ceil(a / step - 1.0e-10));
+  const NumericalScalar last(floor(b / step + 1.0e-10));
+  for (NumericalScalar k = first; k <= last; k += 1.0) ticks.push_back(k * step);
+  return ticks;
+}
+
+/* Drawing style of a primitive. Colors are RGBA quadruplets in [0, 255], an empty color means no drawing */
+struct GraphRendererStyle
+{
+  NumericalPoint stroke_;
+  NumericalPoint fill_;
+  NumericalScalar lineWidth_;
+  Coordinates dash_;
+
+  GraphRendererStyle()
+    : stroke_(0), fill_(0), lineWidth_(1.0), dash_(0) {}
+
+  GraphRendererStyle(const String & color,
+                     const NumericalScalar lineWidth,
+                     const String & lineStyle = "solid")
+    : stroke_(0), fill_(0), lineWidth_(lineWidth), dash_(0)
+  {
+    if (lineStyle == "blank") return;
+    stroke_ = DrawableImplementation::ConvertToRGBA(color);
+    // Dash patterns of R, in units of line width
+    String pattern("");
+    if (lineStyle == "dashed") pattern = "44";
+    else if (lineStyle == "dotted") pattern = "13";
+    else if (lineStyle == "dotdash") pattern = "1343";
+    else if (lineStyle == "longdash") pattern = "73";
+    else if (lineStyle == "twodash") pattern = "2262";
+    for (UnsignedLong i = 0; i < pattern.size(); ++i) dash_.push_back((pattern[i] - '0') * std::max(1.0, lineWidth));
+  }
+}; /* end struct GraphRendererStyle */
+
+/* Region of the device associated with a data range */
+struct GraphRendererFrame
+{
+  NumericalScalar left_;
+  NumericalScalar top_;
+  NumericalScalar width_;
+  NumericalScalar height_;
+  /* The data range, in log10 scale for logarithmic axes */
+  NumericalScalar xMin_;
+  NumericalScalar xMax_;
+  NumericalScalar yMin_;
+  NumericalScalar yMax_;
+  Bool logX_;
+  Bool logY_;
+
+  Bool isValid(const NumericalScalar x,
+               const NumericalScalar y) const
+  {
+    // Reject NaN and infinite values
+    if (!(std::abs(x) <= SpecFunc::MaxNumericalScalar) || !(std::abs(y) <= SpecFunc::MaxNumericalScalar)) return false;
+    return (!logX_ || (x > 0.0)) && (!logY_ || (y > 0.0));
+  }
+
+  NumericalScalar toDeviceX(const NumericalScalar x) const
+  {
+    return left_ + width_ * ((logX_ ? log10(x) : x) - xMin_) / (xMax_ - xMin_);
+  }
+
+  NumericalScalar toDeviceY(const NumericalScalar y) const
+  {
+    return top_ + height_ * (yMax_ - (logY_ ? log10(y) : y)) / (yMax_ - yMin_);
+  }
+
+  Bool contains(const NumericalScalar u,
+                const NumericalScalar v,
+                const NumericalScalar margin) const
+  {
+    return (u >= left_ - margin) && (u <= left_ + width_ + margin) && (v >= top_ - margin) && (v <= top_ + height_ + margin);
+  }
+}; /* end struct GraphRendererFrame */
+
+/*
+ * Abstract drawing device. Coordinates are given in the SVG convention:
+ * origin at the top-left corner, y axis pointing downward
+ */
+class GraphRendererDevice
+{
+public:
+  GraphRendererDevice(const NumericalScalar width,
+                      const NumericalScalar height)
+    : width_(width), height_(height), oss_()
+  {
+    oss_.imbue(std::locale::classic());
+    oss_ << std::fixed << std::setprecision(2);
+  }
+
+  virtual ~GraphRendererDevice() {}
+
+  /** Restrict the drawing to a rectangle */
+  virtual void pushClip(const NumericalScalar left,
+                        const NumericalScalar top,
+                        const NumericalScalar width,
+                        const NumericalScalar height) = 0;
+  virtual void popClip() = 0;
+
+  /** Draw an open polyline */
+  virtual void drawPolyline(const Coordinates & x,
+                            const Coordinates & y,
+                            const GraphRendererStyle & style) = 0;
+
+  /** Draw disconnected segments, given by pairs of consecutive points */
+  virtual void drawSegments(const Coordinates & x,
+                            const Coordinates & y,
+                            const GraphRendererStyle & style) = 0;
+
+  /** Draw a closed polygon */
+  virtual void drawPolygon(const Coordinates & x,
+                           const Coordinates & y,
+                           const GraphRendererStyle & style) = 0;
+
+  /** Draw a text, anchor being 0 for left, 1 for center and 2 for right alignment */
+  virtual void drawText(const NumericalScalar x,
+                        const NumericalScalar y,
+                        const String & text,
+                        const NumericalScalar fontSize,
+                        const UnsignedLong anchor,
+                        const Bool vertical,
+                        const NumericalPoint & color) = 0;
+
+  /** Return the document */
+  virtual String finish() = 0;
+
+  /** Draw a rectangle */
+  void drawRectangle(const NumericalScalar left,
+                     const NumericalScalar top,
+                     const NumericalScalar width,
+                     const NumericalScalar height,
+                     const GraphRendererStyle & style)
+  {
+    Coordinates x(4, left);
+    Coordinates y(4, top);
+    x[1] = left + width;
+    x[2] = left + width;
+    y[2] = top + height;
+    y[3] = top + height;
+    drawPolygon(x, y, style);
+  }
+
+  /** Draw a point symbol, using the R point style names */
+  void drawMarker(const NumericalScalar u,
+                  const NumericalScalar v,
+                  const String & pointStyle,
+                  const NumericalPoint & color,
+                  const NumericalScalar lineWidth)
+  {
+    const NumericalScalar r(3.5);
+    GraphRendererStyle outline;
+    outline.stroke_ = color;
+    outline.lineWidth_ = lineWidth;
+    GraphRendererStyle filled;
+    filled.fill_ = color;
+    const Bool isFilled((pointStyle.size() > 0) && (pointStyle[0] == 'f'));
+    const String shape(isFilled ? pointStyle.substr(1) : pointStyle);
+    if (pointStyle == "dot")
+      {
+        drawRectangle(u - 0.5, v - 0.5, 1.0, 1.0, filled);
+        return;
+      }
+    if ((pointStyle == "plus") || (pointStyle == "times") || (pointStyle == "star"))
+      {
+        Coordinates x(0);
+        Coordinates y(0);
+        if (pointStyle != "times")
+          {
+            x.push_back(u - r); y.push_back(v);
+            x.push_back(u + r); y.push_back(v);
+            x.push_back(u); y.push_back(v - r);
+            x.push_back(u); y.push_back(v + r);
+          }
+        if (pointStyle != "plus")
+          {
+            const NumericalScalar s(r / sqrt(2.0));
+            x.push_back(u - s); y.push_back(v - s);
+            x.push_back(u + s); y.push_back(v + s);
+            x.push_back(u - s); y.push_back(v + s);
+            x.push_back(u + s); y.push_back(v - s);
+          }
+        drawSegments(x, y, outline);
+        return;
+      }
+    Coordinates x(0);
+    Coordinates y(0);
+    if (shape == "square")
+      {
+        const NumericalScalar s(0.8 * r);
+        x.push_back(u - s); y.push_back(v - s);
+        x.push_back(u + s); y.push_back(v - s);
+        x.push_back(u + s); y.push_back(v + s);
+        x.push_back(u - s); y.push_back(v + s);
+      }
+    else if ((shape == "triangleup") || (shape == "triangledown"))
+      {
+        const NumericalScalar sign(shape == "triangleup" ? 1.0 : -1.0);
+        x.push_back(u); y.push_back(v - sign * r);
+        x.push_back(u + 0.866 * r); y.push_back(v + 0.5 * sign * r);
+        x.push_back(u - 0.866 * r); y.push_back(v + 0.5 * sign * r);
+      }
+    else if (shape == "diamond")
+      {
+        x.push_back(u); y.push_back(v - r);
+        x.push_back(u + r); y.push_back(v);
+        x.push_back(u); y.push_back(v + r);
+        x.push_back(u - r); y.push_back(v);
+      }
+    else
+      {
+        // circle, fcircle and bullet
+        const NumericalScalar radius(pointStyle == "bullet" ? 0.6 * r : r);
+        for (UnsignedLong k = 0; k < 16; ++k)
+          {
+            x.push_back(u + radius * cos(M_PI * k / 8.0));
+            y.push_back(v + radius * sin(M_PI * k / 8.0));
+          }
+      }
+    drawPolygon(x, y, (isFilled || (pointStyle == "bullet")) ? filled : outline);
+  }
+
+protected:
+  /** Write a color as a #RRGGBB code */
+  static String HexColor(const NumericalPoint & color)
+  {
+    return DrawableImplementation::ConvertFromRGB(static_cast<UnsignedLong>(color[0]), static_cast<UnsignedLong>(color[1]), static_cast<UnsignedLong>(color[2]));
+  }
+
+  NumericalScalar width_;
+  NumericalScalar height_;
+  std::ostringstream oss_;
+}; /* end class GraphRendererDevice */
+
+
+/* Scalable Vector Graphics device */
+class SVGRendererDevice : public GraphRendererDevice
+{
+public:
+  SVGRendererDevice(const NumericalScalar width,
+                    const NumericalScalar height)
+    : GraphRendererDevice(width, height), clipNumber_(0)
+  {
+    oss_ << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n"
+         << "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" width=\"" << width << "\" height=\"" << height
+         << "\" viewBox=\"0 0 " << width << " " << height << "\" font-family=\"Helvetica, Arial, sans-serif\">\n"
+         << "<rect x=\"0\" y=\"0\" width=\"" << width << "\" height=\"" << height << "\" fill=\"#ffffff\"/>\n";
+  }
+
+  void pushClip(const NumericalScalar left,
+                const NumericalScalar top,
+                const NumericalScalar width,
+                const NumericalScalar height)
+  {
+    oss_ << "<clipPath id=\"clip" << clipNumber_ << "\"><rect x=\"" << left << "\" y=\"" << top << "\" width=\"" << width << "\" height=\"" << height << "\"/></clipPath>\n"
+         << "<g clip-path=\"url(#clip" << clipNumber_ << ")\">\n";
+    ++clipNumber_;
+  }
+
+  void popClip()
+  {
+    oss_ << "</g>\n";
+  }
+
+  void drawPolyline(const Coordinates & x,
+                    const Coordinates & y,
+                    const GraphRendererStyle & style)
+  {
+    if ((x.size() < 2) || (style.stroke_.getDimension() == 0)) return;
+    oss_ << "<polyline points=\"";
+    writePoints(x, y);
+    oss_ << "\" fill=\"none\"";
+    writeStroke(style);
+    oss_ << "/>\n";
+  }
+
+  void drawSegments(const Coordinates & x,
+                    const Coordinates & y,
+                    const GraphRendererStyle & style)
+  {
+    if ((x.size() < 2) || (style.stroke_.getDimension() == 0)) return;
+    oss_ << "<path d=\"";
+    for (UnsignedLong i = 0; i + 1 < x.size(); i += 2)
+      oss_ << "M" << x[i] << " " << y[i] << "L" << x[i + 1] << " " << y[i + 1];
+    oss_ << "\" fill=\"none\"";
+    writeStroke(style);
+    oss_ << "/>\n";
+  }
+
+  void drawPolygon(const Coordinates & x,
+                   const Coordinates & y,
+                   const GraphRendererStyle & style)
+  {
+    if (x.size() < 2) return;
+    oss_ << "<polygon points=\"";
+    writePoints(x, y);
+    oss_ << "\"";
+    if (style.fill_.getDimension() == 0) oss_ << " fill=\"none\"";
+    else
+      {
+        oss_ << " fill=\"" << HexColor(style.fill_) << "\"";
+        if (style.fill_[3] < 255.0) oss_ << " fill-opacity=\"" << style.fill_[3] / 255.0 << "\"";
+      }
+    writeStroke(style);
+    oss_ << "/>\n";
+  }
+
+  void drawText(const NumericalScalar x,
+                const NumericalScalar y,
+                const String & text,
+                const NumericalScalar fontSize,
+                const UnsignedLong anchor,
+                const Bool vertical,
+                const NumericalPoint & color)
+  {
+    if (text.size() == 0) return;
+    static const char * Anchors[3] = {"start", "middle", "end"};
+    oss_ << "<text x=\"" << x << "\" y=\"" << y << "\" font-size=\"" << fontSize
+         << "\" text-anchor=\"" << Anchors[std::min(anchor, 2UL)] << "\" fill=\"" << HexColor(color) << "\"";
+    if (vertical) oss_ << " transform=\"rotate(-90 " << x << " " << y << ")\"";
+    oss_ << ">";
+    for (UnsignedLong i = 0; i < text.size(); ++i)
+      {
+        switch (text[i])
+          {
+          case '&':
+            oss_ << "&amp;";
+            break;
+          case '<':
+            oss_ << "&lt;";
+            break;
+          case '>':
+            oss_ << "&gt;";
+            break;
+          default:
+            oss_ << text[i];
+          }
+      }
+    oss_ << "</text>\n";
+  }
+
+  String finish()
+  {
+    oss_ << "</svg>\n";
+    return oss_.str();
+  }
+
+private:
+  void writePoints(const Coordinates & x,
+                   const Coordinates & y)
+  {
+    for (UnsignedLong i = 0; i < x.size(); ++i) oss_ << (i > 0 ? " " : "") << x[i] << "," << y[i];
+  }
+
+  void writeStroke(const GraphRendererStyle & style)
+  {
+    if (style.stroke_.getDimension() == 0) return;
+    oss_ << " stroke=\"" << HexColor(style.stroke_) << "\" stroke-width=\"" << style.lineWidth_ << "\"";
+    if (style.stroke_[3] < 255.0) oss_ << " stroke-opacity=\"" << style.stroke_[3] / 255.0 << "\"";
+    if (style.dash_.size() > 0)
+      {
+        oss_ << " stroke-dasharray=\"";
+        for (UnsignedLong i = 0; i < style.dash_.size(); ++i) oss_ << (i > 0 ? "," : "") << style.dash_[i];
+        oss_ << "\"";
+      }
+  }
+
+  UnsignedLong clipNumber_;
+}; /* end class SVGRendererDevice */
+
+
+/* Portable Document Format device, using the standard Helvetica font */
+class PDFRendererDevice : public GraphRendererDevice
+{
+public:
+  PDFRendererDevice(const NumericalScalar width,
+                    const NumericalScalar height)
+    : GraphRendererDevice(width, height)
+    , fillAlpha_(255)
+    , strokeAlpha_(255)
+    , savedAlphas_(0)
+    , fillAlphas_()
+    , strokeAlphas_()
+  {
+    // White background
+    oss_ << "1 1 1 rg 0 0 " << width << " " << height << " re f\n";
+  }
+
+  void pushClip(const NumericalScalar left,
+                const NumericalScalar top,
+                const NumericalScalar width,
+                const NumericalScalar height)
+  {
+    oss_ << "q " << left << " " << height_ - top - height << " " << width << " " << height << " re W n\n";
+    // The transparency is part of the graphics state saved by q and restored by Q
+    savedAlphas_.push_back(fillAlpha_);
+    savedAlphas_.push_back(strokeAlpha_);
+  }
+
+  void popClip()
+  {
+    oss_ << "Q\n";
+    strokeAlpha_ = savedAlphas_.back();
+    savedAlphas_.pop_back();
+    fillAlpha_ = savedAlphas_.back();
+    savedAlphas_.pop_back();
+  }
+
+  void drawPolyline(const Coordinates & x,
+                    const Coordinates & y,
+                    const GraphRendererStyle & style)
+  {
+    if ((x.size() < 2) || (style.stroke_.getDimension() == 0)) return;
+    writeStroke(style);
+    for (UnsignedLong i = 0; i < x.size(); ++i) oss_ << x[i] << " " << height_ - y[i] << (i == 0 ? " m\n" : " l\n");
+    oss_ << "S\n";
+  }
+
+  void drawSegments(const Coordinates & x,
+                    const Coordinates & y,
+                    const GraphRendererStyle & style)
+  {
+    if ((x.size() < 2) || (style.stroke_.getDimension() == 0)) return;
+    writeStroke(style);
+    for (UnsignedLong i = 0; i + 1 < x.size(); i += 2)
+      oss_ << x[i] << " " << height_ - y[i] << " m " << x[i + 1] << " " << height_ - y[i + 1] << " l\n";
+    oss_ << "S\n";
+  }
+
+  void drawPolygon(const Coordinates & x,
+                   const Coordinates & y,
+                   const GraphRendererStyle & style)
+  {
+    const Bool hasStroke(style.stroke_.getDimension() > 0);
+    const Bool hasFill(style.fill_.getDimension() > 0);
+    if ((x.size() < 2) || (!hasStroke && !hasFill)) return;
+    if (hasStroke) writeStroke(style);
+    if (hasFill) writeColor(style.fill_, "rg");
+    for (UnsignedLong i = 0; i < x.size(); ++i) oss_ << x[i] << " " << height_ - y[i] << (i == 0 ? " m\n" : " l\n");
+    oss_ << (hasStroke ? (hasFill ? "b\n" : "s\n") : "h f\n");
+  }
+
+  void drawText(const NumericalScalar x,
+                const NumericalScalar y,
+                const String & text,
+                const NumericalScalar fontSize,
+                const UnsignedLong anchor,
+                const Bool vertical,
+                const NumericalPoint & color)
+  {
+    if (text.size() == 0) return;
+    const NumericalScalar shift(0.5 * std::min(anchor, 2UL) * TextWidth(text, fontSize));
+    writeColor(color, "rg");
+    oss_ << "BT /F1 " << fontSize << " Tf ";
+    if (vertical) oss_ << "0 1 -1 0 " << x << " " << height_ - y - shift << " Tm (";
+    else oss_ << "1 0 0 1 " << x - shift << " " << height_ - y << " Tm (";
+    for (UnsignedLong i = 0; i < text.size(); ++i)
+      {
+        const char c(text[i]);
+        if ((c == '(') || (c == ')') || (c == '\\')) oss_ << '\\';
+        oss_ << c;
+      }
+    oss_ << ") Tj ET\n";
+  }
+
+  String finish()
+  {
+    const String content(oss_.str());
+    std::ostringstream pdf;
+    pdf.imbue(std::locale::classic());
+    pdf << std::fixed << std::setprecision(2);
+    std::vector<UnsignedLong> offsets(0);
+    pdf << "%PDF-1.4\n";
+    offsets.push_back(pdf.tellp());
+    pdf << "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n";
+    offsets.push_back(pdf.tellp());
+    pdf << "2 0 obj\n<< /Type /Pages /Kids [3 0 R] /Count 1 >>\nendobj\n";
+    offsets.push_back(pdf.tellp());
+    pdf << "3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 " << width_ << " " << height_ << "] "
+        << "/Resources << /Font << /F1 5 0 R >>";
+    // One graphics state per opacity level, /ca for filling and /CA for stroking
+    if (fillAlphas_.size() + strokeAlphas_.size() > 0)
+      {
+        pdf << " /ExtGState <<";
+        for (std::set<UnsignedLong>::const_iterator it = fillAlphas_.begin(); it != fillAlphas_.end(); ++it) pdf << " /Fa" << *it << " << /ca " << *it / 255.0 << " >>";
+        for (std::set<UnsignedLong>::const_iterator it = strokeAlphas_.begin(); it != strokeAlphas_.end(); ++it) pdf << " /Sa" << *it << " << /CA " << *it / 255.0 << " >>";
+        pdf << " >>";
+      }
+    pdf << " >> /Contents 4 0 R >>\nendobj\n";
+    offsets.push_back(pdf.tellp());
+    pdf << "4 0 obj\n<< /Length " << content.size() << " >>\nstream\n" << content << "endstream\nendobj\n";
+    offsets.push_back(pdf.tellp());
+    pdf << "5 0 obj\n<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica /Encoding /WinAnsiEncoding >>\nendobj\n";
+    const UnsignedLong xref(pdf.tellp());
+    pdf << "xref\n0 " << offsets.size() + 1 << "\n0000000000 65535 f \n";
+    for (UnsignedLong i = 0; i < offsets.size(); ++i) pdf << std::setw(10) << std::setfill('0') << offsets[i] << " 00000 n \n";
+    pdf << "trailer\n<< /Size " << offsets.size() + 1 << " /Root 1 0 R >>\nstartxref\n" << xref << "\n%%EOF\n";
+    return pdf.str();
+  }
+
+private:
+  void writeColor(const NumericalPoint & color,
+                  const String & op)
+  {
+    oss_ << color[0] / 255.0 << " " << color[1] / 255.0 << " " << color[2] / 255.0 << " " << op << "\n";
+    // Select the graphics state of the color opacity if it differs from the current one
+    const Bool isStroke(op == "RG");
+    const UnsignedLong alpha(static_cast<UnsignedLong>(std::min(255.0, std::max(0.0, color[3])) + 0.5));
+    UnsignedLong & currentAlpha(isStroke ? strokeAlpha_ : fillAlpha_);
+    if (alpha == currentAlpha) return;
+    (isStroke ? strokeAlphas_ : fillAlphas_).insert(alpha);
+    oss_ << (isStroke ? "/Sa" : "/Fa") << alpha << " gs\n";
+    currentAlpha = alpha;
+  }
+
+  void writeStroke(const GraphRendererStyle & style)
+  {
+    writeColor(style.stroke_, "RG");
+    oss_ << style.lineWidth_ << " w [";
+    for (UnsignedLong i = 0; i < style.dash_.size(); ++i) oss_ << (i > 0 ? " " : "") << style.dash_[i];
+    oss_ << "] 0 d\n";
+  }
+
+  /** Current opacities, in [0, 255] */
+  UnsignedLong fillAlpha_;
+  UnsignedLong strokeAlpha_;
+  /** Opacities saved by the clipping operations */
+  std::vector<UnsignedLong> savedAlphas_;
+  /** Opacities used in the document */
+  std::set<UnsignedLong> fillAlphas_;
+  std::set<UnsignedLong> strokeAlphas_;
+}; /* end class PDFRendererDevice */
+
+
+/* Keep only the points of a polyline needed at the device resolution: for each run of consecutive
+   points falling into the same pixel column, the first, lowest, highest and last points */
+static void DownsamplePolyline(Coordinates & x,
+                               Coordinates & y)
+{
+  const UnsignedLong size(x.size());
+  if (size <= ResourceMap::GetAsUnsignedLong("GraphRenderer-DownsamplingThreshold")) return;
+  Coordinates newX(0);
+  Coordinates newY(0);
+  UnsignedLong start(0);
+  while (start < size)
+    {
+      const NumericalScalar column(floor(x[start]));
+      UnsignedLong stop(start + 1);
+      UnsignedLong iMin(start);
+      UnsignedLong iMax(start);
+      while ((stop < size) && (floor(x[stop]) == column))
+        {
+          if (y[stop] < y[iMin]) iMin = stop;
+          if (y[stop] > y[iMax]) iMax = stop;
+          ++stop;
+        }
+      UnsignedLong kept[4] = {start, std::min(iMin, iMax), std::max(iMin, iMax), stop - 1};
+      for (UnsignedLong k = 0; k < 4; ++k)
+        if ((k == 0) || (kept[k] != kept[k - 1]))
+          {
+            newX.push_back(x[kept[k]]);
+            newY.push_back(y[kept[k]]);
+          }
+      start = stop;
+    }
+  x.swap(newX);
+  y.swap(newY);
+}
+
+/* Convert a sample into device polylines, splitting it where points cannot be represented */
+static void DrawSampleAsPolyline(GraphRendererDevice & device,
+                                 const GraphRendererFrame & frame,
+                                 const NumericalSample & data,
+                                 const GraphRendererStyle & style)
+{
+  const UnsignedLong size(data.getSize());
+  Coordinates x(0);
+  Coordinates y(0);
+  for (UnsignedLong i = 0; i <= size; ++i)
+    {
+      const Bool valid((i < size) && frame.isValid(data[i][0], data[i][1]));
+      if (valid)
+        {
+          x.push_back(frame.toDeviceX(data[i][0]));
+          y.push_back(frame.toDeviceY(data[i][1]));
+          continue;
+        }
+      DownsamplePolyline(x, y);
+      device.drawPolyline(x, y, style);
+      x.clear();
+      y.clear();
+    }
+}
+
+/* Draw the points of a sample, skipping the points hidden by another point drawn in the same cell.
+   The cells are one pixel wide for dots and two pixels wide for the larger markers */
+static void DrawSampleAsCloud(GraphRendererDevice & device,
+                              const GraphRendererFrame & frame,
+                              const NumericalSample & data,
+                              const UnsignedLong firstComponent,
+                              const UnsignedLong secondComponent,
+                              const String & pointStyle,
+                              const NumericalPoint & color,
+                              const NumericalScalar lineWidth)
+{
+  const UnsignedLong size(data.getSize());
+  const Bool downsample(size > ResourceMap::GetAsUnsignedLong("GraphRenderer-DownsamplingThreshold"));
+  const NumericalScalar margin(5.0);
+  const NumericalScalar cellSize(pointStyle == "dot" ? 1.0 : 2.0);
+  const UnsignedLong columns(static_cast<UnsignedLong>((frame.width_ + 2.0 * margin) / cellSize) + 1);
+  const UnsignedLong rows(static_cast<UnsignedLong>((frame.height_ + 2.0 * margin) / cellSize) + 1);
+  std::vector<bool> occupied(downsample ? columns * rows : 0, false);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      const NumericalScalar xi(data[i][firstComponent]);
+      const NumericalScalar yi(data[i][secondComponent]);
+      if (!frame.isValid(xi, yi)) continue;
+      const NumericalScalar u(frame.toDeviceX(xi));
+      const NumericalScalar v(frame.toDeviceY(yi));
+      if (!frame.contains(u, v, margin)) continue;
+      if (downsample)
+        {
+          const UnsignedLong cell(static_cast<UnsignedLong>((u - frame.left_ + margin) / cellSize) + columns * static_cast<UnsignedLong>((v - frame.top_ + margin) / cellSize));
+          if (occupied[cell]) continue;
+          occupied[cell] = true;
+        }
+      device.drawMarker(u, v, pointStyle, color, lineWidth);
+    }
+}
+
+
+/* Constructor with parameters */
+GraphRenderer::GraphRenderer(const GraphImplementation & graph,
+                             const NumericalScalar width,
+                             const NumericalScalar height)
+  : graph_(graph),
+    width_(width),
+    height_(height),
+    boundingBox_(graph.getBoundingBox())
+{
+  if ((width <= 0.0) || (height <= 0.0)) throw InvalidArgumentException(HERE) << "Error: the size of the rendered graph must be positive, here width=" << width << " and height=" << height;
+}
+
+/* SVG document of the graph */
+String GraphRenderer::toSVG() const
+{
+  SVGRendererDevice device(width_, height_);
+  render(device);
+  return device.finish();
+}
+
+/* PDF document of the graph */
+String GraphRenderer::toPDF() const
+{
+  PDFRendererDevice device(width_, height_);
+  render(device);
+  return device.finish();
+}
+
+/* Write the graph into the given file */
+void GraphRenderer::exportToFile(const FileName & fileName,
+                                 const Format format) const
+{
+  if (!IsNativeFormat(format)) throw NotYetImplementedException(HERE) << "Error: the native renderer only supports the SVG and PDF formats";
+  std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+  if (!file) throw FileOpenException(HERE) << "Error: cannot open file " << fileName << " for writing";
+  file << (format == GraphImplementation::SVG ? toSVG() : toPDF());
+  file.close();
+}
+
+/* Check if the given format can be rendered without R */
+Bool GraphRenderer::IsNativeFormat(const Format format)
+{
+  return (format == GraphImplementation::SVG) || (format == GraphImplementation::PDF);
+}
+
+/* Draw the whole graph on the given device */
+void GraphRenderer::render(GraphRendererDevice & device) const
+{
+  const NumericalScalar fontSize(ResourceMap::GetAsNumericalScalar("GraphRenderer-FontSize"));
+  const Bool showAxes(graph_.getAxes());
+  const String title(graph_.getTitle());
+  const NumericalPoint black(DrawableImplementation::ConvertToRGBA("black"));
+  // The plotting region, with margins similar to the R ones
+  GraphRendererFrame frame;
+  frame.left_ = (showAxes ? 5.0 : 1.0) * fontSize;
+  frame.top_ = (title.size() > 0 ? 3.5 : 1.0) * fontSize;
+  frame.width_ = std::max(1.0, width_ - frame.left_ - fontSize);
+  frame.height_ = std::max(1.0, height_ - frame.top_ - (showAxes ? 4.0 : 1.0) * fontSize);
+  const GraphImplementation::LogScale logScale(graph_.getLogScale());
+  frame.logX_ = (logScale == GraphImplementation::LOGX) || (logScale == GraphImplementation::LOGXY);
+  frame.logY_ = (logScale == GraphImplementation::LOGY) || (logScale == GraphImplementation::LOGXY);
+  if ((frame.logX_ && (boundingBox_[0] <= 0.0)) || (frame.logY_ && (boundingBox_[2] <= 0.0))) throw InvalidArgumentException(HERE) << "Error: cannot use a logarithmic scale with the non-positive bounding box=" << boundingBox_;
+  frame.xMin_ = frame.logX_ ? log10(boundingBox_[0]) : boundingBox_[0];
+  frame.xMax_ = frame.logX_ ? log10(boundingBox_[1]) : boundingBox_[1];
+  frame.yMin_ = frame.logY_ ? log10(boundingBox_[2]) : boundingBox_[2];
+  frame.yMax_ = frame.logY_ ? log10(boundingBox_[3]) : boundingBox_[3];
+  if (!(frame.xMax_ > frame.xMin_))
+    {
+      frame.xMin_ -= 0.5;
+      frame.xMax_ += 0.5;
+    }
+  if (!(frame.yMax_ > frame.yMin_))
+    {
+      frame.yMin_ -= 0.5;
+      frame.yMax_ += 0.5;
+    }
+  // Extend the ranges by 4% as R does
+  const NumericalScalar deltaX(0.04 * (frame.xMax_ - frame.xMin_));
+  const NumericalScalar deltaY(0.04 * (frame.yMax_ - frame.yMin_));
+  frame.xMin_ -= deltaX;
+  frame.xMax_ += deltaX;
+  frame.yMin_ -= deltaY;
+  frame.yMax_ += deltaY;
+
+  device.drawText(0.5 * width_, 2.0 * fontSize, title, 1.5 * fontSize, 1, false, black);
+  const Graph::DrawableCollection drawables(graph_.getDrawables());
+  // A scatter plot matrix uses the whole plotting region
+  for (UnsignedLong i = 0; i < drawables.getSize(); ++i)
+    if (drawables[i].getImplementation()->getClassName() == "Pairs")
+      {
+        renderPairs(device, frame, drawables[i]);
+        return;
+      }
+  renderAxes(device, frame);
+  device.pushClip(frame.left_, frame.top_, frame.width_, frame.height_);
+  for (UnsignedLong i = 0; i < drawables.getSize(); ++i)
+    if (drawables[i].getData().getSize() > 0) renderDrawable(device, frame, drawables[i]);
+  device.popClip();
+  if (graph_.getLegendPosition().size() > 0) renderLegend(device, frame);
+}
+
+/* Draw the axes, the ticks and the grid of a frame */
+void GraphRenderer::renderAxes(GraphRendererDevice & device,
+                               const GraphRendererFrame & frame) const
+{
+  const NumericalScalar fontSize(ResourceMap::GetAsNumericalScalar("GraphRenderer-FontSize"));
+  const NumericalPoint black(DrawableImplementation::ConvertToRGBA("black"));
+  const Bool showAxes(graph_.getAxes());
+  const Bool showGrid(graph_.getGrid());
+  if (!showAxes && !showGrid) return;
+  Coordinates gridX(0);
+  Coordinates gridY(0);
+  Coordinates tickX(0);
+  Coordinates tickY(0);
+  for (UnsignedLong axis = 0; axis < 2; ++axis)
+    {
+      const Bool isLog(axis == 0 ? frame.logX_ : frame.logY_);
+      const NumericalScalar a(axis == 0 ? frame.xMin_ : frame.yMin_);
+      const NumericalScalar b(axis == 0 ? frame.xMax_ : frame.yMax_);
+      // Tick values are computed in the data space
+      Coordinates ticks(0);
+      NumericalScalar step(0.0);
+      if (isLog && (b - a >= 1.0))
+        {
+          for (NumericalScalar k = ceil(a); k <= b; k += 1.0) ticks.push_back(pow(10.0, k));
+          step = ticks[0];
+        }
+      else if (isLog) ticks = PrettyTicks(pow(10.0, a), pow(10.0, b), step);
+      else ticks = PrettyTicks(a, b, step);
+      for (UnsignedLong i = 0; i < ticks.size(); ++i)
+        {
+          const String label(FormatTick(ticks[i], isLog ? ticks[i] : step));
+          if (axis == 0)
+            {
+              const NumericalScalar u(frame.toDeviceX(ticks[i]));
+              gridX.push_back(u); gridY.push_back(frame.top_);
+              gridX.push_back(u); gridY.push_back(frame.top_ + frame.height_);
+              tickX.push_back(u); tickY.push_back(frame.top_ + frame.height_);
+              tickX.push_back(u); tickY.push_back(frame.top_ + frame.height_ + 0.5 * fontSize);
+              if (showAxes) device.drawText(u, frame.top_ + frame.height_ + 1.6 * fontSize, label, fontSize, 1, false, black);
+            }
+          else
+            {
+              const NumericalScalar v(frame.toDeviceY(ticks[i]));
+              gridX.push_back(frame.left_); gridY.push_back(v);
+              gridX.push_back(frame.left_ + frame.width_); gridY.push_back(v);
+              tickX.push_back(frame.left_); tickY.push_back(v);
+              tickX.push_back(frame.left_ - 0.5 * fontSize); tickY.push_back(v);
+              if (showAxes) device.drawText(frame.left_ - 0.8 * fontSize, v + 0.35 * fontSize, label, fontSize, 2, false, black);
+            }
+        }
+    }
+  if (showGrid) device.drawSegments(gridX, gridY, GraphRendererStyle(graph_.getGridColor(), 1.0, "dotted"));
+  if (!showAxes) return;
+  device.drawSegments(tickX, tickY, GraphRendererStyle("black", 1.0));
+  device.drawRectangle(frame.left_, frame.top_, frame.width_, frame.height_, GraphRendererStyle("black", 1.0));
+  device.drawText(frame.left_ + 0.5 * frame.width_, frame.top_ + frame.height_ + 3.2 * fontSize, graph_.getXTitle(), fontSize, 1, false, black);
+  device.drawText(1.2 * fontSize, frame.top_ + 0.5 * frame.height_, graph_.getYTitle(), fontSize, 1, true, black);
+}
+
+/* Draw one drawable within a frame */
+void GraphRenderer::renderDrawable(GraphRendererDevice & device,
+                                   const GraphRendererFrame & frame,
+                                   const Drawable & drawable) const
+{
+  const String kind(drawable.getImplementation()->getClassName());
+  const NumericalSample data(drawable.getData());
+  const UnsignedLong size(data.getSize());
+  const NumericalScalar lineWidth(drawable.getLineWidth());
+  const NumericalPoint black(DrawableImplementation::ConvertToRGBA("black"));
+  if (kind == "Curve")
+    {
+      DrawSampleAsPolyline(device, frame, data, GraphRendererStyle(drawable.getColor(), lineWidth, drawable.getLineStyle()));
+      if (drawable.getImplementation()->getShowPoints())
+        DrawSampleAsCloud(device, frame, data, 0, 1, drawable.getPointStyle(), DrawableImplementation::ConvertToRGBA(drawable.getColor()), lineWidth);
+      return;
+    }
+  if (kind == "Cloud")
+    {
+      DrawSampleAsCloud(device, frame, data, 0, 1, drawable.getPointStyle(), DrawableImplementation::ConvertToRGBA(drawable.getColor()), lineWidth);
+      return;
+    }
+  if (kind == "Staircase")
+    {
+      // "s" goes horizontally first, "S" goes vertically first
+      const Bool horizontalFirst(drawable.getPattern() == "s");
+      NumericalSample steps(size > 0 ? 2 * size - 1 : 0, 2);
+      for (UnsignedLong i = 0; i < size; ++i)
+        {
+          steps[2 * i] = data[i];
+          if (i + 1 < size)
+            {
+              steps[2 * i + 1][0] = horizontalFirst ? data[i + 1][0] : data[i][0];
+              steps[2 * i + 1][1] = horizontalFirst ? data[i][1] : data[i + 1][1];
+            }
+        }
+      DrawSampleAsPolyline(device, frame, steps, GraphRendererStyle(drawable.getColor(), lineWidth, drawable.getLineStyle()));
+      return;
+    }
+  if (kind == "BarPlot")
+    {
+      GraphRendererStyle style("black", lineWidth, drawable.getLineStyle());
+      style.fill_ = DrawableImplementation::ConvertToRGBA(drawable.getColor());
+      if (drawable.getFillStyle() == "shaded") style.fill_[3] = 0.35 * style.fill_[3];
+      NumericalScalar x0(drawable.getOrigin());
+      for (UnsignedLong i = 0; i < size; ++i)
+        {
+          const NumericalScalar x1(x0 + data[i][0]);
+          if (frame.isValid(x0, 1.0) && frame.isValid(x1, data[i][1]) && frame.isValid(1.0, 0.0))
+            {
+              const NumericalScalar u0(frame.toDeviceX(x0));
+              const NumericalScalar v0(frame.toDeviceY(0.0));
+              const NumericalScalar u1(frame.toDeviceX(x1));
+              const NumericalScalar v1(frame.toDeviceY(data[i][1]));
+              device.drawRectangle(std::min(u0, u1), std::min(v0, v1), std::abs(u1 - u0), std::abs(v1 - v0), style);
+            }
+          x0 = x1;
+        }
+      return;
+    }
+  if (kind == "Pie")
+    {
+      const NumericalPoint center(drawable.getCenter());
+      const NumericalScalar radius(drawable.getRadius());
+      const Description labels(drawable.getLabels());
+      const Description palette(drawable.getPalette());
+      const NumericalScalar fontSize(ResourceMap::GetAsNumericalScalar("GraphRenderer-FontSize"));
+      NumericalScalar total(0.0);
+      NumericalScalar maximum(0.0);
+      for (UnsignedLong i = 0; i < size; ++i)
+        {
+          total += data[i][0];
+          maximum = std::max(maximum, data[i][0]);
+        }
+      // Pie checks its data, but a null or non finite total would give meaningless angles: draw a bare circle
+      if (!(total > 0.0) || !(total <= SpecFunc::MaxNumericalScalar))
+        {
+          Coordinates x(0);
+          Coordinates y(0);
+          for (UnsignedLong k = 0; k < 360; ++k)
+            {
+              x.push_back(frame.toDeviceX(center[0] + radius * cos(M_PI * k / 180.0)));
+              y.push_back(frame.toDeviceY(center[1] + radius * sin(M_PI * k / 180.0)));
+            }
+          device.drawPolygon(x, y, GraphRendererStyle("black", 1.0));
+          return;
+        }
+      const NumericalScalar labelThreshold(maximum * ResourceMap::GetAsNumericalScalar("Pie-LabelThreshold"));
+      NumericalScalar cumulated(0.0);
+      for (UnsignedLong i = 0; i < size; ++i)
+        {
+          const NumericalScalar theta0(2.0 * M_PI * cumulated / total);
+          cumulated += data[i][0];
+          const NumericalScalar theta1(2.0 * M_PI * cumulated / total);
+          // Approximate the arc with one vertex every degree at most
+          const UnsignedLong vertices(static_cast<UnsignedLong>(ceil((theta1 - theta0) * 180.0 / M_PI)) + 1);
+          Coordinates x(1, frame.toDeviceX(center[0]));
+          Coordinates y(1, frame.toDeviceY(center[1]));
+          for (UnsignedLong k = 0; k <= vertices; ++k)
+            {
+              const NumericalScalar theta(theta0 + (theta1 - theta0) * k / vertices);
+              x.push_back(frame.toDeviceX(center[0] + radius * cos(theta)));
+              y.push_back(frame.toDeviceY(center[1] + radius * sin(theta)));
+            }
+          GraphRendererStyle style("black", 1.0);
+          style.fill_ = DrawableImplementation::ConvertToRGBA(palette.getSize() > 0 ? palette[i % palette.getSize()] : String("white"));
+          device.drawPolygon(x, y, style);
+          if ((i < labels.getSize()) && (data[i][0] >= labelThreshold))
+            {
+              const NumericalScalar theta(0.5 * (theta0 + theta1));
+              Coordinates tickX(2);
+              Coordinates tickY(2);
+              tickX[0] = frame.toDeviceX(center[0] + radius * cos(theta));
+              tickY[0] = frame.toDeviceY(center[1] + radius * sin(theta));
+              tickX[1] = frame.toDeviceX(center[0] + 1.05 * radius * cos(theta));
+              tickY[1] = frame.toDeviceY(center[1] + 1.05 * radius * sin(theta));
+              device.drawSegments(tickX, tickY, style);
+              device.drawText(frame.toDeviceX(center[0] + 1.1 * radius * cos(theta)), frame.toDeviceY(center[1] + 1.1 * radius * sin(theta)) + 0.35 * fontSize, labels[i], fontSize, cos(theta) >= 0.0 ? 0 : 2, false, black);
+            }
+        }
+      return;
+    }
+  if (kind == "Contour")
+    {
+      const NumericalSample gridX(drawable.getX());
+      const NumericalSample gridY(drawable.getY());
+      const NumericalPoint levels(drawable.getLevels());
+      const Description labels(drawable.getLabels());
+      const Bool drawLabels(drawable.getDrawLabels());
+      const UnsignedLong nX(gridX.getSize());
+      const UnsignedLong nY(gridY.getSize());
+      const GraphRendererStyle style(drawable.getColor(), lineWidth, drawable.getLineStyle());
+      const NumericalScalar fontSize(0.7 * ResourceMap::GetAsNumericalScalar("GraphRenderer-FontSize"));
+      // Marching squares, the values being stored with the x index running fastest
+      for (UnsignedLong l = 0; l < levels.getDimension(); ++l)
+        {
+          const NumericalScalar level(levels[l]);
+          Coordinates segmentX(0);
+          Coordinates segmentY(0);
+          for (UnsignedLong j = 0; j + 1 < nY; ++j)
+            for (UnsignedLong i = 0; i + 1 < nX; ++i)
+              {
+                // Corners in counterclockwise order, starting from (x_i, y_j)
+                const NumericalScalar cx[4] = {gridX[i][0], gridX[i + 1][0], gridX[i + 1][0], gridX[i][0]};
+                const NumericalScalar cy[4] = {gridY[j][0], gridY[j][0], gridY[j + 1][0], gridY[j + 1][0]};
+                const NumericalScalar cz[4] = {data[i + j * nX][0], data[i + 1 + j * nX][0], data[i + 1 + (j + 1) * nX][0], data[i + (j + 1) * nX][0]};
+                // Crossing points on the four edges
+                NumericalScalar px[4];
+                NumericalScalar py[4];
+                Bool crossed[4];
+                UnsignedLong crossings(0);
+                for (UnsignedLong e = 0; e < 4; ++e)
+                  {
+                    const UnsignedLong f((e + 1) % 4);
+                    crossed[e] = ((cz[e] < level) != (cz[f] < level));
+                    if (!crossed[e]) continue;
+                    const NumericalScalar t((level - cz[e]) / (cz[f] - cz[e]));
+                    px[e] = cx[e] + t * (cx[f] - cx[e]);
+                    py[e] = cy[e] + t * (cy[f] - cy[e]);
+                    ++crossings;
+                  }
+                if (crossings == 2)
+                  {
+                    for (UnsignedLong e = 0; e < 4; ++e)
+                      if (crossed[e] && frame.isValid(px[e], py[e]))
+                        {
+                          segmentX.push_back(frame.toDeviceX(px[e]));
+                          segmentY.push_back(frame.toDeviceY(py[e]));
+                        }
+                    if (segmentX.size() % 2 == 1)
+                      {
+                        segmentX.pop_back();
+                        segmentY.pop_back();
+                      }
+                  }
+                else if (crossings == 4)
+                  {
+                    // Saddle point: the mean value decides how the edges are connected
+                    const Bool centerBelow(0.25 * (cz[0] + cz[1] + cz[2] + cz[3]) < level);
+                    const Bool firstBelow(cz[0] < level);
+                    const UnsignedLong pairs[2][4] = {{0, 3, 1, 2}, {0, 1, 2, 3}};
+                    const UnsignedLong * edges(pairs[centerBelow == firstBelow ? 1 : 0]);
+                    for (UnsignedLong e = 0; e < 4; ++e)
+                      {
+                        segmentX.push_back(frame.toDeviceX(px[edges[e]]));
+                        segmentY.push_back(frame.toDeviceY(py[edges[e]]));
+                      }
+                  }
+              } // i, j
+          device.drawSegments(segmentX, segmentY, style);
+          if (drawLabels && (l < labels.getSize()) && (segmentX.size() > 0))
+            {
+              const UnsignedLong middle(2 * (segmentX.size() / 4));
+              device.drawText(0.5 * (segmentX[middle] + segmentX[middle + 1]), 0.5 * (segmentY[middle] + segmentY[middle + 1]), labels[l], fontSize, 1, false, style.stroke_.getDimension() > 0 ? style.stroke_ : black);
+            }
+        } // l
+      return;
+    }
+  LOGWARN(OSS() << "GraphRenderer: drawables of class " << kind << " cannot be rendered natively, skipped");
+}
+
+/* Draw a scatter plot matrix over the whole plotting region */
+void GraphRenderer::renderPairs(GraphRendererDevice & device,
+                                const GraphRendererFrame & frame,
+                                const Drawable & drawable) const
+{
+  const NumericalSample data(drawable.getData());
+  const Description labels(drawable.getLabels());
+  const UnsignedLong dimension(data.getDimension());
+  const NumericalPoint minimum(data.getMin());
+  const NumericalPoint maximum(data.getMax());
+  const NumericalPoint color(DrawableImplementation::ConvertToRGBA(drawable.getColor()));
+  const NumericalPoint black(DrawableImplementation::ConvertToRGBA("black"));
+  const NumericalScalar fontSize(ResourceMap::GetAsNumericalScalar("GraphRenderer-FontSize"));
+  const NumericalScalar gap(0.25 * fontSize);
+  const NumericalScalar panelWidth((frame.width_ - (dimension - 1) * gap) / dimension);
+  const NumericalScalar panelHeight((frame.height_ - (dimension - 1) * gap) / dimension);
+  for (UnsignedLong i = 0; i < dimension; ++i)
+    for (UnsignedLong j = 0; j < dimension; ++j)
+      {
+        GraphRendererFrame panel;
+        panel.left_ = frame.left_ + j * (panelWidth + gap);
+        panel.top_ = frame.top_ + i * (panelHeight + gap);
+        panel.width_ = panelWidth;
+        panel.height_ = panelHeight;
+        panel.logX_ = false;
+        panel.logY_ = false;
+        const NumericalScalar deltaX(std::max(0.04 * (maximum[j] - minimum[j]), SpecFunc::NumericalScalarEpsilon));
+        const NumericalScalar deltaY(std::max(0.04 * (maximum[i] - minimum[i]), SpecFunc::NumericalScalarEpsilon));
+        panel.xMin_ = minimum[j] - deltaX;
+        panel.xMax_ = maximum[j] + deltaX;
+        panel.yMin_ = minimum[i] - deltaY;
+        panel.yMax_ = maximum[i] + deltaY;
+        device.drawRectangle(panel.left_, panel.top_, panel.width_, panel.height_, GraphRendererStyle("black", 1.0));
+        if (i == j)
+          {
+            device.drawText(panel.left_ + 0.5 * panel.width_, panel.top_ + 0.5 * panel.height_ + 0.35 * fontSize, i < labels.getSize() ? labels[i] : String(""), 1.5 * fontSize, 1, false, black);
+            continue;
+          }
+        device.pushClip(panel.left_, panel.top_, panel.width_, panel.height_);
+        DrawSampleAsCloud(device, panel, data, j, i, drawable.getPointStyle(), color, drawable.getLineWidth());
+        device.popClip();
+      }
+}
+
+/* Draw the legend */
+void GraphRenderer::renderLegend(GraphRendererDevice & device,
+                                 const GraphRendererFrame & frame) const
+{
+  const Graph::DrawableCollection drawables(graph_.getDrawables());
+  const NumericalScalar fontSize(graph_.getLegendFontSize() * ResourceMap::GetAsNumericalScalar("GraphRenderer-FontSize"));
+  const NumericalPoint black(DrawableImplementation::ConvertToRGBA("black"));
+  Collection<UnsignedLong> entries(0);
+  NumericalScalar textWidth(0.0);
+  for (UnsignedLong i = 0; i < drawables.getSize(); ++i)
+    if (drawables[i].getLegendName().size() > 0)
+      {
+        entries.add(i);
+        textWidth = std::max(textWidth, TextWidth(drawables[i].getLegendName(), fontSize));
+      }
+  if (entries.getSize() == 0) return;
+  const NumericalScalar lineHeight(1.4 * fontSize);
+  const NumericalScalar symbolWidth(2.5 * fontSize);
+  const NumericalScalar boxWidth(symbolWidth + textWidth + 1.5 * fontSize);
+  const NumericalScalar boxHeight(entries.getSize() * lineHeight + 0.6 * fontSize);
+  const String position(graph_.getLegendPosition());
+  NumericalScalar left(frame.left_ + 0.5 * (frame.width_ - boxWidth));
+  NumericalScalar top(frame.top_ + 0.5 * (frame.height_ - boxHeight));
+  if (position.find("left") != String::npos) left = frame.left_;
+  if (position.find("right") != String::npos) left = frame.left_ + frame.width_ - boxWidth;
+  if (position.find("top") == 0) top = frame.top_;
+  if (position.find("bottom") == 0) top = frame.top_ + frame.height_ - boxHeight;
+  GraphRendererStyle boxStyle("black", 1.0);
+  boxStyle.fill_ = DrawableImplementation::ConvertToRGBA("grey90");
+  device.drawRectangle(left, top, boxWidth, boxHeight, boxStyle);
+  for (UnsignedLong k = 0; k < entries.getSize(); ++k)
+    {
+      const Drawable & drawable(drawables[entries[k]]);
+      const String kind(drawable.getImplementation()->getClassName());
+      const NumericalScalar v(top + 0.3 * fontSize + (k + 0.5) * lineHeight);
+      const NumericalScalar u0(left + 0.5 * fontSize);
+      const NumericalScalar u1(u0 + symbolWidth - 0.5 * fontSize);
+      const String color((kind == "Pie") && (drawable.getPalette().getSize() > 0) ? drawable.getPalette()[0] : drawable.getColor());
+      if ((kind == "BarPlot") || (kind == "Pie"))
+        {
+          GraphRendererStyle style("black", 1.0);
+          style.fill_ = DrawableImplementation::ConvertToRGBA(color);
+          device.drawRectangle(0.5 * (u0 + u1) - 0.4 * fontSize, v - 0.4 * fontSize, 0.8 * fontSize, 0.8 * fontSize, style);
+        }
+      else if (kind == "Cloud")
+        device.drawMarker(0.5 * (u0 + u1), v, drawable.getPointStyle(), DrawableImplementation::ConvertToRGBA(color), drawable.getLineWidth());
+      else
+        {
+          Coordinates x(2, u0);
+          Coordinates y(2, v);
+          x[1] = u1;
+          device.drawPolyline(x, y, GraphRendererStyle(color, drawable.getLineWidth(), drawable.getLineStyle()));
+          if ((kind == "Curve") && drawable.getImplementation()->getShowPoints())
+            device.drawMarker(0.5 * (u0 + u1), v, drawable.getPointStyle(), DrawableImplementation::ConvertToRGBA(color), drawable.getLineWidth());
+        }
+      device.drawText(left + symbolWidth + 0.5 * fontSize, v + 0.35 * fontSize, drawable.getLegendName(), fontSize, 0, false, black);
+    }
+}
+
+
+/* Functor rendering a range of graphs */
+struct GraphRendererFunctor
+{
+  const std::vector<GraphRenderer> & renderers_;
+  const Description & fileNames_;
+  const GraphRenderer::Format format_;
+
+  GraphRendererFunctor(const std::vector<GraphRenderer> & renderers,
+                       const Description & fileNames,
+                       const GraphRenderer::Format format)
+    : renderers_(renderers), fileNames_(fileNames), format_(format) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    for (UnsignedLong i = r.begin(); i != r.end(); ++i) renderers_[i].exportToFile(fileNames_[i], format_);
+  }
+}; /* end struct GraphRendererFunctor */
+
+/* Render a collection of graphs into the given files, in parallel */
+void GraphRenderer::DrawGraphs(const GraphCollection & graphs,
+                               const Description & fileNames,
+                               const NumericalScalar width,
+                               const NumericalScalar height,
+                               const Format format)
+{
+  const UnsignedLong size(graphs.getSize());
+  if (fileNames.getSize() != size) throw InvalidArgumentException(HERE) << "Error: expected " << size << " file names, got " << fileNames.getSize();
+  if (!IsNativeFormat(format)) throw NotYetImplementedException(HERE) << "Error: the native renderer only supports the SVG and PDF formats";
+  // Initialize the shared static data before going parallel
+  DrawableImplementation::GetValidColors();
+  // The bounding boxes are computed sequentially as they are cached in the graphs
+  std::vector<GraphRenderer> renderers;
+  for (UnsignedLong i = 0; i < size; ++i) renderers.push_back(GraphRenderer(*graphs[i].getImplementation(), width, height));
+  const GraphRendererFunctor functor(renderers, fileNames, format);
+  TBB::ParallelFor(0, size, functor);
+}
+
+END_NAMESPACE_OPENTURNS
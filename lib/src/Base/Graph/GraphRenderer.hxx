@@ -0,0 +1,111 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  GraphRenderer.hxx
+ *  @brief GraphRenderer renders graphs natively, without any call to R
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-04-18 17:56:46 +0200 (Wed, 18 Apr 2012)
+ */
+#ifndef OPENTURNS_GRAPHRENDERER_HXX
+#define OPENTURNS_GRAPHRENDERER_HXX
+
+#include "Graph.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+class GraphRendererDevice;
+struct GraphRendererFrame;
+
+/**
+ * @class GraphRenderer
+ *
+ * GraphRenderer draws the drawables of a graph directly into SVG or PDF
+ * documents. Large curves and clouds are downsampled to the device
+ * resolution before being rendered. The rendering does not modify the
+ * graph, so several graphs can be rendered concurrently.
+ */
+class GraphRenderer
+{
+public:
+
+  typedef Graph::GraphCollection GraphCollection;
+  typedef GraphImplementation::Format Format;
+
+  /** Constructor with parameters */
+  GraphRenderer(const GraphImplementation & graph,
+                const NumericalScalar width = ResourceMap::GetAsUnsignedLong("GraphImplementation-DefaultWidth"),
+                const NumericalScalar height = ResourceMap::GetAsUnsignedLong("GraphImplementation-DefaultHeight"));
+
+  /** SVG document of the graph */
+  String toSVG() const;
+
+  /** PDF document of the graph */
+  String toPDF() const;
+
+  /** Write the graph into the given file using the given format, either SVG or PDF */
+  void exportToFile(const FileName & fileName,
+                    const Format format) const;
+
+  /** Check if the given format can be rendered without R */
+  static Bool IsNativeFormat(const Format format);
+
+  /** Render a collection of graphs into the given files, in parallel */
+  static void DrawGraphs(const GraphCollection & graphs,
+                         const Description & fileNames,
+                         const NumericalScalar width = ResourceMap::GetAsUnsignedLong("GraphImplementation-DefaultWidth"),
+                         const NumericalScalar height = ResourceMap::GetAsUnsignedLong("GraphImplementation-DefaultHeight"),
+                         const Format format = GraphImplementation::SVG);
+
+private:
+
+  /** Draw the whole graph on the given device */
+  void render(GraphRendererDevice & device) const;
+
+  /** Draw the axes, the ticks and the grid of a frame */
+  void renderAxes(GraphRendererDevice & device,
+                  const GraphRendererFrame & frame) const;
+
+  /** Draw one drawable within a frame */
+  void renderDrawable(GraphRendererDevice & device,
+                      const GraphRendererFrame & frame,
+                      const Drawable & drawable) const;
+
+  /** Draw a scatter plot matrix over the whole plotting region */
+  void renderPairs(GraphRendererDevice & device,
+                   const GraphRendererFrame & frame,
+                   const Drawable & drawable) const;
+
+  /** Draw the legend */
+  void renderLegend(GraphRendererDevice & device,
+                    const GraphRendererFrame & frame) const;
+
+  /** The graph to be rendered */
+  const GraphImplementation & graph_;
+
+  /** Size of the document, in pixels for SVG and in points for PDF */
+  NumericalScalar width_;
+  NumericalScalar height_;
+
+  /** Bounding box of the graph, computed once as the graph caches it */
+  GraphImplementation::BoundingBox boundingBox_;
+
+}; /* class GraphRenderer */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_GRAPHRENDERER_HXX */
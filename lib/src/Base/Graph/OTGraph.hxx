@@ -34,6 +34,7 @@
 #include "DrawableImplementation.hxx"
 #include "Graph.hxx"
 #include "GraphImplementation.hxx"
+#include "GraphRenderer.hxx"
 #include "Pairs.hxx"
 #include "Pie.hxx"
 #include "Rfunctions.hxx"
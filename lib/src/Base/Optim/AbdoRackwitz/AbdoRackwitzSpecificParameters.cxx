@@ -41,7 +41,8 @@ AbdoRackwitzSpecificParameters::AbdoRackwitzSpecificParameters()
   : PersistentObject(),
     tau_(ResourceMap::GetAsNumericalScalar( "AbdoRackwitz-DefaultTau" )),
     omega_(ResourceMap::GetAsNumericalScalar( "AbdoRackwitz-DefaultOmega" )),
-    smooth_(ResourceMap::GetAsNumericalScalar( "AbdoRackwitz-DefaultSmooth" ))
+    smooth_(ResourceMap::GetAsNumericalScalar( "AbdoRackwitz-DefaultSmooth" )),
+    lineSearchBlockSize_(ResourceMap::GetAsUnsignedLong( "AbdoRackwitz-DefaultLineSearchBlockSize" ))
 {
   // Nothing to do
 }
@@ -54,7 +55,8 @@ AbdoRackwitzSpecificParameters::AbdoRackwitzSpecificParameters(const NumericalSc
   : PersistentObject(),
     tau_(tau),
     omega_(omega),
-    smooth_(smooth)
+    smooth_(smooth),
+    lineSearchBlockSize_(ResourceMap::GetAsUnsignedLong( "AbdoRackwitz-DefaultLineSearchBlockSize" ))
 {
   // Nothing to do
 }
@@ -102,6 +104,19 @@ void AbdoRackwitzSpecificParameters::setSmooth(const NumericalScalar smooth)
   smooth_ = smooth;
 }
 
+/* Line search block size accessor */
+UnsignedLong AbdoRackwitzSpecificParameters::getLineSearchBlockSize() const
+{
+  return lineSearchBlockSize_;
+}
+
+/* Line search block size accessor */
+void AbdoRackwitzSpecificParameters::setLineSearchBlockSize(const UnsignedLong lineSearchBlockSize)
+{
+  if (lineSearchBlockSize == 0) throw InvalidArgumentException(HERE) << "Error: the line search block size must be positive.";
+  lineSearchBlockSize_ = lineSearchBlockSize;
+}
+
 /* String converter */
 String AbdoRackwitzSpecificParameters::__repr__() const
 {
@@ -109,7 +124,8 @@ String AbdoRackwitzSpecificParameters::__repr__() const
   oss << "class=" << AbdoRackwitzSpecificParameters::GetClassName()
       << " tau=" << tau_
       << " omega=" << omega_
-      << " smooth=" << smooth_;
+      << " smooth=" << smooth_
+      << " lineSearchBlockSize=" << lineSearchBlockSize_;
   return oss;
 }
 
@@ -120,6 +136,7 @@ void AbdoRackwitzSpecificParameters::save(Advocate & adv) const
   adv.saveAttribute("tau_", tau_);
   adv.saveAttribute("omega_", omega_);
   adv.saveAttribute("smooth_", smooth_);
+  adv.saveAttribute("lineSearchBlockSize_", lineSearchBlockSize_);
 }
 
 /* Method load() reloads the object from the StorageManager */
@@ -129,6 +146,7 @@ void AbdoRackwitzSpecificParameters::load(Advocate & adv)
   adv.loadAttribute("tau_", tau_);
   adv.loadAttribute("omega_", omega_);
   adv.loadAttribute("smooth_", smooth_);
+  adv.loadAttribute("lineSearchBlockSize_", lineSearchBlockSize_);
 }
 
 END_NAMESPACE_OPENTURNS
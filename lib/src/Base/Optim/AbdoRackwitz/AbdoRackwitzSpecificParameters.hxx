@@ -71,6 +71,12 @@ public:
   /** Smooth accessor */
   void setSmooth(const NumericalScalar tau);
 
+  /** Line search block size accessor: number of step lengths evaluated at once by the line search */
+  UnsignedLong getLineSearchBlockSize() const;
+
+  /** Line search block size accessor */
+  void setLineSearchBlockSize(const UnsignedLong lineSearchBlockSize);
+
   /** String converter */
   String __repr__() const;
 
@@ -91,6 +97,9 @@ private:
   /* Growing factor in penalization term */
   NumericalScalar smooth_;
 
+  /* Number of step lengths evaluated at once by the line search */
+  UnsignedLong lineSearchBlockSize_;
+
   /* Value of the c parameter */
   NumericalScalar gamma_;
 
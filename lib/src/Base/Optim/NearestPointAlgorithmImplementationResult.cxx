@@ -173,6 +173,17 @@ NumericalSample NearestPointAlgorithmImplementationResult::getOutputSample() con
   return outputSample_;
 }
 
+/* Gradient history accessor */
+NumericalSample NearestPointAlgorithmImplementationResult::getGradientInputSample() const
+{
+  return gradientInputSample_;
+}
+
+NumericalSample NearestPointAlgorithmImplementationResult::getGradientSample() const
+{
+  return gradientSample_;
+}
+
 /* String converter */
 String NearestPointAlgorithmImplementationResult::__repr__() const
 {
@@ -205,6 +216,9 @@ void NearestPointAlgorithmImplementationResult::save(Advocate & adv) const
 
   adv.saveAttribute( "inputSample_", inputSample_ );
   adv.saveAttribute( "outputSample_", outputSample_ );
+
+  adv.saveAttribute( "gradientInputSample_", gradientInputSample_ );
+  adv.saveAttribute( "gradientSample_", gradientSample_ );
 }
 
 /* Method load() reloads the object from the StorageManager */
@@ -225,6 +239,9 @@ void NearestPointAlgorithmImplementationResult::load(Advocate & adv)
 
   adv.loadAttribute( "inputSampleHistory_", inputSample_ );
   adv.loadAttribute( "outputSampleHistory_", outputSample_ );
+
+  adv.loadAttribute( "gradientInputSample_", gradientInputSample_ );
+  adv.loadAttribute( "gradientSample_", gradientSample_ );
 }
 
 /* Update current state */
@@ -270,6 +287,21 @@ void NearestPointAlgorithmImplementationResult::store(const NumericalPoint& x,
   outputSample_.add(y);
 }
 
+/* Incremental gradient history storage. It allows to build quasi-Newton
+   approximations of the hessian of the level function from the path of the algorithm */
+void NearestPointAlgorithmImplementationResult::storeGradient(const NumericalPoint & x,
+                                                              const NumericalPoint & gradient)
+{
+  // initialize sample dimension first
+  if ( gradientInputSample_.getSize() == 0 )
+    {
+      gradientInputSample_ = NumericalSample(0, x.getDimension());
+      gradientSample_ = NumericalSample(0, gradient.getDimension());
+    }
+  gradientInputSample_.add(x);
+  gradientSample_.add(gradient);
+}
+
 Graph NearestPointAlgorithmImplementationResult::getErrorHistory() const
 {
   Graph result;
@@ -88,6 +88,10 @@ public:
   NumericalSample getInputSample() const;
   NumericalSample getOutputSample() const;
 
+  /** Gradient history accessor: the points where the gradient of the level function has been computed and the gradients */
+  NumericalSample getGradientInputSample() const;
+  NumericalSample getGradientSample() const;
+
   /** String converter */
   virtual String __repr__() const;
 
@@ -108,6 +112,10 @@ public:
              const NumericalScalar residualError,
              const NumericalScalar constraintError);
 
+  /** Incremental gradient history storage */
+  void storeGradient(const NumericalPoint & inP,
+                     const NumericalPoint & gradient);
+
   /** Draw error history graph */
   Graph getErrorHistory() const;
 
@@ -150,6 +158,8 @@ private:
   NumericalSample constraintErrorHistory_;
   NumericalSample inputSample_;
   NumericalSample outputSample_;
+  NumericalSample gradientInputSample_;
+  NumericalSample gradientSample_;
 
 }; // class NearestPointAlgorithmImplementationResult
 
@@ -95,25 +95,43 @@ NumericalScalar SQP::computeLineSearch()
   /* We start with step=1 */
   NumericalScalar step(1.0);
   NumericalPoint currentStepPoint(currentPoint_.getDimension());
-  NumericalScalar currentStepLevelValue;
-  NumericalScalar currentStepTheta;
-
-  do
+  NumericalScalar currentStepLevelValue(0.0);
+  NumericalScalar currentStepTheta(0.0);
+  /* The next step lengths of the backtracking are proposed by blocks and evaluated in one call,
+     so that the evaluations can be run concurrently. The accepted step is the first admissible
+     one in the backtracking order, as in the sequential line search */
+  const UnsignedLong blockSize(specificParameters_.getLineSearchBlockSize());
+  Bool stop(false);
+  while (!stop)
     {
-      currentStepPoint = currentPoint_ + step * currentDirection_;
-      currentStepLevelValue = levelFunction(currentStepPoint)[0];
-
-      currentStepTheta = 0.5 * currentStepPoint.norm2() + currentSigma_ * fabs(currentStepLevelValue - levelValue);
-      if (getVerbose()) LOGINFO(OSS() << "line search step=" << step << " currentStepPoint=" << currentStepPoint << " currentStepLevelValue=" << currentStepLevelValue << " currentStepTheta=" << currentStepTheta);
-      step *= tau;
+      NumericalSample stepPoints(0, currentPoint_.getDimension());
+      NumericalPoint steps(0);
+      NumericalScalar trialStep(step);
+      for (UnsignedLong i = 0; i < blockSize; ++i)
+        {
+          steps.add(trialStep);
+          stepPoints.add(currentPoint_ + trialStep * currentDirection_);
+          trialStep *= tau;
+          /* The line search stops after this step anyway */
+          if (trialStep < minStep) break;
+        }
+      const NumericalSample stepLevelValues(levelFunction(stepPoints));
+      for (UnsignedLong i = 0; i < steps.getDimension(); ++i)
+        {
+          currentStepPoint = stepPoints[i];
+          currentStepLevelValue = stepLevelValues[i][0];
+          currentStepTheta = 0.5 * currentStepPoint.norm2() + currentSigma_ * fabs(currentStepLevelValue - levelValue);
+          if (getVerbose()) LOGINFO(OSS() << "line search step=" << steps[i] << " currentStepPoint=" << currentStepPoint << " currentStepLevelValue=" << currentStepLevelValue << " currentStepTheta=" << currentStepTheta);
+          step = steps[i] * tau;
+          if (!((step >= minStep) && (currentStepTheta > currentTheta + step * levelIncrement)))
+            {
+              stop = true;
+              break;
+            }
+        }
     }
-
-  while ((step >= minStep) && ( currentStepTheta > currentTheta + step * levelIncrement));
-
   currentPoint_ = currentStepPoint;
-
   currentLevelValue_ = currentStepLevelValue;
-
   /* We went one step beyond */
   return step / tau;
 }
@@ -162,6 +180,7 @@ void SQP::run()
 
       /* Compute the level function gradient at the current point -> Grad(G) */
       currentGradient_ = levelFunction.gradient(currentPoint_) * NumericalPoint(1, 1.0);
+      result_.storeGradient(currentPoint_, currentGradient_);
       /* Compute the current Lagrange multiplier */
       const NumericalScalar normGradientSquared(currentGradient_.norm2());
       /* In case of a null gradient, throw an internal exception */
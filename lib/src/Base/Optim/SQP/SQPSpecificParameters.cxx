@@ -41,7 +41,8 @@ SQPSpecificParameters::SQPSpecificParameters()
   : PersistentObject(),
     tau_(ResourceMap::GetAsNumericalScalar( "SQP-DefaultTau" )),
     omega_(ResourceMap::GetAsNumericalScalar( "SQP-DefaultOmega" )),
-    smooth_(ResourceMap::GetAsNumericalScalar( "SQP-DefaultSmooth" ))
+    smooth_(ResourceMap::GetAsNumericalScalar( "SQP-DefaultSmooth" )),
+    lineSearchBlockSize_(ResourceMap::GetAsUnsignedLong( "SQP-DefaultLineSearchBlockSize" ))
 {
   // Nothing to do
 }
@@ -54,7 +55,8 @@ SQPSpecificParameters::SQPSpecificParameters(const NumericalScalar tau,
   : PersistentObject(),
     tau_(tau),
     omega_(omega),
-    smooth_(smooth)
+    smooth_(smooth),
+    lineSearchBlockSize_(ResourceMap::GetAsUnsignedLong( "SQP-DefaultLineSearchBlockSize" ))
 {
   // Nothing to do
 } /* SpecificParametersSQP */
@@ -101,6 +103,19 @@ void SQPSpecificParameters::setSmooth(const NumericalScalar smooth)
   smooth_ = smooth;
 }
 
+/* Line search block size accessor */
+UnsignedLong SQPSpecificParameters::getLineSearchBlockSize() const
+{
+  return lineSearchBlockSize_;
+}
+
+/* Line search block size accessor */
+void SQPSpecificParameters::setLineSearchBlockSize(const UnsignedLong lineSearchBlockSize)
+{
+  if (lineSearchBlockSize == 0) throw InvalidArgumentException(HERE) << "Error: the line search block size must be positive.";
+  lineSearchBlockSize_ = lineSearchBlockSize;
+}
+
 /* String converter */
 String SQPSpecificParameters::__repr__() const
 {
@@ -108,7 +123,8 @@ String SQPSpecificParameters::__repr__() const
   oss << "class=" << SQPSpecificParameters::GetClassName()
       << " tau=" << tau_
       << " omega=" << omega_
-      << " smooth=" << smooth_;
+      << " smooth=" << smooth_
+      << " lineSearchBlockSize=" << lineSearchBlockSize_;
   return oss;
 }
 
@@ -119,6 +135,7 @@ void SQPSpecificParameters::save(Advocate & adv) const
   adv.saveAttribute("tau_", tau_);
   adv.saveAttribute("omega_", omega_);
   adv.saveAttribute("smooth_", smooth_);
+  adv.saveAttribute("lineSearchBlockSize_", lineSearchBlockSize_);
 }
 
 /* Method load() reloads the object from the StorageManager */
@@ -128,6 +145,7 @@ void SQPSpecificParameters::load(Advocate & adv)
   adv.loadAttribute("tau_", tau_);
   adv.loadAttribute("omega_", omega_);
   adv.loadAttribute("smooth_", smooth_);
+  adv.loadAttribute("lineSearchBlockSize_", lineSearchBlockSize_);
 }
 
 END_NAMESPACE_OPENTURNS
@@ -68,6 +68,10 @@ public:
   NumericalScalar getSmooth() const;
   void setSmooth(const NumericalScalar tau);
 
+  /** Line search block size accessor: number of step lengths evaluated at once by the line search */
+  UnsignedLong getLineSearchBlockSize() const;
+  void setLineSearchBlockSize(const UnsignedLong lineSearchBlockSize);
+
   /** String converter */
   String __repr__() const;
 
@@ -89,6 +93,9 @@ private:
   /* Growing factor in penalization term */
   NumericalScalar smooth_;
 
+  /* Number of step lengths evaluated at once by the line search */
+  UnsignedLong lineSearchBlockSize_;
+
 }; /* class SQPSpecificParameters */
 
 END_NAMESPACE_OPENTURNS
@@ -101,8 +101,8 @@ UserDefinedCovarianceModel * NonStationaryCovarianceModelFactory::build(const Pr
                   NumericalScalar coef(0.0);
                   for (UnsignedLong sampleIndex = 0; sampleIndex < sampleSize; ++sampleIndex)
                     {
-                      coef += (sample[sampleIndex].getValueAtIndex(i)[k] - mean.getValueAtIndex(i)[k])
-                        * (sample[sampleIndex].getValueAtIndex(j)[l] - mean.getValueAtIndex(j)[l]);
+                      coef += (sample(sampleIndex, i, k) - mean.getValueAtIndex(i)[k])
+                        * (sample(sampleIndex, j, l) - mean.getValueAtIndex(j)[l]);
                     }
                   matrix(k, l) = coef * alpha;
                 }
@@ -41,7 +41,6 @@
 #include "Path.hxx"
 #include "Os.hxx"
 #include "TBB.hxx"
-#include "kendall.h"
 
 #include "csv_parser_state.hxx"
 #include "csv_parser.hh"
@@ -805,49 +804,6 @@ typedef Collection<UnsignedLongCollection> UnsignedLongCollectionCollection;
 
 
 
-struct Comparison
-{
-  // Main sorting key
-  UnsignedLong first_;
-  // Secondary sorting key
-  UnsignedLong second_;
-  // Pointer to the data
-  const NumericalSampleImplementation & nsi_;
-  // Sorting permutation
-  UnsignedLongCollection permutation_;
-  // True if sample has ties
-  mutable Bool hasTies_;
-
-  Comparison(UnsignedLong first,
-             const NumericalSampleImplementation & nsi)
-    : first_(first), second_(first), nsi_(nsi), permutation_(nsi_.getSize()), hasTies_(false)
-  {
-    const UnsignedLong size = nsi_.getSize();
-    for (UnsignedLong i = 0; i < size; ++i) permutation_[i] = i;
-  }
-
-  Comparison(UnsignedLong first, UnsignedLong second,
-             const NumericalSampleImplementation & nsi)
-    : first_(first), second_(second), nsi_(nsi), permutation_(nsi_.getSize()), hasTies_(false)
-  {
-    const UnsignedLong size = nsi_.getSize();
-    for (UnsignedLong i = 0; i < size; ++i) permutation_[i] = i;
-  }
-
-  Bool operator() (const UnsignedLong i, const UnsignedLong j) const
-  {
-    const NumericalScalar xI(nsi_[ permutation_[i] ][ first_  ]);
-    const NumericalScalar xJ(nsi_[ permutation_[j] ][ first_  ]);
-    const NumericalScalar yI(nsi_[ permutation_[i] ][ second_ ]);
-    const NumericalScalar yJ(nsi_[ permutation_[j] ][ second_ ]);
-    hasTies_ |= (xI == xJ);
-    return ( (xI < xJ) || ((xI == xJ) && (yI < yJ)) );
-  }
-}; // struct Comparison
-
-
-
-
 /* Ranked sample */
 NumericalSampleImplementation NumericalSampleImplementation::rank() const
 {
@@ -973,284 +929,194 @@ CorrelationMatrix NumericalSampleImplementation::computeSpearmanCorrelation() co
 /*
  * Gives the Kendall tau matrix of the sample
  * The correction for ties should be made according to http://www.statsdirect.com/help/nonparametric_methods/kend.htm
+ * Each component is sorted only once and replaced by its dense ranks. For a given pair (i, j),
+ * the ranks of the component j are reordered according to the component i, ties in i being
+ * broken by the ranks of j, and the number of discordant pairs is the number of exchanges
+ * needed to sort the resulting sequence.
  */
 
-struct MergeSortParameters
-{
-  const NumericalSampleImplementation & nsi_;
-  const UnsignedLong activeDimension_;
-  UnsignedLongCollection & ordering_;
-  UnsignedLongCollection & buffer_;
-
-  MergeSortParameters(const NumericalSampleImplementation & nsi,
-                      const UnsignedLong activeDimension,
-                      UnsignedLongCollection & ordering,
-                      UnsignedLongCollection & buffer)
-    : nsi_(nsi), activeDimension_(activeDimension), ordering_(ordering), buffer_(buffer) {}
-
-}; // end struct MergeSortParameters
-
-static inline
-// uint64_t mergeSortedChunks(const NumericalSampleImplementation & nsi,
-//                           const UnsignedLong offset,
-//                           const UnsignedLong length,
-//                           const UnsignedLong activeDimension,
-//                           UnsignedLongCollection & ordering,
-//                           UnsignedLongCollection & buffer)
-uint64_t mergeSortedChunks(const MergeSortParameters & params,
-                           const UnsignedLong offset,
-                           const UnsignedLong length)
+/* Sort the sequence in place and return the number of exchanges, ie the number of inversions */
+static uint64_t kendallExchanges(UnsignedLong * sequence,
+                                 UnsignedLong * buffer,
+                                 const UnsignedLong length,
+                                 const UnsignedLong smallLength)
 {
+  if (length < 2) return 0;
   uint64_t exchanges(0);
-
-  const NumericalSampleImplementation & nsi = params.nsi_;
-  const UnsignedLong activeDimension        = params.activeDimension_;
-  UnsignedLongCollection & ordering         = params.ordering_;
-  UnsignedLongCollection & buffer           = params.buffer_;
-
+  // Quadratic insertion sort for the small chunks
+  if (length < smallLength)
+    {
+      for (UnsignedLong k = 1; k < length; ++k)
+        {
+          const UnsignedLong value(sequence[k]);
+          UnsignedLong m(k);
+          while ((m > 0) && (sequence[m - 1] > value))
+            {
+              sequence[m] = sequence[m - 1];
+              --m;
+            }
+          sequence[m] = value;
+          exchanges += k - m;
+        }
+      return exchanges;
+    }
   const UnsignedLong length0(length / 2);
-  const UnsignedLong length1(length - length0);
-  const UnsignedLong middle(offset + length0);
-
-  UnsignedLong i(0);
+  exchanges += kendallExchanges(sequence, buffer, length0, smallLength);
+  exchanges += kendallExchanges(sequence + length0, buffer + length0, length - length0, smallLength);
+  // Already ordered chunks
+  if (sequence[length0 - 1] <= sequence[length0]) return exchanges;
+  // Merge the left and right chunks
   UnsignedLong j(0);
-  UnsignedLong k(0);
-
-  if (nsi[ ordering[middle - 1] ][activeDimension] < nsi[ ordering[middle] ][activeDimension]) return exchanges;
-
-  // Merge the left and right arrays
-  while ((j < length0) || (k < length1))
+  UnsignedLong k(length0);
+  UnsignedLong i(0);
+  while ((j < length0) && (k < length))
     {
-      int d(0);
-      if ( (k >= length1) ||
-           ( (j < length0) &&
-             (nsi[ ordering[offset + j] ][activeDimension] <= nsi[ ordering[middle + k] ][activeDimension]) ))
+      if (sequence[k] < sequence[j])
         {
-          buffer[offset + i] = ordering[offset + j];
-          d = i - j;
-          ++j;
-
+          buffer[i] = sequence[k];
+          exchanges += length0 - j;
+          ++k;
         }
       else
         {
-          buffer[offset + i] = ordering[middle + k];
-          d = (offset + i) - (middle + k);
-          ++k;
+          buffer[i] = sequence[j];
+          ++j;
         }
-
-      if (d > 0) exchanges += d;
       ++i;
-    } // merge of the arrays
-
-  for (UnsignedLong m = 0; m < length; ++m)
-    ordering[offset + m] = buffer[offset + m];
-
-  return exchanges;
-}
-
-/* Private merge sort for the fast computation of Kendall's tau */
-static inline
-uint64_t mergeSort(const MergeSortParameters & params,
-                   const UnsignedLong offset,
-                   const UnsignedLong length)
-{
-  uint64_t exchanges(0);
-
-  const NumericalSampleImplementation & nsi = params.nsi_;
-  const UnsignedLong activeDimension        = params.activeDimension_;
-  UnsignedLongCollection & ordering         = params.ordering_;
-
-  assert( length > 0);
-  // Array of length 1, no swap
-  if (length == 1) return 0;
-
-  // Swap?
-  if (length == 2)
-    {
-      if ( nsi[ ordering[offset] ][activeDimension] <= nsi[ ordering[offset + 1] ][activeDimension]) return 0;
-      std::swap( ordering[offset], ordering[offset + 1] );
-      return 1;
     }
-
-  const UnsignedLong length0(length / 2);
-  const UnsignedLong length1(length - length0);
-  const UnsignedLong middle(offset + length0);
-
-  // Recursive sort of left and right parts
-  exchanges += mergeSort( params, offset, length0 );
-  exchanges += mergeSort( params, middle, length1 );
-  exchanges += mergeSortedChunks( params, offset, length );
+  while (j < length0) buffer[i++] = sequence[j++];
+  while (k < length) buffer[i++] = sequence[k++];
+  std::copy(buffer, buffer + length, sequence);
   return exchanges;
 }
 
-/* Lexical ordering between two dimensions: ranking with respect to i then to j if ties */
-static inline
-NumericalSampleImplementation::UnsignedLongCollection lexicalRank(const NumericalSampleImplementation & nsi,
-                                                                  const UnsignedLong i,
-                                                                  const UnsignedLong j)
+/* Sort each component once: ordering, dense ranks and number of tied pairs */
+class KendallTauMarginalFunctor
 {
-  // Sort and rank all the marginal samples
-  Comparison comparison(i, j, nsi);
-  std::stable_sort(comparison.permutation_.begin(), comparison.permutation_.end(), comparison);
-  return comparison.permutation_;
-}
-
-
-#ifdef HAVE_TBB
-struct MergeSortContinuationTask : public tbb::task
-{
-  const MergeSortParameters & params_;
-  const UnsignedLong offset_;
-  const UnsignedLong length_;
-  uint64_t & exchanges_;
-  uint64_t exchangesLeft_;
-  uint64_t exchangesRight_;
-
-  MergeSortContinuationTask(const MergeSortParameters & params,
-                            UnsignedLong offset,
-                            UnsignedLong length,
-                            uint64_t & exchanges)
-    : params_(params), offset_(offset), length_(length),
-      exchanges_(exchanges), exchangesLeft_(0), exchangesRight_(0) {}
-
-  tbb::task * execute()
-  {
-    exchanges_ += exchangesLeft_;
-    exchanges_ += exchangesRight_;
-    exchanges_ += mergeSortedChunks( params_, offset_, length_ );
-    return NULL;
-  }
-}; // end class MergeSortContinuationTask
-
-struct MergeSortTask : public tbb::task
-{
-  const MergeSortParameters & params_;
-  const UnsignedLong offset_;
-  const UnsignedLong length_;
-  uint64_t & exchanges_;
-
-  MergeSortTask(const MergeSortParameters & params,
-                UnsignedLong offset,
-                UnsignedLong length,
-                uint64_t & exchanges)
-    : params_(params), offset_(offset), length_(length),
-      exchanges_(exchanges)
+  const NumericalSampleImplementation & nsi_;
+  UnsignedLongCollection & orderings_;
+  UnsignedLongCollection & ranks_;
+  NumericalPoint & ties_;
+public:
+  KendallTauMarginalFunctor(const NumericalSampleImplementation & nsi,
+                            UnsignedLongCollection & orderings,
+                            UnsignedLongCollection & ranks,
+                            NumericalPoint & ties)
+    : nsi_(nsi), orderings_(orderings), ranks_(ranks), ties_(ties)
   {}
 
-  tbb::task * execute()
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
   {
-    if (length_ < 500)
-      {
-        exchanges_ = mergeSort( params_, offset_, length_ );
-
-      }
-    else
+    const UnsignedLong size(nsi_.getSize());
+    PairCollection sortedMarginal(size);
+    for (UnsignedLong i = r.begin(); i < r.end(); ++i)
       {
-        MergeSortContinuationTask & cont = *new( allocate_continuation() ) MergeSortContinuationTask( params_, offset_, length_, exchanges_);
-
-        const UnsignedLong length0 = length_ / 2;
-        const UnsignedLong length1 = length_ - length0;
-        const UnsignedLong middle  = offset_ + length0;
-
-        MergeSortTask & left  = *new( cont.allocate_child() ) MergeSortTask( params_, offset_, length0, cont.exchangesLeft_  );
-        MergeSortTask & right = *new( cont.allocate_child() ) MergeSortTask( params_, middle, length1, cont.exchangesRight_ );
-
-        cont.set_ref_count( 2 );
-        cont.spawn( right );
-        cont.spawn( left  );
-
-      }
-    return NULL;
+        for (UnsignedLong k = 0; k < size; ++k)
+          {
+            sortedMarginal[k].value_ = nsi_[k][i];
+            sortedMarginal[k].index_ = k;
+          }
+        std::sort(sortedMarginal.begin(), sortedMarginal.end());
+        const UnsignedLong shift(i * size);
+        UnsignedLong rank(0);
+        UnsignedLong first(0);
+        NumericalScalar ties(0.0);
+        for (UnsignedLong k = 0; k < size; ++k)
+          {
+            if (sortedMarginal[k].value_ != sortedMarginal[first].value_)
+              {
+                ties += (k - first) * (k - first - 1.0);
+                first = k;
+                ++rank;
+              }
+            orderings_[shift + k] = sortedMarginal[k].index_;
+            ranks_[shift + sortedMarginal[k].index_] = rank;
+          }
+        ties += (size - first) * (size - first - 1.0);
+        ties_[i] = ties;
+      } // end for i
   }
+}; // end class KendallTauMarginalFunctor
 
-}; // end class MergeSortTask
-#endif /* HAVE_TBB */
-
+/* Compute the Kendall tau of a range of pairs of components */
 class KendallTauFunctor
 {
-  const NumericalSampleImplementation & nsi_;
-  const Comparison & comp_;
+  const UnsignedLongCollection & orderings_;
+  const UnsignedLongCollection & ranks_;
+  const NumericalPoint & ties_;
+  const UnsignedLongCollection & firstIndices_;
+  const UnsignedLongCollection & secondIndices_;
+  const UnsignedLong size_;
+  const UnsignedLong smallSize_;
   MatrixImplementation & tau_;
-  const UnsignedLong i_;
-  const NumericalScalar total_;
 public:
-  KendallTauFunctor(const NumericalSampleImplementation & nsi,
-                    const Comparison & comp,
-                    UnsignedLong i,
-                    const NumericalScalar total,
+  KendallTauFunctor(const UnsignedLongCollection & orderings,
+                    const UnsignedLongCollection & ranks,
+                    const NumericalPoint & ties,
+                    const UnsignedLongCollection & firstIndices,
+                    const UnsignedLongCollection & secondIndices,
+                    const UnsignedLong size,
+                    const UnsignedLong smallSize,
                     MatrixImplementation & tau)
-    : nsi_(nsi), comp_(comp), tau_(tau), i_(i), total_(total)
+    : orderings_(orderings), ranks_(ranks), ties_(ties)
+    , firstIndices_(firstIndices), secondIndices_(secondIndices)
+    , size_(size), smallSize_(smallSize), tau_(tau)
   {}
 
   void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
   {
-    const UnsignedLong size = nsi_.getSize();
-    UnsignedLongCollection buffer(size);
-    UnsignedLongCollection ordering;
+    // Work buffers shared by all the pairs of the range
+    UnsignedLongCollection sequence(size_);
+    UnsignedLongCollection buffer(size_);
+    const NumericalScalar total(size_ * (size_ - 1.0));
 
-    for (UnsignedLong j = r.begin(); j < r.end(); ++j)
+    for (UnsignedLong p = r.begin(); p < r.end(); ++p)
       {
-        // If there are ties according to X_i, solve the ties by a lexical sorting of (X_i, X_j)
-        if (comp_.hasTies_) ordering = lexicalRank(nsi_, i_, j);
-        else ordering = comp_.permutation_;
-
-        NumericalScalar t = 0.0;
-        NumericalScalar u = 0.0;
-        NumericalScalar v = 0.0;
-        UnsignedLong firstT = 0;
-        UnsignedLong firstU = 0;
-        UnsignedLong firstV = 0;
-
-        // Check for ties
-        // joint ties
-        for (UnsignedLong k = 1; k < size; ++k)
+        const UnsignedLong i(firstIndices_[p]);
+        const UnsignedLong j(secondIndices_[p]);
+        // Kendall's tau is symmetric, so the ordering is made according to the component with the fewest ties
+        const Bool swapped(ties_[j] < ties_[i]);
+        const UnsignedLong a(swapped ? j : i);
+        const UnsignedLong b(swapped ? i : j);
+        const UnsignedLong * ordering = &orderings_[a * size_];
+        const UnsignedLong * rankA = &ranks_[a * size_];
+        const UnsignedLong * rankB = &ranks_[b * size_];
+        for (UnsignedLong k = 0; k < size_; ++k) sequence[k] = rankB[ordering[k]];
+
+        // Ties in a: sort each group of ties according to b and count the joint ties
+        NumericalScalar t(0.0);
+        if (ties_[a] > 0.0)
           {
-            if ( ( nsi_[ordering[firstT]][i_] != nsi_[ordering[k]][i_] ) ||
-                 ( nsi_[ordering[firstT]][j ] != nsi_[ordering[k]][j ] ) )
-              {
-                t += (k - firstT) * (k - firstT - 1);
-                firstT = k;
-              }
-            if (nsi_[ordering[firstU]][i_] != nsi_[ordering[k]][i_])
+            UnsignedLong first(0);
+            for (UnsignedLong k = 1; k <= size_; ++k)
               {
-                u += (k - firstU) * (k - firstU - 1);
-                firstU = k;
+                if ((k < size_) && (rankA[ordering[k]] == rankA[ordering[first]])) continue;
+                if (k - first > 1)
+                  {
+                    std::sort(sequence.begin() + first, sequence.begin() + k);
+                    UnsignedLong firstT(first);
+                    for (UnsignedLong m = first + 1; m <= k; ++m)
+                      if ((m == k) || (sequence[m] != sequence[firstT]))
+                        {
+                          t += (m - firstT) * (m - firstT - 1.0);
+                          firstT = m;
+                        }
+                  }
+                first = k;
               }
-          } // ties in x and y
-
-        t += (size - firstT) * (size - firstT - 1);
-        u += (size - firstU) * (size - firstU - 1);
+          } // ties in a
 
-        // swaps
+        const NumericalScalar u(ties_[i]);
+        const NumericalScalar v(ties_[j]);
         // It is casted into a NumericalScalar as it will be used in an expression using real values
-        MergeSortParameters params( nsi_, j, ordering, buffer );
-#ifdef HAVE_TBB
-        uint64_t exchangesWork = 0;
-        MergeSortTask & work  = *new( tbb::task::allocate_root() ) MergeSortTask( params, 0, size, exchangesWork );
-        tbb::task::spawn_root_and_wait( work );
-        const NumericalScalar exchanges = exchangesWork;
-#else /* HAVE_TBB */
-        const NumericalScalar exchanges = mergeSort( params, 0, size );
-#endif /* HAVE_TBB */
-
-        // ties in y after mergesort with counting
-        for (UnsignedLong k = 1; k < size; ++k)
-          {
-            if ( nsi_[ordering[firstV]][j] != nsi_[ordering[k]][j] )
-              {
-                v += (k - firstV) * (k - firstV - 1);
-                firstV = k;
-              }
-          } // ties in y after mergesort and counting
-
-        v += (size - firstV) * (size - firstV - 1);
-
-        tau_(i_, j) = ((total_ == u) && (total_ == v)) ?
-          1.0 :
-          ((total_ - (v + u - t)) - 4.0 * exchanges) / (sqrt((total_ - u) * (total_ - v)));
-
-      } // end for j
-
+        const NumericalScalar exchanges(kendallExchanges(&sequence[0], &buffer[0], size_, smallSize_));
+
+        // Only the lower triangular part of the matrix is used
+        // Two constant components are fully tied, a constant component is not correlated to a varying one
+        if ((total == u) && (total == v)) tau_(j, i) = 1.0;
+        else if ((total == u) || (total == v)) tau_(j, i) = 0.0;
+        else tau_(j, i) = ((total - (v + u - t)) - 4.0 * exchanges) / (sqrt((total - u) * (total - v)));
+      } // end for p
   }
 }; // end class KendallTauFunctor
 
@@ -1261,42 +1127,32 @@ CorrelationMatrix NumericalSampleImplementation::computeKendallTau() const
 {
   if (size_ == 0) throw InternalException(HERE) << "Error: cannot compute the Kendall tau of an empty sample.";
 
-#define KENDALLTAU_PARALLEL 0
+  // Sort each component only once
+  UnsignedLongCollection orderings(size_ * dimension_);
+  UnsignedLongCollection ranks(size_ * dimension_);
+  NumericalPoint ties(dimension_);
+  const KendallTauMarginalFunctor marginalFunctor( *this, orderings, ranks, ties );
+  TBB::ParallelFor( 0, dimension_, marginalFunctor );
+
+  // Enumerate the pairs of components
+  const UnsignedLong pairsNumber(dimension_ * (dimension_ - 1) / 2);
+  UnsignedLongCollection firstIndices(pairsNumber);
+  UnsignedLongCollection secondIndices(pairsNumber);
+  UnsignedLong p(0);
+  for (UnsignedLong i = 0; i < dimension_; ++i)
+    for (UnsignedLong j = i + 1; j < dimension_; ++j)
+      {
+        firstIndices[p] = i;
+        secondIndices[p] = j;
+        ++p;
+      }
 
-#if KENDALLTAU_PARALLEL
-  const NumericalScalar total = size_ * (size_ - 1);
-#else
-  // Use external efficient C implementation of the O(Nlog(N)) or O(N^2) Kendall tau computation depending on the sample size
-  Bool useSmallCase(size_ < ResourceMap::GetAsUnsignedLong("NumericalSampleImplementation-SmallKendallTau"));
-  NumericalPoint x(size_);
-  NumericalPoint y(size_);
-#endif
   // The resulting matrix
   CorrelationMatrix tau(dimension_);
-
-  for (UnsignedLong i = 0; i < dimension_ - 1; ++i)
-    {
-#if KENDALLTAU_PARALLEL
-      Comparison comparison(i, i, *this);
-      std::stable_sort(comparison.permutation_.begin(), comparison.permutation_.end(), comparison);
-      KendallTauFunctor functor( *this, comparison, i, total, *tau.getImplementation() );
-      TBB::ParallelFor( i + 1, dimension_, functor );
-#else /* KENDALLTAU_PARALLEL */
-      for (UnsignedLong j = i + 1; j < dimension_; ++j)
-        {
-          LOGINFO(OSS() << "in NumericalSampleImplementation::computeKendallTau(), computing tau[" << i << ", " << j << "]");
-          // We have to copy both the row i and j at each call to the external computation of Kendall's tau as the arrays will be modified in place
-          for (UnsignedLong k = 0; k < size_; ++k)
-            {
-              x[k] = (*this)[k][i];
-              y[k] = (*this)[k][j];
-            }
-          if (useSmallCase) tau(i, j) = kendallSmallN(&x[0], &y[0], size_);
-          else tau(i, j) = kendallNlogN(&x[0], &y[0], size_);
-          LOGINFO(OSS() << "value=" << tau(i, j));
-        }
-#endif /* KENDALLTAU_PARALLEL */
-    } // end for i
+  // Below this chunk size, the exchanges are counted by insertion sort within the merge sort
+  const UnsignedLong smallSize(ResourceMap::GetAsUnsignedLong("NumericalSampleImplementation-KendallTauInsertionSortSize"));
+  const KendallTauFunctor functor( orderings, ranks, ties, firstIndices, secondIndices, size_, smallSize, *tau.getImplementation() );
+  TBB::ParallelFor( 0, pairsNumber, functor );
 
   return tau;
 }
@@ -56,6 +56,7 @@
 #include "ExponentialCauchy.hxx"
 #include "SensitivityAnalysis.hxx"
 #include "SobolSequence.hxx"
+#include "Spill.hxx"
 #include "TestResult.hxx"
 #include "TimeSeries.hxx"
 #include "FilteringWindowsImplementation.hxx"
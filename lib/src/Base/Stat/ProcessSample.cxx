@@ -22,12 +22,22 @@
  *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
  */
 
+#include <cstring>
+#include <fstream>
+#include "OTconfig.hxx"
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 #include "ProcessSample.hxx"
 #include "PersistentObjectFactory.hxx"
 #include "Exception.hxx"
 #include "ResourceMap.hxx"
 #include "Drawable.hxx"
 #include "Description.hxx"
+#include "Log.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -36,6 +46,81 @@ TEMPLATE_CLASSNAMEINIT(PersistentCollection<ProcessSample>);
 TEMPLATE_CLASSNAMEINIT(PersistentCollection<TimeSeries>);
 static Factory<PersistentCollection<TimeSeries> > RegisteredFactory1("PersistentCollection<TimeSeries>");
 
+/* Header of the binary files: a magic string, the size, the dimension and the time grid,
+   padded to 64 bytes so that the values that follow are aligned */
+struct ProcessSampleFileHeader
+{
+  char magic_[8];
+  uint64_t size_;
+  uint64_t dimension_;
+  uint64_t n_;
+  double start_;
+  double step_;
+  char padding_[16];
+}; /* end struct ProcessSampleFileHeader */
+
+static const char ProcessSampleMagic[8] = {'O', 'T', 'P', 'S', 'v', '1', '\0', '\0'};
+
+/* Read the header of a binary file and check it */
+static ProcessSampleFileHeader ReadProcessSampleFileHeader(std::istream & file,
+                                                           const FileName & fileName)
+{
+  ProcessSampleFileHeader header;
+  file.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!file || (std::memcmp(header.magic_, ProcessSampleMagic, sizeof(ProcessSampleMagic)) != 0)) throw FileOpenException(HERE) << "Error: the file " << fileName << " does not contain a process sample";
+  return header;
+}
+
+/* Read-only mapping of the values stored in a binary file */
+class ProcessSampleMapping
+{
+public:
+  ProcessSampleMapping(const FileName & fileName,
+                       const UnsignedLong valuesNumber)
+    : address_(0), length_(0)
+  {
+#ifdef HAVE_SYS_MMAN_H
+    const int descriptor(open(fileName.c_str(), O_RDONLY));
+    if (descriptor < 0) throw FileOpenException(HERE) << "Error: cannot open the file " << fileName;
+    length_ = sizeof(ProcessSampleFileHeader) + valuesNumber * sizeof(NumericalScalar);
+    struct stat status;
+    if ((fstat(descriptor, &status) != 0) || (static_cast<UnsignedLong>(status.st_size) < length_))
+      {
+        close(descriptor);
+        throw FileOpenException(HERE) << "Error: the file " << fileName << " is truncated";
+      }
+    void * address(mmap(0, length_, PROT_READ, MAP_PRIVATE, descriptor, 0));
+    // The mapping remains valid once the descriptor is closed
+    close(descriptor);
+    if (address == MAP_FAILED) throw FileOpenException(HERE) << "Error: cannot map the file " << fileName;
+    // The values are mostly accessed in sequential passes
+    madvise(address, length_, MADV_SEQUENTIAL);
+    address_ = static_cast<char *>(address);
+#else
+    throw NotYetImplementedException(HERE) << "Error: memory-mapped files are not supported on this platform";
+#endif
+  }
+
+  ~ProcessSampleMapping()
+  {
+#ifdef HAVE_SYS_MMAN_H
+    if (address_) munmap(address_, length_);
+#endif
+  }
+
+  const NumericalScalar * getValues() const
+  {
+    return reinterpret_cast<const NumericalScalar *>(address_ + sizeof(ProcessSampleFileHeader));
+  }
+
+private:
+  ProcessSampleMapping(const ProcessSampleMapping & other);
+  ProcessSampleMapping & operator = (const ProcessSampleMapping & other);
+
+  char * address_;
+  UnsignedLong length_;
+}; /* end class ProcessSampleMapping */
+
 
 CLASSNAMEINIT(ProcessSample);
 
@@ -45,7 +130,9 @@ ProcessSample::ProcessSample()
   : PersistentObject(),
     dimension_(1),
     timeGrid_(),
-    data_(0)
+    size_(0),
+    data_(0),
+    p_mapping_()
 {
   // Nothing to do
 }
@@ -56,9 +143,13 @@ ProcessSample::ProcessSample(const UnsignedLong size,
   : PersistentObject(),
     dimension_(timeSeries.getDimension()),
     timeGrid_(timeSeries.getTimeGrid()),
-    data_(TimeSeriesPersistentCollection(size, timeSeries))
+    size_(0),
+    data_(0),
+    p_mapping_()
 {
-  // Nothing to do
+  data_.resize(size * getBlockSize());
+  size_ = size;
+  for (UnsignedLong i = 0; i < size; ++i) setTimeSeries(i, timeSeries);
 }
 
 
@@ -68,7 +159,9 @@ ProcessSample::ProcessSample(const RegularGrid & timeGrid,
   : PersistentObject(),
     dimension_(dimension),
     timeGrid_(timeGrid),
-    data_(TimeSeriesPersistentCollection(size, TimeSeries(timeGrid, NumericalSample(timeGrid.getN(), dimension))))
+    size_(size),
+    data_(size * timeGrid.getN() * dimension, 0.0),
+    p_mapping_()
 {
   // Nothing to do
 }
@@ -77,7 +170,9 @@ ProcessSample::ProcessSample(const TimeSeriesCollection & collection)
   : PersistentObject(),
     dimension_(0),
     timeGrid_(),
-    data_(0)
+    size_(0),
+    data_(0),
+    p_mapping_()
 {
   const UnsignedLong collectionSize(collection.getSize());
   for (UnsignedLong i = 0; i < collectionSize; ++i ) add(collection[i]);
@@ -95,7 +190,10 @@ String ProcessSample::__repr__() const
   OSS oss;
   oss << "class=" << ProcessSample::GetClassName()
       << " timeGrid = " << timeGrid_
-      << " values = " << data_;
+      << " values = [";
+  String separator("");
+  for (UnsignedLong i = 0; i < size_; ++i, separator = ",") oss << separator << (*this)[i].__repr__();
+  oss << "]";
   return oss;
 }
 
@@ -104,46 +202,88 @@ String ProcessSample::__str__(const String & offset) const
   OSS oss;
   oss << offset << "[";
   String separator("");
-  for (UnsignedLong i = 0; i < data_.getSize(); ++i, separator = "\n") oss << separator << offset << "time series " << i << ":\n" << (*this)[i].__str__(offset);
+  for (UnsignedLong i = 0; i < size_; ++i, separator = "\n") oss << separator << offset << "time series " << i << ":\n" << (*this)[i].__str__(offset);
   oss << "]";
   return oss;
 }
 
 void ProcessSample::add(const TimeSeries & timeSeries)
 {
-  if (getSize() == 0)
+  if (size_ == 0)
     {
-      data_.add(timeSeries);
       timeGrid_ = timeSeries.getTimeGrid();
       dimension_ = timeSeries.getDimension();
     }
-  else if ((dimension_ == timeSeries.getDimension()) && (timeGrid_ == timeSeries.getTimeGrid())) data_.add(timeSeries);
-  else throw InvalidArgumentException(HERE) << "Error; could not add the timeSeries. Either its dimenson or its time grid are incompatible.";
+  else if ((dimension_ != timeSeries.getDimension()) || !(timeGrid_ == timeSeries.getTimeGrid())) throw InvalidArgumentException(HERE) << "Error; could not add the timeSeries. Either its dimenson or its time grid are incompatible.";
+  copyOnWrite();
+  data_.resize((size_ + 1) * getBlockSize());
+  ++size_;
+  setTimeSeries(size_ - 1, timeSeries);
 }
 
 
 /* Operators accessors */
-TimeSeries & ProcessSample::operator [] (const UnsignedLong index)
+ProcessSample::TimeSeriesReference ProcessSample::operator [] (const UnsignedLong index)
+{
+  if (index >= size_) throw InvalidArgumentException(HERE)  << " Error - index should be between 0 and " << size_ - 1;
+  return TimeSeriesReference(*this, index);
+}
+
+const TimeSeries ProcessSample::operator [] (const UnsignedLong index) const
+{
+  return getTimeSeries(index);
+}
+
+const NumericalScalar & ProcessSample::operator () (const UnsignedLong i,
+                                                    const UnsignedLong t,
+                                                    const UnsignedLong k) const
+{
+  return getValues()[(i * timeGrid_.getN() + t) * dimension_ + k];
+}
+
+/* Time series accessors */
+TimeSeries ProcessSample::getTimeSeries(const UnsignedLong index) const
 {
-  if (index > getSize() - 1) throw InvalidArgumentException(HERE)  << " Error - index should be between 0 and " << getSize() - 1;
-  return data_[index];
+  if (index >= size_) throw InvalidArgumentException(HERE)  << " Error - index should be between 0 and " << size_ - 1;
+  const UnsignedLong length(timeGrid_.getN());
+  NumericalSample values(length, dimension_);
+  const NumericalScalar * source(getValues() + index * getBlockSize());
+  for (UnsignedLong t = 0; t < length; ++t)
+    for (UnsignedLong k = 0; k < dimension_; ++k)
+      {
+        values[t][k] = *source;
+        ++source;
+      }
+  return TimeSeries(timeGrid_, values);
 }
 
-const TimeSeries & ProcessSample::operator [] (const UnsignedLong index) const
+void ProcessSample::setTimeSeries(const UnsignedLong index,
+                                  const TimeSeries & timeSeries)
 {
-  return data_[index];
+  if (index >= size_) throw InvalidArgumentException(HERE)  << " Error - index should be between 0 and " << size_ - 1;
+  if ((timeSeries.getDimension() != dimension_) || (timeSeries.getSize() != timeGrid_.getN())) throw InvalidArgumentException(HERE) << "Error: expected a time series of dimension " << dimension_ << " and size " << timeGrid_.getN() << ", got a time series of dimension " << timeSeries.getDimension() << " and size " << timeSeries.getSize();
+  copyOnWrite();
+  const NumericalSample values(timeSeries.getSample());
+  const UnsignedLong length(timeGrid_.getN());
+  UnsignedLong position(index * getBlockSize());
+  for (UnsignedLong t = 0; t < length; ++t)
+    for (UnsignedLong k = 0; k < dimension_; ++k)
+      {
+        data_[position] = values[t][k];
+        ++position;
+      }
 }
 
 /* Method __getitem__() - Python use */
 TimeSeries ProcessSample::__getitem__ (const UnsignedLong i) const
 {
-  return (*this)[i];
+  return getTimeSeries(i);
 }
 
 /* Method __setitem__() is for Python */
 void ProcessSample::__setitem__(const UnsignedLong i, const TimeSeries & timeSeries)
 {
-  (*this)[i] = timeSeries;
+  setTimeSeries(i, timeSeries);
 }
 
 /* Time grid accessors */
@@ -161,34 +301,71 @@ UnsignedLong ProcessSample::getDimension() const
 /* Dimension accessors */
 UnsignedLong ProcessSample::getSize() const
 {
-  return data_.getSize();
+  return size_;
+}
+
+/* Number of values of one time series */
+UnsignedLong ProcessSample::getBlockSize() const
+{
+  return timeGrid_.getN() * dimension_;
+}
+
+/* Address of the values */
+const NumericalScalar * ProcessSample::getValues() const
+{
+  if (!p_mapping_.isNull()) return p_mapping_->getValues();
+  if (data_.getSize() == 0) return 0;
+  return &data_[0];
+}
+
+/* Copy the memory-mapped values into memory before any modification */
+void ProcessSample::copyOnWrite()
+{
+  if (p_mapping_.isNull()) return;
+  const NumericalScalar * values(p_mapping_->getValues());
+  data_ = InternalType(values, values + size_ * getBlockSize());
+  p_mapping_.reset();
 }
 
 TimeSeries ProcessSample::computeMean() const
 {
-  const UnsignedLong size(getSize());
-  if (size == 0) return TimeSeries();
-  if (size == 1) return data_[0];
-  TimeSeries result(data_[0]);
-  const UnsignedLong length(result.getSize());
-  // Aggregate the mean on the fly
-  for (UnsignedLong k = 1; k < size; ++k)
-    for (UnsignedLong t = 0; t < length ; ++t)
-      result.getValueAtIndex(t) += data_[k].getValueAtIndex(t);
+  if (size_ == 0) return TimeSeries();
+  const UnsignedLong blockSize(getBlockSize());
+  const NumericalScalar * values(getValues());
+  // Aggregate the mean on the fly, in a single pass over the values
+  NumericalPoint sum(blockSize);
+  for (UnsignedLong j = 0; j < blockSize; ++j) sum[j] = values[j];
+  for (UnsignedLong i = 1; i < size_; ++i)
+    {
+      values += blockSize;
+      for (UnsignedLong j = 0; j < blockSize; ++j) sum[j] += values[j];
+    }
   // Normalize the result
-  const NumericalScalar factor(1.0 / size);
-  for (UnsignedLong t = 0; t < length ; ++t)
-    result.getValueAtIndex(t) *= factor;
-  return result;
+  if (size_ > 1) sum *= 1.0 / size_;
+  const UnsignedLong length(timeGrid_.getN());
+  NumericalSample mean(length, dimension_);
+  for (UnsignedLong t = 0; t < length; ++t)
+    for (UnsignedLong k = 0; k < dimension_; ++k) mean[t][k] = sum[t * dimension_ + k];
+  return TimeSeries(timeGrid_, mean);
 }
 
 /* Compute the sample of temporal means of each time series */
 NumericalSample ProcessSample::computeTemporalMean() const
 {
-  const UnsignedLong size(getSize());
-  const UnsignedLong dimension(getDimension());
-  NumericalSample result(size, dimension);
-  for (UnsignedLong i = 0; i < size; ++i) result[i] = data_[i].getTemporalMean();
+  const UnsignedLong length(timeGrid_.getN());
+  NumericalSample result(size_, dimension_);
+  const NumericalScalar * values(getValues());
+  for (UnsignedLong i = 0; i < size_; ++i)
+    {
+      NumericalPoint mean(dimension_, 0.0);
+      for (UnsignedLong t = 0; t < length; ++t)
+        for (UnsignedLong k = 0; k < dimension_; ++k)
+          {
+            mean[k] += *values;
+            ++values;
+          }
+      result[i] = mean * (1.0 / length);
+    }
   return result;
 }
 
@@ -197,23 +374,52 @@ NumericalSample ProcessSample::computeTemporalMean() const
  */
 TimeSeries ProcessSample::computeQuantilePerComponent(const NumericalScalar prob) const
 {
-  const UnsignedLong size(getSize());
-  if (size == 0) return TimeSeries();
-  if (size == 1) return data_[0];
+  if (size_ == 0) return TimeSeries();
+  if (size_ == 1) return getTimeSeries(0);
   // This initialization set the correct time grid into result
   TimeSeries result(timeGrid_, dimension_);
-  const UnsignedLong length(data_[0].getSize());
+  const UnsignedLong length(timeGrid_.getN());
+  const UnsignedLong blockSize(getBlockSize());
+  const NumericalScalar * values(getValues());
   // Loop over the time indices
-  for (UnsignedLong i = 0; i < length; ++i)
+  for (UnsignedLong t = 0; t < length; ++t)
     {
-      NumericalSample dataI(size, dimension_);
-      for (UnsignedLong j = 0; j < size; ++j)
-        dataI[j] = data_[j].getValueAtIndex(i);
-      result.getValueAtIndex(i) = dataI.computeQuantilePerComponent(prob);
+      NumericalSample dataT(size_, dimension_);
+      for (UnsignedLong i = 0; i < size_; ++i)
+        for (UnsignedLong k = 0; k < dimension_; ++k)
+          dataT[i][k] = values[i * blockSize + t * dimension_ + k];
+      result.getValueAtIndex(t) = dataT.computeQuantilePerComponent(prob);
     }
   return result;
 }
 
+/* Proportion of the time series taking at least one value in the given domain, as for EventProcess */
+NumericalScalar ProcessSample::computeEventProbability(const Domain & domain) const
+{
+  if (domain.getDimension() != dimension_) throw InvalidArgumentException(HERE) << "Error: expected a domain of dimension " << dimension_ << ", got a domain of dimension " << domain.getDimension();
+  if (size_ == 0) throw InternalException(HERE) << "Error: cannot compute the event probability of an empty process sample.";
+  const UnsignedLong length(timeGrid_.getN());
+  const UnsignedLong blockSize(getBlockSize());
+  const NumericalScalar * values(getValues());
+  NumericalPoint point(dimension_);
+  UnsignedLong count(0);
+  // A single pass over the values, each time series being left as soon as it enters the domain
+  for (UnsignedLong i = 0; i < size_; ++i)
+    {
+      const NumericalScalar * trajectory(values + i * blockSize);
+      for (UnsignedLong t = 0; t < length; ++t)
+        {
+          std::copy(trajectory + t * dimension_, trajectory + (t + 1) * dimension_, point.begin());
+          if (domain.contains(point))
+            {
+              ++count;
+              break;
+            }
+        }
+    }
+  return static_cast<NumericalScalar>(count) / size_;
+}
+
 /* Draw a marginal of the ProcessSample, ie the collection of all the TimeSeries marginals */
 Graph ProcessSample::drawMarginal(const UnsignedLong index) const
 {
@@ -223,32 +429,113 @@ Graph ProcessSample::drawMarginal(const UnsignedLong index) const
   const String title(OSS() << getName() << " - " << index << " marginal" );
   Graph graph(title, "Time", "Values", true, "topright");
   const UnsignedLong maxColors(Drawable::GetValidColors().getSize());
-  const UnsignedLong size(data_.getSize());
-  for (UnsignedLong i = 0; i < size; ++i)
+  for (UnsignedLong i = 0; i < size_; ++i)
     {
-      Drawable drawable(data_[i].drawMarginal(index).getDrawable(0));
+      Drawable drawable(getTimeSeries(i).drawMarginal(index).getDrawable(0));
       drawable.setColor(Drawable::GetValidColors()[i % maxColors]);
       graph.add(drawable);
     }
   return graph;
 }
 
+/* Export the sample into a binary file */
+void ProcessSample::exportToBinaryFile(const FileName & fileName,
+                                       const Bool append) const
+{
+  ProcessSampleFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic_, ProcessSampleMagic, sizeof(ProcessSampleMagic));
+  header.size_ = size_;
+  header.dimension_ = dimension_;
+  header.n_ = timeGrid_.getN();
+  header.start_ = timeGrid_.getStart();
+  header.step_ = timeGrid_.getStep();
+  std::fstream file;
+  if (append) file.open(fileName.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+  if (file.is_open())
+    {
+      // The file already holds a sample: the new time series are added after its values
+      const ProcessSampleFileHeader previous(ReadProcessSampleFileHeader(file, fileName));
+      if ((previous.dimension_ != header.dimension_) || (previous.n_ != header.n_) || (previous.start_ != header.start_) || (previous.step_ != header.step_)) throw InvalidArgumentException(HERE) << "Error: the sample stored in the file " << fileName << " has a dimension or a time grid incompatible with the sample to append";
+      header.size_ += previous.size_;
+      file.seekp(sizeof(header) + previous.size_ * getBlockSize() * sizeof(NumericalScalar));
+    }
+  else
+    {
+      file.clear();
+      file.open(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+      if (!file.is_open()) throw FileOpenException(HERE) << "Error: cannot open the file " << fileName;
+      file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+  if (size_ > 0) file.write(reinterpret_cast<const char *>(getValues()), size_ * getBlockSize() * sizeof(NumericalScalar));
+  // The size is updated once the values are written
+  file.seekp(0);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  if (!file) throw FileOpenException(HERE) << "Error: cannot write into the file " << fileName;
+}
+
+/* Import a sample from a binary file */
+ProcessSample ProcessSample::ImportFromBinaryFile(const FileName & fileName)
+{
+  std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+  if (!file.is_open()) throw FileOpenException(HERE) << "Error: cannot open the file " << fileName;
+  const ProcessSampleFileHeader header(ReadProcessSampleFileHeader(file, fileName));
+  ProcessSample result;
+  result.dimension_ = header.dimension_;
+  result.timeGrid_ = RegularGrid(header.start_, header.step_, header.n_);
+  result.size_ = header.size_;
+  const UnsignedLong valuesNumber(result.size_ * result.getBlockSize());
+  if (valuesNumber == 0) return result;
+#ifdef HAVE_SYS_MMAN_H
+  result.p_mapping_ = new ProcessSampleMapping(fileName, valuesNumber);
+#else
+  result.data_.resize(valuesNumber);
+  file.read(reinterpret_cast<char *>(&result.data_[0]), valuesNumber * sizeof(NumericalScalar));
+  if (!file) throw FileOpenException(HERE) << "Error: the file " << fileName << " is truncated";
+#endif
+  return result;
+}
+
+/* Tell if the values are memory-mapped from a file */
+Bool ProcessSample::isMemoryMapped() const
+{
+  return !p_mapping_.isNull();
+}
+
 /* Method save() stores the object through the StorageManager */
 void ProcessSample::save(Advocate & adv) const
 {
   PersistentObject::save(adv);
   adv.saveAttribute( "dimension_", dimension_);
   adv.saveAttribute( "timeGrid_", timeGrid_);
-  adv.saveAttribute( "data_", data_ );
+  adv.saveAttribute( "size_", size_);
+  if (p_mapping_.isNull()) adv.saveAttribute( "data_", data_ );
+  else
+    {
+      const NumericalScalar * values(p_mapping_->getValues());
+      adv.saveAttribute( "data_", InternalType(values, values + size_ * getBlockSize()) );
+    }
 }
 
 /* Method load() reloads the object from the StorageManager */
 void ProcessSample::load(Advocate & adv)
 {
   PersistentObject::load(adv);
+  p_mapping_.reset();
   adv.loadAttribute( "dimension_", dimension_);
   adv.loadAttribute( "timeGrid_", timeGrid_);
-  adv.loadAttribute( "data_", data_ );
+  if (adv.hasAttribute( "size_" ))
+    {
+      adv.loadAttribute( "size_", size_);
+      adv.loadAttribute( "data_", data_ );
+      return;
+    }
+  // Former format, where the time series were stored as a collection
+  TimeSeriesPersistentCollection timeSeriesCollection;
+  adv.loadAttribute( "data_", timeSeriesCollection );
+  size_ = timeSeriesCollection.getSize();
+  data_ = InternalType(size_ * getBlockSize());
+  for (UnsignedLong i = 0; i < size_; ++i) setTimeSeries(i, timeSeriesCollection[i]);
 }
 
 END_NAMESPACE_OPENTURNS
@@ -32,9 +32,12 @@
 #include "NumericalSample.hxx"
 #include "Collection.hxx"
 #include "PersistentCollection.hxx"
+#include "Pointer.hxx"
+#include "Domain.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
+class ProcessSampleMapping;
 
 
 
@@ -42,6 +45,12 @@ BEGIN_NAMESPACE_OPENTURNS
  * @class ProcessSample
  *
  * An interface for time series
+ *
+ * The values of all the time series are stored in a single contiguous block
+ * sharing one time grid: the kth component of the ith time series at the tth
+ * time stamp is at position (i * n + t) * dimension + k, n being the number of
+ * time stamps. The block can also be memory-mapped from a binary file, in which
+ * case it is copied into memory only when it is modified.
  */
 class ProcessSample
   : public PersistentObject
@@ -53,7 +62,7 @@ public:
   /** Some typedefs to ease reading */
   typedef Collection<TimeSeries>               TimeSeriesCollection;
   typedef PersistentCollection<TimeSeries>     TimeSeriesPersistentCollection;
-  typedef TimeSeriesPersistentCollection             InternalType;
+  typedef PersistentCollection<NumericalScalar>      InternalType;
 
   /** Default constructor */
   ProcessSample();
@@ -71,12 +80,65 @@ public:
 
 #ifndef SWIG
 
-  /** Operators accessors */
-  TimeSeries & operator [] (const UnsignedLong i);
-  const TimeSeries & operator [] (const UnsignedLong i) const;
+  /**
+   * Reference to one time series of a sample. As the values are stored contiguously,
+   * it converts into a copy of the time series and it writes the values assigned to it
+   * back into the sample.
+   */
+  class TimeSeriesReference
+  {
+  public:
+    TimeSeriesReference(ProcessSample & sample,
+                        const UnsignedLong index)
+      : sample_(sample), index_(index) {}
+
+    operator TimeSeries () const
+    {
+      return sample_.getTimeSeries(index_);
+    }
+
+    TimeSeriesReference & operator = (const TimeSeries & timeSeries)
+    {
+      sample_.setTimeSeries(index_, timeSeries);
+      return *this;
+    }
+
+    TimeSeriesReference & operator = (const TimeSeriesReference & other)
+    {
+      sample_.setTimeSeries(index_, other);
+      return *this;
+    }
+
+  private:
+    ProcessSample & sample_;
+    UnsignedLong index_;
+  }; /* class TimeSeriesReference */
+
+  /** Time series accessors. The values are accessed one at a time with operator () */
+  TimeSeriesReference operator [] (const UnsignedLong i);
+  const TimeSeries operator [] (const UnsignedLong i) const;
+
+  /** Value accessors: kth component of the ith time series at the tth time stamp */
+  inline NumericalScalar & operator () (const UnsignedLong i,
+                                        const UnsignedLong t,
+                                        const UnsignedLong k)
+  {
+    // Only memory-mapped values have to be copied before being modified
+    if (!p_mapping_.isNull()) copyOnWrite();
+    return data_[(i * timeGrid_.getN() + t) * dimension_ + k];
+  }
+
+  const NumericalScalar & operator () (const UnsignedLong i,
+                                       const UnsignedLong t,
+                                       const UnsignedLong k) const;
 
 #endif
 
+  /** Time series accessors */
+  TimeSeries getTimeSeries(const UnsignedLong i) const;
+  void setTimeSeries(const UnsignedLong i,
+                     const TimeSeries & timeSeries);
+
   /** Method __getitem__() for Python */
   TimeSeries __getitem__ (const UnsignedLong i) const;
 
@@ -109,9 +171,22 @@ public:
   /**  Method computeQuantilePerComponent() gives the quantile per component of the sample */
   TimeSeries computeQuantilePerComponent(const NumericalScalar prob) const;
 
+  /** Proportion of the time series taking at least one value in the given domain */
+  NumericalScalar computeEventProbability(const Domain & domain) const;
+
   /** Draw a marginal of the timeSerie */
   Graph drawMarginal(const UnsignedLong index = 0) const;
 
+  /** Export the sample into a binary file, possibly appending it to the sample already stored in the file */
+  void exportToBinaryFile(const FileName & fileName,
+                          const Bool append = false) const;
+
+  /** Import a sample from a binary file, memory-mapping its values when the platform allows it */
+  static ProcessSample ImportFromBinaryFile(const FileName & fileName);
+
+  /** Tell if the values are memory-mapped from a file */
+  Bool isMemoryMapped() const;
+
   /** Method save() stores the object through the StorageManager */
   void save(Advocate & adv) const;
 
@@ -120,9 +195,14 @@ public:
 
 private:
 
-  /* To be optimized by :
-   * keeping 1 timeGrid
-   * concatenate Numerical data into a NumericalSample*/
+  /** Number of values of one time series */
+  UnsignedLong getBlockSize() const;
+
+  /** Address of the values */
+  const NumericalScalar * getValues() const;
+
+  /** Copy the memory-mapped values into memory before any modification */
+  void copyOnWrite();
 
   /** Dimension of the process sample, ie the dimension of the underlying time series */
   UnsignedLong dimension_;
@@ -130,8 +210,14 @@ private:
   /** TimeGrid on which the ProcessSample focuses */
   RegularGrid timeGrid_;
 
-  /** NumericalSample which stocks the data */
-  TimeSeriesPersistentCollection data_;
+  /** Number of time series */
+  UnsignedLong size_;
+
+  /** Values of all the time series, stored contiguously */
+  InternalType data_;
+
+  /** Memory-mapped values, if any */
+  Pointer<ProcessSampleMapping> p_mapping_;
 
 }; /* class ProcessSample */
 
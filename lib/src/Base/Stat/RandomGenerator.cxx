@@ -32,6 +32,8 @@ Bool RandomGenerator::IsInitialized = false;
 
 RandomGenerator::MersenneTwister RandomGenerator::Generator(ResourceMap::GetAsUnsignedLong( "RandomGenerator-InitialSeed" ));
 
+__thread RandomGenerator::MersenneTwister * RandomGenerator::P_LocalGenerator = 0;
+
 /* Sub-classes methods */
 
 // Stream operator for State objects
@@ -52,6 +54,31 @@ RandomGenerator::RandomGenerator()
   // Nothing to do
 }
 
+/* Redirect the generation of the calling thread to the given generator */
+RandomGenerator::LocalStream::LocalStream(MersenneTwister & generator)
+  : p_previousGenerator_(P_LocalGenerator)
+{
+  P_LocalGenerator = &generator;
+}
+
+/* Restore the previous generator of the calling thread */
+RandomGenerator::LocalStream::~LocalStream()
+{
+  P_LocalGenerator = p_previousGenerator_;
+}
+
+/* The generator used by the calling thread: its local stream if any, the global generator otherwise */
+RandomGenerator::MersenneTwister & RandomGenerator::GetGenerator()
+{
+  if (P_LocalGenerator != 0) return *P_LocalGenerator;
+  if (!IsInitialized)
+    {
+      SetSeed(ResourceMap::GetAsUnsignedLong( "RandomGenerator-InitialSeed" ));
+      IsInitialized = true;
+    }
+  return Generator;
+}
+
 /* Seed accessor */
 void RandomGenerator::SetSeed(const UnsignedLong seed)
 {
@@ -89,38 +116,21 @@ RandomGeneratorState RandomGenerator::GetState()
 /* Generate a pseudo-random number uniformly distributed over ]0, 1[ */
 NumericalScalar RandomGenerator::Generate()
 {
-  if (!IsInitialized)
-    {
-      SetSeed(ResourceMap::GetAsUnsignedLong( "RandomGenerator-InitialSeed" ));
-      IsInitialized = true;
-    }
-  return Generator.gen();
+  return GetGenerator().gen();
 }
 
 /* Generate a pseudo-random integer uniformly distributed over [[0,...,n-1]] */
 UnsignedLong RandomGenerator::IntegerGenerate(const UnsignedLong n)
 {
-  if (!IsInitialized)
-    {
-      SetSeed(ResourceMap::GetAsUnsignedLong( "RandomGenerator-InitialSeed" ));
-      IsInitialized = true;
-    }
-  return Generator.igen((uint32_t)(n));
+  return GetGenerator().igen((uint32_t)(n));
 }
 
 /* Generate a pseudo-random vector of numbers uniformly distributed over ]0, 1[ */
 NumericalPoint RandomGenerator::Generate(const UnsignedLong size)
 {
   NumericalPoint result(size);
-  if (!IsInitialized)
-    {
-      SetSeed(ResourceMap::GetAsUnsignedLong( "RandomGenerator-InitialSeed" ));
-      IsInitialized = true;
-    }
-  for (UnsignedLong i = 0; i < size; i++)
-    {
-      result[i] = Generator.gen();
-    }
+  // The values are copied block by block from the internal buffer of the generator
+  if (size > 0) GetGenerator().gen(&result[0], (uint32_t)(size));
   return result;
 }
 
@@ -128,14 +138,10 @@ NumericalPoint RandomGenerator::Generate(const UnsignedLong size)
 RandomGenerator::UnsignedLongCollection RandomGenerator::IntegerGenerate(const UnsignedLong size, const UnsignedLong n)
 {
   UnsignedLongCollection result(size);
-  if (!IsInitialized)
-    {
-      SetSeed(ResourceMap::GetAsUnsignedLong( "RandomGenerator-InitialSeed" ));
-      IsInitialized = true;
-    }
+  MersenneTwister & generator(GetGenerator());
   for (UnsignedLong i = 0; i < size; i++)
     {
-      result[i] = Generator.igen((uint32_t)(n));
+      result[i] = generator.igen((uint32_t)(n));
     }
   return result;
 }
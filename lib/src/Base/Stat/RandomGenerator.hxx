@@ -90,9 +90,29 @@ public:
   /** Generate a pseudo-random vector of integers uniformly distributed over [[0,...,n-1]] */
   static UnsignedLongCollection IntegerGenerate(const UnsignedLong size, const UnsignedLong n);
 
+#ifndef SWIG
+  /** Redirect the generation of the calling thread to the given generator while the object lives */
+  class LocalStream
+  {
+  public:
+    explicit LocalStream(MersenneTwister & generator);
+    ~LocalStream();
+  private:
+    LocalStream(const LocalStream & other);
+    LocalStream & operator = (const LocalStream & other);
+    MersenneTwister * p_previousGenerator_;
+  }; /* class LocalStream */
+
+  /** The generator used by the calling thread, to be fetched once by the algorithms drawing many values */
+  static MersenneTwister & GetGenerator();
+#endif
+
 private:
   static Bool IsInitialized;
   static MersenneTwister Generator;
+#ifndef SWIG
+  static __thread MersenneTwister * P_LocalGenerator;
+#endif
 
 }; /* class RandomGenerator */
 
@@ -26,6 +26,9 @@
 #include "OTconfig.hxx"
 #include "Pie.hxx"
 #include "Description.hxx"
+#include "MPI.hxx"
+#include "TBB.hxx"
+#include "RandomGenerator.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -37,6 +40,7 @@ SensitivityAnalysis::SensitivityAnalysis(const NumericalSample & inputSample1,
   inputSample1_(inputSample1),
   inputSample2_(inputSample2),
   model_(model),
+  bootstrapSize_(ResourceMap::GetAsUnsignedLong( "SensitivityAnalysis-DefaultBootstrapSize" )),
   alreadyComputedOrder_(0)
 {
   if (inputSample1_.getDimension() != inputSample2_.getDimension()) throw InvalidDimensionException(HERE) << "Error: input samples must have the same dimension";
@@ -48,129 +52,286 @@ SensitivityAnalysis::SensitivityAnalysis(const NumericalSample & inputSample1,
   blockSize_ = std::min( size, ResourceMap::GetAsUnsignedLong( "SensitivityAnalysis-DefaultBlockSize" ) );
 }
 
-/* Compute all the Sobol indices */
-void SensitivityAnalysis::computeSobolIndices(const UnsignedLong order) const
+/* Functor computing the statistics of the pick-freeze design, each bootstrap super-block merging its blocks in order */
+struct SensitivityAnalysisBlockFunctor
+{
+  const SensitivityAnalysis & analysis_;
+  const UnsignedLong order_;
+  const UnsignedLong blockNumber_;
+  const UnsignedLong first_;
+  const UnsignedLong stride_;
+  Collection<NumericalPoint> & superBlockStatistics_;
+
+  SensitivityAnalysisBlockFunctor(const SensitivityAnalysis & analysis,
+                                  const UnsignedLong order,
+                                  const UnsignedLong blockNumber,
+                                  const UnsignedLong first,
+                                  const UnsignedLong stride,
+                                  Collection<NumericalPoint> & superBlockStatistics)
+    : analysis_(analysis), order_(order), blockNumber_(blockNumber), first_(first), stride_(stride), superBlockStatistics_(superBlockStatistics) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    const UnsignedLong superBlockNumber( superBlockStatistics_.getSize() );
+    for (UnsignedLong i = r.begin(); i != r.end(); ++i)
+      {
+        const UnsignedLong superBlockIndex(first_ + i * stride_);
+        // the super-block gathers the blocks [superBlockIndex * blockNumber / superBlockNumber, (superBlockIndex + 1) * blockNumber / superBlockNumber[
+        const UnsignedLong firstBlock( ( superBlockIndex * blockNumber_ ) / superBlockNumber );
+        const UnsignedLong lastBlock( ( ( superBlockIndex + 1 ) * blockNumber_ ) / superBlockNumber );
+        for ( UnsignedLong blockIndex = firstBlock; blockIndex < lastBlock; ++ blockIndex )
+          analysis_.mergeStatistics( superBlockStatistics_[superBlockIndex], analysis_.computeBlockStatistics( blockIndex, order_ ), order_ );
+      }
+  }
+}; /* end struct SensitivityAnalysisBlockFunctor */
+
+/* Number of statistics accumulated per block */
+UnsignedLong SensitivityAnalysis::getStatisticDimension(const UnsignedLong order) const
 {
   const UnsignedLong inputDimension( inputSample1_.getDimension() );
-  const UnsignedLong outputDimension( model_.getOutputDimension() );
-  const UnsignedLong size( inputSample1_.getSize() );
+  const UnsignedLong pairNumber( order >= 2 ? ( inputDimension * ( inputDimension - 1 ) ) / 2 : 0 );
+  const UnsignedLong meanNumber( order >= 2 ? 2 + 2 * inputDimension : 2 + inputDimension );
+  // the block size, then for each output: the means of yA, yB, yCk and yDk (only for 2nd order), and the centered
+  // cross moments sum((yA-mA)^2), sum((yA-mA)(yB-mB)), sum((yCk-mCk)(yB-mB)), sum((yCk-mCk)(yA-mA)) and sum((yCk1-mCk1)(yDk2-mDk2)) for k2 < k1
+  return 1 + model_.getOutputDimension() * ( meanNumber + 2 + 2 * inputDimension + pairNumber );
+}
 
-  // allocate indices
-  firstOrderIndice_ = NumericalSample( outputDimension, inputDimension );
-  totalOrderIndice_ = NumericalSample( outputDimension, inputDimension );
-  if (order >= 2)
+/* Evaluate the pick-freeze design of the given block and compute its statistics */
+NumericalPoint SensitivityAnalysis::computeBlockStatistics(const UnsignedLong blockIndex,
+                                                           const UnsignedLong order) const
+{
+  const UnsignedLong inputDimension( inputSample1_.getDimension() );
+  const UnsignedLong outputDimension( model_.getOutputDimension() );
+  const UnsignedLong start( blockIndex * blockSize_ );
+  const UnsignedLong effectiveBlockSize( std::min( blockSize_, inputSample1_.getSize() - start ) );
+
+  // the whole design of the block is submitted to the model at once: A, B, A with the k-th column of B for each k
+  // and, only for 2nd order, B with the k-th column of A for each k
+  const UnsignedLong replicationNumber( order >= 2 ? 2 + 2 * inputDimension : 2 + inputDimension );
+  NumericalSample design( replicationNumber * effectiveBlockSize, inputDimension );
+  for ( UnsignedLong i = 0; i < effectiveBlockSize; ++ i )
     {
-      secondOrderIndice_ = SymmetricTensor( inputDimension, outputDimension );
+      const NumericalPoint pointA( inputSample1_[start + i] );
+      const NumericalPoint pointB( inputSample2_[start + i] );
+      design[i] = pointA;
+      design[effectiveBlockSize + i] = pointB;
+      for ( UnsignedLong k = 0; k < inputDimension; ++ k )
+        {
+          const UnsignedLong indexC( ( 2 + k ) * effectiveBlockSize + i );
+          design[indexC] = pointA;
+          design[indexC][k] = pointB[k];
+          if ( order >= 2 )
+            {
+              const UnsignedLong indexD( ( 2 + inputDimension + k ) * effectiveBlockSize + i );
+              design[indexD] = pointB;
+              design[indexD][k] = pointA[k];
+            }
+        }
     }
+  const NumericalSample output( model_( design ) );
 
-  // this avoids to store huge input samples while allowing for multi-threading
-  const UnsignedLong maximumOuterSampling( static_cast<UnsignedLong>( ceil( 1.0 * size / blockSize_ ) ) );
-  const UnsignedLong modulo ( size % blockSize_ );
-  const UnsignedLong lastBlockSize( modulo == 0 ? blockSize_ : modulo );
-
-  // 2*N evaluations
-  const NumericalSample outputSample1( model_(inputSample1_) );
-  const NumericalSample outputSample2( model_(inputSample2_) );
-
-  NumericalPoint sample1SquareMean( outputSample1.computeMean() );// mean over one sample, used for total order indices
+  // the moments are centered within the block, the blocks being merged pairwise afterwards
+  NumericalPoint statistics( getStatisticDimension( order ), 0.0 );
+  statistics[0] = effectiveBlockSize;
+  const UnsignedLong outputStride( ( getStatisticDimension( order ) - 1 ) / outputDimension );
   for ( UnsignedLong j = 0; j < outputDimension; ++ j )
     {
-      sample1SquareMean[j] *=  sample1SquareMean[j];
-    }
-  NumericalPoint crossSquareMean( outputDimension, 0.0 );// cross-mean over both samples, used for 1st order indices
-  for ( UnsignedLong i = 0; i < size; ++ i)
-    {
-      for ( UnsignedLong j = 0; j < outputDimension; ++ j )
+      const UnsignedLong offset( 1 + j * outputStride );
+      const UnsignedLong momentOffset( offset + replicationNumber );
+      for ( UnsignedLong r = 0; r < replicationNumber; ++ r )
         {
-          crossSquareMean[j] += outputSample1[i][j] * outputSample2[i][j] / size;
+          NumericalScalar mean( 0.0 );
+          for ( UnsignedLong i = 0; i < effectiveBlockSize; ++ i ) mean += output[r * effectiveBlockSize + i][j];
+          statistics[offset + r] = mean / effectiveBlockSize;
         }
-    }
-  const NumericalPoint sample1Variance( outputSample1.computeVariancePerComponent() );
-
-  // for each block ...
-  for ( UnsignedLong outerSampling = 0; outerSampling < maximumOuterSampling; ++ outerSampling )
-    {
-      // the last block can be smaller
-      const UnsignedLong effectiveBlockSize( outerSampling < ( maximumOuterSampling - 1 ) ? blockSize_ : lastBlockSize );
-
-      // k*N evaluations
-      NumericalSample scrambledAllOutputBlock1( 0, outputDimension );
-
-      // k*N evaluations ( only 2nd order )
-      NumericalSample scrambledAllOutputBlock2( 0, outputDimension );
-
-      for ( UnsignedLong k1 = 0; k1 < inputDimension; ++ k1 )
+      const NumericalScalar meanA( statistics[offset] );
+      const NumericalScalar meanB( statistics[offset + 1] );
+      for ( UnsignedLong i = 0; i < effectiveBlockSize; ++ i )
         {
-          NumericalSample scrambledInputBlock1( effectiveBlockSize, inputDimension );
-          for ( UnsignedLong blockIndex = 0; blockIndex < effectiveBlockSize; ++ blockIndex )
-            {
-              scrambledInputBlock1[blockIndex] = inputSample1_[outerSampling * blockSize_ + blockIndex];
-              scrambledInputBlock1[blockIndex][k1] = inputSample2_[outerSampling * blockSize_ + blockIndex][k1];
-            }
-          const NumericalSample scrambledOutputBlock1( model_( scrambledInputBlock1 ) );
-          scrambledAllOutputBlock1.add( scrambledOutputBlock1 );
-
-          if ( order >= 2 )
-            {
-              NumericalSample scrambledInputBlock2( effectiveBlockSize , inputDimension );
-              for ( UnsignedLong blockIndex = 0; blockIndex < effectiveBlockSize; ++ blockIndex )
-                {
-                  scrambledInputBlock2[blockIndex] = inputSample2_[outerSampling * blockSize_ + blockIndex];
-                  scrambledInputBlock2[blockIndex][k1] = inputSample1_[outerSampling * blockSize_ + blockIndex][k1];
-                }
-              const NumericalSample scrambledOutputBlock2( model_( scrambledInputBlock2 ) );
-              scrambledAllOutputBlock2.add( scrambledOutputBlock2 );
-            }
-
-          for ( UnsignedLong j = 0; j < outputDimension; ++ j )
+          const NumericalScalar yA( output[i][j] - meanA );
+          const NumericalScalar yB( output[effectiveBlockSize + i][j] - meanB );
+          statistics[momentOffset] += yA * yA;
+          statistics[momentOffset + 1] += yA * yB;
+          for ( UnsignedLong k1 = 0; k1 < inputDimension; ++ k1 )
             {
-              for ( UnsignedLong blockIndex = 0; blockIndex < effectiveBlockSize; ++ blockIndex )
+              // this is the core idea of the Saltelli 2002 algorithm
+              const NumericalScalar yC( output[( 2 + k1 ) * effectiveBlockSize + i][j] - statistics[offset + 2 + k1] );
+              statistics[momentOffset + 2 + k1] += yC * yB;
+              statistics[momentOffset + 2 + inputDimension + k1] += yC * yA;
+              if ( order >= 2 )
                 {
-                  // this is the core idea of the Saltelli 2002 algorithm
-                  firstOrderIndice_[j][k1] += scrambledOutputBlock1[blockIndex][j] * outputSample2[outerSampling * blockSize_ + blockIndex][j] / ( size - 1 );
-                  totalOrderIndice_[j][k1] += scrambledOutputBlock1[blockIndex][j] * outputSample1[outerSampling * blockSize_ + blockIndex][j] / ( size - 1 );
-                  if ( order >= 2 )
-                    {
-                      for ( UnsignedLong k2 = 0; k2 < k1; ++ k2 )
-                        {
-                          // here we could also get the closed second order effects with the same trick as above without any further computation
-                          secondOrderIndice_(k1, k2, j) += scrambledAllOutputBlock1[k1 * effectiveBlockSize + blockIndex][j] * scrambledAllOutputBlock2[k2 * effectiveBlockSize + blockIndex][j] / (size - 1);
-                        }
-                    }
+                  // here we could also get the closed second order effects with the same trick as above without any further computation
+                  for ( UnsignedLong k2 = 0; k2 < k1; ++ k2 )
+                    statistics[momentOffset + 2 + 2 * inputDimension + ( k1 * ( k1 - 1 ) ) / 2 + k2] += yC * ( output[( 2 + inputDimension + k2 ) * effectiveBlockSize + i][j] - statistics[offset + 2 + inputDimension + k2] );
                 }
             }
         }
+    }
+  return statistics;
+}
 
+/* Merge the statistics of another set of points into the given ones */
+void SensitivityAnalysis::mergeStatistics(NumericalPoint & statistics,
+                                          const NumericalPoint & other,
+                                          const UnsignedLong order) const
+{
+  const NumericalScalar size( statistics[0] );
+  const NumericalScalar otherSize( other[0] );
+  if ( otherSize == 0.0 ) return;
+  if ( size == 0.0 )
+    {
+      statistics = other;
+      return;
     }
+  const UnsignedLong inputDimension( inputSample1_.getDimension() );
+  const UnsignedLong outputDimension( model_.getOutputDimension() );
+  const UnsignedLong replicationNumber( order >= 2 ? 2 + 2 * inputDimension : 2 + inputDimension );
+  const UnsignedLong outputStride( ( statistics.getDimension() - 1 ) / outputDimension );
+  const NumericalScalar totalSize( size + otherSize );
+  // the centered cross moments of the union are sum((x-mx)(y-my)) + sum'((x-mx')(y-my')) + (mx'-mx)(my'-my) * n * n' / (n + n')
+  const NumericalScalar factor( size * ( otherSize / totalSize ) );
+  NumericalPoint delta( replicationNumber );
+  for ( UnsignedLong j = 0; j < outputDimension; ++ j )
+    {
+      const UnsignedLong offset( 1 + j * outputStride );
+      const UnsignedLong momentOffset( offset + replicationNumber );
+      for ( UnsignedLong r = 0; r < replicationNumber; ++ r ) delta[r] = other[offset + r] - statistics[offset + r];
+      statistics[momentOffset] += other[momentOffset] + delta[0] * delta[0] * factor;
+      statistics[momentOffset + 1] += other[momentOffset + 1] + delta[0] * delta[1] * factor;
+      for ( UnsignedLong k1 = 0; k1 < inputDimension; ++ k1 )
+        {
+          statistics[momentOffset + 2 + k1] += other[momentOffset + 2 + k1] + delta[2 + k1] * delta[1] * factor;
+          statistics[momentOffset + 2 + inputDimension + k1] += other[momentOffset + 2 + inputDimension + k1] + delta[2 + k1] * delta[0] * factor;
+          if ( order >= 2 )
+            for ( UnsignedLong k2 = 0; k2 < k1; ++ k2 )
+              {
+                const UnsignedLong index( momentOffset + 2 + 2 * inputDimension + ( k1 * ( k1 - 1 ) ) / 2 + k2 );
+                statistics[index] += other[index] + delta[2 + k1] * delta[2 + inputDimension + k2] * factor;
+              }
+        }
+      for ( UnsignedLong r = 0; r < replicationNumber; ++ r ) statistics[offset + r] += delta[r] * ( otherSize / totalSize );
+    }
+  statistics[0] = totalSize;
+}
 
-  // normalize indices
+/* Compute the indices from the merged statistics of the blocks */
+void SensitivityAnalysis::computeIndices(const NumericalPoint & statistics,
+                                         const UnsignedLong order,
+                                         NumericalSample & firstOrderIndice,
+                                         NumericalSample & totalOrderIndice,
+                                         SymmetricTensor & secondOrderIndice,
+                                         const Bool checkRange) const
+{
+  const UnsignedLong inputDimension( inputSample1_.getDimension() );
+  const UnsignedLong outputDimension( model_.getOutputDimension() );
+  const UnsignedLong replicationNumber( order >= 2 ? 2 + 2 * inputDimension : 2 + inputDimension );
+  const NumericalScalar size( statistics[0] );
+  const UnsignedLong outputStride( ( statistics.getDimension() - 1 ) / outputDimension );
+  firstOrderIndice = NumericalSample( outputDimension, inputDimension );
+  totalOrderIndice = NumericalSample( outputDimension, inputDimension );
+  if ( order >= 2 ) secondOrderIndice = SymmetricTensor( inputDimension, outputDimension );
   for ( UnsignedLong j = 0; j < outputDimension; ++ j )
     {
+      const UnsignedLong offset( 1 + j * outputStride );
+      const UnsignedLong momentOffset( offset + replicationNumber );
+      // the estimators are applied to the output centered by the mean of yA: the centered cross moment of yX and yY is then
+      // sum((yX-mA)(yY-mA)) = sum((yX-mX)(yY-mY)) + n (mX-mA)(mY-mA)
+      const NumericalScalar meanA( statistics[offset] );
+      const NumericalScalar shiftB( statistics[offset + 1] - meanA );
+      const NumericalScalar crossSquareMean( statistics[momentOffset + 1] / size );// cross-mean over both samples, used for 1st order indices
+      const NumericalScalar sample1Variance( statistics[momentOffset] / ( size - 1 ) );
       for ( UnsignedLong k = 0; k < inputDimension; ++ k )
         {
-          firstOrderIndice_[j][k] = (firstOrderIndice_[j][k] - crossSquareMean[j]) / sample1Variance[j];
-          if ((firstOrderIndice_[j][k] < 0.0) || (firstOrderIndice_[j][k] > 1.0)) LOGWARN(OSS() << "The estimated first order total Sobol index (" << k << ") is not in the range [0, 1]. You may increase the sampling size.");
-
-          totalOrderIndice_[j][k] = 1.0 - (totalOrderIndice_[j][k] - sample1SquareMean[j]) / sample1Variance[j];
-          if ((totalOrderIndice_[j][k] < 0.0) || (totalOrderIndice_[j][k] > 1.0)) LOGWARN(OSS() << "The estimated total order total Sobol index (" << k << ") is not in the range [0, 1]. You may increase the sampling size.");
+          const NumericalScalar shiftC( statistics[offset + 2 + k] - meanA );
+          firstOrderIndice[j][k] = ( ( statistics[momentOffset + 2 + k] + size * shiftC * shiftB ) / ( size - 1 ) - crossSquareMean ) / sample1Variance;
+          if (checkRange && ((firstOrderIndice[j][k] < 0.0) || (firstOrderIndice[j][k] > 1.0))) LOGWARN(OSS() << "The estimated first order total Sobol index (" << k << ") is not in the range [0, 1]. You may increase the sampling size.");
 
+          totalOrderIndice[j][k] = 1.0 - ( statistics[momentOffset + 2 + inputDimension + k] / ( size - 1 ) ) / sample1Variance;
+          if (checkRange && ((totalOrderIndice[j][k] < 0.0) || (totalOrderIndice[j][k] > 1.0))) LOGWARN(OSS() << "The estimated total order total Sobol index (" << k << ") is not in the range [0, 1]. You may increase the sampling size.");
         }
       if (order >= 2)
         {
           for ( UnsignedLong k1 = 0; k1 < inputDimension; ++ k1 )
             {
+              const NumericalScalar shiftC( statistics[offset + 2 + k1] - meanA );
               for ( UnsignedLong k2 = 0; k2 < k1; ++ k2 )
                 {
-                  secondOrderIndice_(k1, k2, j) = (secondOrderIndice_(k1, k2, j) - crossSquareMean[j]) / sample1Variance[j] - firstOrderIndice_[j][k1] - firstOrderIndice_[j][k2];
-                  if ((secondOrderIndice_(k1, k2, j) < 0.0) || (secondOrderIndice_(k1, k2, j) > 1.0)) LOGWARN(OSS() << "The estimated second order Sobol index (" << k1 << ", " << k2 << ") is not in the range [0, 1]. You may increase the sampling size.");
+                  const NumericalScalar shiftD( statistics[offset + 2 + inputDimension + k2] - meanA );
+                  secondOrderIndice(k1, k2, j) = ( ( statistics[momentOffset + 2 + 2 * inputDimension + ( k1 * ( k1 - 1 ) ) / 2 + k2] + size * shiftC * shiftD ) / ( size - 1 ) - crossSquareMean ) / sample1Variance - firstOrderIndice[j][k1] - firstOrderIndice[j][k2];
+                  if (checkRange && ((secondOrderIndice(k1, k2, j) < 0.0) || (secondOrderIndice(k1, k2, j) > 1.0))) LOGWARN(OSS() << "The estimated second order Sobol index (" << k1 << ", " << k2 << ") is not in the range [0, 1]. You may increase the sampling size.");
                 }
             }
         }
     }
+}
+
+/* Compute all the Sobol indices */
+void SensitivityAnalysis::computeSobolIndices(const UnsignedLong order) const
+{
+  const UnsignedLong size( inputSample1_.getSize() );
+  const UnsignedLong statisticDimension( getStatisticDimension( order ) );
 
+  // this avoids to store huge input samples while allowing for multi-threading
+  const UnsignedLong blockNumber( static_cast<UnsignedLong>( ceil( 1.0 * size / blockSize_ ) ) );
+  // the blocks are merged into a fixed number of super-blocks, kept for the bootstrap
+  const UnsignedLong superBlockNumber( std::max( static_cast<UnsignedLong>( 1 ), std::min( blockNumber, ResourceMap::GetAsUnsignedLong( "SensitivityAnalysis-BootstrapBlockNumber" ) ) ) );
+
+  // the super-blocks are dealt between the processes: the current one is in charge of the super-blocks rank, rank + processNumber...
+  const MPICommunicator communicator( MPICommunicator::GetCommWorld() );
+  const UnsignedLong rank( communicator.getRank() );
+  const UnsignedLong processNumber( communicator.getSize() );
+  const UnsignedLong localSuperBlockNumber( rank < superBlockNumber ? ( superBlockNumber - rank + processNumber - 1 ) / processNumber : 0 );
+  Collection<NumericalPoint> superBlockStatistics( superBlockNumber, NumericalPoint( statisticDimension, 0.0 ) );
+  const SensitivityAnalysisBlockFunctor functor( *this, order, blockNumber, rank, processNumber, superBlockStatistics );
+  TBB::ParallelFor( 0, localSuperBlockNumber, functor );
+
+  // each super-block is computed by a single process, the others holding null statistics
+  blockStatistics_ = NumericalSample( superBlockNumber, statisticDimension );
+  if ( processNumber > 1 )
+    {
+      NumericalPoint allStatistics( superBlockNumber * statisticDimension );
+      for ( UnsignedLong superBlockIndex = 0; superBlockIndex < superBlockNumber; ++ superBlockIndex )
+        std::copy( superBlockStatistics[superBlockIndex].begin(), superBlockStatistics[superBlockIndex].end(), allStatistics.begin() + superBlockIndex * statisticDimension );
+      allStatistics = communicator.allReduceSum( allStatistics );
+      for ( UnsignedLong superBlockIndex = 0; superBlockIndex < superBlockNumber; ++ superBlockIndex )
+        for ( UnsignedLong i = 0; i < statisticDimension; ++ i ) blockStatistics_[superBlockIndex][i] = allStatistics[superBlockIndex * statisticDimension + i];
+    }
+  else
+    for ( UnsignedLong superBlockIndex = 0; superBlockIndex < superBlockNumber; ++ superBlockIndex ) blockStatistics_[superBlockIndex] = superBlockStatistics[superBlockIndex];
+
+  // the super-blocks are merged in order, so the indices do not depend on the scheduling
+  NumericalPoint statistics( statisticDimension, 0.0 );
+  for ( UnsignedLong superBlockIndex = 0; superBlockIndex < superBlockNumber; ++ superBlockIndex ) mergeStatistics( statistics, blockStatistics_[superBlockIndex], order );
+  computeIndices( statistics, order, firstOrderIndice_, totalOrderIndice_, secondOrderIndice_, true );
   alreadyComputedOrder_ = order;
 }
 
+/* Bootstrap confidence interval of the first or total order indices */
+Interval SensitivityAnalysis::computeBootstrapInterval(const UnsignedLong marginalIndex,
+                                                       const NumericalScalar level,
+                                                       const Bool firstOrder) const
+{
+  if ( ( level <= 0.0 ) || ( level >= 1.0 ) ) throw InvalidArgumentException(HERE) << "Error: the confidence level must be in ]0, 1[, here level=" << level;
+  if ( alreadyComputedOrder_ < 1 ) computeSobolIndices( 1 );
+  if ( marginalIndex >= model_.getOutputDimension() ) throw InvalidArgumentException(HERE) << "Error: the marginal index=" << marginalIndex << " must be less than the output dimension=" << model_.getOutputDimension();
+  const UnsignedLong inputDimension( inputSample1_.getDimension() );
+  const UnsignedLong superBlockNumber( blockStatistics_.getSize() );
+  const UnsignedLong statisticDimension( blockStatistics_.getDimension() );
+  // the super-blocks are independent, so the bootstrap samples are drawn among them
+  NumericalSample bootstrapIndices( bootstrapSize_, inputDimension );
+  NumericalSample firstOrderIndice;
+  NumericalSample totalOrderIndice;
+  SymmetricTensor secondOrderIndice;
+  for ( UnsignedLong n = 0; n < bootstrapSize_; ++ n )
+    {
+      const RandomGenerator::UnsignedLongCollection selection( RandomGenerator::IntegerGenerate( superBlockNumber, superBlockNumber ) );
+      NumericalPoint statistics( statisticDimension, 0.0 );
+      for ( UnsignedLong superBlockIndex = 0; superBlockIndex < superBlockNumber; ++ superBlockIndex ) mergeStatistics( statistics, blockStatistics_[selection[superBlockIndex]], alreadyComputedOrder_ );
+      computeIndices( statistics, alreadyComputedOrder_, firstOrderIndice, totalOrderIndice, secondOrderIndice, false );
+      bootstrapIndices[n] = firstOrder ? firstOrderIndice[marginalIndex] : totalOrderIndice[marginalIndex];
+    }
+  return Interval( bootstrapIndices.computeQuantilePerComponent( 0.5 * ( 1.0 - level ) ), bootstrapIndices.computeQuantilePerComponent( 0.5 * ( 1.0 + level ) ) );
+}
 
 /* First Order indices accessor */
 NumericalPoint SensitivityAnalysis::getFirstOrderIndices(const UnsignedLong marginalIndex) const
@@ -193,6 +354,20 @@ NumericalPoint SensitivityAnalysis::getTotalOrderIndices(const UnsignedLong marg
   return totalOrderIndice_[marginalIndex];
 }
 
+/* First order indices confidence interval accessor */
+Interval SensitivityAnalysis::getFirstOrderIndicesInterval(const UnsignedLong marginalIndex,
+                                                           const NumericalScalar level) const
+{
+  return computeBootstrapInterval( marginalIndex, level, true );
+}
+
+/* Total order indices confidence interval accessor */
+Interval SensitivityAnalysis::getTotalOrderIndicesInterval(const UnsignedLong marginalIndex,
+                                                           const NumericalScalar level) const
+{
+  return computeBootstrapInterval( marginalIndex, level, false );
+}
+
 /* Block size accessor */
 void SensitivityAnalysis::setBlockSize(const UnsignedLong blockSize)
 {
@@ -204,6 +379,18 @@ UnsignedLong SensitivityAnalysis::getBlockSize() const
   return blockSize_;
 }
 
+/* Bootstrap size accessor */
+void SensitivityAnalysis::setBootstrapSize(const UnsignedLong bootstrapSize)
+{
+  if ( bootstrapSize == 0 ) throw InvalidArgumentException(HERE) << "Error: the bootstrap size must be positive.";
+  bootstrapSize_ = bootstrapSize;
+}
+
+UnsignedLong SensitivityAnalysis::getBootstrapSize() const
+{
+  return bootstrapSize_;
+}
+
 /* ImportanceFactors graph */
 Graph SensitivityAnalysis::DrawImportanceFactors(const NumericalPointWithDescription & importanceFactors,
                                                  const String & title)
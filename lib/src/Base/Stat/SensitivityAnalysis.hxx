@@ -32,6 +32,7 @@
 #include "Description.hxx"
 #include "NumericalPointWithDescription.hxx"
 #include "Graph.hxx"
+#include "Interval.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -58,10 +59,22 @@ public:
   /** Total order indices accessor */
   NumericalPoint getTotalOrderIndices(UnsignedLong marginalIndex = 0) const;
 
+  /** First order indices confidence interval accessor, computed by bootstrap */
+  Interval getFirstOrderIndicesInterval(const UnsignedLong marginalIndex = 0,
+                                        const NumericalScalar level = 0.95) const;
+
+  /** Total order indices confidence interval accessor, computed by bootstrap */
+  Interval getTotalOrderIndicesInterval(const UnsignedLong marginalIndex = 0,
+                                        const NumericalScalar level = 0.95) const;
+
   /** Block size accessor */
   void setBlockSize(const UnsignedLong blockSize);
   UnsignedLong getBlockSize() const;
 
+  /** Bootstrap size accessor */
+  void setBootstrapSize(const UnsignedLong bootstrapSize);
+  UnsignedLong getBootstrapSize() const;
+
   /** ImportanceFactors graph */
   static Graph DrawImportanceFactors(const NumericalPointWithDescription & importanceFactors,
                                      const String & title = "Importance Factors");
@@ -72,9 +85,36 @@ public:
                                      const String & title = "Importance Factors");
 
 private:
+  friend struct SensitivityAnalysisBlockFunctor;
+
   /** Compute all the Sobol indices */
   void computeSobolIndices(const UnsignedLong order) const;
 
+  /** Number of statistics accumulated per block */
+  UnsignedLong getStatisticDimension(const UnsignedLong order) const;
+
+  /** Evaluate the pick-freeze design of the given block and compute its statistics */
+  NumericalPoint computeBlockStatistics(const UnsignedLong blockIndex,
+                                        const UnsignedLong order) const;
+
+  /** Merge the statistics of another set of points into the given ones */
+  void mergeStatistics(NumericalPoint & statistics,
+                       const NumericalPoint & other,
+                       const UnsignedLong order) const;
+
+  /** Compute the indices from the merged statistics of the blocks */
+  void computeIndices(const NumericalPoint & statistics,
+                      const UnsignedLong order,
+                      NumericalSample & firstOrderIndice,
+                      NumericalSample & totalOrderIndice,
+                      SymmetricTensor & secondOrderIndice,
+                      const Bool checkRange) const;
+
+  /** Bootstrap confidence interval of the first or total order indices */
+  Interval computeBootstrapInterval(const UnsignedLong marginalIndex,
+                                    const NumericalScalar level,
+                                    const Bool firstOrder) const;
+
   /** Two independently generated samples */
   NumericalSample inputSample1_;
   NumericalSample inputSample2_;
@@ -91,9 +131,15 @@ private:
   /** Second order indices */
   mutable SymmetricTensor secondOrderIndice_;
 
+  /** Statistics of each bootstrap super-block */
+  mutable NumericalSample blockStatistics_;
+
   /** Size of blocks */
   UnsignedLong blockSize_;
 
+  /** Number of bootstrap samples */
+  UnsignedLong bootstrapSize_;
+
   /** Store the maximum order already computed */
   mutable UnsignedLong alreadyComputedOrder_;
 
@@ -0,0 +1,363 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  Spill.cxx
+ *  @brief History strategy keeping a bounded buffer in memory and spilling full blocks to a file
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author: schueller
+ *  @date:   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#include <fstream>
+#include <vector>
+#include "OTconfig.hxx"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "Spill.hxx"
+#include "ResourceMap.hxx"
+#include "Path.hxx"
+#include "Os.hxx"
+#include "Exception.hxx"
+#include "PersistentObjectFactory.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+/* Temporary file shared between the copies of a strategy, removed with the last one.
+   The blocks are appended by a background thread, one at a time, while the next block fills up */
+class SpillFile
+{
+public:
+  SpillFile()
+    : fileName_(Path::BuildTemporaryFileName("openturns_spill_XXXXXX")),
+      columns_(0),
+      isWriting_(false),
+      hasFailed_(false)
+  {
+    // Nothing to do
+  }
+
+  ~SpillFile()
+  {
+#ifdef HAVE_PTHREAD_H
+    if (isWriting_) pthread_join(writer_, NULL);
+#endif
+    Os::Remove(fileName_);
+  }
+
+  /* Hand the columns of a block to the writer, the given vector gets the storage of the previous block */
+  void append(std::vector<NumericalScalar> & columns)
+  {
+    flush();
+    columns_.swap(columns);
+#ifdef HAVE_PTHREAD_H
+    if (pthread_create(&writer_, NULL, SpillFile::Write, this) == 0)
+      {
+        isWriting_ = true;
+        return;
+      }
+#endif
+    // No thread available: write the block synchronously
+    write();
+    flush();
+  }
+
+  /* Wait for the block being written */
+  void flush() const
+  {
+#ifdef HAVE_PTHREAD_H
+    if (isWriting_)
+      {
+        pthread_join(writer_, NULL);
+        isWriting_ = false;
+      }
+#endif
+    if (hasFailed_) throw InternalException(HERE) << "Error: cannot write the history file " << fileName_;
+  }
+
+  const FileName & getFileName() const
+  {
+    return fileName_;
+  }
+
+private:
+  SpillFile(const SpillFile & other);
+  SpillFile & operator = (const SpillFile & other);
+
+  static void * Write(void * p_file)
+  {
+    static_cast<SpillFile *>(p_file)->write();
+    return NULL;
+  }
+
+  void write()
+  {
+    std::ofstream output(fileName_.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+    output.write(reinterpret_cast<const char *>(&columns_[0]), columns_.size() * sizeof(NumericalScalar));
+    hasFailed_ = hasFailed_ || !output;
+  }
+
+  FileName fileName_;
+  std::vector<NumericalScalar> columns_;
+#ifdef HAVE_PTHREAD_H
+  mutable pthread_t writer_;
+#endif
+  mutable Bool isWriting_;
+  Bool hasFailed_;
+}; /* end class SpillFile */
+
+/* Read-only view of a range of the values stored in the file, memory-mapped when the platform allows it */
+class SpillMapping
+{
+public:
+  SpillMapping(const FileName & fileName,
+               const UnsignedLong offset,
+               const UnsignedLong length)
+    : address_(0), length_(0), delta_(0), values_(0)
+  {
+#ifdef HAVE_SYS_MMAN_H
+    const int descriptor(open(fileName.c_str(), O_RDONLY));
+    if (descriptor < 0) throw FileOpenException(HERE) << "Error: cannot open the history file " << fileName;
+    // The mapping must start on a page boundary
+    const UnsignedLong pageSize(sysconf(_SC_PAGESIZE));
+    delta_ = offset % pageSize;
+    length_ = length + delta_;
+    void * address(mmap(0, length_, PROT_READ, MAP_PRIVATE, descriptor, offset - delta_));
+    // The mapping remains valid once the descriptor is closed
+    close(descriptor);
+    if (address == MAP_FAILED) throw FileOpenException(HERE) << "Error: cannot map the history file " << fileName;
+    madvise(address, length_, MADV_SEQUENTIAL);
+    address_ = static_cast<char *>(address);
+#else
+    values_ = std::vector<NumericalScalar>(length / sizeof(NumericalScalar));
+    std::ifstream input(fileName.c_str(), std::ios::in | std::ios::binary);
+    input.seekg(offset);
+    input.read(reinterpret_cast<char *>(&values_[0]), length);
+    if (!input) throw FileOpenException(HERE) << "Error: cannot read the history file " << fileName;
+#endif
+  }
+
+  ~SpillMapping()
+  {
+#ifdef HAVE_SYS_MMAN_H
+    if (address_) munmap(address_, length_);
+#endif
+  }
+
+  const NumericalScalar * getValues() const
+  {
+    if (address_) return reinterpret_cast<const NumericalScalar *>(address_ + delta_);
+    return &values_[0];
+  }
+
+private:
+  SpillMapping(const SpillMapping & other);
+  SpillMapping & operator = (const SpillMapping & other);
+
+  char * address_;
+  UnsignedLong length_;
+  UnsignedLong delta_;
+  std::vector<NumericalScalar> values_;
+}; /* end class SpillMapping */
+
+
+/*
+ * @class Spill
+ */
+
+CLASSNAMEINIT(Spill);
+
+static Factory<Spill> RegisteredFactory("Spill");
+
+/* Constructor with parameters */
+Spill::Spill()
+  : HistoryStrategyImplementation(),
+    blockSize_(ResourceMap::GetAsUnsignedLong( "Spill-DefaultBlockSize" )),
+    blockNumber_(0),
+    file_()
+{
+  if (blockSize_ == 0) throw InvalidArgumentException(HERE) << "Error: the block size must be positive.";
+}
+
+/* Constructor with parameters */
+Spill::Spill(const UnsignedLong blockSize)
+  : HistoryStrategyImplementation(),
+    blockSize_(blockSize),
+    blockNumber_(0),
+    file_()
+{
+  if (blockSize_ == 0) throw InvalidArgumentException(HERE) << "Error: the block size must be positive.";
+}
+
+/* Virtual constructor */
+Spill * Spill::clone() const
+{
+  return new Spill(*this);
+}
+
+/* Store the point according to the strategy */
+void Spill::store(const NumericalPoint & point)
+{
+  if (!isInitialized_)
+    {
+      sample_ = NumericalSample(0, point.getDimension());
+      blockNumber_ = 0;
+      file_.reset();
+      isInitialized_ = true;
+    }
+  sample_.add(point);
+  if (sample_.getSize() == blockSize_) spill();
+}
+
+/* Append the in-memory buffer to the file as a new block */
+void Spill::spill()
+{
+  writeBlock(sample_);
+  ++blockNumber_;
+  sample_ = NumericalSample(0, sample_.getDimension());
+}
+
+/* Hand a full block to the writer of the file */
+void Spill::writeBlock(const NumericalSample & block)
+{
+  const UnsignedLong dimension(block.getDimension());
+  const UnsignedLong blockBytes(blockSize_ * dimension * sizeof(NumericalScalar));
+  // The file is shared with a copy of this strategy: detach before appending
+  if (!file_.isNull() && !file_.unique())
+    {
+      file_->flush();
+      Pointer<SpillFile> newFile(new SpillFile);
+      std::ifstream input(file_->getFileName().c_str(), std::ios::in | std::ios::binary);
+      std::ofstream output(newFile->getFileName().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      std::vector<char> buffer(blockBytes);
+      for (UnsignedLong i = 0; i < blockNumber_; ++i)
+        {
+          input.read(&buffer[0], blockBytes);
+          output.write(&buffer[0], blockBytes);
+        }
+      if (!input || !output) throw InternalException(HERE) << "Error: cannot copy the history file " << file_->getFileName() << " into " << newFile->getFileName();
+      file_ = newFile;
+    }
+  if (file_.isNull()) file_.reset(new SpillFile);
+  // Store the block column by column
+  std::vector<NumericalScalar> columns(blockSize_ * dimension);
+  for (UnsignedLong i = 0; i < blockSize_; ++i)
+    for (UnsignedLong j = 0; j < dimension; ++j)
+      columns[j * blockSize_ + i] = block[i][j];
+  file_->append(columns);
+}
+
+/* Read blockNumber blocks from the file, starting at the given index, into the sample from the given row */
+void Spill::readBlocks(const UnsignedLong index,
+                       const UnsignedLong blockNumber,
+                       NumericalSample & sample,
+                       const UnsignedLong row) const
+{
+  if (blockNumber == 0) return;
+  file_->flush();
+  const UnsignedLong dimension(sample.getDimension());
+  const UnsignedLong blockValues(blockSize_ * dimension);
+  const SpillMapping mapping(file_->getFileName(), index * blockValues * sizeof(NumericalScalar), blockNumber * blockValues * sizeof(NumericalScalar));
+  const NumericalScalar * values(mapping.getValues());
+  for (UnsignedLong k = 0; k < blockNumber; ++k)
+    for (UnsignedLong i = 0; i < blockSize_; ++i)
+      for (UnsignedLong j = 0; j < dimension; ++j)
+        sample[row + k * blockSize_ + i][j] = values[k * blockValues + j * blockSize_ + i];
+}
+
+/* Read back the block of given index from the file */
+NumericalSample Spill::getBlock(const UnsignedLong index) const
+{
+  if (index >= blockNumber_) throw InvalidArgumentException(HERE) << "Error: the block index=" << index << " must be less than the block number=" << blockNumber_;
+  NumericalSample block(blockSize_, sample_.getDimension());
+  readBlocks(index, 1, block, 0);
+  return block;
+}
+
+/* Sample accessor */
+NumericalSample Spill::getSample() const
+{
+  // If nothing has been stored
+  if (!isInitialized_) return sample_;
+  NumericalSample outSample(getSize(), sample_.getDimension());
+  readBlocks(0, blockNumber_, outSample, 0);
+  const UnsignedLong row(blockNumber_ * blockSize_);
+  for (UnsignedLong i = 0; i < sample_.getSize(); ++i) outSample[row + i] = sample_[i];
+  return outSample;
+}
+/* Total number of stored points, on disk and in memory */
+UnsignedLong Spill::getSize() const
+{
+  return blockNumber_ * blockSize_ + sample_.getSize();
+}
+
+/* BlockSize accessor */
+UnsignedLong Spill::getBlockSize() const
+{
+  return blockSize_;
+}
+
+/* Number of blocks written to the file */
+UnsignedLong Spill::getBlockNumber() const
+{
+  return blockNumber_;
+}
+
+/* String converter */
+String Spill::__repr__() const
+{
+  OSS oss;
+  oss << "class=" << Spill::GetClassName();
+  oss << " sample_= " << sample_;
+  oss << " blockSize_ " << blockSize_;
+  oss << " blockNumber_ " << blockNumber_;
+  return oss;
+}
+
+/* Method save() stores the object through the StorageManager, one block at a time */
+void Spill::save(Advocate & adv) const
+{
+  HistoryStrategyImplementation::save(adv);
+  adv.saveAttribute("blockSize_", blockSize_);
+  adv.saveAttribute("blockNumber_", blockNumber_);
+  for (UnsignedLong i = 0; i < blockNumber_; ++i) adv.saveAttribute(OSS() << "block_" << i, getBlock(i));
+}
+
+/* Method load() reloads the object from the StorageManager, one block at a time */
+void Spill::load(Advocate & adv)
+{
+  HistoryStrategyImplementation::load(adv);
+  adv.loadAttribute("blockSize_", blockSize_);
+  UnsignedLong blockNumber(0);
+  adv.loadAttribute("blockNumber_", blockNumber);
+  // Write the blocks into a fresh file
+  file_.reset();
+  for (blockNumber_ = 0; blockNumber_ < blockNumber; ++blockNumber_)
+    {
+      NumericalSample block;
+      adv.loadAttribute(OSS() << "block_" << blockNumber_, block);
+      writeBlock(block);
+    }
+}
+
+
+END_NAMESPACE_OPENTURNS
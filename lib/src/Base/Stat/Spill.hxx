@@ -0,0 +1,121 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  Spill.hxx
+ *  @brief History strategy keeping a bounded buffer in memory and spilling full blocks to a file
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author: schueller
+ *  @date:   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#ifndef OPENTURNS_SPILL_HXX
+#define OPENTURNS_SPILL_HXX
+
+#include "HistoryStrategyImplementation.hxx"
+#include "NumericalSample.hxx"
+#include "Pointer.hxx"
+
+BEGIN_NAMESPACE_OPENTURNS
+
+class SpillFile;
+
+/**
+ * @class Spill
+ *
+ * Keeps the whole history like Full, but only the last blockSize points are
+ * kept in memory. Each time the buffer is full it is handed to a background
+ * writer that appends it to a temporary file as a block stored column by
+ * column, while the next block fills up; the memory footprint does not grow
+ * with the number of stored points. The blocks are read back through a
+ * read-only mapping of the file, one at a time with getBlock() or all
+ * together with getSample(). The blocks are not compressed, so that each of
+ * them stays at a fixed offset of the file.
+ */
+
+class Spill
+  : public HistoryStrategyImplementation
+{
+
+  CLASSNAME;
+
+public:
+
+
+  /** Constructor with parameters */
+  explicit Spill();
+
+  /** Constructor with parameters */
+  Spill(const UnsignedLong blockSize);
+
+  /** Virtual constructor */
+  virtual Spill * clone() const;
+
+  /** Store the point according to the strategy */
+  using HistoryStrategyImplementation::store;
+  void store(const NumericalPoint & point);
+
+  /** Sample accessor */
+  NumericalSample getSample() const;
+
+  /** Total number of stored points, on disk and in memory */
+  UnsignedLong getSize() const;
+
+  /** BlockSize accessor */
+  UnsignedLong getBlockSize() const;
+
+  /** Number of blocks written to the file */
+  UnsignedLong getBlockNumber() const;
+
+  /** Read back the block of given index from the file */
+  NumericalSample getBlock(const UnsignedLong index) const;
+
+  /** String converter */
+  String __repr__() const;
+
+  /** Method save() stores the object through the StorageManager */
+  void save(Advocate & adv) const;
+
+  /** Method load() reloads the object from the StorageManager */
+  void load(Advocate & adv);
+
+private:
+
+  /** Append the in-memory buffer to the file as a new block */
+  void spill();
+
+  /** Hand a full block to the writer of the file */
+  void writeBlock(const NumericalSample & block);
+
+  /** Read blockNumber blocks from the file, starting at the given index, into the sample from the given row */
+  void readBlocks(const UnsignedLong index,
+                  const UnsignedLong blockNumber,
+                  NumericalSample & sample,
+                  const UnsignedLong row) const;
+
+  // Number of points kept in memory before spilling
+  UnsignedLong blockSize_;
+
+  // Number of blocks already written to the file
+  UnsignedLong blockNumber_;
+
+  // The temporary file and its writer, copied on write when shared, removed with the last copy
+  Pointer<SpillFile> file_;
+
+} ; /* class Spill */
+
+END_NAMESPACE_OPENTURNS
+
+#endif /* OPENTURNS_SPILL_HXX */
@@ -131,14 +131,13 @@ UserDefinedStationaryCovarianceModel StationaryCovarianceModelFactory::build(con
 
   // We use the same FFT as the spectral factory
   FFT fftAlgorithm(spectralFactory_.getFFTAlgorithm());
+  // FFT applications, all the columns being transformed at once in the same matrix
+  fftAlgorithm.inverseTransformBatch(*matrix.getImplementation(), size);
   for (UnsignedLong columnIndex = 0; columnIndex < numberOfFFT; ++columnIndex)
     {
-      // FFT applications
-      const Collection<NumericalComplex> marginal(fftAlgorithm.inverseTransform(*matrix.getImplementation(), columnIndex * size, size));
-      // We save result in the same matrix
       for (UnsignedLong rowIndex = 0; rowIndex < size; ++rowIndex)
         {
-          matrix(rowIndex, columnIndex) = marginal[rowIndex] * delta[rowIndex];
+          matrix(rowIndex, columnIndex) *= delta[rowIndex];
         }
     }
 
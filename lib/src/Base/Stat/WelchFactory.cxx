@@ -155,31 +155,25 @@ UserDefinedSpectralModel * WelchFactory::build(const ProcessSample & sample) con
     }
   const RegularGrid frequencyGrid(frequencyMin, frequencyStep, kMax);
   HermitianMatrixCollection DSPCollection(kMax, HermitianMatrix(dimension));
+  // Buffer for the transformation of all the components of a time series
+  NumericalComplexCollection zHat(dimension * N);
   // Loop over the time series
   for (UnsignedLong l = 0 ; l < sampleSize; ++l)
     {
-      // The current time series values are stored into a ComplexMatrix in order to
-      // have a two-indices access and an internal linear storage. The data are stored column-wise, i.e the column elements are contiguous in memory
-      ComplexMatrix zHat(kMax, dimension);
-      // Loop over the dimension
-      // For each component, compute the FFT of the time series component
+      // The tapered components of the current time series are stored one after the other
+      // in order to be transformed all at once
       for (UnsignedLong p = 0; p < dimension; ++p)
-        {
-          // Loop over the time stamps
-          NumericalComplexCollection zP(N);
-          for (UnsignedLong m = 0; m < N; ++m) zP[m] = alpha[m] * sample[l][m][p + 1]; // The first component of the value of a time series at a given index is the time value
-          // Perform the FFT direct transform of the tapered data
-          const NumericalComplexCollection zPHat(fftAlgorithm_.transform(zP));
-          // Stores the result. Only the values associated with nonnegative frequency values are stored.
-          for (UnsignedLong k = 0; k < kMax; ++k) zHat(k, p) = zPHat[N - kMax + k];
-        }
-      // Now, we can estimate the spectral density over the reduced frequency grid
+        for (UnsignedLong m = 0; m < N; ++m) zHat[p * N + m] = alpha[m] * sample(l, m, p);
+      // Perform the FFT direct transform of the tapered data of all the components
+      fftAlgorithm_.transformBatch(zHat, N);
+      // Now, we can estimate the spectral density over the reduced frequency grid.
+      // Only the values associated with nonnegative frequency values are used.
       for (UnsignedLong k = 0; k < kMax; ++k)
         {
           // Perform the row-wise kronecker product
           for (UnsignedLong p = 0; p < dimension; ++p)
             for (UnsignedLong q = 0; q <= p; ++q)
-              DSPCollection[k](p, q) += zHat(k, p) * std::conj(zHat(k, q));
+              DSPCollection[k](p, q) += zHat[p * N + N - kMax + k] * std::conj(zHat[q * N + N - kMax + k]);
         }
     } // Loop over the time series
   return UserDefinedSpectralModel(frequencyGrid, DSPCollection).clone();
@@ -202,8 +196,9 @@ UserDefinedSpectralModel * WelchFactory::build(const TimeSeries & timeSeries) co
     {
       for (UnsignedLong timeIndex = 0; timeIndex < blockSize; ++timeIndex)
         {
+          // The first component of the value of a time series at a given index is the time value
           for (UnsignedLong i = 1; i <= dimension; ++i)
-            sample[blockIndex][timeIndex][i] = timeSeries[blockIndex * hopSize + timeIndex][i];
+            sample(blockIndex, timeIndex, i - 1) = timeSeries[blockIndex * hopSize + timeIndex][i];
         } // Loop on the time index
     } // Loop on the blocks
   return build(sample);
@@ -61,6 +61,22 @@ namespace tutils
         }
         double gen() { return gen_close1_open2() - 1.0; }
 
+        /* Fill the given array with the next size values of gen(), block by block */
+        void gen(double * array, const uint32_t size) {
+          uint32_t done = 0;
+          while (done < size) {
+            if (i_ == 2 * N) {
+              gen_rand_all();
+            }
+            const double * buffer = reinterpret_cast<double*>(u_) + i_;
+            uint32_t count = 2 * N - i_;
+            if (count > size - done) count = size - done;
+            for (uint32_t j = 0; j < count; ++j) array[done + j] = buffer[j] - 1.0;
+            i_ += count;
+            done += count;
+          }
+        }
+
         /* Added by Regis LEBRUN, OpenTURNS project */
         uint32_t igen(const uint32_t n) {
           if (i_ == 2 * N) {
@@ -1,58 +0,0 @@
-/* This file contains code to calculate Kendall's Tau in O(N log N) time in
- * a manner similar to the following reference:
- *
- * A Computer Method for Calculating Kendall's Tau with Ungrouped Data
- * William R. Knight Journal of the American Statistical Association, Vol. 61,
- * No. 314, Part 1 (Jun., 1966), pp. 436-439
- *
- * Copyright (C) 2010 David Simcha
- *
- * License:
- * Boost Software License - Version 1.0 - August 17th, 2003
- *
- * Permission is hereby granted, free of charge, to any person or organization
- * obtaining a copy of the software and accompanying documentation covered by
- * this license (the "Software") to use, reproduce, display, distribute,
- * execute, and transmit the Software, and to prepare derivative works of the
- * Software, and to permit third-parties to whom the Software is furnished to
- * do so, all subject to the following:
- *
- * The copyright notices in the Software and this entire statement, including
- * the above license grant, this restriction and the following disclaimer,
- * must be included in all copies of the Software, in whole or in part, and
- * all derivative works of the Software, unless such copies or derivative
- * works are solely in the form of machine-executable object code generated by
- * a source language processor.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
- * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
- * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
- * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
- * DEALINGS IN THE SOFTWARE.
- *
- */
-
-#ifndef _KENDALL_
-#define _KENDALL_
-
-#include <OTdebug.h>
-
-BEGIN_C_DECLS
-
-/* This function calculates the Kendall Tau B on a pair of C-style "arrays".
- * Note that it will completely overwrite arr1 and sort arr2, so these need
- * to be duplicated before passing them in.
- */
-double kendallNlogN(double* arr1, double* arr2, size_t len);
-
-/* This function uses a simple O(N^2) implementation.  It probably has a smaller
- * constant and therefore is useful in the small N case, and is also useful
- * for testing the relatively complex O(N log N) implementation.
- */
-double kendallSmallN(double* arr1, double* arr2, size_t len);
-
-END_C_DECLS
-
-#endif /* _COBYLA_ */
@@ -126,6 +126,11 @@ void DGESDD_F77(char *jobz, int *m, int *n, double *A, int *lda, double *S, doub
 #define DTRMV_F77 F77_FUNC(dtrmv,DTRMV)
 void DTRMV_F77(char *uplo, char *trans, char *diag, int *n, double *A, int *lda, double *X, int *incx, int *luplo, int *ltrans, int *ldiag);
 
+/** Function dtrmm is to be used to compute the product of a triangular
+    (upper or lower) matrix with another matrix */
+#define DTRMM_F77 F77_FUNC(dtrmm,DTRMM)
+void DTRMM_F77(char *side, char *uplo, char *trans, char *diag, int *m, int *n, double *alpha, double *A, int *lda, double *B, int *ldb, int *lside, int *luplo, int *ltrans, int *ldiag);
+
 /** BLAS routines for complex values */
 
 /** Function zaxpy is to be used to compute the sum or the difference of two complex matrices
@@ -27,6 +27,13 @@
 #include "Distribution.hxx"
 #include "ComparisonOperatorImplementation.hxx"
 #include "PersistentObjectFactory.hxx"
+#include "Log.hxx"
+#include "TBB.hxx"
+#include "SpecFunc.hxx"
+#include "Indices.hxx"
+#include "CenteredFiniteDifferenceGradient.hxx"
+#include "NonCenteredFiniteDifferenceGradient.hxx"
+#include "CenteredFiniteDifferenceHessian.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -44,7 +51,8 @@ Analytical::Analytical(const NearestPointAlgorithm & nearestPointAlgorithm,
     Threadable(),
     nearestPointAlgorithm_(nearestPointAlgorithm),
     event_(event),
-    physicalStartingPoint_(physicalStartingPoint)
+    physicalStartingPoint_(physicalStartingPoint),
+    physicalStartingSample_(0, physicalStartingPoint.getDimension())
 {
   const UnsignedLong dimension = event.getImplementation()->getFunction().getInputDimension();
   if (physicalStartingPoint.getDimension() != dimension) throw InvalidArgumentException(HERE) << "Starting point dimension (" << physicalStartingPoint.getDimension() << ") does not match event dimension (" << dimension << ").";
@@ -69,6 +77,20 @@ void Analytical::setPhysicalStartingPoint(const NumericalPoint & physicalStartin
   physicalStartingPoint_ = physicalStartingPoint;
 }
 
+/* Physical starting sample accessor */
+NumericalSample Analytical::getPhysicalStartingSample() const
+{
+  return physicalStartingSample_;
+}
+
+/* Physical starting sample accessor */
+void Analytical::setPhysicalStartingSample(const NumericalSample & physicalStartingSample)
+{
+  const UnsignedLong dimension(event_.getImplementation()->getFunction().getInputDimension());
+  if ((physicalStartingSample.getSize() > 0) && (physicalStartingSample.getDimension() != dimension)) throw InvalidArgumentException(HERE) << "Starting sample dimension (" << physicalStartingSample.getDimension() << ") does not match event dimension (" << dimension << ").";
+  physicalStartingSample_ = physicalStartingSample;
+}
+
 /* Event accessor */
 Event Analytical::getEvent() const
 {
@@ -116,11 +138,16 @@ void Analytical::run()
   /* set the level value of the algorithm in the standard space  */
   nearestPointAlgorithm_.setLevelValue(event_.getThreshold());
 
-  /* set the starting point of the algorithm in the standard space  */
-  nearestPointAlgorithm_.setStartingPoint(event_.getImplementation()->getAntecedent()->getDistribution().getIsoProbabilisticTransformation().operator()(physicalStartingPoint_));
+  if (physicalStartingSample_.getSize() == 0)
+    {
+      /* set the starting point of the algorithm in the standard space  */
+      nearestPointAlgorithm_.setStartingPoint(event_.getImplementation()->getAntecedent()->getDistribution().getIsoProbabilisticTransformation().operator()(physicalStartingPoint_));
 
-  /* solve the nearest point problem */
-  nearestPointAlgorithm_.run();
+      /* solve the nearest point problem */
+      nearestPointAlgorithm_.run();
+    }
+  /* solve the nearest point problem from all the starting points of the sample in the standard space */
+  else runMultiStart(event_.getImplementation()->getAntecedent()->getDistribution().getIsoProbabilisticTransformation().operator()(physicalStartingSample_));
 
   /* set standard space design point in Result */
   NumericalPoint standardSpaceDesignPoint(nearestPointAlgorithm_.getResult().getMinimizer());
@@ -134,6 +161,98 @@ void Analytical::run()
   result_.setIsStandardPointOriginInFailureSpace(event_.getOperator().compare(value[0], event_.getThreshold()));
 } /* Analytical::run() */
 
+/* Copy of a gradient sharing no evaluation with the given one: the finite difference gradients are rebuilt on a clone of their evaluation */
+static NumericalMathFunction::GradientImplementation CloneGradient(const NumericalMathFunction::GradientImplementation & p_gradient)
+{
+  const CenteredFiniteDifferenceGradient * p_centered(dynamic_cast<const CenteredFiniteDifferenceGradient *>(p_gradient.get()));
+  if (p_centered) return new CenteredFiniteDifferenceGradient(p_centered->getFiniteDifferenceStep(), p_centered->getEvaluation()->clone());
+  const NonCenteredFiniteDifferenceGradient * p_nonCentered(dynamic_cast<const NonCenteredFiniteDifferenceGradient *>(p_gradient.get()));
+  if (p_nonCentered) return new NonCenteredFiniteDifferenceGradient(p_nonCentered->getFiniteDifferenceStep(), p_nonCentered->getEvaluation()->clone());
+  return p_gradient->clone();
+}
+
+/* Copy of a hessian sharing no evaluation with the given one */
+static NumericalMathFunction::HessianImplementation CloneHessian(const NumericalMathFunction::HessianImplementation & p_hessian)
+{
+  const CenteredFiniteDifferenceHessian * p_centered(dynamic_cast<const CenteredFiniteDifferenceHessian *>(p_hessian.get()));
+  if (p_centered) return new CenteredFiniteDifferenceHessian(p_centered->getFiniteDifferenceStep(), p_centered->getEvaluation()->clone());
+  return p_hessian->clone();
+}
+
+/* Level function of the standard event built on clones of the event function, so that concurrent starts do not share its evaluation state (parsers, caches, counters).
+   The calls made through the clones are not reported on the event function */
+static NumericalMathFunction CloneLevelFunction(const Event & event)
+{
+  const NumericalMathFunction function(event.getImplementation()->getFunction());
+  const NumericalMathFunction clone(function.getEvaluationImplementation()->clone(), CloneGradient(function.getGradientImplementation()), CloneHessian(function.getHessianImplementation()));
+  return NumericalMathFunction(clone, event.getImplementation()->getAntecedent()->getDistribution().getInverseIsoProbabilisticTransformation());
+}
+
+struct AnalyticalMultiStartFunctor
+{
+  Collection<NearestPointAlgorithm> & algorithms_;
+  Indices & succeeded_;
+
+  AnalyticalMultiStartFunctor(Collection<NearestPointAlgorithm> & algorithms,
+                              Indices & succeeded)
+    : algorithms_(algorithms), succeeded_(succeeded) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    for (UnsignedLong i = r.begin(); i != r.end(); ++i)
+      {
+        try
+          {
+            algorithms_[i].run();
+            succeeded_[i] = 1;
+          }
+        catch (Exception & ex)
+          {
+            LOGWARN(OSS() << "Warning! The nearest point algorithm failed from the starting point " << algorithms_[i].getStartingPoint() << ", message=" << ex);
+          }
+      }
+  }
+}; /* end struct AnalyticalMultiStartFunctor */
+
+/* Each start uses its own copy of the nearest point algorithm and of the level function, so the starts can run concurrently.
+   The design points satisfying the constraint are preferred, then the nearest one to the origin.
+   If none satisfies the constraint, the one with the smallest constraint error is kept */
+void Analytical::runMultiStart(const NumericalSample & standardStartingSample)
+{
+  const UnsignedLong size(standardStartingSample.getSize());
+  Collection<NearestPointAlgorithm> algorithms(size);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      algorithms[i] = NearestPointAlgorithm(*nearestPointAlgorithm_.getImplementation());
+      algorithms[i].setLevelFunction(CloneLevelFunction(event_));
+      algorithms[i].setStartingPoint(standardStartingSample[i]);
+    }
+  Indices succeeded(size, 0);
+  const AnalyticalMultiStartFunctor functor(algorithms, succeeded);
+  TBB::ParallelFor(0, size, functor);
+  const NumericalScalar maximumConstraintError(nearestPointAlgorithm_.getMaximumConstraintError());
+  UnsignedLong bestIndex(size);
+  Bool bestIsFeasible(false);
+  NumericalScalar bestCriterion(SpecFunc::MaxNumericalScalar);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      if (!succeeded[i]) continue;
+      const NearestPointAlgorithm::Result result(algorithms[i].getResult());
+      const Bool isFeasible(result.getConstraintError() <= maximumConstraintError);
+      if (bestIsFeasible && !isFeasible) continue;
+      const NumericalScalar criterion(isFeasible ? result.getMinimizer().norm() : result.getConstraintError());
+      if ((isFeasible && !bestIsFeasible) || (criterion < bestCriterion))
+        {
+          bestIndex = i;
+          bestIsFeasible = isFeasible;
+          bestCriterion = criterion;
+        }
+    }
+  if (bestIndex == size) throw InternalException(HERE) << "Error: the nearest point algorithm failed from all the starting points.";
+  nearestPointAlgorithm_.setStartingPoint(standardStartingSample[bestIndex]);
+  nearestPointAlgorithm_.setResult(algorithms[bestIndex].getResult());
+}
+
 /* Result accessor */
 AnalyticalResult Analytical::getAnalyticalResult() const
 {
@@ -149,6 +268,7 @@ void Analytical::save(Advocate & adv) const
   adv.saveAttribute("nearestPointAlgorithm_", nearestPointAlgorithm_);
   adv.saveAttribute("event_", event_);
   adv.saveAttribute("physicalStartingPoint_", physicalStartingPoint_);
+  adv.saveAttribute("physicalStartingSample_", physicalStartingSample_);
   adv.saveAttribute("result_", result_);
 }
 
@@ -159,6 +279,7 @@ void Analytical::load(Advocate & adv)
   adv.loadAttribute("nearestPointAlgorithm_", nearestPointAlgorithm_);
   adv.loadAttribute("event_", event_);
   adv.loadAttribute("physicalStartingPoint_", physicalStartingPoint_);
+  adv.loadAttribute("physicalStartingSample_", physicalStartingSample_);
   adv.loadAttribute("result_", result_);
 }
 
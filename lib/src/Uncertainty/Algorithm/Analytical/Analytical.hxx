@@ -75,6 +75,14 @@ public:
   /** Physical starting point accessor */
   void setPhysicalStartingPoint(const NumericalPoint & physicalStartingPoint);
 
+  /** Physical starting sample accessor: if it is not empty, the nearest point algorithm is run
+   *  concurrently from each of its points instead of the physical starting point, and the nearest
+   *  design point is kept */
+  NumericalSample getPhysicalStartingSample() const;
+
+  /** Physical starting sample accessor */
+  void setPhysicalStartingSample(const NumericalSample & physicalStartingSample);
+
   /** Event accessor */
   Event getEvent() const;
 
@@ -111,9 +119,13 @@ protected:
 
 private:
 
+  /** Run the nearest point algorithm from each standard starting point and keep the nearest design point */
+  void runMultiStart(const NumericalSample & standardStartingSample);
+
   NearestPointAlgorithm nearestPointAlgorithm_;
   Event event_;
   NumericalPoint physicalStartingPoint_;
+  NumericalSample physicalStartingSample_;
   AnalyticalResult result_;
 
 } ; /* class Analytical */
@@ -24,6 +24,7 @@
 
 #include "SORM.hxx"
 #include "PersistentObjectFactory.hxx"
+#include "ResourceMap.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -36,7 +37,8 @@ static Factory< SORM > RegisteredFactory("SORM");
 /* Default constructor for the save/load mechanism */
 SORM::SORM()
   : Analytical(),
-    sormResult_()
+    sormResult_(),
+    quasiNewtonHessian_(ResourceMap::GetAsBool("SORM-DefaultQuasiNewtonHessian"))
 {
   // Nothing to do
 }
@@ -48,7 +50,8 @@ SORM::SORM(const NearestPointAlgorithm & nearestPointAlgorithm,
            const Event & event,
            const NumericalPoint & physicalStartingPoint):
   Analytical(nearestPointAlgorithm, event, physicalStartingPoint),
-  sormResult_()
+  sormResult_(),
+  quasiNewtonHessian_(ResourceMap::GetAsBool("SORM-DefaultQuasiNewtonHessian"))
 {
   // Nothing to do
 }
@@ -71,13 +74,26 @@ void SORM::setResult(const SORMResult & sormResult)
   sormResult_ = sormResult;
 }
 
+/* Quasi-Newton hessian flag accessor */
+Bool SORM::getQuasiNewtonHessian() const
+{
+  return quasiNewtonHessian_;
+}
+
+/* Quasi-Newton hessian flag accessor */
+void SORM::setQuasiNewtonHessian(const Bool quasiNewtonHessian)
+{
+  quasiNewtonHessian_ = quasiNewtonHessian;
+}
+
 /* String converter */
 String SORM::__repr__() const
 {
   OSS oss;
   oss << "class=" << SORM::GetClassName()
       << " " << Analytical::__repr__()
-      << " result=" << sormResult_;
+      << " result=" << sormResult_
+      << " quasiNewtonHessian=" << quasiNewtonHessian_;
   return oss;
 }
 
@@ -85,7 +101,13 @@ String SORM::__repr__() const
 void SORM::run()
 {
   Analytical::run();
-  sormResult_ = SORMResult(Analytical::getAnalyticalResult().getStandardSpaceDesignPoint(), Analytical::getAnalyticalResult().getLimitStateVariable(), Analytical::getAnalyticalResult().getIsStandardPointOriginInFailureSpace());
+  if (quasiNewtonHessian_)
+    {
+      /* Reuse the gradients computed by the nearest point algorithm */
+      const NearestPointAlgorithm::Result nearestPointResult(getNearestPointAlgorithm().getResult());
+      sormResult_ = SORMResult(Analytical::getAnalyticalResult().getStandardSpaceDesignPoint(), Analytical::getAnalyticalResult().getLimitStateVariable(), Analytical::getAnalyticalResult().getIsStandardPointOriginInFailureSpace(), nearestPointResult.getGradientInputSample(), nearestPointResult.getGradientSample());
+    }
+  else sormResult_ = SORMResult(Analytical::getAnalyticalResult().getStandardSpaceDesignPoint(), Analytical::getAnalyticalResult().getLimitStateVariable(), Analytical::getAnalyticalResult().getIsStandardPointOriginInFailureSpace());
 }
 
 
@@ -95,6 +117,7 @@ void SORM::save(Advocate & adv) const
 
   Analytical::save(adv);
   adv.saveAttribute("sormResult_", sormResult_);
+  adv.saveAttribute("quasiNewtonHessian_", quasiNewtonHessian_);
 }
 
 /* Method load() reloads the object from the StorageManager */
@@ -102,6 +125,7 @@ void SORM::load(Advocate & adv)
 {
   Analytical::load(adv);
   adv.loadAttribute("sormResult_", sormResult_);
+  adv.loadAttribute("quasiNewtonHessian_", quasiNewtonHessian_);
 }
 
 END_NAMESPACE_OPENTURNS
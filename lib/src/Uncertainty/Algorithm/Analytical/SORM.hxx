@@ -67,6 +67,11 @@ public:
   /** Result accessor */
   void setResult(const SORMResult & sormResult);
 
+  /** Quasi-Newton hessian flag accessor: if true, the hessian of the limit state function is approximated
+   *  using the gradient history of the nearest point algorithm, see SORMResult */
+  Bool getQuasiNewtonHessian() const;
+  void setQuasiNewtonHessian(const Bool quasiNewtonHessian);
+
   /** String converter */
   String __repr__() const;
 
@@ -82,6 +87,7 @@ public:
 private:
 
   SORMResult sormResult_;
+  Bool quasiNewtonHessian_;
 
 } ; /* class SORM */
 
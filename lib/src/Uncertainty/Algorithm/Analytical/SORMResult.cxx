@@ -34,6 +34,8 @@
 #include "StandardEvent.hxx"
 #include "PersistentObjectFactory.hxx"
 #include "SpecFunc.hxx"
+#include "SymmetricMatrix.hxx"
+#include "ResourceMap.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -80,6 +82,40 @@ SORMResult::SORMResult(const NumericalPoint & standardSpaceDesignPoint,
       hessianLimitStateFunction_(i, j) = hessian(i, j, 0);
 } // end SORMResult::Result
 
+/*
+ * @brief  Quasi-Newton constructor: the hessian of the limit state function is approximated using the gradients
+ *         computed by the nearest point algorithm instead of being fully computed at the design point
+ */
+SORMResult::SORMResult(const NumericalPoint & standardSpaceDesignPoint,
+                       const Event & limitStateVariable,
+                       const Bool isStandardPointOriginInFailureSpace,
+                       const NumericalSample & gradientInputSample,
+                       const NumericalSample & gradientSample,
+                       const String & name):
+  AnalyticalResult(standardSpaceDesignPoint, limitStateVariable, isStandardPointOriginInFailureSpace, name),
+  hessianLimitStateFunction_(),
+  gradientLimitStateFunction_(),
+  sortedCurvatures_(),
+  isAlreadyComputedSortedCurvatures_(false),
+  eventProbabilityBreitung_(-1.0),
+  eventProbabilityHohenBichler_(-1.0),
+  eventProbabilityTvedt_(-1.0),
+  generalisedReliabilityIndexBreitung_(SpecFunc::MaxNumericalScalar),
+  generalisedReliabilityIndexHohenBichler_(SpecFunc::MaxNumericalScalar),
+  generalisedReliabilityIndexTvedt_(SpecFunc::MaxNumericalScalar),
+  standardDistribution_(limitStateVariable.getImplementation()->getAntecedent().getImplementation()->getDistribution().getStandardDistribution()),
+  standardMarginal_(standardDistribution_.getMarginal(0))
+{
+  /* get the physical Limite State Function */
+  const NumericalMathFunction limitStateFunction(StandardEvent(limitStateVariable).getImplementation()->getFunction());
+  /* compute its gradient */
+  const Matrix gradient(limitStateFunction.gradient(getStandardSpaceDesignPoint()));
+  /* Get the first column */
+  gradientLimitStateFunction_ = gradient * NumericalPoint(1, 1.0);
+  /* approximate its hessian */
+  hessianLimitStateFunction_ = computeQuasiNewtonHessian(limitStateFunction, gradientInputSample, gradientSample);
+} // end SORMResult::Result
+
 /* Default constructor */
 SORMResult::SORMResult():
   AnalyticalResult(),
@@ -105,6 +141,90 @@ SORMResult * SORMResult::clone() const
   return new SORMResult(*this);
 }
 
+/* The hessian of the standard limit state function at the design point is first approximated
+   by symmetric rank one (SR1) updates along the path of the nearest point algorithm, starting
+   from a null hessian: it is exact in the directions explored by the algorithm for a quadratic
+   function. Then, only the main principal directions of this approximation in the tangent plane
+   of the limit state surface are refined, using centered differences of the gradient at the design
+   point. It costs two gradients per refined direction instead of the full hessian. */
+SquareMatrix SORMResult::computeQuasiNewtonHessian(const NumericalMathFunction & limitStateFunction,
+                                                   const NumericalSample & gradientInputSample,
+                                                   const NumericalSample & gradientSample) const
+{
+  const NumericalPoint designPoint(getStandardSpaceDesignPoint());
+  const UnsignedLong dimension(designPoint.getDimension());
+  const UnsignedLong size(gradientInputSample.getSize());
+  if (gradientSample.getSize() != size) throw InvalidArgumentException(HERE) << "Error: the gradient history must contain as many gradients as points, here " << gradientSample.getSize() << " gradients for " << size << " points";
+  if ((size > 0) && ((gradientInputSample.getDimension() != dimension) || (gradientSample.getDimension() != dimension))) throw InvalidArgumentException(HERE) << "Error: the gradient history must have the dimension of the design point=" << dimension;
+  /* SR1 updates along the path, the design point being the last point of the path */
+  const NumericalScalar skipThreshold(ResourceMap::GetAsNumericalScalar("SORMResult-QuasiNewtonSkipThreshold"));
+  SquareMatrix hessian(dimension);
+  for (UnsignedLong k = 0; k < size; ++k)
+    {
+      const NumericalPoint nextPoint(k + 1 < size ? NumericalPoint(gradientInputSample[k + 1]) : designPoint);
+      const NumericalPoint nextGradient(k + 1 < size ? NumericalPoint(gradientSample[k + 1]) : gradientLimitStateFunction_);
+      const NumericalPoint step(nextPoint - NumericalPoint(gradientInputSample[k]));
+      const NumericalPoint residual(nextGradient - NumericalPoint(gradientSample[k]) - hessian * step);
+      const NumericalScalar denominator(dot(residual, step));
+      // Skip the update if it is not well defined
+      if (fabs(denominator) <= skipThreshold * residual.norm() * step.norm()) continue;
+      for (UnsignedLong i = 0; i < dimension; ++i)
+        for (UnsignedLong j = 0; j < dimension; ++j)
+          hessian(i, j) += residual[i] * residual[j] / denominator;
+    }
+  const UnsignedLong refinementNumber(std::min(dimension, ResourceMap::GetAsUnsignedLong("SORMResult-QuasiNewtonRefinementNumber")));
+  if (refinementNumber == 0) return hessian;
+  /* Principal directions of the approximation projected onto the tangent plane: P.H.P with P = Id - n.n^t */
+  const NumericalPoint normal((1.0 / gradientLimitStateFunction_.norm()) * gradientLimitStateFunction_);
+  const NumericalPoint hessianNormal(hessian * normal);
+  const NumericalScalar normalHessianNormal(dot(normal, hessianNormal));
+  SymmetricMatrix projectedHessian(dimension);
+  for (UnsignedLong i = 0; i < dimension; ++i)
+    for (UnsignedLong j = 0; j <= i; ++j)
+      projectedHessian(i, j) = hessian(i, j) - normal[i] * hessianNormal[j] - hessianNormal[i] * normal[j] + normal[i] * normal[j] * normalHessianNormal;
+  SquareMatrix eigenVectors(dimension);
+  const NumericalPoint eigenValues(projectedHessian.computeEigenValues(eigenVectors));
+  // Select the directions with the largest curvatures in absolute value
+  Collection< std::pair<NumericalScalar, UnsignedLong> > order(dimension);
+  for (UnsignedLong i = 0; i < dimension; ++i) order[i] = std::pair<NumericalScalar, UnsignedLong>(-fabs(eigenValues[i]), i);
+  std::sort(order.begin(), order.end());
+  UnsignedLong directionNumber(0);
+  while ((directionNumber < refinementNumber) && (-order[directionNumber].first > skipThreshold * (-order[0].first))) ++directionNumber;
+  if (directionNumber == 0) return hessian;
+  /* Exact products of the hessian with the selected directions */
+  const NumericalScalar refinementStep(ResourceMap::GetAsNumericalScalar("SORMResult-QuasiNewtonRefinementStep"));
+  Matrix directions(dimension, directionNumber);
+  Matrix products(dimension, directionNumber);
+  for (UnsignedLong k = 0; k < directionNumber; ++k)
+    {
+      NumericalPoint direction(dimension);
+      for (UnsignedLong i = 0; i < dimension; ++i) direction[i] = eigenVectors(i, order[k].second);
+      const NumericalPoint forwardGradient(limitStateFunction.gradient(designPoint + refinementStep * direction) * NumericalPoint(1, 1.0));
+      const NumericalPoint backwardGradient(limitStateFunction.gradient(designPoint - refinementStep * direction) * NumericalPoint(1, 1.0));
+      for (UnsignedLong i = 0; i < dimension; ++i)
+        {
+          directions(i, k) = direction[i];
+          products(i, k) = (forwardGradient[i] - backwardGradient[i]) / (2.0 * refinementStep);
+        }
+    }
+  /* Replace the approximation by the exact hessian on the span V of the selected directions:
+     H' = (Id - V.V^t).H.(Id - V.V^t) + W.V^t + V.W^t - V.M.V^t with W = H.V and M = sym(V^t.W)
+        = H + D.V^t + V.D^t + V.C.V^t with D = W - H.V and C = V^t.H.V - M */
+  const Matrix hessianDirections(hessian * directions);
+  const Matrix differences(products - hessianDirections);
+  Matrix correction(directionNumber, directionNumber);
+  for (UnsignedLong k = 0; k < directionNumber; ++k)
+    for (UnsignedLong l = 0; l < directionNumber; ++l)
+      for (UnsignedLong i = 0; i < dimension; ++i)
+        correction(k, l) += directions(i, k) * hessianDirections(i, l) - 0.5 * (directions(i, k) * products(i, l) + directions(i, l) * products(i, k));
+  const Matrix directionsCorrection(directions * correction);
+  for (UnsignedLong i = 0; i < dimension; ++i)
+    for (UnsignedLong j = 0; j < dimension; ++j)
+      for (UnsignedLong k = 0; k < directionNumber; ++k)
+        hessian(i, j) += differences(i, k) * directions(j, k) + directions(i, k) * differences(j, k) + directionsCorrection(i, k) * directions(j, k);
+  return hessian;
+}
+
 /* The function that actually evaluates the curvatures of the standard limite state function at the standard design point */
 void SORMResult::computeSortedCurvatures() const
 {
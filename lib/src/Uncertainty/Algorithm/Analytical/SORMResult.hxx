@@ -27,6 +27,7 @@
 
 #include "AnalyticalResult.hxx"
 #include "Event.hxx"
+#include "NumericalMathFunction.hxx"
 #include "SquareMatrix.hxx"
 #include "Distribution.hxx"
 
@@ -49,6 +50,15 @@ public:
              const Bool isStandardPointOriginInFailureSpace,
              const String & name = DefaultName);
 
+  /** Constructor using a quasi-Newton approximation of the hessian of the limit state function
+   *  built from the gradients computed along the path of the nearest point algorithm */
+  SORMResult(const NumericalPoint & standardSpaceDesignPoint,
+             const Event & limitStateVariable,
+             const Bool isStandardPointOriginInFailureSpace,
+             const NumericalSample & gradientInputSample,
+             const NumericalSample & gradientSample,
+             const String & name = DefaultName);
+
   /* Default constructor (required by SWIG :-<) */
   explicit SORMResult();
 
@@ -93,6 +103,11 @@ private:
   /** the function that evaluates the curvatures of the standard limite state fucntion at the standard design point */
   void computeSortedCurvatures() const;
 
+  /** the function that approximates the hessian of the standard limit state function at the standard design point */
+  SquareMatrix computeQuasiNewtonHessian(const NumericalMathFunction & limitStateFunction,
+                                         const NumericalSample & gradientInputSample,
+                                         const NumericalSample & gradientSample) const;
+
   /** type of gradients and hessian attributes are due to the constraint : limitStateVariable is scalar only in Open Turns v std */
   /** It should be a SymmetricMatrix but there is a bug in linear algebra with these matrices */
   SquareMatrix hessianLimitStateFunction_;
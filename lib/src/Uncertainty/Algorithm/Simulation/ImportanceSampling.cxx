@@ -21,7 +21,9 @@
  *  @author schueller
  *  @date   2012-07-16 15:59:45 +0200 (Mon, 16 Jul 2012)
  */
+#include <cmath>
 #include "ImportanceSampling.hxx"
+#include "Indices.hxx"
 #include "ComparisonOperatorImplementation.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
@@ -37,7 +39,8 @@ CLASSNAMEINIT(ImportanceSampling);
 /* Constructor with parameters */
 ImportanceSampling::ImportanceSampling(const Event & event, const Distribution & importanceDistribution):
   Simulation(event),
-  importanceDistribution_(importanceDistribution)
+  importanceDistribution_(importanceDistribution),
+  initialDistribution_(event.getImplementation()->getAntecedent()->getDistribution())
 {
   // Check if the importance distribution dimension is compatible with the event
   if (importanceDistribution.getDimension() != event.getImplementation()->getAntecedent()->getDimension()) throw InvalidArgumentException(HERE) << "The importance distribution must have the same dimension as the event";
@@ -57,20 +60,25 @@ NumericalSample ImportanceSampling::computeBlockSample()
   const NumericalSample inputSample(importanceDistribution_.getSample(blockSize));
   // Then, evaluate the function on this sample
   NumericalSample blockSample(getEvent().getImplementation()->getFunction()(inputSample));
-  // Then, modify in place this sample to take into account the change in the input distribution
-  // realizedEventSample = NumericalSample(blockSize_, inputSample.getDimension());
-  for (UnsignedLong i = 0; i < blockSize; i++)
+  // Then, gather the points where the event occured
+  Indices realizedIndices(0);
+  NumericalSample realizedSample(0, inputSample.getDimension());
+  for (UnsignedLong i = 0; i < blockSize; ++i)
     {
       const Bool isRealized(getEvent().getOperator()(blockSample[i][0], getEvent().getThreshold()));
       if (isRealized)
         {
-          // If the event occured, the value is p_initial(x[i]) / p_importance(x[i])
-          // Having access to p_initial is a long trip...
-          const NumericalScalar weight(getEvent().getImplementation()->getAntecedent()->getDistribution().computePDF(inputSample[i]) / importanceDistribution_.computePDF(inputSample[i]));
-          blockSample[i][0] = weight;
+          realizedIndices.add(i);
+          realizedSample.add(inputSample[i]);
         }
-      else blockSample[i][0] = 0.0;
+      blockSample[i][0] = 0.0;
     }
+  const UnsignedLong realizedSize(realizedIndices.getSize());
+  if (realizedSize == 0) return blockSample;
+  // If the event occured, the value is p_initial(x[i]) / p_importance(x[i]), computed in log space for the whole block
+  const NumericalSample initialLogPDF(initialDistribution_.computeLogPDF(realizedSample));
+  const NumericalSample importanceLogPDF(importanceDistribution_.computeLogPDF(realizedSample));
+  for (UnsignedLong i = 0; i < realizedSize; ++i) blockSample[realizedIndices[i]][0] = exp(initialLogPDF[i][0] - importanceLogPDF[i][0]);
   return blockSample;
 }
 
@@ -80,6 +88,12 @@ Distribution ImportanceSampling::getImportanceDistribution() const
   return importanceDistribution_;
 }
 
+/* The blocks only depend on the random stream */
+Bool ImportanceSampling::hasIndependentBlocks() const
+{
+  return true;
+}
+
 /* String converter */
 String ImportanceSampling::__repr__() const
 {
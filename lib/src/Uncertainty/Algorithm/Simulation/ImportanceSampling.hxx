@@ -63,9 +63,15 @@ private:
   /** Compute the block sample */
   NumericalSample computeBlockSample();
 
+  /** The blocks only depend on the random stream */
+  Bool hasIndependentBlocks() const;
+
   /** Instrumental importance distribution */
   Distribution importanceDistribution_;
 
+  /** Initial distribution of the input vector of the event */
+  Distribution initialDistribution_;
+
 } ; /* class ImportanceSampling */
 
 END_NAMESPACE_OPENTURNS
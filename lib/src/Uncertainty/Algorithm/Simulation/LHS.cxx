@@ -73,21 +73,8 @@ NumericalSample LHS::computeBlockSample()
   const UnsignedLong blockSize(getBlockSize());
   // Compute the total sample size
   const UnsignedLong totalSize(blockSize * getMaximumOuterSampling());
-  // Compute the total sample base position
-  UnsignedLong basePosition(blockIndex_ * blockSize);
-  // First, compute the input sub-sample based on the shuffling
-  NumericalSample inputSample(blockSize, NumericalPoint(dimension_));
-  for(UnsignedLong index = 0; index < blockSize; ++index)
-    {
-      const NumericalPoint u(RandomGenerator::Generate(dimension_));
-      for(UnsignedLong component = 0; component < dimension_; ++component)
-        {
-          NumericalScalar xi((shuffle_(component, basePosition) + u[component]) / totalSize);
-          inputSample[index][component] = marginals_[component].computeQuantile(xi)[0];
-        }
-      // Update the base position
-      ++basePosition;
-    }
+  // First, compute the input sub-sample based on the permutation of the cells
+  const NumericalSample inputSample(LHSExperiment::ComputeBlockSample(marginals_, keys_, totalSize, blockIndex_ * blockSize, blockSize));
   // Then, evaluate the function on this sample
   NumericalSample blockSample(getEvent().getImplementation()->getFunction()(inputSample));
   for (UnsignedLong i = 0; i < blockSize; ++i) blockSample[i][0] = getEvent().getOperator()(blockSample[i][0], event_.getThreshold());
@@ -96,10 +83,26 @@ NumericalSample LHS::computeBlockSample()
   return blockSample;
 }
 
+/* Skip the block computed by another process */
+void LHS::skipBlockSample()
+{
+  ++blockIndex_;
+}
+
 /* Performs the actual computation. */
 void LHS::run()
 {
-  shuffle_ = LHSExperiment::ComputeShuffle(dimension_, getBlockSize() * getMaximumOuterSampling());
+  keys_ = LHSExperiment::ComputePermutationKeys(dimension_);
+  // All the processes must share the same permutations
+  const MPICommunicator communicator(MPICommunicator::GetCommWorld());
+  if (communicator.getSize() > 1)
+    {
+      NumericalPoint sharedKeys(dimension_);
+      for (UnsignedLong i = 0; i < dimension_; ++i) sharedKeys[i] = keys_[i];
+      communicator.broadcast(sharedKeys);
+      for (UnsignedLong i = 0; i < dimension_; ++i) keys_[i] = static_cast<UnsignedLong>(sharedKeys[i]);
+    }
+  blockIndex_ = 0;
   Simulation::run();
 }
 
@@ -118,7 +121,7 @@ void LHS::save(Advocate & adv) const
   Simulation::save(adv);
   adv.saveAttribute("dimension_", dimension_);
   adv.saveAttribute("blockIndex_", blockIndex_);
-  adv.saveAttribute("shuffle_", shuffle_);
+  adv.saveAttribute("keys_", keys_);
   adv.saveAttribute("marginals_", marginals_);
 }
 
@@ -128,7 +131,7 @@ void LHS::load(Advocate & adv)
   Simulation::load(adv);
   adv.loadAttribute("dimension_", dimension_);
   adv.loadAttribute("blockIndex_", blockIndex_);
-  adv.loadAttribute("shuffle_", shuffle_);
+  adv.loadAttribute("keys_", keys_);
   adv.loadAttribute("marginals_", marginals_);
 }
 
@@ -29,7 +29,7 @@
 #include "Collection.hxx"
 #include "PersistentCollection.hxx"
 #include "Distribution.hxx"
-#include "Matrix.hxx"
+#include "Indices.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -37,6 +37,9 @@ BEGIN_NAMESPACE_OPENTURNS
 
 /**
  * @class LHS
+ *
+ * The cells of the whole design are permuted on the fly by keyed
+ * permutations, so the memory used does not depend on the total sample size.
  */
 
 class LHS: public Simulation
@@ -75,14 +78,17 @@ protected:
   /** Compute the block sample */
   NumericalSample computeBlockSample();
 
+  /** Skip the block computed by another process */
+  void skipBlockSample();
+
   /** Second antecedent dimension */
   UnsignedLong dimension_;
 
   /** Active block index */
   UnsignedLong blockIndex_;
 
-  /** Cells shuffle */
-  Matrix shuffle_;
+  /** Keys of the cells permutations */
+  Indices keys_;
 
   /** Marginal distributions */
   PersistentMarginals marginals_;
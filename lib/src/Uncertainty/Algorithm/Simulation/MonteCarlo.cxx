@@ -56,6 +56,12 @@ NumericalSample MonteCarlo::computeBlockSample()
   return event_.getSample(blockSize_);
 }
 
+/* The blocks only depend on the random stream */
+Bool MonteCarlo::hasIndependentBlocks() const
+{
+  return true;
+}
+
 /* String converter */
 String MonteCarlo::__repr__() const
 {
@@ -60,6 +60,9 @@ private:
   /** Compute the block sample and the points that realized the event */
   NumericalSample computeBlockSample();
 
+  /** The blocks only depend on the random stream */
+  Bool hasIndependentBlocks() const;
+
 } ; /* class MonteCarlo */
 
 END_NAMESPACE_OPENTURNS
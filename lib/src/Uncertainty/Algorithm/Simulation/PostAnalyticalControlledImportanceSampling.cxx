@@ -24,6 +24,7 @@
 #include "PostAnalyticalControlledImportanceSampling.hxx"
 #include "NumericalPoint.hxx"
 #include "ComparisonOperatorImplementation.hxx"
+#include "Indices.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -67,7 +68,10 @@ NumericalSample PostAnalyticalControlledImportanceSampling::computeBlockSample()
   inputSample.translate(standardSpaceDesignPoint);
   // Then, evaluate the function on this sample
   NumericalSample blockSample(getEvent().getImplementation()->getFunction()(inputSample));
-  // Then, modify in place this sample to take into account the change in the input distribution
+  // Then, gather the points where the event and its linear control disagree
+  Indices correctedIndices(0);
+  NumericalPoint factors(0);
+  NumericalSample correctedSample(0, inputSample.getDimension());
   for (UnsignedLong i = 0; i < blockSize; ++i)
     {
       const NumericalPoint realization(inputSample[i]);
@@ -78,11 +82,25 @@ NumericalSample PostAnalyticalControlledImportanceSampling::computeBlockSample()
       const Bool failureEvent(event_.getOperator()(blockSample[i][0], threshold));
       blockSample[i][0] = probability;
       const NumericalScalar factor((!failureControl && failureEvent) - (failureControl && !failureEvent));
-      if (factor != 0.0) blockSample[i][0] = blockSample[i][0] + factor * standardDistribution_.computePDF(realization) / standardDistribution_.computePDF(realization - standardSpaceDesignPoint);
+      if (factor != 0.0)
+        {
+          correctedIndices.add(i);
+          factors.add(factor);
+          correctedSample.add(realization);
+        }
     }
+  // Then, correct the control probability by the likelihood ratios computed at once
+  const NumericalPoint weights(computeImportanceWeights(correctedSample));
+  for (UnsignedLong i = 0; i < correctedIndices.getSize(); ++i) blockSample[correctedIndices[i]][0] += factors[i] * weights[i];
   return blockSample;
 }
 
+/* The blocks only depend on the random stream */
+Bool PostAnalyticalControlledImportanceSampling::hasIndependentBlocks() const
+{
+  return true;
+}
+
 /* String converter */
 String PostAnalyticalControlledImportanceSampling::__repr__() const
 {
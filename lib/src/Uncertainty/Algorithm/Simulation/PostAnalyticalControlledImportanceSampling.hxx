@@ -57,6 +57,9 @@ private:
   /** Compute the block sample */
   NumericalSample computeBlockSample();
 
+  /** The blocks only depend on the random stream */
+  Bool hasIndependentBlocks() const;
+
 } ; /* class PostAnalyticalControlledImportanceSampling */
 
 END_NAMESPACE_OPENTURNS
@@ -24,6 +24,7 @@
 #include "PostAnalyticalImportanceSampling.hxx"
 #include "NumericalPoint.hxx"
 #include "ComparisonOperatorImplementation.hxx"
+#include "Indices.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -62,23 +63,31 @@ NumericalSample PostAnalyticalImportanceSampling::computeBlockSample()
   inputSample.translate(standardSpaceDesignPoint);
   // Then, evaluate the function on this sample
   NumericalSample blockSample(getEvent().getImplementation()->getFunction()(inputSample));
-  // realizedEventSample = NumericalSample(blockSize_, inputSample.getDimension());
-  // Then, modify in place this sample to take into account the change in the input distribution
+  // Then, gather the points where the event occured
+  Indices realizedIndices(0);
+  NumericalSample realizedSample(0, inputSample.getDimension());
   for (UnsignedLong i = 0; i < blockSize; ++i)
     {
       const Bool isRealized(getEvent().getOperator()(blockSample[i][0], threshold));
-      // If the event has occured
       if (isRealized)
         {
-          // If the event occured, the value is p_initial(x[i]) / p_importance(x[i])
-          const NumericalScalar weight(standardDistribution_.computePDF(inputSample[i]) / standardDistribution_.computePDF(inputSample[i] - standardSpaceDesignPoint));
-          blockSample[i][0] = weight;
+          realizedIndices.add(i);
+          realizedSample.add(inputSample[i]);
         }
-      else blockSample[i][0] = 0.0;
+      blockSample[i][0] = 0.0;
     }
+  // If the event occured, the value is p_initial(x[i]) / p_importance(x[i])
+  const NumericalPoint weights(computeImportanceWeights(realizedSample));
+  for (UnsignedLong i = 0; i < realizedIndices.getSize(); ++i) blockSample[realizedIndices[i]][0] = weights[i];
   return blockSample;
 }
 
+/* The blocks only depend on the random stream */
+Bool PostAnalyticalImportanceSampling::hasIndependentBlocks() const
+{
+  return true;
+}
+
 /* String converter */
 String PostAnalyticalImportanceSampling::__repr__() const
 {
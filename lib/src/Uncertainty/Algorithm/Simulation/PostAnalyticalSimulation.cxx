@@ -22,6 +22,7 @@
  *  @author lebrun
  *  @date   2008-06-04 11:47:22 +0200 (mer, 04 jun 2008)
  */
+#include <cmath>
 #include "PostAnalyticalSimulation.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
@@ -57,6 +58,21 @@ NumericalScalar PostAnalyticalSimulation::getControlProbability() const
   return controlProbability_;
 }
 
+/* Compute the likelihood ratios p(u) / p(u - u*) of points u drawn around the standard design point u*.
+   The ratios are computed in log space for the whole sample at once */
+NumericalPoint PostAnalyticalSimulation::computeImportanceWeights(const NumericalSample & standardSample) const
+{
+  const UnsignedLong size(standardSample.getSize());
+  NumericalPoint weights(size);
+  if (size == 0) return weights;
+  NumericalSample centeredSample(standardSample);
+  centeredSample.translate(-1.0 * analyticalResult_.getStandardSpaceDesignPoint());
+  const NumericalSample initialLogPDF(standardDistribution_.computeLogPDF(standardSample));
+  const NumericalSample importanceLogPDF(standardDistribution_.computeLogPDF(centeredSample));
+  for (UnsignedLong i = 0; i < size; ++i) weights[i] = exp(initialLogPDF[i][0] - importanceLogPDF[i][0]);
+  return weights;
+}
+
 /* String converter */
 String PostAnalyticalSimulation::__repr__() const
 {
@@ -62,6 +62,9 @@ public:
 
 protected:
 
+  /** Compute the likelihood ratios p(u) / p(u - u*) of points u drawn around the standard design point u* */
+  NumericalPoint computeImportanceWeights(const NumericalSample & standardSample) const;
+
   /** FORM result upon which one compute a correction */
   AnalyticalResult analyticalResult_;
 
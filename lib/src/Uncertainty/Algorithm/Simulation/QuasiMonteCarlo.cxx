@@ -104,6 +104,13 @@ NumericalSample QuasiMonteCarlo::computeBlockSample()
 }
 
 
+/* Skip the block computed by another process */
+void QuasiMonteCarlo::skipBlockSample()
+{
+  // Move the low-discrepancy sequence past the points of the block
+  lowDiscrepancySequence_.generate(getBlockSize());
+}
+
 /* String converter */
 String QuasiMonteCarlo::__repr__() const
 {
@@ -68,6 +68,9 @@ NumericalSample RandomizedLHS::computeBlockSample()
   const UnsignedLong blockSize(getBlockSize());
   // Compute a shuffle of given dimension and blocksize
   const Matrix shuffle(LHSExperiment::ComputeShuffle(dimension_, blockSize));
+  // The quantile computation updates the caches of the distributions, so each block works on its own copies
+  Collection<Distribution> marginals(0);
+  for (UnsignedLong component = 0; component < dimension_; ++component) marginals.add(Distribution(*marginals_[component].getImplementation()));
   // First, compute the input sub-sample based on the shuffling
   NumericalSample inputSample(blockSize, NumericalPoint(dimension_));
   for(UnsignedLong index = 0; index < blockSize; ++index)
@@ -76,7 +79,7 @@ NumericalSample RandomizedLHS::computeBlockSample()
       for(UnsignedLong component = 0; component < dimension_; ++component)
         {
           NumericalScalar xi((shuffle(component, index) + u[component]) / blockSize);
-          inputSample[index][component] = marginals_[component].computeQuantile(xi)[0];
+          inputSample[index][component] = marginals[component].computeQuantile(xi)[0];
         }
     }
   // Then, evaluate the function on this sample
@@ -85,6 +88,12 @@ NumericalSample RandomizedLHS::computeBlockSample()
   return blockSample;
 }
 
+/* The blocks only depend on the random stream */
+Bool RandomizedLHS::hasIndependentBlocks() const
+{
+  return true;
+}
+
 /* String converter */
 String RandomizedLHS::__repr__() const
 {
@@ -72,6 +72,9 @@ protected:
   /** Compute the block sample */
   NumericalSample computeBlockSample();
 
+  /** The blocks only depend on the random stream */
+  Bool hasIndependentBlocks() const;
+
   /** Second antecedent dimension */
   UnsignedLong dimension_;
 
@@ -99,6 +99,13 @@ NumericalSample RandomizedQuasiMonteCarlo::computeBlockSample()
 }
 
 
+/* Skip the block computed by another process */
+void RandomizedQuasiMonteCarlo::skipBlockSample()
+{
+  // Move the low-discrepancy sequence past the points of the block
+  lowDiscrepancySequence_.generate(getBlockSize());
+}
+
 /* String converter */
 String RandomizedQuasiMonteCarlo::__repr__() const
 {
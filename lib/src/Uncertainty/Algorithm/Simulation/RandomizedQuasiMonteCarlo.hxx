@@ -69,6 +69,9 @@ private:
   /** Compute the block sample */
   NumericalSample computeBlockSample();
 
+  /** Skip the block computed by another process */
+  void skipBlockSample();
+
 protected:
   /** Antecedent dimension */
   UnsignedLong dimension_;
@@ -27,6 +27,9 @@
 #include "Curve.hxx"
 #include "NumericalPoint.hxx"
 #include "ResourceMap.hxx"
+#include "RandomGenerator.hxx"
+#include "TBB.hxx"
+#include "MutexLock.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -51,7 +54,8 @@ Simulation::Simulation(const Event & event,
     maximumOuterSampling_(ResourceMap::GetAsUnsignedLong( "Simulation-DefaultMaximumOuterSampling" )),
     maximumCoefficientOfVariation_(ResourceMap::GetAsNumericalScalar( "Simulation-DefaultMaximumCoefficientOfVariation" )),
     maximumStandardDeviation_(ResourceMap::GetAsNumericalScalar( "Simulation-DefaultMaximumStandardDeviation" )),
-    verbose_(verbose)
+    verbose_(verbose),
+    concurrentBlockNumber_(ResourceMap::GetAsUnsignedLong( "Simulation-DefaultConcurrentBlockNumber" ))
 {
   // Nothing to do
 }
@@ -125,6 +129,19 @@ UnsignedLong Simulation::getBlockSize() const
   return blockSize_;
 }
 
+/* Accessor to the number of blocks computed concurrently */
+void Simulation::setConcurrentBlockNumber(const UnsignedLong concurrentBlockNumber)
+{
+  if (concurrentBlockNumber < 1) throw InvalidArgumentException(HERE) << "The number of concurrent blocks must be >= 1";
+  concurrentBlockNumber_ = concurrentBlockNumber;
+}
+
+/* Accessor to the number of blocks computed concurrently */
+UnsignedLong Simulation::getConcurrentBlockNumber() const
+{
+  return concurrentBlockNumber_;
+}
+
 /* Verbosity accessor */
 void Simulation::setVerbose(const Bool verbose)
 {
@@ -163,11 +180,8 @@ void Simulation::run()
   // First, reset the convergence history
   convergenceStrategy_.clear();
   UnsignedLong outerSampling(0);
-  NumericalScalar coefficientOfVariation(-1.0);
-  NumericalScalar standardDeviation(-1.0);
   NumericalScalar probabilityEstimate(0.0);
   NumericalScalar varianceEstimate(0.0);
-  const UnsignedLong blockSize(getBlockSize());
   // Initialize the result. We use the accessors in order to preserve the exact nature of the result (SimulationResult or QuasiMonteCarloResult)
   // First, the invariant part
   // For the event, we have to access to the implementation as the interface does not provide the setEvent() method ON PURPOSE!
@@ -178,52 +192,248 @@ void Simulation::run()
   result_.setVarianceEstimate(varianceEstimate);
   result_.setOuterSampling(outerSampling);
   // We loop if there remains some outer sampling and the coefficient of variation is greater than the limit or has not been computed yet.
-  while ((outerSampling < getMaximumOuterSampling()) && ((coefficientOfVariation == -1.0) || (coefficientOfVariation > getMaximumCoefficientOfVariation())) && ((standardDeviation == -1.0) || (standardDeviation > getMaximumStandardDeviation())))
+  // The blocks are dealt between all the processes
+  const MPICommunicator communicator(MPICommunicator::GetCommWorld());
+  Bool converged(false);
+  while ((outerSampling < getMaximumOuterSampling()) && !converged)
     {
-      // Perform a block of simulation
-      const NumericalSample blockSample(computeBlockSample());
-      LOGDEBUG(OSS() << "Simulation::run: blockSample=\n" << blockSample);
-      ++outerSampling;
-      // Then, actualize the estimates
-      const NumericalScalar meanBlock(blockSample.computeMean()[0]);
-      const NumericalScalar varianceBlock(blockSample.computeCovariance()(0, 0));
-      // Let Skp be the empirical variance of a sample of size k*p
-      // Let Mkp be the empirical mean of a sample of size k*p
-      // Let Sp be the empirical variance of a sample of size p
-      // Let Mp be the empirical mean of a sample of size p
-      // Then, the empirical variance of the concatenated sample of size (k+1)*p is
-      // S(k+1)p = (Sp + k * Skp) / (k + 1) + k * (Mkp - Mp)^2 / (k + 1)^2
-      // and the empirical mean of the concatenated sample of size (k+1)*p is
-      // M(k+1)p = (Mp + k * Mkp) / (k + 1)
-      // To avoid integer overflow and double loss of precision, the formulas have to be written the way they are
-      const NumericalScalar size(outerSampling);
-      varianceEstimate = (varianceBlock + (size - 1.0) * varianceEstimate) / size + (1.0 - 1.0 / size) * (probabilityEstimate - meanBlock) * (probabilityEstimate - meanBlock) / size;
-      probabilityEstimate = (meanBlock + (size - 1.0) * probabilityEstimate) / size;
-      const NumericalScalar reducedVarianceEstimate(varianceEstimate / (size * blockSize));
-      // Update result
-      result_.setProbabilityEstimate(probabilityEstimate);
-      result_.setVarianceEstimate(reducedVarianceEstimate);
-      result_.setOuterSampling(outerSampling);
-      // Display the result at each outer sample
-      if (verbose_) LOGINFO(result_.__repr__());
-      // Get the coefficient of variation back
-      // We use the result to compute these quantities in order to
-      // delegate the treatment of the degenerate cases (i.e. the
-      // variance estimate is 0)
-      coefficientOfVariation = result_.getCoefficientOfVariation();
-      standardDeviation = result_.getStandardDeviation();
-      // Update the history
-      NumericalPoint convergencePoint(2);
-      convergencePoint[0] = probabilityEstimate;
-      // Get the variance estimate from the result in order to deal with simulation
-      // methods that do not provide variance estimate (conventional value: -1.0)
-      // It is checked using the value of the standard deviation
-      if (standardDeviation >= 0.0)
-        convergencePoint[1] = reducedVarianceEstimate;
-      else
-        convergencePoint[1] = -1.0;
-      convergenceStrategy_.store(convergencePoint);
+      // Perform several blocks of simulation at once
+      const UnsignedLong blockNumber(std::min(concurrentBlockNumber_ * communicator.getSize(), getMaximumOuterSampling() - outerSampling));
+      converged = computeBlocks(blockNumber, communicator, outerSampling, probabilityEstimate, varianceEstimate);
+    }
+}
+
+/* Merge the estimators of the next block into the running estimates and tell if the convergence is reached */
+Bool Simulation::mergeBlockEstimates(const NumericalScalar meanBlock,
+                                     const NumericalScalar varianceBlock,
+                                     UnsignedLong & outerSampling,
+                                     NumericalScalar & probabilityEstimate,
+                                     NumericalScalar & varianceEstimate)
+{
+  ++outerSampling;
+  // Let Skp be the empirical variance of a sample of size k*p
+  // Let Mkp be the empirical mean of a sample of size k*p
+  // Let Sp be the empirical variance of a sample of size p
+  // Let Mp be the empirical mean of a sample of size p
+  // Then, the empirical variance of the concatenated sample of size (k+1)*p is
+  // S(k+1)p = (Sp + k * Skp) / (k + 1) + k * (Mkp - Mp)^2 / (k + 1)^2
+  // and the empirical mean of the concatenated sample of size (k+1)*p is
+  // M(k+1)p = (Mp + k * Mkp) / (k + 1)
+  // To avoid integer overflow and double loss of precision, the formulas have to be written the way they are
+  const NumericalScalar size(outerSampling);
+  varianceEstimate = (varianceBlock + (size - 1.0) * varianceEstimate) / size + (1.0 - 1.0 / size) * (probabilityEstimate - meanBlock) * (probabilityEstimate - meanBlock) / size;
+  probabilityEstimate = (meanBlock + (size - 1.0) * probabilityEstimate) / size;
+  const NumericalScalar reducedVarianceEstimate(varianceEstimate / (size * getBlockSize()));
+  // Update result
+  result_.setProbabilityEstimate(probabilityEstimate);
+  result_.setVarianceEstimate(reducedVarianceEstimate);
+  result_.setOuterSampling(outerSampling);
+  // Display the result at each outer sample
+  if (verbose_) LOGINFO(result_.__repr__());
+  // Get the coefficient of variation back
+  // We use the result to compute these quantities in order to
+  // delegate the treatment of the degenerate cases (i.e. the
+  // variance estimate is 0)
+  const NumericalScalar coefficientOfVariation(result_.getCoefficientOfVariation());
+  const NumericalScalar standardDeviation(result_.getStandardDeviation());
+  // Update the history
+  NumericalPoint convergencePoint(2);
+  convergencePoint[0] = probabilityEstimate;
+  // Get the variance estimate from the result in order to deal with simulation
+  // methods that do not provide variance estimate (conventional value: -1.0)
+  // It is checked using the value of the standard deviation
+  if (standardDeviation >= 0.0)
+    convergencePoint[1] = reducedVarianceEstimate;
+  else
+    convergencePoint[1] = -1.0;
+  convergenceStrategy_.store(convergencePoint);
+  return ((coefficientOfVariation != -1.0) && (coefficientOfVariation <= getMaximumCoefficientOfVariation())) || ((standardDeviation != -1.0) && (standardDeviation <= getMaximumStandardDeviation()));
+}
+
+/* Tell if the blocks only depend on the random stream */
+Bool Simulation::hasIndependentBlocks() const
+{
+  return false;
+}
+
+/* Tell if the blocks can be computed concurrently, i.e. if the evaluation of the function of the event is reentrant */
+Bool Simulation::hasReentrantBlocks() const
+{
+  return event_.isComposite() && event_.getImplementation()->getFunction().getEvaluationImplementation()->isReentrant();
+}
+
+/* Update the state of the algorithm as if a block had been computed */
+void Simulation::skipBlockSample()
+{
+  // Nothing to do
+}
+
+/* Merging state of the blocks in flight in the current process */
+struct SimulationBlockMerger
+{
+  pthread_mutex_t mutex_;
+  Indices isComputed_;
+  UnsignedLong mergedBlockNumber_;
+  Bool converged_;
+  UnsignedLong & outerSampling_;
+  NumericalScalar & probabilityEstimate_;
+  NumericalScalar & varianceEstimate_;
+
+  SimulationBlockMerger(const UnsignedLong blockNumber,
+                        UnsignedLong & outerSampling,
+                        NumericalScalar & probabilityEstimate,
+                        NumericalScalar & varianceEstimate)
+    : isComputed_(blockNumber, 0), mergedBlockNumber_(0), converged_(false)
+    , outerSampling_(outerSampling), probabilityEstimate_(probabilityEstimate), varianceEstimate_(varianceEstimate)
+  {
+    pthread_mutex_init(&mutex_, NULL);
+  }
+
+  ~SimulationBlockMerger()
+  {
+    pthread_mutex_destroy(&mutex_);
+  }
+}; /* end struct SimulationBlockMerger */
+
+/* Functor computing blocks of a simulation, each one with its own random stream. If a merger is given,
+   the estimators are merged in order as soon as possible and the blocks that have not been started
+   when the convergence is reached are cancelled */
+struct SimulationBlockFunctor
+{
+  Simulation & simulation_;
+  const RandomGenerator::UnsignedLongCollection & seeds_;
+  const UnsignedLong first_;
+  const UnsignedLong stride_;
+  NumericalPoint & estimates_;
+  SimulationBlockMerger * p_merger_;
+
+  SimulationBlockFunctor(Simulation & simulation,
+                         const RandomGenerator::UnsignedLongCollection & seeds,
+                         const UnsignedLong first,
+                         const UnsignedLong stride,
+                         NumericalPoint & estimates,
+                         SimulationBlockMerger * p_merger)
+    : simulation_(simulation), seeds_(seeds), first_(first), stride_(stride), estimates_(estimates), p_merger_(p_merger) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    for (UnsignedLong i = r.begin(); i != r.end(); ++i)
+      {
+        const UnsignedLong blockIndex(first_ + i * stride_);
+        if (p_merger_ != 0)
+          {
+            MutexLock lock(p_merger_->mutex_);
+            if (p_merger_->converged_) return;
+          }
+        NumericalSample blockSample;
+        {
+          RandomGenerator::MersenneTwister generator(seeds_[blockIndex]);
+          const RandomGenerator::LocalStream stream(generator);
+          blockSample = simulation_.computeBlockSample();
+        }
+        LOGDEBUG(OSS() << "Simulation::computeBlocks: blockSample=\n" << blockSample);
+        estimates_[2 * blockIndex] = blockSample.computeMean()[0];
+        estimates_[2 * blockIndex + 1] = blockSample.computeCovariance()(0, 0);
+        if (p_merger_ != 0)
+          {
+            MutexLock lock(p_merger_->mutex_);
+            p_merger_->isComputed_[blockIndex] = 1;
+            while (!p_merger_->converged_ && (p_merger_->mergedBlockNumber_ < p_merger_->isComputed_.getSize()) && (p_merger_->isComputed_[p_merger_->mergedBlockNumber_] == 1))
+              {
+                const UnsignedLong mergedIndex(p_merger_->mergedBlockNumber_);
+                p_merger_->converged_ = simulation_.mergeBlockEstimates(estimates_[2 * mergedIndex], estimates_[2 * mergedIndex + 1], p_merger_->outerSampling_, p_merger_->probabilityEstimate_, p_merger_->varianceEstimate_);
+                ++p_merger_->mergedBlockNumber_;
+              }
+          }
+      }
+  }
+}; /* end struct SimulationBlockFunctor */
+
+/* Compute the given number of blocks, concurrently if possible, merge their estimators in order and tell if the convergence is reached */
+Bool Simulation::computeBlocks(const UnsignedLong blockNumber,
+                               const MPICommunicator & communicator,
+                               UnsignedLong & outerSampling,
+                               NumericalScalar & probabilityEstimate,
+                               NumericalScalar & varianceEstimate)
+{
+  const UnsignedLong size(communicator.getSize());
+  // The blocks are computed one after the other using the global random stream
+  if ((size == 1) && ((concurrentBlockNumber_ == 1) || !hasIndependentBlocks()))
+    {
+      for (UnsignedLong i = 0; i < blockNumber; ++i)
+        {
+          const NumericalSample blockSample(computeBlockSample());
+          LOGDEBUG(OSS() << "Simulation::computeBlocks: blockSample=\n" << blockSample);
+          if (mergeBlockEstimates(blockSample.computeMean()[0], blockSample.computeCovariance()(0, 0), outerSampling, probabilityEstimate, varianceEstimate)) return true;
+        }
+      return false;
+    }
+  // The seeds of the blocks are drawn in order from the global random stream of the root process, so
+  // the result does not depend on the scheduling of the blocks nor on the number of processes
+  RandomGenerator::UnsignedLongCollection seeds(RandomGenerator::IntegerGenerate(blockNumber, 4294967295UL));
+  if (size > 1)
+    {
+      NumericalPoint sharedSeeds(blockNumber);
+      for (UnsignedLong i = 0; i < blockNumber; ++i) sharedSeeds[i] = seeds[i];
+      communicator.broadcast(sharedSeeds);
+      for (UnsignedLong i = 0; i < blockNumber; ++i) seeds[i] = static_cast<UnsignedLong>(sharedSeeds[i]);
+    }
+  // Within a single process the estimators are merged as soon as possible, so the blocks past the
+  // convergence are not computed
+  if (size == 1)
+    {
+      SimulationBlockMerger merger(blockNumber, outerSampling, probabilityEstimate, varianceEstimate);
+      NumericalPoint estimates(2 * blockNumber, 0.0);
+      const SimulationBlockFunctor functor(*this, seeds, 0, 1, estimates, &merger);
+      if (hasReentrantBlocks()) TBB::ParallelFor(0, blockNumber, functor);
+      else functor(TBB::BlockedRange<UnsignedLong>(0, blockNumber));
+      return merger.converged_;
+    }
+  // Between processes, only the estimators of the blocks are exchanged and the convergence is checked
+  // once the estimators of all the blocks have been gathered
+  const NumericalPoint estimates(communicator.allReduceSum(computeBlockEstimates(seeds, communicator.getRank(), size)));
+  for (UnsignedLong i = 0; i < blockNumber; ++i)
+    if (mergeBlockEstimates(estimates[2 * i], estimates[2 * i + 1], outerSampling, probabilityEstimate, varianceEstimate)) return true;
+  return false;
+}
+
+/* Compute the mean and the variance of the blocks dealt to the given process, the ones of the other blocks being null */
+NumericalPoint Simulation::computeBlockEstimates(const RandomGenerator::UnsignedLongCollection & seeds,
+                                                 const UnsignedLong rank,
+                                                 const UnsignedLong size)
+{
+  if (rank >= size) throw InvalidArgumentException(HERE) << "Error: the rank=" << rank << " must be less than the number of processes=" << size;
+  const UnsignedLong blockNumber(seeds.getSize());
+  NumericalPoint estimates(2 * blockNumber, 0.0);
+  // The process is in charge of the blocks rank, rank + size, rank + 2 * size...
+  if (hasIndependentBlocks())
+    {
+      const UnsignedLong localBlockNumber(rank < blockNumber ? (blockNumber - rank + size - 1) / size : 0);
+      const SimulationBlockFunctor functor(*this, seeds, rank, size, estimates, 0);
+      // The evaluations of the function are shared by the threads only if they are reentrant, otherwise
+      // the blocks are computed one after the other with the same random streams
+      if (hasReentrantBlocks()) TBB::ParallelFor(0, localBlockNumber, functor);
+      else functor(TBB::BlockedRange<UnsignedLong>(0, localBlockNumber));
+      return estimates;
+    }
+  // The state of the algorithm has to go through all the blocks, in order
+  for (UnsignedLong i = 0; i < blockNumber; ++i)
+    {
+      if (i % size == rank)
+        {
+          NumericalSample blockSample;
+          {
+            RandomGenerator::MersenneTwister generator(seeds[i]);
+            const RandomGenerator::LocalStream stream(generator);
+            blockSample = computeBlockSample();
+          }
+          LOGDEBUG(OSS() << "Simulation::computeBlockEstimates: blockSample=\n" << blockSample);
+          estimates[2 * i] = blockSample.computeMean()[0];
+          estimates[2 * i + 1] = blockSample.computeCovariance()(0, 0);
+        }
+      else skipBlockSample();
     }
+  return estimates;
 }
 
 /* Convergence strategy accessor */
@@ -291,6 +501,7 @@ void Simulation::save(Advocate & adv) const
   adv.saveAttribute("maximumCoefficientOfVariation_", maximumCoefficientOfVariation_);
   adv.saveAttribute("maximumStandardDeviation_", maximumStandardDeviation_);
   adv.saveAttribute("verbose_", verbose_);
+  adv.saveAttribute("concurrentBlockNumber_", concurrentBlockNumber_);
 
 }
 
@@ -306,6 +517,7 @@ void Simulation::load(Advocate & adv)
   adv.loadAttribute("maximumCoefficientOfVariation_", maximumCoefficientOfVariation_);
   adv.loadAttribute("maximumStandardDeviation_", maximumStandardDeviation_);
   adv.loadAttribute("verbose_", verbose_);
+  adv.loadAttribute("concurrentBlockNumber_", concurrentBlockNumber_);
 }
 
 
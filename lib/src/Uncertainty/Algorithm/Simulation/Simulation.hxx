@@ -33,6 +33,9 @@
 #include "Graph.hxx"
 #include "SimulationResult.hxx"
 #include "Event.hxx"
+#include "Collection.hxx"
+#include "MPI.hxx"
+#include "RandomGenerator.hxx"
 
 
 BEGIN_NAMESPACE_OPENTURNS
@@ -42,6 +45,23 @@ BEGIN_NAMESPACE_OPENTURNS
 
 /**
  * @class Simulation
+ *
+ * Simulation estimates the probability of an event by blocks of
+ * realizations. By default the blocks are drawn one after the other from
+ * the global random stream. Several blocks can be kept in flight at once:
+ * each of them is then computed with its own random stream, seeded in
+ * order from the global one, so the result does not depend on the number
+ * of blocks in flight as long as there are several of them, but it differs
+ * from the result with a single block in flight. The estimators are merged
+ * in a deterministic order and the blocks that have not been started when
+ * the convergence criteria are met are cancelled. The blocks run in
+ * separate threads only if the evaluation of the function is reentrant.
+ * The simulations whose blocks modify the algorithm (LHS, quasi Monte
+ * Carlo) never keep several blocks in flight: within a single process they
+ * always draw their blocks one after the other from the global stream.
+ * When the library is built with MPI, the blocks are dealt between the
+ * processes of the global communicator and the block estimators are
+ * gathered on all of them.
  */
 
 class Simulation
@@ -80,6 +100,10 @@ public:
   void setBlockSize(const UnsignedLong blockSize);
   UnsignedLong getBlockSize() const;
 
+  /** Accessor to the number of blocks computed concurrently */
+  void setConcurrentBlockNumber(const UnsignedLong concurrentBlockNumber);
+  UnsignedLong getConcurrentBlockNumber() const;
+
   /** Verbosity accessor */
   void setVerbose(const Bool verbose);
   Bool getVerbose() const;
@@ -111,13 +135,31 @@ protected:
   /** Compute the block sample and the points that realized the event */
   virtual NumericalSample computeBlockSample() = 0;
 
+  /** Tell if the blocks only depend on the random stream, i.e. if computeBlockSample() does not modify the algorithm.
+      Only such simulations compute several blocks at once */
+  virtual Bool hasIndependentBlocks() const;
+
+  /** Tell if computeBlockSample() can be called concurrently, i.e. if the evaluation of the function of the event is reentrant */
+  virtual Bool hasReentrantBlocks() const;
+
+  /** Update the state of the algorithm as if a block had been computed, when this block is computed by another process */
+  virtual void skipBlockSample();
+
+  /** Compute the mean and the variance of the blocks dealt to the process of the given rank among the given number of
+      processes, block i being computed with the random stream seeded by seeds[i]. The estimators of the other blocks are null */
+  NumericalPoint computeBlockEstimates(const RandomGenerator::UnsignedLongCollection & seeds,
+                                       const UnsignedLong rank,
+                                       const UnsignedLong size);
+
 protected:
 
   /** For save/load mechanism*/
   Simulation(const Bool verbose = true,
-             const HistoryStrategy & convergenceStrategy = Compact()) {};
+             const HistoryStrategy & convergenceStrategy = Compact())
+    : concurrentBlockNumber_(1) {};
 
   friend class Factory<Simulation>;
+  friend struct SimulationBlockFunctor;
 
   /** History strategy for the probability and variance estimate */
   HistoryStrategy convergenceStrategy_;
@@ -133,6 +175,20 @@ protected:
 
 private:
 
+  /** Compute the given number of blocks, concurrently if possible, merge their estimators in order and tell if the convergence is reached */
+  Bool computeBlocks(const UnsignedLong blockNumber,
+                     const MPICommunicator & communicator,
+                     UnsignedLong & outerSampling,
+                     NumericalScalar & probabilityEstimate,
+                     NumericalScalar & varianceEstimate);
+
+  /** Merge the estimators of the next block into the running estimates and tell if the convergence is reached */
+  Bool mergeBlockEstimates(const NumericalScalar meanBlock,
+                           const NumericalScalar varianceBlock,
+                           UnsignedLong & outerSampling,
+                           NumericalScalar & probabilityEstimate,
+                           NumericalScalar & varianceEstimate);
+
   // Maximum number of outer iteration allowed
   UnsignedLong maximumOuterSampling_;
 
@@ -145,6 +201,9 @@ private:
   // Do we have to echo all the intermediate results?
   Bool verbose_;
 
+  // Number of blocks computed concurrently
+  UnsignedLong concurrentBlockNumber_;
+
 } ; /* class Simulation */
 
 
@@ -26,19 +26,18 @@
 #include "Collection.hxx"
 #include "NumericalPoint.hxx"
 #include "Exception.hxx"
+#include "TBB.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
 
 
-typedef Collection<Distribution> DistributionCollection;
-
 CLASSNAMEINIT(LHSExperiment);
 
 /* Default constructor */
 LHSExperiment::LHSExperiment(const String & name):
   WeightedExperiment(name),
-  shuffle_(0, 0),
+  keys_(0),
   isAlreadyComputedShuffle_(false)
 {
   // Nothing to do
@@ -48,7 +47,7 @@ LHSExperiment::LHSExperiment(const String & name):
 LHSExperiment::LHSExperiment(const UnsignedLong size,
                              const String & name):
   WeightedExperiment(size, name),
-  shuffle_(0, 0),
+  keys_(0),
   isAlreadyComputedShuffle_(false)
 {
   // Nothing to do
@@ -59,7 +58,7 @@ LHSExperiment::LHSExperiment(const Distribution & distribution,
                              const UnsignedLong size,
                              const String & name):
   WeightedExperiment(distribution, size, name),
-  shuffle_(0, 0),
+  keys_(0),
   isAlreadyComputedShuffle_(false)
 {
   // Check if the distribution has an independent copula
@@ -87,21 +86,15 @@ String LHSExperiment::__repr__() const
 NumericalSample LHSExperiment::generate()
 {
   const UnsignedLong dimension(distribution_.getDimension());
-  // To insure that the shuffle has been initialized
-  shuffle_ = getShuffle();
-  NumericalSample sample(size_, dimension);
-  DistributionCollection marginals(dimension);
-  for (UnsignedLong i = 0; i < dimension; ++i) marginals[i] = distribution_.getMarginal(i);
-  for(UnsignedLong index = 0; index < size_; ++index)
+  // To insure that the permutation keys have been initialized
+  if (!isAlreadyComputedShuffle_)
     {
-      const NumericalPoint u(RandomGenerator::Generate(dimension));
-      for(UnsignedLong component = 0; component < dimension; ++component)
-        {
-          const NumericalScalar xi((shuffle_(component, index) + u[component]) / size_);
-          sample[index][component] = marginals[component].computeQuantile(xi)[0];
-        }
+      keys_ = ComputePermutationKeys(dimension);
+      isAlreadyComputedShuffle_ = true;
     }
-  return sample;
+  DistributionCollection marginals(dimension);
+  for (UnsignedLong i = 0; i < dimension; ++i) marginals[i] = distribution_.getMarginal(i);
+  return ComputeBlockSample(marginals, keys_, size_, 0, size_);
 }
 
 /* Shuffle the cells. */
@@ -131,15 +124,129 @@ Matrix LHSExperiment::ComputeShuffle(const UnsignedLong dimension,
   return result;
 }
 
-/* Shuffle accessor */
+/* Draw the keys of the cells permutations, one per component */
+Indices LHSExperiment::ComputePermutationKeys(const UnsignedLong dimension)
+{
+  const RandomGenerator::UnsignedLongCollection keys(RandomGenerator::IntegerGenerate(dimension, 4294967295UL));
+  Indices result(dimension);
+  for (UnsignedLong i = 0; i < dimension; ++i) result[i] = keys[i];
+  return result;
+}
+
+/* Cell of the given point through the keyed permutation of [[0, size-1]].
+   The permutation is a composition of bijections of the integers of w bits,
+   where 2^w is the smallest power of 2 not less than size: xor with the key,
+   multiplications by odd constants and right xorshifts restricted to the w
+   bits. The values outside of [[0, size-1]] are skipped by cycle walking,
+   which needs less than two rounds on average. See A. Kensler, "Correlated
+   multi-jittered sampling", Pixar technical memo 13-01, 2013. */
+UnsignedLong LHSExperiment::ComputePermutation(const UnsignedLong index,
+                                               const UnsignedLong size,
+                                               const UnsignedLong key)
+{
+  if (size < 2) return 0;
+  UnsignedLong mask(size - 1);
+  mask |= mask >> 1;
+  mask |= mask >> 2;
+  mask |= mask >> 4;
+  mask |= mask >> 8;
+  mask |= mask >> 16;
+  mask |= mask >> 32;
+  UnsignedLong i(index);
+  do
+    {
+      i ^= key;
+      i *= 0xe170893dUL;
+      i ^= key >> 16;
+      i ^= (i & mask) >> 4;
+      i ^= key >> 8;
+      i *= 0x0929eb3fUL;
+      i ^= key >> 23;
+      i ^= (i & mask) >> 1;
+      i *= 1 | key >> 27;
+      i *= 0x6935fa69UL;
+      i ^= (i & mask) >> 11;
+      i *= 0x74dcb303UL;
+      i ^= (i & mask) >> 2;
+      i *= 0x9e501cc3UL;
+      i ^= (i & mask) >> 2;
+      i *= 0xc860a3dfUL;
+      i &= mask;
+      i ^= i >> 5;
+    }
+  while (i >= size);
+  return (i + key) % size;
+}
+
+/* Functor computing a block of an LHS design. The cells of the points are
+   computed along each component and the quantiles of each marginal are
+   evaluated at once over the range of points */
+struct LHSExperimentBlockFunctor
+{
+  const LHSExperiment::DistributionCollection & marginals_;
+  const Indices & keys_;
+  const NumericalPoint & u_;
+  const UnsignedLong totalSize_;
+  const UnsignedLong basePosition_;
+  NumericalSample & output_;
+
+  LHSExperimentBlockFunctor(const LHSExperiment::DistributionCollection & marginals,
+                            const Indices & keys,
+                            const NumericalPoint & u,
+                            const UnsignedLong totalSize,
+                            const UnsignedLong basePosition,
+                            NumericalSample & output)
+    : marginals_(marginals), keys_(keys), u_(u), totalSize_(totalSize), basePosition_(basePosition), output_(output) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    const UnsignedLong dimension(marginals_.getSize());
+    NumericalPoint xi(r.end() - r.begin());
+    for (UnsignedLong component = 0; component < dimension; ++component)
+      {
+        for (UnsignedLong index = r.begin(); index != r.end(); ++index)
+          xi[index - r.begin()] = (LHSExperiment::ComputePermutation(basePosition_ + index, totalSize_, keys_[component]) + u_[index * dimension + component]) / totalSize_;
+        // The quantile computation updates the caches of the distribution, so each task works on its own copy
+        const Distribution marginal(*marginals_[component].getImplementation());
+        const NumericalSample quantiles(marginal.getImplementation()->computeQuantile(xi));
+        for (UnsignedLong index = r.begin(); index != r.end(); ++index)
+          output_[index][component] = quantiles[index - r.begin()][0];
+      }
+  }
+}; /* end struct LHSExperimentBlockFunctor */
+
+/* Compute the points [basePosition, basePosition + blockSize[ of an LHS design of the given total size */
+NumericalSample LHSExperiment::ComputeBlockSample(const DistributionCollection & marginals,
+                                                  const Indices & keys,
+                                                  const UnsignedLong totalSize,
+                                                  const UnsignedLong basePosition,
+                                                  const UnsignedLong blockSize)
+{
+  const UnsignedLong dimension(marginals.getSize());
+  if (keys.getSize() != dimension) throw InvalidArgumentException(HERE) << "Error: expected " << dimension << " permutation keys, got " << keys.getSize();
+  if (basePosition + blockSize > totalSize) throw InvalidArgumentException(HERE) << "Error: the block [" << basePosition << ", " << basePosition + blockSize << "[ exceeds the size of the design=" << totalSize;
+  // The jitters are drawn sequentially so that the design does not depend on the partition of the block
+  const NumericalPoint u(RandomGenerator::Generate(blockSize * dimension));
+  NumericalSample sample(blockSize, dimension);
+  const LHSExperimentBlockFunctor functor(marginals, keys, u, totalSize, basePosition, sample);
+  TBB::ParallelFor(0, blockSize, functor);
+  return sample;
+}
+
+/* Shuffle accessor. The shuffle is built from the permutation keys */
 Matrix LHSExperiment::getShuffle() const
 {
+  const UnsignedLong dimension(distribution_.getDimension());
   if (!isAlreadyComputedShuffle_)
     {
-      shuffle_ = ComputeShuffle(distribution_.getDimension(), size_);
+      keys_ = ComputePermutationKeys(dimension);
       isAlreadyComputedShuffle_ = true;
     }
-  return shuffle_;
+  Matrix shuffle(dimension, size_);
+  for (UnsignedLong j = 0; j < size_; ++j)
+    for (UnsignedLong i = 0; i < dimension; ++i)
+      shuffle(i, j) = ComputePermutation(j, size_, keys_[i]);
+  return shuffle;
 }
 
 /* Distribution accessor */
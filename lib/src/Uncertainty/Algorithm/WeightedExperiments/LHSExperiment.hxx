@@ -27,6 +27,8 @@
 
 #include "WeightedExperiment.hxx"
 #include "Matrix.hxx"
+#include "Indices.hxx"
+#include "Collection.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -35,7 +37,10 @@ BEGIN_NAMESPACE_OPENTURNS
 /**
  * @class LHSExperiment
  *
- * The class describes the probabilistic concept of LHSExperiment plan
+ * The class describes the probabilistic concept of LHSExperiment plan.
+ * The cells are shuffled by keyed random permutations computed on the fly,
+ * so that only one key per component has to be stored whatever the size
+ * of the experiment.
  */
 class LHSExperiment
   : public WeightedExperiment
@@ -43,6 +48,7 @@ class LHSExperiment
   CLASSNAME;
 public:
 
+  typedef Collection<Distribution> DistributionCollection;
 
   /** Default constructor */
   explicit LHSExperiment(const String & name = DefaultName);
@@ -72,6 +78,21 @@ public:
   static Matrix ComputeShuffle(const UnsignedLong dimension,
                                const UnsignedLong totalSize);
 
+  /** Draw the keys of the cells permutations, one per component */
+  static Indices ComputePermutationKeys(const UnsignedLong dimension);
+
+  /** Cell of the given point through the keyed permutation of [[0, size-1]] */
+  static UnsignedLong ComputePermutation(const UnsignedLong index,
+                                         const UnsignedLong size,
+                                         const UnsignedLong key);
+
+  /** Compute the points [basePosition, basePosition + blockSize[ of an LHS design of the given total size */
+  static NumericalSample ComputeBlockSample(const DistributionCollection & marginals,
+                                            const Indices & keys,
+                                            const UnsignedLong totalSize,
+                                            const UnsignedLong basePosition,
+                                            const UnsignedLong blockSize);
+
   /** Shuffle accessor */
   virtual Matrix getShuffle() const;
 
@@ -79,8 +100,8 @@ public:
   void setDistribution(const Distribution & distribution);
 
 private:
-  /** Cells shuffle */
-  mutable Matrix shuffle_;
+  /** Keys of the cells permutations */
+  mutable Indices keys_;
 
   /** Flag to avoid redundant computation of the shuffle */
   mutable Bool isAlreadyComputedShuffle_;
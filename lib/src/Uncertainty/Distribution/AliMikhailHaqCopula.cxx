@@ -226,6 +226,13 @@ NumericalScalar AliMikhailHaqCopula::computeConditionalQuantile(const NumericalS
   return -0.5 * (theta_ + 2.0 * qTheta - 2.0 * qTheta2 - 2.0 * qTheta2U2 - tmp1 - 1.0 + tmp2 + tmp3) / (theta_ * (-1.0 + qTheta - tmp1 + qTheta * u2));
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint AliMikhailHaqCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                               const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Compute the archimedean generator of the archimedean copula, i.e.
  * the function phi such that the CDF of the copula can
  * be written as CDF(t) = phi^{-1}(phi(u)+phi(v))
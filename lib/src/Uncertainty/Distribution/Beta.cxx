@@ -138,6 +138,17 @@ NumericalPoint Beta::getRealization() const
   return NumericalPoint(1, a_ + (b_ - a_) * DistFunc::rBeta(r_, t_ - r_));
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample Beta::getSample(const UnsignedLong size) const
+{
+  const NumericalPoint values(DistFunc::rBeta(r_, t_ - r_, size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = a_ + (b_ - a_) * values[i];
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 /* Get the DDF of the distribution */
 NumericalPoint Beta::computeDDF(const NumericalPoint & point) const
 {
@@ -96,6 +96,17 @@ NumericalPoint Binomial::getRealization() const
   return NumericalPoint(1, DistFunc::rBinomial(n_, p_));
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample Binomial::getSample(const UnsignedLong size) const
+{
+  const Indices values(DistFunc::rBinomial(n_, p_, size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = values[i];
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 
 /* Get the PDF of the distribution */
 NumericalScalar Binomial::computePDF(const NumericalPoint & point) const
@@ -125,6 +125,17 @@ NumericalPoint ChiSquare::getRealization() const
   return NumericalPoint(1, 2.0 * DistFunc::rGamma(0.5 * nu_));
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample ChiSquare::getSample(const UnsignedLong size) const
+{
+  const NumericalPoint values(DistFunc::rGamma(0.5 * nu_, size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = 2.0 * values[i];
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 
 /* Get the DDF of the distribution */
 NumericalPoint ChiSquare::computeDDF(const NumericalPoint & point) const
@@ -255,6 +255,13 @@ NumericalScalar ClaytonCopula::computeConditionalQuantile(const NumericalScalar
   return z * pow(pow(q, -theta_ / (1.0 + theta_)) - 1.0 + pow(z, theta_), -1.0 / theta_);
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint ClaytonCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                         const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Tell if the distribution has independent copula */
 Bool ClaytonCopula::hasIndependentCopula() const
 {
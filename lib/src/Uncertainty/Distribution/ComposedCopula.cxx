@@ -366,6 +366,13 @@ NumericalScalar ComposedCopula::computeConditionalQuantile(const NumericalScalar
   return copulaCollection_[copulaIndex].computeConditionalQuantile(q, conditioningVector);
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint ComposedCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                          const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Get the distribution of the marginal distribution corresponding to indices dimensions
    Some additional restriction occur for this copula: the indices must be of the form:
    [i_1^1,...,i_k1^1,i_1^2,...,i_k2^2,...,i_1^n,...,i_kn^n]
@@ -184,6 +184,7 @@ void ComposedDistribution::setCopula(const Copula & copula)
 
   copula_ = copula;
   isAlreadyComputedCovariance_ = false;
+  isAlreadyCreatedConditionalDistributions_ = false;
   // We ensure that the copula has the same description than the ComposedDistribution
   copula_.setDescription(getDescription());
 }
@@ -412,6 +413,43 @@ NumericalScalar ComposedDistribution::computeConditionalCDF(const NumericalScala
   return copula_.computeConditionalCDF(distributionCollection_[conditioningDimension].computeCDF(x), u);
 }
 
+/* Compute the quantile of Xi | X1, ..., Xi-1, i.e. x such that CDF(x|y) = q with x = Xi, y = (X1,...,Xi-1) */
+NumericalScalar ComposedDistribution::computeConditionalQuantile(const NumericalScalar q, const NumericalPoint & y) const
+{
+  const UnsignedLong conditioningDimension(y.getDimension());
+  if (conditioningDimension >= getDimension()) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional quantile with a conditioning point of dimension greater or equal to the distribution dimension.";
+  if ((q < 0.0) || (q > 1.0)) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional quantile for a probability level outside of [0, 1]";
+  // Special case for no conditioning or independent copula
+  if ((conditioningDimension == 0) || (hasIndependentCopula())) return distributionCollection_[conditioningDimension].computeQuantile(q)[0];
+  // General case
+  NumericalPoint u(conditioningDimension);
+  for (UnsignedLong i = 0; i < conditioningDimension; ++i) u[i] = distributionCollection_[i].computeCDF(y[i]);
+  return distributionCollection_[conditioningDimension].computeQuantile(copula_.computeConditionalQuantile(q, u))[0];
+}
+
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint ComposedDistribution::computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const
+{
+  const UnsignedLong size(q.getDimension());
+  if (y.getSize() != size) throw InvalidArgumentException(HERE) << "Error: cannot compute conditional quantiles with a number of probability levels=" << size << " different from the number of conditioning points=" << y.getSize();
+  const UnsignedLong conditioningDimension(y.getDimension());
+  if (conditioningDimension >= getDimension()) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional quantile with a conditioning point of dimension greater or equal to the distribution dimension.";
+  for (UnsignedLong i = 0; i < size; ++i)
+    if ((q[i] < 0.0) || (q[i] > 1.0)) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional quantile for a probability level outside of [0, 1]";
+  NumericalPoint quantile(q);
+  // The conditioning points are mapped into the copula space, then the copula inverts the whole column at once
+  if ((conditioningDimension > 0) && !hasIndependentCopula())
+    {
+      NumericalSample u(size, conditioningDimension);
+      for (UnsignedLong j = 0; j < conditioningDimension; ++j)
+        for (UnsignedLong i = 0; i < size; ++i) u[i][j] = distributionCollection_[j].computeCDF(y[i][j]);
+      quantile = copula_.computeConditionalQuantile(q, u);
+    }
+  const Distribution marginal(distributionCollection_[conditioningDimension]);
+  for (UnsignedLong i = 0; i < size; ++i) quantile[i] = marginal.computeQuantile(quantile[i])[0];
+  return quantile;
+}
+
 /* Compute the numerical range of the distribution given the parameters values */
 void ComposedDistribution::computeRange()
 {
@@ -116,6 +116,12 @@ public:
   /** Compute the CDF of Xi | X1, ..., Xi-1. x = Xi, y = (X1,...,Xi-1) */
   NumericalScalar computeConditionalCDF(const NumericalScalar x, const NumericalPoint & y) const;
 
+  /** Compute the quantile of Xi | X1, ..., Xi-1, i.e. x such that CDF(x|y) = q with x = Xi, y = (X1,...,Xi-1) */
+  NumericalScalar computeConditionalQuantile(const NumericalScalar q, const NumericalPoint & y) const;
+
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+  NumericalPoint computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const;
+
   /** Get the standard deviation of the distribution */
   NumericalPoint getStandardDeviation() const;
 
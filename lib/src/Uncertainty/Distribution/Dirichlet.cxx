@@ -179,19 +179,22 @@ NumericalScalar Dirichlet::computeCDF(const NumericalPoint & point) const
       // Initialization at the first call
       static const UnsignedLong N(ResourceMap::GetAsUnsignedLong("Dirichlet-DefaultIntegrationSize"));
       // Do we have to initialize the CDF data?
-      if (!isInitializedCDF_)
-        {
-          integrationNodes_ = NumericalPointCollection(0);
-          integrationWeights_ = NumericalPointCollection(0);
-          for (UnsignedLong i = 0; i < dimension; ++i)
-            {
-              NumericalPoint marginalWeights;
-              NumericalPoint marginalNodes(JacobiFactory(0, theta_[i] - 1.0).getNodesAndWeights(N, marginalWeights));
-              integrationNodes_.add(marginalNodes);
-              integrationWeights_.add(marginalWeights);
-            }
-          isInitializedCDF_ = true;
-        } // !isInitialized
+      {
+        CacheLock lock(*this);
+        if (!isInitializedCDF_)
+          {
+            integrationNodes_ = NumericalPointCollection(0);
+            integrationWeights_ = NumericalPointCollection(0);
+            for (UnsignedLong i = 0; i < dimension; ++i)
+              {
+                NumericalPoint marginalWeights;
+                NumericalPoint marginalNodes(JacobiFactory(0, theta_[i] - 1.0).getNodesAndWeights(N, marginalWeights));
+                integrationNodes_.add(marginalNodes);
+                integrationWeights_.add(marginalWeights);
+              }
+            isInitializedCDF_ = true;
+          } // !isInitialized
+      }
       Indices indices(dimension, 0);
       NumericalScalar value(0.0);
       NumericalScalar logFactor(normalizationFactor_);
@@ -333,6 +336,13 @@ NumericalScalar Dirichlet::computeConditionalQuantile(const NumericalScalar q,
   return (1.0 - sum) * DistFunc::qBeta(r, s, q);
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint Dirichlet::computeConditionalQuantile(const NumericalPoint & q,
+                                                     const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Compute the mean of the distribution */
 void Dirichlet::computeMean() const
 {
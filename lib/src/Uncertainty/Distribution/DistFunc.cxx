@@ -45,6 +45,25 @@
 
 BEGIN_NAMESPACE_OPENTURNS
 
+/* The random variate generators are written against a uniform generator given as a template
+   parameter, so that the same algorithm can draw from the global random generator one variate at
+   a time or from a generator fetched once for a whole array of variates */
+/* Adapter giving access to the global random generator */
+struct GlobalUniformGenerator
+{
+  NumericalScalar gen()
+  {
+    return RandomGenerator::Generate();
+  }
+  UnsignedLong igen(const UnsignedLong n)
+  {
+    return RandomGenerator::IntegerGenerate(n);
+  }
+}; /* end struct GlobalUniformGenerator */
+
+template <class UniformGenerator>
+static NumericalScalar ZigguratNormal(UniformGenerator & generator);
+
 
 
 
@@ -154,8 +173,10 @@ NumericalScalar DistFunc::qBeta(const NumericalScalar p1,
    and with the important errata at:
    http://cg.scs.carleton.ca/~luc/errors.pdf
 */
-NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
-                                const NumericalScalar p2)
+template <class UniformGenerator>
+static NumericalScalar BetaVariate(const NumericalScalar p1,
+                                   const NumericalScalar p2,
+                                   UniformGenerator & generator)
 {
   // Strategy:
   // If (a = 1 and b = 1), Beta(1,1) = Uniform(0,1)
@@ -165,15 +186,15 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
   // If (a < 1 and b < 1), Atkinson and Whittaker 1
   // If (a < 1 and b > 1) or (a > 1 and b < 1), Atkinson and Whittaker 2
   // If (a > 1 and b > 1) Cheng.
-  if ((p1 == 1.0) && (p2 == 1.0)) return RandomGenerator::Generate();
+  if ((p1 == 1.0) && (p2 == 1.0)) return generator.gen();
   // Special case for p1 = 1 or p2 = 1
   if (p1 == 1.0)
     {
-      return 1.0 - pow(RandomGenerator::Generate(), 1.0 / p2);
+      return 1.0 - pow(generator.gen(), 1.0 / p2);
     }
   if (p2 == 1.0)
     {
-      return pow(RandomGenerator::Generate(), 1.0 / p1);
+      return pow(generator.gen(), 1.0 / p1);
     }
   // Now, the more general cases
   NumericalScalar minp(std::min(p1, p2));
@@ -188,8 +209,8 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
         {
           for (;;)
             {
-              NumericalScalar u(RandomGenerator::Generate());
-              NumericalScalar v(RandomGenerator::Generate());
+              NumericalScalar u(generator.gen());
+              NumericalScalar v(generator.gen());
               NumericalScalar logx(log(u) / p1);
               NumericalScalar logy(log(v) / p2);
               NumericalScalar logsum((logx > logy) ? logx + log1p(exp(logy - logx)) : logy + log1p(exp(logx - logy)));
@@ -200,8 +221,8 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
       // Usual form of the algorithm
       for (;;)
         {
-          NumericalScalar u(RandomGenerator::Generate());
-          NumericalScalar v(RandomGenerator::Generate());
+          NumericalScalar u(generator.gen());
+          NumericalScalar v(generator.gen());
           NumericalScalar x(pow(u, 1.0 / p1));
           NumericalScalar y(pow(v, 1.0 / p2));
           // Acceptation step
@@ -215,8 +236,8 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
       NumericalScalar c(minp + 1.0 / lambda);
       for (;;)
         {
-          NumericalScalar u1(RandomGenerator::Generate());
-          NumericalScalar u2(RandomGenerator::Generate());
+          NumericalScalar u1(generator.gen());
+          NumericalScalar u2(generator.gen());
           NumericalScalar v(lambda * log(u1 / (1.0 - u1)));
           NumericalScalar w(minp * exp(v));
           NumericalScalar z(u1 * u1 * u2);
@@ -239,8 +260,8 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
       NumericalScalar p(maxp * t / (maxp * t + minp * tc));
       for (;;)
         {
-          NumericalScalar u(RandomGenerator::Generate());
-          NumericalScalar e(-log(RandomGenerator::Generate()));
+          NumericalScalar u(generator.gen());
+          NumericalScalar e(-log(generator.gen()));
           if (u <= p)
             {
               NumericalScalar x(t * pow(u / p, 1.0 / minp));
@@ -261,8 +282,8 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
   NumericalScalar p(maxp * t / (maxp * t + minp * pow(tc, maxp)));
   for (;;)
     {
-      NumericalScalar u(RandomGenerator::Generate());
-      NumericalScalar e(-log(RandomGenerator::Generate()));
+      NumericalScalar u(generator.gen());
+      NumericalScalar e(-log(generator.gen()));
       if (u <= p)
         {
           NumericalScalar x(t * pow(u / p, 1.0 / minp));
@@ -274,7 +295,32 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
           if (e >= (1.0 - minp) * log(x / t)) return ((p1 == minp) ? x : 1.0 - x);
         }
     } // End Atkinson and Whittaker 2
-} // End of rBeta
+} // End of BetaVariate
+
+NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
+                                const NumericalScalar p2)
+{
+  GlobalUniformGenerator generator;
+  return BetaVariate(p1, p2, generator);
+}
+
+NumericalPoint DistFunc::rBeta(const NumericalScalar p1,
+                               const NumericalScalar p2,
+                               const UnsignedLong size)
+{
+  // The analytic cases use exactly one uniform variate per realization, which can be drawn in bulk
+  if ((p1 == 1.0) && (p2 == 1.0)) return RandomGenerator::Generate(size);
+  if ((p1 == 1.0) || (p2 == 1.0))
+    {
+      NumericalPoint result(RandomGenerator::Generate(size));
+      for (UnsignedLong i = 0; i < size; ++i) result[i] = (p1 == 1.0 ? 1.0 - pow(result[i], 1.0 / p2) : pow(result[i], 1.0 / p1));
+      return result;
+    }
+  RandomGenerator::MersenneTwister & generator(RandomGenerator::GetGenerator());
+  NumericalPoint result(size);
+  for (UnsignedLong i = 0; i < size; ++i) result[i] = BetaVariate(p1, p2, generator);
+  return result;
+}
 
 /*******************************************************************************************************/
 /* Binomial distribution, i.e. with a PDF equals to C(n, p) p^k (1 - p)^(n - k) */
@@ -285,7 +331,7 @@ NumericalScalar DistFunc::rBeta(const NumericalScalar p1,
    Journal of Statistical Computation and Simulation 46, pp. 101-110, 1993
    http://epub.wu.ac.at/1242/
 */
-NumericalScalar DistFunc::fcBinomial(const UnsignedLong k)
+static NumericalScalar FcBinomial(const UnsignedLong k)
 {
   switch (k)
     {
@@ -326,8 +372,10 @@ NumericalScalar DistFunc::fcBinomial(const UnsignedLong k)
     } // switch
 }
 
-UnsignedLong DistFunc::rBinomial(const UnsignedLong n,
-                                 const NumericalScalar p)
+template <class UniformGenerator>
+static UnsignedLong BinomialVariate(const UnsignedLong n,
+                                    const NumericalScalar p,
+                                    UniformGenerator & generator)
 {
   // Quick return for degenerate cases
   if (p == 0.0) return 0;
@@ -344,7 +392,7 @@ UnsignedLong DistFunc::rBinomial(const UnsignedLong n,
       const NumericalScalar r(q / (1.0 - q));
       NumericalScalar t(pow(1.0 - q, n));
       NumericalScalar s(t);
-      const NumericalScalar u(RandomGenerator::Generate());
+      const NumericalScalar u(generator.gen());
       for (UnsignedLong k = 0; k <= n; ++k)
         {
           if (s >= u) return (complementary ? n - k : k);
@@ -372,7 +420,7 @@ UnsignedLong DistFunc::rBinomial(const UnsignedLong n,
   // Main loop
   for (;;)
     {
-      NumericalScalar v(RandomGenerator::Generate());
+      NumericalScalar v(generator.gen());
       if (v <= urvr)
         {
           u = v / vr - 0.43;
@@ -381,13 +429,13 @@ UnsignedLong DistFunc::rBinomial(const UnsignedLong n,
         } // v <= urvr
       if (v >= vr)
         {
-          u = RandomGenerator::Generate() - 0.5;
+          u = generator.gen() - 0.5;
         } // v >= vr
       else
         {
           u = v / vr - 0.93;
           u = (u < 0.0 ? -0.5 : 0.5) - u;
-          v = RandomGenerator::Generate() * vr;
+          v = generator.gen() * vr;
         } // v < vr
       const NumericalScalar us(0.5 - fabs(u));
       k = floor((2.0 * a / us + b) * u + c);
@@ -428,12 +476,29 @@ UnsignedLong DistFunc::rBinomial(const UnsignedLong n,
       if (v < t - rho) return (complementary ? static_cast<UnsignedLong>(n - k) : static_cast<UnsignedLong>(k));
       if (v > t + rho) continue;
       const NumericalScalar nm(n - m + 1);
-      const NumericalScalar h((m + 0.5) * log((m + 1) / (r * nm)) + fcBinomial(static_cast<UnsignedLong>(m)) + fcBinomial(static_cast<UnsignedLong>(n - m)));
+      const NumericalScalar h((m + 0.5) * log((m + 1) / (r * nm)) + FcBinomial(static_cast<UnsignedLong>(m)) + FcBinomial(static_cast<UnsignedLong>(n - m)));
       // Final acceptance-rejection
       const NumericalScalar nk(n - k + 1);
-      if (v <= h + (n + 1) * log(nm / nk) + (k + 0.5) * log(nk * r / (k + 1)) - fcBinomial(static_cast<UnsignedLong>(k)) - fcBinomial(static_cast<UnsignedLong>(n - k))) return (complementary ? static_cast<UnsignedLong>(n - k) : static_cast<UnsignedLong>(k));
+      if (v <= h + (n + 1) * log(nm / nk) + (k + 0.5) * log(nk * r / (k + 1)) - FcBinomial(static_cast<UnsignedLong>(k)) - FcBinomial(static_cast<UnsignedLong>(n - k))) return (complementary ? static_cast<UnsignedLong>(n - k) : static_cast<UnsignedLong>(k));
     } // for(;;)
-} // rBinomial
+} // BinomialVariate
+
+UnsignedLong DistFunc::rBinomial(const UnsignedLong n,
+                                 const NumericalScalar p)
+{
+  GlobalUniformGenerator generator;
+  return BinomialVariate(n, p, generator);
+}
+
+Indices DistFunc::rBinomial(const UnsignedLong n,
+                            const NumericalScalar p,
+                            const UnsignedLong size)
+{
+  RandomGenerator::MersenneTwister & generator(RandomGenerator::GetGenerator());
+  Indices result(size);
+  for (UnsignedLong i = 0; i < size; ++i) result[i] = BinomialVariate(n, p, generator);
+  return result;
+}
 
 /*******************************************************************************************************/
 /* Normalized Gamma distribution, i.e. with a PDF equals to x ^ (k - 1) . exp(-x) / gamma(k) . (x > 0) */
@@ -488,14 +553,16 @@ NumericalScalar DistFunc::qGamma(const NumericalScalar k,
    with a small optimization on the beta that appears in the squeezing function (1 + beta * x^4)*exp(-x^2/2).
    We also add the special treatment of the case k < 1
 */
-NumericalScalar DistFunc::rGamma(const NumericalScalar k)
+template <class UniformGenerator>
+static NumericalScalar GammaVariate(const NumericalScalar k,
+                                    UniformGenerator & generator)
 {
   // Special case k < 1.0
   NumericalScalar correction(1.0);
   NumericalScalar alpha(k);
   if (alpha < 1.0)
     {
-      correction = pow(RandomGenerator::Generate(), 1.0 / alpha);
+      correction = pow(generator.gen(), 1.0 / alpha);
       alpha++;
     }
   NumericalScalar d(alpha - 0.3333333333333333333333333);
@@ -506,12 +573,12 @@ NumericalScalar DistFunc::rGamma(const NumericalScalar k)
     {
       do
         {
-          x = rNormal();
+          x = ZigguratNormal(generator);
           v = 1.0 + c * x;
         }
       while (v <= 0.0);
       v = v * v * v;
-      NumericalScalar u(RandomGenerator::Generate());
+      NumericalScalar u(generator.gen());
       NumericalScalar x2(x * x);
       // Quick acceptation test
       // 0.03431688782875261396035499 is the numerical solution of the squeezing
@@ -520,7 +587,22 @@ NumericalScalar DistFunc::rGamma(const NumericalScalar k)
       // Acceptation test
       if (log(u) < 0.5 * x2 + d * (1.0 - v + log(v))) return correction * d * v;
     }
-} // End of rGamma
+} // End of GammaVariate
+
+NumericalScalar DistFunc::rGamma(const NumericalScalar k)
+{
+  GlobalUniformGenerator generator;
+  return GammaVariate(k, generator);
+}
+
+NumericalPoint DistFunc::rGamma(const NumericalScalar k,
+                                const UnsignedLong size)
+{
+  RandomGenerator::MersenneTwister & generator(RandomGenerator::GetGenerator());
+  NumericalPoint result(size);
+  for (UnsignedLong i = 0; i < size; ++i) result[i] = GammaVariate(k, generator);
+  return result;
+}
 
 /****************************/
 /* Kolmogorov distribution. */
@@ -1133,16 +1215,17 @@ NumericalScalar DistFunc::qNormal(const NumericalScalar q,
    Random Samples", mimeo, Nuffield College, University of Oxford,
    and www.doornik.com/research.
 */
-NumericalScalar DistFunc::rNormal()
+template <class UniformGenerator>
+static NumericalScalar ZigguratNormal(UniformGenerator & generator)
 {
   for (;;)
     {
-      NumericalScalar u(2.0 * RandomGenerator::Generate() - 1.0);
-      UnsignedLong index(RandomGenerator::IntegerGenerate(DistFunc::NumberOfBandNormalZigurrat));
+      NumericalScalar u(2.0 * generator.gen() - 1.0);
+      UnsignedLong index(generator.igen(DistFunc::NumberOfBandNormalZigurrat));
       /* Are we in a rectangular band of the ziggurat? */
       if (fabs(u) < DistFunc::NormalZigguratRatio[index])
         {
-          return u * NormalZigguratAbscissa[index + 1];
+          return u * DistFunc::NormalZigguratAbscissa[index + 1];
         }
       /* No, we are either on a wedge or in the upper tail of the Normal distribution */
       /* Are we in the bottom band? Sample from the tail of the Normal distribution */
@@ -1153,26 +1236,46 @@ NumericalScalar DistFunc::rNormal()
           /* Marsaglia method */
           do
             {
-              x = log(RandomGenerator::Generate()) / DistFunc::NormalZigguratTail;
-              y = log(RandomGenerator::Generate());
+              x = log(generator.gen()) / DistFunc::NormalZigguratTail;
+              y = log(generator.gen());
             }
           while (-(y + y) < x * x);
           return (u > 0.0) ? x - DistFunc::NormalZigguratTail : DistFunc::NormalZigguratTail - x;
         }
       /* Are we in the wedges? Basic rejection method */
-      NumericalScalar xI(NormalZigguratAbscissa[index]);
-      NumericalScalar xIp1(NormalZigguratAbscissa[index + 1]);
+      NumericalScalar xI(DistFunc::NormalZigguratAbscissa[index]);
+      NumericalScalar xIp1(DistFunc::NormalZigguratAbscissa[index + 1]);
       NumericalScalar x(u * xIp1);
       NumericalScalar pdfX(  exp(-0.5 * x * x));
       NumericalScalar pdfI(  exp(-0.5 * xI * xI));
       NumericalScalar pdfIp1(exp(-0.5 * xIp1 * xIp1));
-      if (RandomGenerator::Generate() * (pdfI - pdfIp1) < pdfX - pdfIp1)
+      if (generator.gen() * (pdfI - pdfIp1) < pdfX - pdfIp1)
         {
           return x;
         }
     }
 }
 
+NumericalScalar DistFunc::rNormal()
+{
+  GlobalUniformGenerator generator;
+  return ZigguratNormal(generator);
+}
+
+/* Same algorithm using a local random generator, which allows to use independent streams in concurrent tasks */
+NumericalScalar DistFunc::rNormal(RandomGenerator::MersenneTwister & generator)
+{
+  return ZigguratNormal(generator);
+}
+
+NumericalPoint DistFunc::rNormal(const UnsignedLong size)
+{
+  RandomGenerator::MersenneTwister & generator(RandomGenerator::GetGenerator());
+  NumericalPoint result(size);
+  for (UnsignedLong i = 0; i < size; ++i) result[i] = ZigguratNormal(generator);
+  return result;
+}
+
 /**********************************************************************************/
 /* Poisson distribution, i.e. with a PDF equals to exp(-lambda) . lambda ^ k / k! */
 /**********************************************************************************/
@@ -1185,7 +1288,9 @@ NumericalScalar DistFunc::rNormal()
    For the large values of lambda, we use the ratio of uniform method described in:
    E. Stadlober, "The ratio of uniforms approach for generating discrete random variates". Journal of Computational and Applied Mathematics, vol. 31, no. 1, 1990, pp. 181-189.
 */
-NumericalScalar DistFunc::rPoisson(const NumericalScalar lambda)
+template <class UniformGenerator>
+static NumericalScalar PoissonVariate(const NumericalScalar lambda,
+                                      UniformGenerator & generator)
 {
   NumericalScalar mu(floor(lambda));
   // Small case. The bound 6 is quite arbitrary, but must be < 80 to avoid overflow.
@@ -1194,7 +1299,7 @@ NumericalScalar DistFunc::rPoisson(const NumericalScalar lambda)
       NumericalScalar x(0.0);
       NumericalScalar sum(exp(-lambda));
       NumericalScalar prod(sum);
-      NumericalScalar u(RandomGenerator::Generate());
+      NumericalScalar u(generator.gen());
       for (;;)
         {
           if (u <= sum) return x;
@@ -1214,8 +1319,8 @@ NumericalScalar DistFunc::rPoisson(const NumericalScalar lambda)
   NumericalScalar safetyBound(hatCenter + 6.0 * hatWidth);
   for (;;)
     {
-      NumericalScalar u(RandomGenerator::Generate());
-      NumericalScalar x(hatCenter + hatWidth * (RandomGenerator::Generate() - 0.5) / u);
+      NumericalScalar u(generator.gen());
+      NumericalScalar x(hatCenter + hatWidth * (generator.gen() - 0.5) / u);
       if (x < 0 || x >= safetyBound) continue;
       NumericalScalar k(floor(x));
       NumericalScalar logPdf(k * logLambda - SpecFunc::LnGamma(k + 1.0) - pdfMode);
@@ -1228,6 +1333,21 @@ NumericalScalar DistFunc::rPoisson(const NumericalScalar lambda)
     }
 }
 
+NumericalScalar DistFunc::rPoisson(const NumericalScalar lambda)
+{
+  GlobalUniformGenerator generator;
+  return PoissonVariate(lambda, generator);
+}
+
+NumericalPoint DistFunc::rPoisson(const NumericalScalar lambda,
+                                  const UnsignedLong size)
+{
+  RandomGenerator::MersenneTwister & generator(RandomGenerator::GetGenerator());
+  NumericalPoint result(size);
+  for (UnsignedLong i = 0; i < size; ++i) result[i] = PoissonVariate(lambda, generator);
+  return result;
+}
+
 /********************************************************************************************************************************/
 /* Normalized Student distribution, i.e. with a PDF equals to (1 + x^2 / nu)^(-(1 + nu) / 2) / (sqrt(nu) . Beta(1 / 2, nu / 2)) */
 /********************************************************************************************************************************/
@@ -1292,6 +1412,20 @@ NumericalScalar DistFunc::rStudent(const NumericalScalar nu)
   return sqrt(0.5 * nu / g) * n;
 }
 
+NumericalPoint DistFunc::rStudent(const NumericalScalar nu,
+                                  const UnsignedLong size)
+{
+  RandomGenerator::MersenneTwister & generator(RandomGenerator::GetGenerator());
+  NumericalPoint result(size);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      const NumericalScalar n(ZigguratNormal(generator));
+      const NumericalScalar g(GammaVariate(0.5 * nu, generator));
+      result[i] = sqrt(0.5 * nu / g) * n;
+    }
+  return result;
+}
+
 /* Compute the expectation of the min of n independent standard normal random variables. Usefull for the modified moment estimator of the LogNormal distribution. */
 NumericalScalar DistFunc::eZ1(const UnsignedLong n)
 {
@@ -26,6 +26,8 @@
 #define OPENTURNS_DISTFUNC_HXX
 
 #include "OTprivate.hxx"
+#include "RandomGenerator.hxx"
+#include "Indices.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -59,13 +61,15 @@ public:
                                const Bool tail = false);
   static NumericalScalar rBeta(const NumericalScalar p1,
                                const NumericalScalar p2);
+  static NumericalPoint rBeta(const NumericalScalar p1,
+                              const NumericalScalar p2,
+                              const UnsignedLong size);
   // For the Binomial distribution
-private:
-  static NumericalScalar fcBinomial(const UnsignedLong k);
-
-public:
   static UnsignedLong rBinomial(const UnsignedLong n,
                                 const NumericalScalar p);
+  static Indices rBinomial(const UnsignedLong n,
+                           const NumericalScalar p,
+                           const UnsignedLong size);
   // For Gamma distribution
   static NumericalScalar pGamma(const NumericalScalar k,
                                 const NumericalScalar x,
@@ -74,6 +78,8 @@ public:
                                 const NumericalScalar q,
                                 const Bool tail = false);
   static NumericalScalar rGamma(const NumericalScalar k);
+  static NumericalPoint rGamma(const NumericalScalar k,
+                               const UnsignedLong size);
   // For Kolmogorov distribution
   static NumericalScalar pKolmogorov(const UnsignedLong n,
                                      const NumericalScalar x,
@@ -119,8 +125,14 @@ public:
   static NumericalScalar qNormal(const NumericalScalar q,
                                  const Bool tail = false);
   static NumericalScalar rNormal();
+#ifndef SWIG
+  static NumericalScalar rNormal(RandomGenerator::MersenneTwister & generator);
+#endif
+  static NumericalPoint rNormal(const UnsignedLong size);
   // For Poisson distribution
   static NumericalScalar rPoisson(const NumericalScalar lambda);
+  static NumericalPoint rPoisson(const NumericalScalar lambda,
+                                 const UnsignedLong size);
   // For Student distribution
   static NumericalScalar pStudent(const NumericalScalar nu,
                                   const NumericalScalar x,
@@ -129,6 +141,8 @@ public:
                                   const NumericalScalar q,
                                   const Bool tail = false);
   static NumericalScalar rStudent(const NumericalScalar nu);
+  static NumericalPoint rStudent(const NumericalScalar nu,
+                                 const UnsignedLong size);
   // For TruncatedNormal distribution
   //      static NumericalScalar rTruncatedNormal(const NumericalScalar a, const NumericalScalar b);
   // Compute the expectation of the min of n independent standard normal random variables
@@ -94,6 +94,17 @@ NumericalPoint Exponential::getRealization() const
   return NumericalPoint(1, gamma_ - log(RandomGenerator::Generate()) / lambda_);
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample Exponential::getSample(const UnsignedLong size) const
+{
+  const NumericalPoint values(RandomGenerator::Generate(size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = gamma_ - log(values[i]) / lambda_;
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 
 /* Get the DDF of the distribution */
 NumericalPoint Exponential::computeDDF(const NumericalPoint & point) const
@@ -68,6 +68,9 @@ public:
   /** Get one realization of the distribution */
   NumericalPoint getRealization() const;
 
+  /** Get a numerical sample whose elements follow the distribution */
+  NumericalSample getSample(const UnsignedLong size) const;
+
   /** Get the DDF of the distribution */
   using NonEllipticalDistribution::computeDDF;
   NumericalPoint computeDDF(const NumericalPoint & point) const;
@@ -94,4 +94,23 @@ Exponential ExponentialFactory::buildAsExponential() const
   return Exponential();
 }
 
+/* Compute the parameters estimated on the bootstrap resample from its sufficient statistics, without building it */
+NumericalPoint ExponentialFactory::computeBootstrapParameters(const NumericalSample & sample,
+                                                              const Indices & indices) const
+{
+  const UnsignedLong size(indices.getSize());
+  NumericalScalar xMin(sample[indices[0]][0]);
+  NumericalScalar sum(0.0);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      const NumericalScalar x(sample[indices[i]][0]);
+      xMin = std::min(xMin, x);
+      sum += x;
+    }
+  const NumericalScalar gamma(xMin - fabs(xMin) / (2.0 + size));
+  const NumericalScalar mean(sum / size);
+  if (mean == gamma) throw InvalidArgumentException(HERE) << "Error: can build an Exponential distribution only from a sample with mean > min, here mean=" << mean << " and min=" << gamma;
+  return ParametersAsNumericalPoint(Exponential(1.0 / (mean - gamma), gamma).getParametersCollection());
+}
+
 END_NAMESPACE_OPENTURNS
@@ -57,6 +57,11 @@ public:
   Exponential buildAsExponential(const NumericalPointWithDescriptionCollection & parameters) const;
   Exponential buildAsExponential() const;
 
+protected:
+  /** Compute the parameters estimated on the bootstrap resample from its sufficient statistics, without building it */
+  NumericalPoint computeBootstrapParameters(const NumericalSample & sample,
+                                            const Indices & indices) const;
+
 }; /* class ExponentialFactory */
 
 END_NAMESPACE_OPENTURNS
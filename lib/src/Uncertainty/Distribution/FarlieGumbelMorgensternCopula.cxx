@@ -196,6 +196,13 @@ NumericalScalar FarlieGumbelMorgensternCopula::computeConditionalQuantile(const
   return 2.0 * q / (alpha1 + sqrt(alpha1 * alpha1 - 4.0 * q * alpha));
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint FarlieGumbelMorgensternCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                                         const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Tell if the distribution has an elliptical copula */
 Bool FarlieGumbelMorgensternCopula::hasEllipticalCopula() const
 {
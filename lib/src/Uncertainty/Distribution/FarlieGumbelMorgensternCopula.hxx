@@ -86,6 +86,9 @@ public:
   /** Compute the quantile of Xi | X1, ..., Xi-1, i.e. x such that CDF(x|y) = q with x = Xi, y = (X1,...,Xi-1) */
   NumericalScalar computeConditionalQuantile(const NumericalScalar q, const NumericalPoint & y) const;
 
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+  NumericalPoint computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const;
+
   /** Parameters value and description accessor */
   NumericalPointWithDescriptionCollection getParametersCollection() const;
   using CopulaImplementation::setParametersCollection;
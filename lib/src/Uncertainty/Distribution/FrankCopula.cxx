@@ -246,6 +246,13 @@ NumericalScalar FrankCopula::computeConditionalQuantile(const NumericalScalar q,
   return 1.0 + log((factor - q) / (factor * exp(theta_) - q)) / theta_;
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint FrankCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                       const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Compute the archimedean generator of the archimedean copula, i.e.
  * the function phi such that the CDF of the copula can
  * be written as CDF(t) = phi^{-1}(phi(u)+phi(v))
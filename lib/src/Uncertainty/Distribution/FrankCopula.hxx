@@ -92,6 +92,9 @@ public:
   /** Compute the quantile of Xi | X1, ..., Xi-1, i.e. x such that CDF(x|y) = q with x = Xi, y = (X1,...,Xi-1) */
   NumericalScalar computeConditionalQuantile(const NumericalScalar q, const NumericalPoint & y) const;
 
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+  NumericalPoint computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const;
+
   /** Compute the archimedean generator of the archimedean copula, i.e.
    *  the function phi such that the CDF of the copula can
    *  be written as CDF(t) = phi^{-1}(phi(u)+phi(v))
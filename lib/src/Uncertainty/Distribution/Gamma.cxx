@@ -216,6 +216,17 @@ NumericalPoint Gamma::getRealization() const
   return NumericalPoint(1, gamma_ + DistFunc::rGamma(k_) / lambda_);
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample Gamma::getSample(const UnsignedLong size) const
+{
+  const NumericalPoint values(DistFunc::rGamma(k_, size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = gamma_ + values[i] / lambda_;
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 
 /* Get the DDF of the distribution */
 NumericalPoint Gamma::computeDDF(const NumericalPoint & point) const
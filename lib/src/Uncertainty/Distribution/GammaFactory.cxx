@@ -98,4 +98,31 @@ Gamma GammaFactory::buildAsGamma() const
   return Gamma();
 }
 
+/* Compute the parameters estimated on the bootstrap resample from its sufficient statistics, without building it */
+NumericalPoint GammaFactory::computeBootstrapParameters(const NumericalSample & sample,
+                                                        const Indices & indices) const
+{
+  const UnsignedLong size(indices.getSize());
+  // The sums are computed on values shifted by the first point of the resample for numerical stability
+  const NumericalScalar shift(sample[indices[0]][0]);
+  NumericalScalar xMin(shift);
+  NumericalScalar sum(0.0);
+  NumericalScalar sumSquares(0.0);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      const NumericalScalar x(sample[indices[i]][0]);
+      xMin = std::min(xMin, x);
+      sum += x - shift;
+      sumSquares += (x - shift) * (x - shift);
+    }
+  const NumericalScalar gamma(xMin - fabs(xMin) / (2.0 + size));
+  const NumericalScalar mu(shift + sum / size);
+  const NumericalScalar sigma(size > 1 ? sqrt(std::max(0.0, (sumSquares - sum * sum / size) / (size - 1.0))) : 0.0);
+  if (sigma <= 0.0) throw InvalidArgumentException(HERE) << "Error: can build a Gamma distribution only if sigma >= 0, here sigma=" << sigma;
+  NumericalScalar lambda((mu - gamma) / sigma);
+  const NumericalScalar k(lambda * lambda);
+  lambda /= sigma;
+  return ParametersAsNumericalPoint(Gamma(k, lambda, gamma).getParametersCollection());
+}
+
 END_NAMESPACE_OPENTURNS
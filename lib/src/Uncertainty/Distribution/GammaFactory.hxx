@@ -57,6 +57,11 @@ public:
   Gamma buildAsGamma(const NumericalPointWithDescriptionCollection & parameters) const;
   Gamma buildAsGamma() const;
 
+protected:
+  /** Compute the parameters estimated on the bootstrap resample from its sufficient statistics, without building it */
+  NumericalPoint computeBootstrapParameters(const NumericalSample & sample,
+                                            const Indices & indices) const;
+
 }; /* class GammaFactory */
 
 END_NAMESPACE_OPENTURNS
@@ -269,6 +269,13 @@ NumericalScalar GumbelCopula::computeConditionalQuantile(const NumericalScalar q
   return exp(-pow(exp(theta_ * (log(factor) / (theta_ - 1.0) - SpecFunc::LambertW(pow(factor, inverseThetaMinusOne) * inverseThetaMinusOne))) - minusLogUPowTheta, 1.0 / theta_));
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint GumbelCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                        const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Parameters value and description accessor */
 GumbelCopula::NumericalPointWithDescriptionCollection GumbelCopula::getParametersCollection() const
 {
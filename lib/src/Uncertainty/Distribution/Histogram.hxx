@@ -32,6 +32,7 @@
 #include "PersistentCollection.hxx"
 #include "PersistentObject.hxx"
 #include "ResourceMap.hxx"
+#include "Indices.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -78,6 +79,9 @@ public:
   /** Get one realization of the Histogram distribution */
   NumericalPoint getRealization() const;
 
+  /** Get a numerical sample whose elements follow the distribution */
+  NumericalSample getSample(const UnsignedLong size) const;
+
   /** Get the DDF of the Histogram distribution */
   using NonEllipticalDistribution::computeDDF;
   NumericalPoint computeDDF(const NumericalPoint & point) const;
@@ -144,6 +148,9 @@ private:
   /** Compute the numerical range of the distribution given the parameters values */
   void computeRange();
 
+  /** Compute the guide tables of the cumulated widths and surfaces */
+  void computeGuideTables();
+
   /** The first point of the collection */
   NumericalScalar first_;
 
@@ -159,6 +166,10 @@ private:
   /** The total surface */
   NumericalScalar surface_;
 
+  /** The guide tables used to find the bin associated with a point or a probability level */
+  Indices widthGuideTable_;
+  Indices surfaceGuideTable_;
+
 }; /* class Histogram */
 
 
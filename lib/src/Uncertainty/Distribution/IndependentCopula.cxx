@@ -220,6 +220,13 @@ NumericalScalar IndependentCopula::computeConditionalQuantile(const NumericalSca
   return q;
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint IndependentCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                             const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Get the isoprobabilist transformation */
 IndependentCopula::IsoProbabilisticTransformation IndependentCopula::getIsoProbabilisticTransformation() const
 {
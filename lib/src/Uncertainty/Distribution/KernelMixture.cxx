@@ -32,6 +32,8 @@
 #include "RandomGenerator.hxx"
 #include "Exception.hxx"
 #include "PersistentObjectFactory.hxx"
+#include "ResourceMap.hxx"
+#include "FFT.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -244,6 +246,198 @@ NumericalScalar KernelMixture::computeCDF(const NumericalPoint & point) const
   return cdfValue / size;
 }
 
+/* Get the PDF of the KernelMixture over a sample */
+NumericalSample KernelMixture::computePDF(const NumericalSample & sample) const
+{
+  if (!useBinning()) return NonEllipticalDistribution::computePDF(sample);
+  if (sample.getDimension() != 1) throw InvalidArgumentException(HERE) << "Error: the given sample has a dimension=" << sample.getDimension() << " different from the distribution dimension=1";
+  return computeBinnedPDFCDF(sample, false);
+}
+
+/* Compute the PDF of 1D KernelMixture over a regular grid */
+NumericalSample KernelMixture::computePDF(const NumericalScalar xMin,
+                                          const NumericalScalar xMax,
+                                          const UnsignedLong pointNumber,
+                                          const NumericalScalar precision) const
+{
+  if (!useBinning() || (pointNumber < 2)) return NonEllipticalDistribution::computePDF(xMin, xMax, pointNumber, precision);
+  return computeBinnedPDFCDF(xMin, xMax, pointNumber, false);
+}
+
+/* Get the CDF of the KernelMixture over a sample */
+NumericalSample KernelMixture::computeCDF(const NumericalSample & sample) const
+{
+  if (!useBinning()) return NonEllipticalDistribution::computeCDF(sample);
+  if (sample.getDimension() != 1) throw InvalidArgumentException(HERE) << "Error: the given sample has a dimension=" << sample.getDimension() << " different from the distribution dimension=1";
+  return computeBinnedPDFCDF(sample, true);
+}
+
+/* Compute the CDF of 1D KernelMixture over a regular grid */
+NumericalSample KernelMixture::computeCDF(const NumericalScalar xMin,
+                                          const NumericalScalar xMax,
+                                          const UnsignedLong pointNumber,
+                                          const NumericalScalar precision) const
+{
+  if (!useBinning() || (pointNumber < 2)) return NonEllipticalDistribution::computeCDF(xMin, xMax, pointNumber, precision);
+  return computeBinnedPDFCDF(xMin, xMax, pointNumber, true);
+}
+
+/* Tell if the PDF and the CDF have to be evaluated using the binned sample */
+Bool KernelMixture::useBinning() const
+{
+  return (getDimension() == 1) && (sample_.getSize() > ResourceMap::GetAsUnsignedLong( "KernelMixture-SmallSize" ));
+}
+
+/* Linear binning of the 1D sample over the regular grid origin + k * step, k = 0,...,binNumber-1
+   Each atom is shared between its two neighbouring nodes proportionally to its proximity to them */
+NumericalPoint KernelMixture::computeBinnedWeights(const NumericalScalar origin,
+                                                   const NumericalScalar step,
+                                                   const UnsignedLong binNumber,
+                                                   NumericalScalar & leftWeight) const
+{
+  NumericalPoint weights(binNumber, 0.0);
+  leftWeight = 0.0;
+  const UnsignedLong size(sample_.getSize());
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      const NumericalScalar t((sample_[i][0] - origin) / step);
+      const NumericalScalar index(floor(t));
+      // Atoms entirely on the left or on the right of the grid
+      if (index < -1.0)
+        {
+          leftWeight += 1.0;
+          continue;
+        }
+      if (index >= binNumber) continue;
+      const NumericalScalar alpha(t - index);
+      if (index < 0.0) leftWeight += 1.0 - alpha;
+      else weights[static_cast<UnsignedLong>(index)] += 1.0 - alpha;
+      if (index + 1.0 < binNumber) weights[static_cast<UnsignedLong>(index + 1.0)] += alpha;
+    }
+  return weights;
+}
+
+/* Compute the PDF or the CDF of a 1D KernelMixture over a sample using the binned sample
+   The bin step is h / KernelMixture-BinNumberPerBandwidth, which bounds the relative
+   error of a smooth kernel by roughly 1 / (8 * KernelMixture-BinNumberPerBandwidth^2).
+   Each value costs a number of kernel evaluations proportional to the number of bins
+   covered by the kernel range instead of the sample size */
+NumericalSample KernelMixture::computeBinnedPDFCDF(const NumericalSample & sample,
+                                                   const Bool isCDF) const
+{
+  const UnsignedLong size(sample_.getSize());
+  const NumericalScalar h(bandwidth_[0]);
+  const NumericalScalar step(h / ResourceMap::GetAsUnsignedLong( "KernelMixture-BinNumberPerBandwidth" ));
+  const NumericalScalar origin(sample_.getMin()[0]);
+  const NumericalScalar binNumberScalar(floor((sample_.getMax()[0] - origin) / step) + 2.0);
+  // Binning is useless if there are more bins than atoms
+  if (binNumberScalar > size) return isCDF ? NonEllipticalDistribution::computeCDF(sample) : NonEllipticalDistribution::computePDF(sample);
+  const UnsignedLong binNumber(static_cast<UnsignedLong>(binNumberScalar));
+  NumericalScalar leftWeight(0.0);
+  const NumericalPoint weights(computeBinnedWeights(origin, step, binNumber, leftWeight));
+  // cumulatedWeights[k] is the total weight of the bins 0,...,k-1
+  NumericalPoint cumulatedWeights(binNumber + 1, 0.0);
+  for (UnsignedLong k = 0; k < binNumber; ++k) cumulatedWeights[k + 1] = cumulatedWeights[k] + weights[k];
+  const NumericalScalar a(kernel_.getRange().getLowerBound()[0]);
+  const NumericalScalar b(kernel_.getRange().getUpperBound()[0]);
+  const UnsignedLong outputSize(sample.getSize());
+  NumericalSample result(outputSize, 1);
+  for (UnsignedLong i = 0; i < outputSize; ++i)
+    {
+      const NumericalScalar x(sample[i][0]);
+      // Only the bins in [x - b * h, x - a * h] are within the kernel range, the ones below contribute fully to the CDF
+      const NumericalScalar kMin(std::min(binNumberScalar, std::max(0.0, ceil((x - b * h - origin) / step))));
+      const NumericalScalar kMax(std::min(binNumberScalar - 1.0, floor((x - a * h - origin) / step)));
+      NumericalScalar value(isCDF ? cumulatedWeights[static_cast<UnsignedLong>(kMin)] : 0.0);
+      if (kMin <= kMax)
+        for (UnsignedLong k = static_cast<UnsignedLong>(kMin); k <= static_cast<UnsignedLong>(kMax); ++k)
+          {
+            const NumericalScalar u((x - origin - k * step) / h);
+            value += weights[k] * (isCDF ? kernel_.computeCDF(u) : kernel_.computePDF(u));
+          }
+      result[i][0] = isCDF ? std::min(1.0, value / size) : normalizationFactor_ * value;
+    }
+  return result;
+}
+
+/* Compute the PDF or the CDF of a 1D KernelMixture over a regular grid using an FFT convolution of the binned sample
+   The grid is refined if needed in order to get a bin step of at most h / KernelMixture-BinNumberPerBandwidth,
+   then the binned sample is convolved with the kernel tabulated on the same step */
+NumericalSample KernelMixture::computeBinnedPDFCDF(const NumericalScalar xMin,
+                                                   const NumericalScalar xMax,
+                                                   const UnsignedLong pointNumber,
+                                                   const Bool isCDF) const
+{
+  const UnsignedLong size(sample_.getSize());
+  const NumericalScalar h(bandwidth_[0]);
+  const NumericalScalar gridStep((xMax - xMin) / (pointNumber - 1.0));
+  const UnsignedLong refinement(static_cast<UnsignedLong>(std::max(1.0, ceil(gridStep * ResourceMap::GetAsUnsignedLong( "KernelMixture-BinNumberPerBandwidth" ) / h))));
+  const NumericalScalar step(gridStep / refinement);
+  // Lags, in number of bins, covered by the kernel range
+  const NumericalScalar lagMin(floor(kernel_.getRange().getLowerBound()[0] * h / step));
+  const NumericalScalar lagMax(ceil(kernel_.getRange().getUpperBound()[0] * h / step));
+  const NumericalScalar kernelNumberScalar(lagMax - lagMin + 1.0);
+  const NumericalScalar binNumberScalar((pointNumber - 1.0) * refinement + kernelNumberScalar);
+  // Binning is useless if there are more bins than atoms, fall back to the evaluation over the grid points
+  if (binNumberScalar > size)
+    {
+      NumericalSample grid(pointNumber, 1);
+      NumericalScalar x(xMin);
+      for (UnsignedLong i = 0; i < pointNumber; ++i)
+        {
+          grid[i][0] = x;
+          x += gridStep;
+        }
+      const NumericalSample values(computeBinnedPDFCDF(grid, isCDF));
+      NumericalSample result(pointNumber, 2);
+      for (UnsignedLong i = 0; i < pointNumber; ++i)
+        {
+          result[i][0] = grid[i][0];
+          result[i][1] = values[i][0];
+        }
+      return result;
+    }
+  const UnsignedLong kernelNumber(static_cast<UnsignedLong>(kernelNumberScalar));
+  const UnsignedLong binNumber(static_cast<UnsignedLong>(binNumberScalar));
+  // The bin k is located at xMin + (k - lagMax) * step
+  NumericalScalar leftWeight(0.0);
+  const NumericalPoint weights(computeBinnedWeights(xMin - lagMax * step, step, binNumber, leftWeight));
+  // Zero-padding to get the linear convolution instead of the circular one
+  UnsignedLong fftSize(1);
+  while (fftSize < binNumber + kernelNumber - 1) fftSize *= 2;
+  Collection<NumericalScalar> paddedWeights(fftSize, 0.0);
+  for (UnsignedLong k = 0; k < binNumber; ++k) paddedWeights[k] = weights[k];
+  Collection<NumericalScalar> kernelValues(fftSize, 0.0);
+  for (UnsignedLong k = 0; k < kernelNumber; ++k)
+    {
+      const NumericalScalar u((lagMin + k) * step / h);
+      kernelValues[k] = isCDF ? kernel_.computeCDF(u) : kernel_.computePDF(u);
+    }
+  const FFT fft;
+  Collection<NumericalComplex> spectrum(fft.transform(paddedWeights));
+  const Collection<NumericalComplex> kernelSpectrum(fft.transform(kernelValues));
+  for (UnsignedLong k = 0; k < fftSize; ++k) spectrum[k] *= kernelSpectrum[k];
+  const Collection<NumericalScalar> convolution(fft.inverseTransformReal(spectrum));
+  NumericalSample result(pointNumber, 2);
+  NumericalScalar x(xMin);
+  // Total weight of the bins fully below the kernel range of the current grid point, for the CDF
+  NumericalScalar cumulatedWeight(leftWeight);
+  UnsignedLong binIndex(0);
+  for (UnsignedLong i = 0; i < pointNumber; ++i)
+    {
+      const UnsignedLong fineIndex(i * refinement);
+      result[i][0] = x;
+      if (isCDF)
+        {
+          for (; binIndex < fineIndex; ++binIndex) cumulatedWeight += weights[binIndex];
+          result[i][1] = std::max(0.0, std::min(1.0, (cumulatedWeight + convolution[fineIndex + kernelNumber - 1]) / size));
+        }
+      else result[i][1] = std::max(0.0, normalizationFactor_ * convolution[fineIndex + kernelNumber - 1]);
+      x += gridStep;
+    }
+  return result;
+}
+
 /* Get the characteristic function of the distribution, i.e. phi(u) = E(exp(I*u*X)) */
 NumericalComplex KernelMixture::computeCharacteristicFunction(const NumericalScalar x) const
 {
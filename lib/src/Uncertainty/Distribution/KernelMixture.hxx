@@ -87,10 +87,28 @@ public:
   using NonEllipticalDistribution::computePDF;
   virtual NumericalScalar computePDF(const NumericalPoint & point) const;
 
+  /** Get the PDF of the KernelMixture over a sample. Large 1D mixtures are evaluated on a linearly binned version of their sample */
+  virtual NumericalSample computePDF(const NumericalSample & sample) const;
+
+  /** Compute the PDF of 1D KernelMixture over a regular grid. Large mixtures use an FFT convolution of their binned sample */
+  virtual NumericalSample computePDF(const NumericalScalar xMin,
+                                     const NumericalScalar xMax,
+                                     const UnsignedLong pointNumber,
+                                     const NumericalScalar precision = ResourceMap::GetAsNumericalScalar("DistributionImplementation-DefaultPDFEpsilon")) const;
+
   /** Get the CDF of the KernelMixture */
   using NonEllipticalDistribution::computeCDF;
   virtual NumericalScalar computeCDF(const NumericalPoint & point) const;
 
+  /** Get the CDF of the KernelMixture over a sample. Large 1D mixtures are evaluated on a linearly binned version of their sample */
+  virtual NumericalSample computeCDF(const NumericalSample & sample) const;
+
+  /** Compute the CDF of 1D KernelMixture over a regular grid. Large mixtures use an FFT convolution of their binned sample */
+  virtual NumericalSample computeCDF(const NumericalScalar xMin,
+                                     const NumericalScalar xMax,
+                                     const UnsignedLong pointNumber,
+                                     const NumericalScalar precision = ResourceMap::GetAsNumericalScalar("DistributionImplementation-DefaultCDFEpsilon")) const;
+
   /** Get the characteristic function of the distribution, i.e. phi(u) = E(exp(I*u*X)) */
   NumericalComplex computeCharacteristicFunction(const NumericalScalar x) const;
 
@@ -157,6 +175,25 @@ private:
   /** Compute the normalization factor */
   void computeNormalizationFactor();
 
+  /** Tell if the PDF and the CDF have to be evaluated using the binned sample */
+  Bool useBinning() const;
+
+  /** Linear binning of the 1D sample over the regular grid origin + k * step, k = 0,...,binNumber-1. The mass falling on the left of the grid is put into leftWeight, the one falling on the right is dropped */
+  NumericalPoint computeBinnedWeights(const NumericalScalar origin,
+                                      const NumericalScalar step,
+                                      const UnsignedLong binNumber,
+                                      NumericalScalar & leftWeight) const;
+
+  /** Compute the PDF or the CDF of a 1D KernelMixture over a sample using the binned sample */
+  NumericalSample computeBinnedPDFCDF(const NumericalSample & sample,
+                                      const Bool isCDF) const;
+
+  /** Compute the PDF or the CDF of a 1D KernelMixture over a regular grid using an FFT convolution of the binned sample */
+  NumericalSample computeBinnedPDFCDF(const NumericalScalar xMin,
+                                      const NumericalScalar xMax,
+                                      const UnsignedLong pointNumber,
+                                      const Bool isCDF) const;
+
   /** The kernel of the kernelMixture */
   Distribution kernel_;
 
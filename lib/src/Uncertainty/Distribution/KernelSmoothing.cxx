@@ -34,6 +34,7 @@
 #include "UniVariatePolynomial.hxx"
 #include "SpecFunc.hxx"
 #include "ResourceMap.hxx"
+#include "FFT.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -95,27 +96,76 @@ struct PluginConstraint
     N_(sample.getSize()),
     K_(K),
     order_(order),
-    hermitePolynomial_(HermiteFactory().build(order))
+    hermitePolynomial_(HermiteFactory().build(order)),
+    binStep_(0.0),
+    binAutocorrelation_(0)
   {
     // Normalize the polynomial
     hermitePolynomial_ = hermitePolynomial_ * (1.0 / hermitePolynomial_.getCoefficients()[order]);
+    // For large samples, the double sum over the pairs of points is replaced by a sum over the lags of a linearly binned sample
+    const UnsignedLong binNumber(ResourceMap::GetAsUnsignedLong( "KernelSmoothing-BinNumber" ));
+    const NumericalScalar xMin(sample.getMin()[0]);
+    const NumericalScalar xMax(sample.getMax()[0]);
+    if ((N_ > binNumber) && (binNumber > 1) && (xMax > xMin)) computeBinAutocorrelation(xMin, xMax, binNumber);
   };
 
+  /** Linear binning of the sample and autocorrelation of the bin counts, i.e. the weighted number of pairs of points separated by each lag */
+  void computeBinAutocorrelation(const NumericalScalar xMin,
+                                 const NumericalScalar xMax,
+                                 const UnsignedLong binNumber)
+  {
+    binStep_ = (xMax - xMin) / (binNumber - 1.0);
+    // The FFT is done on a zero-padded sequence in order to get the linear autocorrelation instead of the circular one
+    UnsignedLong fftSize(1);
+    while (fftSize < 2 * binNumber) fftSize *= 2;
+    Collection<NumericalScalar> counts(fftSize, 0.0);
+    for (UnsignedLong i = 0; i < N_; ++i)
+      {
+        const NumericalScalar t((sample_[i][0] - xMin) / binStep_);
+        const UnsignedLong index(std::min(static_cast<UnsignedLong>(floor(t)), binNumber - 2));
+        const NumericalScalar alpha(t - index);
+        counts[index] += 1.0 - alpha;
+        counts[index + 1] += alpha;
+      }
+    const FFT fft;
+    Collection<NumericalComplex> spectrum(fft.transform(counts));
+    for (UnsignedLong i = 0; i < fftSize; ++i) spectrum[i] = std::norm(spectrum[i]);
+    const Collection<NumericalScalar> autocorrelation(fft.inverseTransformReal(spectrum));
+    binAutocorrelation_ = NumericalPoint(binNumber);
+    for (UnsignedLong i = 0; i < binNumber; ++i) binAutocorrelation_[i] = autocorrelation[i];
+  }
+
   /** Compute the derivative estimate based on the given bandwidth */
   NumericalScalar computePhi(const NumericalScalar h) const
   {
     // Quick return for odd order
     if (order_ % 2 == 1) return 0.0;
-    NumericalScalar phi(N_ * hermitePolynomial_(0.0));
     const NumericalScalar cutOffPlugin(ResourceMap::GetAsNumericalScalar( "KernelSmoothing-CutOffPlugin" ));
-    for (UnsignedLong i = 1; i < N_; ++i)
+    NumericalScalar phi(0.0);
+    const UnsignedLong binNumber(binAutocorrelation_.getDimension());
+    if (binNumber > 0)
+      {
+        phi = binAutocorrelation_[0] * hermitePolynomial_(0.0);
+        for (UnsignedLong i = 1; i < binNumber; ++i)
+          {
+            const NumericalScalar x(i * binStep_ / h);
+            // Clipping: the lags are increasing, so all the remaining terms are 0.0
+            if (x >= cutOffPlugin) break;
+            phi += 2.0 * binAutocorrelation_[i] * hermitePolynomial_(x) * exp(-0.5 * x * x);
+          }
+      }
+    else
       {
-        for (UnsignedLong j = 0; j < i; ++j)
+        phi = N_ * hermitePolynomial_(0.0);
+        for (UnsignedLong i = 1; i < N_; ++i)
           {
-            const NumericalScalar dx(sample_[i][0] - sample_[j][0]);
-            const NumericalScalar x(dx / h);
-            // Clipping: if x is large enough, the exponential factor is 0.0
-            if (fabs(x) < cutOffPlugin) phi += 2.0 * hermitePolynomial_(x) * exp(-0.5 * x * x);
+            for (UnsignedLong j = 0; j < i; ++j)
+              {
+                const NumericalScalar dx(sample_[i][0] - sample_[j][0]);
+                const NumericalScalar x(dx / h);
+                // Clipping: if x is large enough, the exponential factor is 0.0
+                if (fabs(x) < cutOffPlugin) phi += 2.0 * hermitePolynomial_(x) * exp(-0.5 * x * x);
+              }
           }
       }
     const NumericalScalar res(phi / ((N_ * (N_ - 1.0)) * pow(h, order_ + 1) * sqrt(2.0 * M_PI)));
@@ -137,11 +187,14 @@ struct PluginConstraint
   NumericalScalar K_;
   UnsignedLong order_;
   UniVariatePolynomial hermitePolynomial_;
+  NumericalScalar binStep_;
+  NumericalPoint binAutocorrelation_;
 };
 
 /* Compute the bandwidth according to the plugin rule
    See Vikas Chandrakant Raykar, Ramani Duraiswami, "Very Fast optimal bandwidth selection for univariate kernel density estimation" CS-TR-4774
-   We implement only the basic estimator, not the fast version of it.
+   We implement only the basic estimator, not the fast version of it, but large samples are
+   linearly binned so that the cost of each derivative estimate no longer grows as size^2.
 */
 NumericalPoint KernelSmoothing::computePluginBandwidth(const NumericalSample & sample)
 {
@@ -148,6 +148,17 @@ NumericalPoint LogNormal::getRealization() const
   return NumericalPoint(1, gamma_ + exp(muLog_ + sigmaLog_ * DistFunc::rNormal()));
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample LogNormal::getSample(const UnsignedLong size) const
+{
+  const NumericalPoint values(DistFunc::rNormal(size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = gamma_ + exp(muLog_ + sigmaLog_ * values[i]);
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 
 
 /* Get the DDF of the distribution */
@@ -241,7 +252,14 @@ NumericalComplex LogNormal::computeLogCharacteristicFunction(const NumericalScal
     {
       UnsignedLong integrationNodesNumber(ResourceMap::GetAsUnsignedLong("LogNormal-CharacteristicFunctionIntegrationNodes"));
       // Check if the integration nodes have to be recomputed
-      if (integrationNodesNumber != hermiteNodes_.getSize()) hermiteNodes_ = HermiteFactory().getNodesAndWeights(integrationNodesNumber, hermiteWeights_);
+      NumericalPoint hermiteNodes;
+      NumericalPoint hermiteWeights;
+      {
+        CacheLock lock(*this);
+        if (integrationNodesNumber != hermiteNodes_.getSize()) hermiteNodes_ = HermiteFactory().getNodesAndWeights(integrationNodesNumber, hermiteWeights_);
+        hermiteNodes = hermiteNodes_;
+        hermiteWeights = hermiteWeights_;
+      }
       // Hermite integration of the Fourier transform for small sigma
       if (sigmaLog_ <= ResourceMap::GetAsNumericalScalar("LogNormal-CharacteristicFunctionSmallSigmaThreshold"))
         {
@@ -255,7 +273,7 @@ NumericalComplex LogNormal::computeLogCharacteristicFunction(const NumericalScal
           // const UnsignedLong minimumIntegrationNodesNumber(static_cast<UnsignedLong>(8 * 2 * M_PI * nu));
           // integrationNodesNumber = std::max(integrationNodesNumber, static_cast<UnsignedLong>(8 * 2 * M_PI * nu));
           NumericalComplex value(0.0);
-          for (UnsignedLong i = 0; i < integrationNodesNumber; ++i) value += hermiteWeights_[i] * exp(NumericalComplex(0.0, nu * exp(sigmaLog_ * hermiteNodes_[i])));
+          for (UnsignedLong i = 0; i < integrationNodesNumber; ++i) value += hermiteWeights[i] * exp(NumericalComplex(0.0, nu * exp(sigmaLog_ * hermiteNodes[i])));
           logCFValue = log(value);
         } // Small sigma
       else
@@ -264,7 +282,7 @@ NumericalComplex LogNormal::computeLogCharacteristicFunction(const NumericalScal
           // Compute the characteristic function for the positive arguments
           const NumericalScalar sStar(-SpecFunc::LambertW(sigmaLog_ * sigmaLog_ * nu) / sigmaLog_);
           NumericalComplex value(0.0);
-          for (UnsignedLong i = 0; i < integrationNodesNumber; ++i) value += hermiteWeights_[i] * characteristicIntegrand(hermiteNodes_[i], sStar);
+          for (UnsignedLong i = 0; i < integrationNodesNumber; ++i) value += hermiteWeights[i] * characteristicIntegrand(hermiteNodes[i], sStar);
           logCFValue = log(value) + H_ - NumericalComplex(sStar * sStar / 2.0, M_PI * sStar / (2.0 * sigmaLog_));
         } // Large sigma
     } // Large argument
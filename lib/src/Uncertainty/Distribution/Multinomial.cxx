@@ -382,6 +382,13 @@ NumericalScalar Multinomial::computeConditionalQuantile(const NumericalScalar q,
   return Binomial(static_cast<UnsignedLong>(n_ - sumY), p_[conditioningDimension] / sumP).computeQuantile(q)[0];
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint Multinomial::computeConditionalQuantile(const NumericalPoint & q,
+                                                       const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Get the i-th marginal distribution */
 Multinomial::Implementation Multinomial::getMarginal(const UnsignedLong i) const
 {
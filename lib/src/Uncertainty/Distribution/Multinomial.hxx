@@ -88,6 +88,9 @@ public:
   NumericalScalar computeConditionalQuantile(const NumericalScalar q,
                                              const NumericalPoint & y) const;
 
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+  NumericalPoint computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const;
+
   /** Get the i-th marginal distribution */
   using DiscreteDistribution::getMarginal;
   Implementation getMarginal(const UnsignedLong i) const;
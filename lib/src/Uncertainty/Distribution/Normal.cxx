@@ -171,6 +171,30 @@ NumericalPoint Normal::getRealization() const
   return cholesky_ * value + mean_;
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample Normal::getSample(const UnsignedLong size) const
+{
+  const UnsignedLong dimension(getDimension());
+  // The standard coordinates are drawn in the same order as by successive calls to getRealization()
+  const NumericalPoint values(DistFunc::rNormal(size * dimension));
+  NumericalSample result(size, dimension);
+  NumericalPoint value(dimension);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      for (UnsignedLong j = 0; j < dimension; ++j) value[j] = values[i * dimension + j];
+      if (hasIndependentCopula_)
+        for (UnsignedLong j = 0; j < dimension; ++j) result[i][j] = mean_[j] + sigma_[j] * value[j];
+      else
+        {
+          const NumericalPoint realization(cholesky_ * value + mean_);
+          for (UnsignedLong j = 0; j < dimension; ++j) result[i][j] = realization[j];
+        }
+    }
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 /* Compute the density generator of the ellipticalal generator, i.e.
  *  the function phi such that the density of the distribution can
  *  be written as p(x) = phi(t(x-mu)S^(-1)(x-mu))                      */
@@ -179,6 +203,12 @@ NumericalScalar Normal::computeDensityGenerator(const NumericalScalar betaSquare
   return normalizationFactor_ * exp(-0.5 * betaSquare);
 }
 
+/* Compute the logarithm of the density generator */
+NumericalScalar Normal::computeLogDensityGenerator(const NumericalScalar betaSquare) const
+{
+  return log(normalizationFactor_) - 0.5 * betaSquare;
+}
+
 /* Compute the derivative of the density generator */
 NumericalScalar Normal::computeDensityGeneratorDerivative(const NumericalScalar betaSquare) const
 {
@@ -497,9 +527,9 @@ NumericalScalar Normal::computeConditionalPDF(const NumericalScalar x,
   const NumericalScalar sigmaRos(1.0 / inverseCholesky_(conditioningDimension, conditioningDimension));
   for (UnsignedLong i = 0; i < conditioningDimension; ++i)
     {
-      meanRos += inverseCholesky_(conditioningDimension, i) / sqrt(sigma_[i]) * (y[i] - mean_[i]);
+      meanRos += inverseCholesky_(conditioningDimension, i) * (y[i] - mean_[i]);
     }
-  meanRos = mean_[conditioningDimension] - sigmaRos * sqrt(sigma_[conditioningDimension]) * meanRos;
+  meanRos = mean_[conditioningDimension] - sigmaRos * meanRos;
   return exp(-0.5 * pow(x - meanRos, 2.0) / (sigmaRos * sigmaRos)) / (sigmaRos * sqrt(2.0 * M_PI));
 }
 
@@ -516,9 +546,9 @@ NumericalScalar Normal::computeConditionalCDF(const NumericalScalar x,
   const NumericalScalar sigmaRos(1.0 / inverseCholesky_(conditioningDimension, conditioningDimension));
   for (UnsignedLong i = 0; i < conditioningDimension; ++i)
     {
-      meanRos += inverseCholesky_(conditioningDimension, i) / sqrt(sigma_[i]) * (y[i] - mean_[i]);
+      meanRos += inverseCholesky_(conditioningDimension, i) * (y[i] - mean_[i]);
     }
-  meanRos = mean_[conditioningDimension] - sigmaRos * sqrt(sigma_[conditioningDimension]) * meanRos;
+  meanRos = mean_[conditioningDimension] - sigmaRos * meanRos;
   return DistFunc::pNormal((x - meanRos) / sigmaRos);
 }
 
@@ -536,14 +566,21 @@ NumericalScalar Normal::computeConditionalQuantile(const NumericalScalar q,
   const NumericalScalar sigmaRos(1.0 / inverseCholesky_(conditioningDimension, conditioningDimension));
   for (UnsignedLong i = 0; i < conditioningDimension; ++i)
     {
-      meanRos += inverseCholesky_(conditioningDimension, i) / sqrt(sigma_[i]) * (y[i] - mean_[i]);
+      meanRos += inverseCholesky_(conditioningDimension, i) * (y[i] - mean_[i]);
     }
-  meanRos = mean_[conditioningDimension] - sigmaRos * sqrt(sigma_[conditioningDimension]) * meanRos;
+  meanRos = mean_[conditioningDimension] - sigmaRos * meanRos;
   if (q == 0.0) return meanRos - 0.5 * sigmaRos * sqrt(4.0 * (log(SpecFunc::ISQRT2PI / sigmaRos) - SpecFunc::LogMinNumericalScalar));
   if (q == 1.0) return meanRos + 0.5 * sigmaRos * sqrt(4.0 * (log(SpecFunc::ISQRT2PI / sigmaRos) - SpecFunc::LogMinNumericalScalar));
   return meanRos + sigmaRos * DistFunc::qNormal(q);
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint Normal::computeConditionalQuantile(const NumericalPoint & q,
+                                                  const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Get the i-th marginal distribution */
 Normal::Implementation Normal::getMarginal(const UnsignedLong i) const
 {
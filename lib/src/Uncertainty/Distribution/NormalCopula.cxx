@@ -330,6 +330,13 @@ NumericalScalar NormalCopula::computeConditionalQuantile(const NumericalScalar q
   return DistFunc::pNormal(normal_.computeConditionalQuantile(q, u));
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint NormalCopula::computeConditionalQuantile(const NumericalPoint & q,
+                                                        const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Get the distribution of the marginal distribution corresponding to indices dimensions */
 NormalCopula::Implementation NormalCopula::getMarginal(const Indices & indices) const
 {
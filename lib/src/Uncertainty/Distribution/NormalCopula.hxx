@@ -100,6 +100,9 @@ public:
   NumericalScalar computeConditionalQuantile(const NumericalScalar q,
                                              const NumericalPoint & y) const;
 
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+  NumericalPoint computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const;
+
   /** Get the distribution of the marginal distribution corresponding to indices dimensions */
   using CopulaImplementation::getMarginal;
   Implementation getMarginal(const Indices & indices) const;
@@ -91,4 +91,46 @@ Normal NormalFactory::buildAsNormal() const
   return Normal();
 }
 
+/* Compute the parameters estimated on the bootstrap resample from its sufficient statistics, without building it */
+NumericalPoint NormalFactory::computeBootstrapParameters(const NumericalSample & sample,
+                                                         const Indices & indices) const
+{
+  const UnsignedLong size(indices.getSize());
+  const UnsignedLong dimension(sample.getDimension());
+  // The sums are computed on values shifted by the first point of the resample for numerical stability
+  const NumericalPoint shift(sample[indices[0]]);
+  NumericalPoint sums(dimension, 0.0);
+  // Lower triangular part of the sum of the cross products, row by row
+  NumericalPoint crossSums((dimension * (dimension + 1)) / 2, 0.0);
+  NumericalPoint delta(dimension);
+  for (UnsignedLong k = 0; k < size; ++k)
+    {
+      for (UnsignedLong i = 0; i < dimension; ++i) delta[i] = sample[indices[k]][i] - shift[i];
+      UnsignedLong index(0);
+      for (UnsignedLong i = 0; i < dimension; ++i)
+        {
+          sums[i] += delta[i];
+          for (UnsignedLong j = 0; j <= i; ++j)
+            {
+              crossSums[index] += delta[i] * delta[j];
+              ++index;
+            }
+        }
+    }
+  NumericalPoint mean(shift);
+  for (UnsignedLong i = 0; i < dimension; ++i) mean[i] += sums[i] / size;
+  CovarianceMatrix covariance(dimension);
+  if (size > 1)
+    {
+      UnsignedLong index(0);
+      for (UnsignedLong i = 0; i < dimension; ++i)
+        for (UnsignedLong j = 0; j <= i; ++j)
+          {
+            covariance(i, j) = (crossSums[index] - sums[i] * sums[j] / size) / (size - 1.0);
+            ++index;
+          }
+    }
+  return ParametersAsNumericalPoint(Normal(mean, covariance).getParametersCollection());
+}
+
 END_NAMESPACE_OPENTURNS
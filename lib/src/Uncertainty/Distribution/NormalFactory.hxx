@@ -58,6 +58,11 @@ public:
   Normal buildAsNormal() const;
 
 
+protected:
+  /** Compute the parameters estimated on the bootstrap resample from its sufficient statistics, without building it */
+  NumericalPoint computeBootstrapParameters(const NumericalSample & sample,
+                                            const Indices & indices) const;
+
 }; /* class NormalFactory */
 
 
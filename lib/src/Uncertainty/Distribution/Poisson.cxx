@@ -92,6 +92,17 @@ NumericalPoint Poisson::getRealization() const
   return NumericalPoint(1, DistFunc::rPoisson(lambda_));
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample Poisson::getSample(const UnsignedLong size) const
+{
+  const NumericalPoint values(DistFunc::rPoisson(lambda_, size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = values[i];
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 
 /* Get the PDF of the distribution */
 NumericalScalar Poisson::computePDF(const NumericalPoint & point) const
@@ -66,6 +66,9 @@ public:
   /** Get one realization of the distribution */
   NumericalPoint getRealization() const;
 
+  /** Get a numerical sample whose elements follow the distribution */
+  NumericalSample getSample(const UnsignedLong size) const;
+
   /** Get the PDF of the distribution */
   using DiscreteDistribution::computePDF;
   NumericalScalar computePDF(const NumericalPoint & point) const;
@@ -34,6 +34,7 @@
 #include "Interval.hxx"
 #include "NumericalMathFunction.hxx"
 #include "Log.hxx"
+#include "OTthread.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -51,6 +52,33 @@ CLASSNAMEINIT(RandomMixture);
 
 static Factory<RandomMixture> RegisteredFactory("RandomMixture");
 
+/* The characteristic values caches are read concurrently and extended exclusively */
+static pthread_rwlock_t RandomMixture_CacheLock_ = PTHREAD_RWLOCK_INITIALIZER;
+
+struct RandomMixtureCacheReadLock
+{
+  RandomMixtureCacheReadLock()
+  {
+    pthread_rwlock_rdlock(&RandomMixture_CacheLock_);
+  }
+  ~RandomMixtureCacheReadLock()
+  {
+    pthread_rwlock_unlock(&RandomMixture_CacheLock_);
+  }
+}; /* end struct RandomMixtureCacheReadLock */
+
+struct RandomMixtureCacheWriteLock
+{
+  RandomMixtureCacheWriteLock()
+  {
+    pthread_rwlock_wrlock(&RandomMixture_CacheLock_);
+  }
+  ~RandomMixtureCacheWriteLock()
+  {
+    pthread_rwlock_unlock(&RandomMixture_CacheLock_);
+  }
+}; /* end struct RandomMixtureCacheWriteLock */
+
 /* Default constructor */
 RandomMixture::RandomMixture(const DistributionCollection & coll,
                              const NumericalScalar constant)
@@ -343,10 +371,11 @@ NumericalScalar RandomMixture::computePDF(const NumericalPoint & point) const
   while ( (k < kmin) || ( (k < kmax) && (error > precision))) // (error > std::max(precision, fabs(precision * value))) ) )
     {
       error = 0.0;
+      const NumericalComplexCollection deltaValues(computeDeltaCharacteristicFunction(k, 2 * k - 1));
       for (UnsignedLong m = k + 1; m <= 2 * k; ++m)
         {
           const NumericalScalar tmp(cosMHX);
-          const NumericalComplex cfValue(computeDeltaCharacteristicFunction(m - 1));
+          const NumericalComplex cfValue(deltaValues[m - 1 - k]);
           error += factor * (cfValue.real() * cosMHX + cfValue.imag() * sinMHX);
           cosMHX = tmp * cosHX - sinMHX * sinHX;
           sinMHX = sinMHX * cosHX + tmp * sinHX;
@@ -367,9 +396,6 @@ NumericalSample RandomMixture::computePDF(const NumericalScalar xMin,
                                           const UnsignedLong pointNumber,
                                           const NumericalScalar precision) const
 {
-  const NumericalScalar oldPDFPrecision(pdfPrecision_);
-  pdfPrecision_ = std::max(precision / distributionCollection_.getSize(), pdfPrecision_);
-  pdfPrecision_ = oldPDFPrecision;
   return DistributionImplementation::computePDF(xMin, xMax, pointNumber, precision);
 }
 
@@ -434,7 +460,6 @@ NumericalSample RandomMixture::computeCDF(const NumericalScalar xMin,
                                           const UnsignedLong pointNumber,
                                           const NumericalScalar precision) const
 {
-  const NumericalScalar oldCDFPrecision(cdfPrecision_);
   //        cdfPrecision_ = std::max(precision / distributionCollection_.getSize(), cdfPrecision_);
   //         if (getDimension() != 1) throw InvalidArgumentException(HERE) << "Error: cannot compute the CDF over a regular 1D grid if the dimension is > 1";
   //         NumericalSample result(pointNumber, 2);
@@ -451,9 +476,7 @@ NumericalSample RandomMixture::computeCDF(const NumericalScalar xMin,
   //          else
   //            result[i][1] = result[i-1][1] + computeProbability(Interval(x - step, x));
   //           }
-  NumericalSample result(DistributionImplementation::computeCDF(xMin, xMax, pointNumber, precision));
-  cdfPrecision_ = oldCDFPrecision;
-  return result;
+  return DistributionImplementation::computeCDF(xMin, xMax, pointNumber, precision);
 }
 
 /* Get the probability content of an interval. It uses the Poisson inversion formula as described in the reference:
@@ -505,7 +528,8 @@ NumericalScalar RandomMixture::computeProbability(const Interval & interval) con
       const UnsignedLong numberOfNodes(nodesAndWeights.getDimension());
       NumericalScalar cdf(0.0);
       const NumericalScalar halfLength(0.5 * (upperBound - lowerBound));
-      cdfEpsilon_ = 0.0;
+      // The error is accumulated locally and stored once, as the distribution may be shared between threads
+      NumericalScalar cdfEpsilon(0.0);
       // Map [x-8*s,x] into [-1,1]
       for (UnsignedLong i = 0; i < numberOfNodes; ++i)
         {
@@ -516,8 +540,9 @@ NumericalScalar RandomMixture::computeProbability(const Interval & interval) con
           // Accumulate CDF value
           cdf += w * pdf;
           // Compute an approximation of the rounding error
-          cdfEpsilon_ += w * getPDFEpsilon();
+          cdfEpsilon += w * getPDFEpsilon();
         }
+      cdfEpsilon_ = cdfEpsilon;
       cdf *= halfLength;
       return cdf;
     }
@@ -546,9 +571,10 @@ NumericalScalar RandomMixture::computeProbability(const Interval & interval) con
   while ( (k < kmax) && (error > std::max(precision, fabs(precision * value)) || k < kmin) )
     {
       error = 0.0;
+      const NumericalComplexCollection deltaValues(computeDeltaCharacteristicFunction(k, 2 * k - 1));
       for (UnsignedLong m = k + 1; m <= 2 * k; ++m)
         {
-          cfValue = computeDeltaCharacteristicFunction(m - 1);
+          cfValue = deltaValues[m - 1 - k];
           error += factor * (cfValue.real() * (sinMHUpper - sinMHLower) + cfValue.imag() * (cosMHLower - cosMHUpper)) / mH;
           NumericalScalar tmp(cosMHUpper * cosHUpper - sinMHUpper * sinHUpper);
           sinMHUpper = sinMHUpper * cosHUpper + cosMHUpper * sinHUpper;
@@ -575,8 +601,6 @@ NumericalSample RandomMixture::computeQuantile(const NumericalScalar qMin,
                                                const Bool tail) const
 {
   if (getDimension() != 1) throw InvalidArgumentException(HERE) << "Error: cannot compute the quantile over a regular 1D grid if the dimension is > 1";
-  const NumericalScalar oldCDFPrecision(cdfPrecision_);
-  const NumericalScalar oldPDFPrecision(pdfPrecision_);
   NumericalSample result(pointNumber, 2);
   NumericalScalar q(qMin);
   const NumericalScalar step((qMax - qMin) / NumericalScalar(pointNumber - 1.0));
@@ -586,8 +610,6 @@ NumericalSample RandomMixture::computeQuantile(const NumericalScalar qMin,
       result[i][1] = computeQuantile(q)[0];
       q += step;
     }
-  cdfPrecision_ = oldCDFPrecision;
-  pdfPrecision_ = oldPDFPrecision;
   return result;
   // const NumericalScalar dX((xMax - xMin) / (pointNumber - 1.0));
   // const NumericalSample dataCDF(computeCDF(xMin, xMax, pointNumber, cdfPrecision_, tail));
@@ -690,27 +712,49 @@ NumericalComplex RandomMixture::computeLogCharacteristicFunction(const Numerical
 /* Compute a value of the characteristic function on a prescribed discretization. As the value associated with index == 0 is known, it is not stored so for index > 0, the corresponding value is at position index-1 */
 NumericalComplex RandomMixture::computeDeltaCharacteristicFunction(const UnsignedLong index) const
 {
-  if (index == 0) return 0.0;
-  // The cached values are computed and stored in an ascending order without hole: this function is always called on sequence starting from 0 to n-1
-  // Usual case first: the index is within the already computed values
-  if (index <= storedSize_) return characteristicValuesCache_[index - 1];
-  // If the index is higher than the maximum allowed storage
-  if (index > maxSize_)
+  return computeDeltaCharacteristicFunction(index, index)[0];
+}
+
+/* Compute the values of the characteristic function for all the indices between first and last.
+   The cached values are computed and stored in an ascending order without hole. The cache may be
+   shared by several threads: the missing values are computed outside of any lock, then appended
+   under an exclusive lock, and the values are read under a shared lock */
+RandomMixture::NumericalComplexCollection RandomMixture::computeDeltaCharacteristicFunction(const UnsignedLong first,
+                                                                                            const UnsignedLong last) const
+{
+  // The values above the maximum allowed storage are not cached
+  const UnsignedLong cacheLast(std::min(last, maxSize_));
+  UnsignedLong storedSize(0);
+  {
+    RandomMixtureCacheReadLock lock;
+    storedSize = storedSize_;
+  }
+  // Here, some indices have not been computed so far, fill-in the gap
+  if (cacheLast > storedSize)
     {
-      LOGINFO(OSS() << "Cache exceeded in RandomMixture::computeDeltaCharacteristicFunction, consider increasing maxSize_ to " << index);
-      const NumericalScalar x(index * referenceBandwidth_);
-      return computeCharacteristicFunction(x) - equivalentNormal_.computeCharacteristicFunction(x);
+      NumericalComplexCollection newValues(0);
+      for (UnsignedLong i = storedSize + 1; i <= cacheLast; ++i)
+        newValues.add(computeCharacteristicFunction(i * referenceBandwidth_) - equivalentNormal_.computeCharacteristicFunction(i * referenceBandwidth_));
+      RandomMixtureCacheWriteLock lock;
+      // Another thread may have extended the cache in the mean time
+      for (UnsignedLong i = storedSize_ + 1; i <= cacheLast; ++i) characteristicValuesCache_.add(newValues[i - storedSize - 1]);
+      storedSize_ = std::max(storedSize_, cacheLast);
     }
-  // Here, the index has not been computed so far, fill-in the gap
-  if (index > storedSize_)
+  NumericalComplexCollection values(last - first + 1, 0.0);
+  {
+    RandomMixtureCacheReadLock lock;
+    for (UnsignedLong i = std::max(first, UnsignedLong(1)); i <= cacheLast; ++i) values[i - first] = characteristicValuesCache_[i - 1];
+  }
+  if (last > maxSize_)
     {
-      for (UnsignedLong i = storedSize_ + 1; i <= index; ++i)
-        characteristicValuesCache_.add(computeCharacteristicFunction(i * referenceBandwidth_) - equivalentNormal_.computeCharacteristicFunction(i * referenceBandwidth_));
-      storedSize_ = index;
-      return characteristicValuesCache_[storedSize_ - 1];
+      LOGINFO(OSS() << "Cache exceeded in RandomMixture::computeDeltaCharacteristicFunction, consider increasing maxSize_ to " << last);
+      for (UnsignedLong i = std::max(first, maxSize_ + 1); i <= last; ++i)
+        {
+          const NumericalScalar x(i * referenceBandwidth_);
+          values[i - first] = computeCharacteristicFunction(x) - equivalentNormal_.computeCharacteristicFunction(x);
+        }
     }
-  // Should never go there
-  throw InvalidArgumentException(HERE) << "Error: trying to access to a cached characteristic value in an incorrect pattern.";
+  return values;
 }
 
 /* Get the PDF gradient of the distribution */
@@ -830,6 +874,7 @@ RandomMixture::NumericalPointWithDescriptionCollection RandomMixture::getParamet
 /* Get a positon indicator for a 1D distribution */
 NumericalScalar RandomMixture::getPositionIndicator() const
 {
+  CacheLock lock(*this);
   if (!isAlreadyComputedPositionIndicator_) computePositionIndicator();
   return positionIndicator_;
 }
@@ -848,6 +893,7 @@ void RandomMixture::computePositionIndicator() const
 /* Get a dispersion indicator for a 1D distribution */
 NumericalScalar RandomMixture::getDispersionIndicator() const
 {
+  CacheLock lock(*this);
   if (!isAlreadyComputedDispersionIndicator_) computeDispersionIndicator();
   return dispersionIndicator_;
 }
@@ -889,7 +935,9 @@ UnsignedLong RandomMixture::getBlockMax() const
 void RandomMixture::setMaxSize(const UnsignedLong maxSize)
 {
   maxSize_ = maxSize;
-  characteristicValuesCache_.resize(maxSize);
+  // Drop the cached values beyond the new maximum size
+  storedSize_ = std::min(storedSize_, maxSize_);
+  characteristicValuesCache_.resize(storedSize_);
 }
 
 UnsignedLong RandomMixture::getMaxSize() const
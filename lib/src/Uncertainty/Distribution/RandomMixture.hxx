@@ -50,6 +50,7 @@ public:
   typedef Collection<Distribution>               DistributionCollection;
   typedef PersistentCollection<Distribution>     DistributionPersistentCollection;
   typedef PersistentCollection<NumericalComplex> NumericalComplexPersistentCollection;
+  typedef Collection<NumericalComplex>           NumericalComplexCollection;
   typedef Collection<DistributionFactory>        DistributionFactoryCollection;
 
 
@@ -115,6 +116,10 @@ private:
   /** Compute the characteristic function of 1D distributions by difference to a reference Normal distribution with the same mean and the same standard deviation in a regular pattern with cache */
   NumericalComplex computeDeltaCharacteristicFunction(const UnsignedLong index) const;
 
+  /** Same as above for all the indices between first and last included, with a single access to the cache */
+  NumericalComplexCollection computeDeltaCharacteristicFunction(const UnsignedLong first,
+                                                                const UnsignedLong last) const;
+
 public:
   /** Get the CDF of the RandomMixture */
   using DistributionImplementation::computeCDF;
@@ -148,8 +148,7 @@ void Rice::computeMean() const
 /* Get the standard deviation of the distribution */
 NumericalPoint Rice::getStandardDeviation() const
 {
-  if (!isAlreadyComputedCovariance_) computeCovariance();
-  return NumericalPoint(1, sqrt(covariance_(0, 0)));
+  return NumericalPoint(1, sqrt(getCovariance()(0, 0)));
 }
 
 /* Get the moments of the standardized distribution */
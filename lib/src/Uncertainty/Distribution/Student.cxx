@@ -125,6 +125,12 @@ NumericalScalar Student::computeDensityGenerator(const NumericalScalar betaSquar
   return exp(studentNormalizationFactor_ - 0.5 * (nu_ + getDimension()) * log1p(betaSquare / nu_));
 }
 
+/* Compute the logarithm of the density generator */
+NumericalScalar Student::computeLogDensityGenerator(const NumericalScalar betaSquare) const
+{
+  return studentNormalizationFactor_ - 0.5 * (nu_ + getDimension()) * log1p(betaSquare / nu_);
+}
+
 /* Compute the derivative of the density generator */
 NumericalScalar Student::computeDensityGeneratorDerivative(const NumericalScalar betaSquare) const
 {
@@ -159,6 +165,19 @@ NumericalPoint Student::getRealization() const
   return sqrt(0.5 * nu_ / DistFunc::rGamma(0.5 * nu_)) * (cholesky_ * value) + mean_;
 }
 
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample Student::getSample(const UnsignedLong size) const
+{
+  // The multivariate case shares a Gamma variate between the components of a realization
+  if (getDimension() > 1) return EllipticalDistribution::getSample(size);
+  const NumericalPoint values(DistFunc::rStudent(nu_, size));
+  NumericalSample result(size, 1);
+  for (UnsignedLong i = 0; i < size; ++i) result[i][0] = mean_[0] + sigma_[0] * values[i];
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
+}
+
 
 /* Get the CDF of the distribution */
 NumericalScalar Student::computeCDF(const NumericalPoint & point) const
@@ -483,6 +502,13 @@ NumericalScalar Student::computeConditionalQuantile(const NumericalScalar q,
   return meanRos + sigmaRos * DistFunc::qNormal(q);
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint Student::computeConditionalQuantile(const NumericalPoint & q,
+                                                   const NumericalSample & y) const
+{
+  return computeConditionalQuantileByPoint(q, y);
+}
+
 /* Get the i-th marginal distribution */
 Student::Implementation Student::getMarginal(const UnsignedLong i) const
 {
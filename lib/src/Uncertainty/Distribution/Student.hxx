@@ -78,6 +78,9 @@ public:
   /** Get one realization of the distribution */
   NumericalPoint getRealization() const;
 
+  /** Get a numerical sample whose elements follow the distribution */
+  NumericalSample getSample(const UnsignedLong size) const;
+
   /** Get the CDF of the distribution */
   using EllipticalDistribution::computeCDF;
   NumericalScalar computeCDF(const NumericalPoint & point) const;
@@ -106,6 +109,9 @@ public:
   /** Compute the quantile of Xi | X1, ..., Xi-1, i.e. x such that CDF(x|y) = q with x = Xi, y = (X1,...,Xi-1) */
   NumericalScalar computeConditionalQuantile(const NumericalScalar q, const NumericalPoint & y) const;
 
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+  NumericalPoint computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const;
+
   /** Get the i-th marginal distribution */
   Implementation getMarginal(const UnsignedLong i) const;
 
@@ -156,6 +162,9 @@ public:
    *  be written as p(x) = phi(t(x-mu)R^(-1)(x-mu))                      */
   NumericalScalar computeDensityGenerator(const NumericalScalar betaSquare) const;
 
+  /** Compute the logarithm of the density generator */
+  NumericalScalar computeLogDensityGenerator(const NumericalScalar betaSquare) const;
+
   /** Compute the derivative of the density generator */
   NumericalScalar computeDensityGeneratorDerivative(const NumericalScalar betaSquare) const;
 
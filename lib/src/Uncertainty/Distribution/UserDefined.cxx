@@ -42,7 +42,9 @@ UserDefined::UserDefined()
   , collection_(UserDefinedPairCollection(1))
   , cumulativeProbabilities_(NumericalScalarCollection(1, 1.0))
   , hasUniformWeights_(true)
+  , guideTable_(0)
 {
+  computeGuideTable();
   // Empty range
   setRange(Interval(1.0, 0.0));
 }
@@ -53,6 +55,7 @@ UserDefined::UserDefined(const UserDefinedPairCollection & collection)
   , collection_(0)
   , cumulativeProbabilities_(0)
   , hasUniformWeights_(false)
+  , guideTable_(0)
 {
   // We set the dimension of the UserDefined distribution
   // This call set also the range
@@ -65,6 +68,7 @@ UserDefined::UserDefined(const NumericalSample & sample)
   , collection_(0)
   , cumulativeProbabilities_(0)
   , hasUniformWeights_(true)
+  , guideTable_(0)
 {
   const UnsignedLong size(sample.getSize());
   if (size == 0) throw InvalidArgumentException(HERE) << "Error: cannot build a UserDefined distribution based on an empty sample.";
@@ -84,6 +88,7 @@ UserDefined::UserDefined(const NumericalSample & sample,
   , collection_(0)
   , cumulativeProbabilities_(0)
   , hasUniformWeights_(false)
+  , guideTable_(0)
 {
   const UnsignedLong size(sample.getSize());
   if (size == 0) throw InvalidArgumentException(HERE) << "Error: cannot build a UserDefined distribution based on an empty sample.";
@@ -147,17 +152,28 @@ NumericalPoint UserDefined::getRealization() const
       const UnsignedLong j(RandomGenerator::IntegerGenerate(size));
       return collection_[j].getX();
     }
-  const NumericalScalar uniformRealization(RandomGenerator::Generate());
-  if (uniformRealization <= cumulativeProbabilities_[0]) return collection_[0].getX();
-  UnsignedLong j0(0);
-  UnsignedLong j1(size - 1);
-  while (j1 - j0 > 1)
+  return collection_[computeIndex(RandomGenerator::Generate())].getX();
+}
+
+/* Get a numerical sample whose elements follow the distribution */
+NumericalSample UserDefined::getSample(const UnsignedLong size) const
+{
+  const UnsignedLong supportSize(collection_.getSize());
+  NumericalSample result(size, getDimension());
+  // The random numbers are drawn in the same order as by successive calls to getRealization()
+  if (hasUniformWeights_)
     {
-      const UnsignedLong jm((j0 + j1) / 2);
-      if (uniformRealization > cumulativeProbabilities_[jm]) j0 = jm;
-      else j1 = jm;
+      const RandomGenerator::UnsignedLongCollection indices(RandomGenerator::IntegerGenerate(size, supportSize));
+      for (UnsignedLong i = 0; i < size; ++i) result[i] = collection_[indices[i]].getX();
     }
-  return collection_[j1].getX();
+  else
+    {
+      const NumericalPoint uniformRealizations(RandomGenerator::Generate(size));
+      for (UnsignedLong i = 0; i < size; ++i) result[i] = collection_[computeIndex(uniformRealizations[i])].getX();
+    }
+  result.setName(getName());
+  result.setDescription(getDescription());
+  return result;
 }
 
 /* Get the PDF of the distribution */
@@ -492,6 +508,7 @@ void UserDefined::setPairCollection(const UserDefinedPairCollection & collection
     }
   // We augment slightly the last cumulative probability, which should be equal to 1.0 but we enforce a value > 1.0. It stabilizes the sampling procedures without affecting their correctness (i.e. the algoritms are exact, not approximative)
   cumulativeProbabilities_[size - 1] = 1.0 + 2.0 * ResourceMap::GetAsNumericalScalar("DiscreteDistribution-SupportEpsilon");
+  computeGuideTable();
   collection_ = sortedCollection;
   isAlreadyComputedMean_ = false;
   isAlreadyComputedCovariance_ = false;
@@ -509,10 +526,35 @@ NumericalScalar UserDefined::computeScalarQuantile(const NumericalScalar prob,
                                                    const Bool tail,
                                                    const NumericalScalar precision) const
 {
-  UnsignedLong index(0);
   const NumericalScalar p(tail ? 1 - prob : prob);
-  while (cumulativeProbabilities_[index] < p) ++index;
-  return collection_[index].getX()[0];
+  return collection_[computeIndex(p)].getX()[0];
+}
+
+/* Compute the guide table of the cumulative probabilities
+   It allows to find the first cumulative probability greater or equal to a given p
+   by starting a linear search at guideTable_[floor(size * p)], which costs O(1) in average
+   for any distribution of the weights (Chen and Asau, 1974) */
+void UserDefined::computeGuideTable()
+{
+  const UnsignedLong size(cumulativeProbabilities_.getSize());
+  guideTable_ = Indices(size + 1);
+  UnsignedLong index(0);
+  for (UnsignedLong k = 0; k <= size; ++k)
+    {
+      // The comparison is made on the scaled probabilities, as in computeIndex(), to be robust to round-off errors
+      while ((index < size - 1) && (cumulativeProbabilities_[index] * size < k)) ++index;
+      guideTable_[k] = index;
+    }
+}
+
+/* Get the index of the first cumulative probability greater or equal to p */
+UnsignedLong UserDefined::computeIndex(const NumericalScalar p) const
+{
+  const UnsignedLong size(cumulativeProbabilities_.getSize());
+  const NumericalScalar scaledP(p * size);
+  UnsignedLong index(scaledP <= 0.0 ? 0 : guideTable_[static_cast<UnsignedLong>(std::min(floor(scaledP), NumericalScalar(size)))]);
+  while ((index < size - 1) && (cumulativeProbabilities_[index] < p)) ++index;
+  return index;
 }
 
 /* Merge the identical points of the support */
@@ -557,6 +599,7 @@ void UserDefined::load(Advocate & adv)
   DiscreteDistribution::load(adv);
   adv.loadAttribute( "collection_", collection_ );
   adv.loadAttribute( "cumulativeProbabilities_", cumulativeProbabilities_ );
+  computeGuideTable();
   computeRange();
 }
 
@@ -82,6 +82,9 @@ public:
   /** Get one realization of the distribution */
   NumericalPoint getRealization() const;
 
+  /** Get a numerical sample whose elements follow the distribution */
+  NumericalSample getSample(const UnsignedLong size) const;
+
   /** Get the PDF of the distribution */
   using DiscreteDistribution::computePDF;
   NumericalScalar computePDF(const NumericalPoint & point) const;
@@ -145,6 +148,12 @@ private:
                                         const Bool tail = false,
                                         const NumericalScalar precision = ResourceMap::GetAsNumericalScalar("DistributionImplementation-DefaultQuantileEpsilon")) const;
 
+  /** Compute the guide table of the cumulative probabilities */
+  void computeGuideTable();
+
+  /** Get the index of the first cumulative probability greater or equal to p */
+  UnsignedLong computeIndex(const NumericalScalar p) const;
+
   /** The collection of couple (xi,pi) of the UserDefined distribution */
   UserDefinedPairPersistentCollection collection_;
 
@@ -154,6 +163,9 @@ private:
   /** Flag to accelerate computations in case of uniform weights */
   mutable Bool hasUniformWeights_;
 
+  /** The guide table: guideTable_[k] is the first index i such that size * cumulativeProbabilities_[i] >= k */
+  Indices guideTable_;
+
 }; /* class UserDefined */
 
 END_NAMESPACE_OPENTURNS
@@ -105,7 +105,10 @@ NumericalPoint ZipfMandelbrot::getRealization() const
 {
   const NumericalScalar uniformRealization(1.0 - RandomGenerator::Generate());
 
-  if (!isAlreadyComputedHarmonicNumbers_) computeHarmonicNumbers();
+  {
+    CacheLock lock(*this);
+    if (!isAlreadyComputedHarmonicNumbers_) computeHarmonicNumbers();
+  }
 
   NumericalScalarCollection::iterator it(lower_bound(harmonicNumbers_.begin(),
                                                      harmonicNumbers_.end(),
@@ -317,7 +320,10 @@ void ZipfMandelbrot::load(Advocate & adv)
 /* Method getHarmonicNumbers returns the k-th harmonic number for the current distribution */
 NumericalScalar ZipfMandelbrot::getHarmonicNumbers(const UnsignedLong k ) const
 {
-  if (! isAlreadyComputedHarmonicNumbers_)computeHarmonicNumbers();
+  {
+    CacheLock lock(*this);
+    if (!isAlreadyComputedHarmonicNumbers_) computeHarmonicNumbers();
+  }
 
   if (k < 1) throw InvalidArgumentException(HERE) << "k must be >= 1" ;
   if (k > n_) throw InvalidArgumentException(HERE) << "k must be <= N";
@@ -146,29 +146,24 @@ NumericalScalar ContinuousDistribution::computeConditionalCDF(const NumericalSca
   const UnsignedLong conditioningDimension(y.getDimension());
   if (conditioningDimension >= getDimension()) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional CDF with a conditioning point of dimension greater or equal to the distribution dimension.";
   // Special case for no conditioning or independent copula
-  if ((conditioningDimension == 0) || (hasIndependentCopula())) return Implementation(getMarginal(conditioningDimension))->computeCDF(x);
+  Implementation marginal;
+  Implementation conditioningDistribution;
+  Implementation conditionedDistribution;
+  getConditionalDistributions(conditioningDimension, marginal, conditioningDistribution, conditionedDistribution);
+  if ((conditioningDimension == 0) || (hasIndependentCopula())) return marginal->computeCDF(x);
   // General case
-  Indices conditioning(conditioningDimension);
-  for (UnsignedLong i = 0; i < conditioningDimension; ++i)
-    {
-      conditioning[i] = i;
-    }
-  Indices conditioned(conditioning);
-  conditioned.add(conditioningDimension);
-  Implementation conditioningDistribution(getMarginal(conditioning));
   const NumericalScalar pdfConditioning(conditioningDistribution->computePDF(y));
   if (pdfConditioning <= 0.0) return 0.0;
   // Compute the conditional CDF by numerical integration of the conditional PDF. We use a fixed point Gauss integration.
   const NumericalSample nodesAndWeights(getGaussNodesAndWeights());
   const UnsignedLong numberOfNodes(nodesAndWeights.getDimension());
   NumericalScalar cdfConditioned(0.0);
-  const Implementation marginal(getMarginal(conditioningDimension));
   const NumericalScalar dispersion(marginal->getDispersionIndicator());
   const NumericalScalar position(marginal->getPositionIndicator());
   const NumericalScalar lowerBound(std::max(std::min(position, x) - 8.0 * dispersion, marginal->getRange().getLowerBound()[0]));
   const NumericalScalar halfLength(0.5 * (std::min(x, marginal->getRange().getUpperBound()[0]) - lowerBound));
-  const Implementation conditionedDistribution(getMarginal(conditioned));
-  cdfEpsilon_ = 0.0;
+  // The error is accumulated locally and stored once, as the distribution may be shared between threads
+  NumericalScalar cdfEpsilon(0.0);
   // Map [x-8*s,x] into [-1,1]
   for (UnsignedLong i = 0; i < numberOfNodes; ++i)
     {
@@ -180,10 +175,10 @@ NumericalScalar ContinuousDistribution::computeConditionalCDF(const NumericalSca
       // Accumulate CDF value
       cdfConditioned += w * pdfConditioned;
       // Compute an approximation of the rounding error
-      cdfEpsilon_ += w * conditionedDistribution->getPDFEpsilon();
+      cdfEpsilon += w * conditionedDistribution->getPDFEpsilon();
     }
   cdfConditioned *= halfLength;
-  cdfEpsilon_ = cdfEpsilon_ * halfLength + conditioningDistribution->getPDFEpsilon();
+  cdfEpsilon_ = cdfEpsilon * halfLength + conditioningDistribution->getPDFEpsilon();
   return std::max(std::min(cdfConditioned / pdfConditioning, 1.0 - 1e-7), 1e-7);
 }
 
@@ -512,6 +512,12 @@ NumericalScalar Distribution::computeConditionalQuantile(const NumericalScalar q
   return getImplementation()->computeConditionalQuantile(q, y);
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint Distribution::computeConditionalQuantile(const NumericalPoint & q, const NumericalSample & y) const
+{
+  return getImplementation()->computeConditionalQuantile(q, y);
+}
+
 /* Get the isoprobabilist transformation */
 Distribution::IsoProbabilisticTransformation Distribution::getIsoProbabilisticTransformation() const
 {
@@ -266,6 +266,10 @@ public:
   virtual NumericalScalar computeConditionalQuantile(const NumericalScalar q,
                                                      const NumericalPoint & y) const;
 
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once, i.e. the x[j] such that CDF(x[j]|y[j]) = q[j] with x = Xi, y = (X1,...,Xi-1) */
+  virtual NumericalPoint computeConditionalQuantile(const NumericalPoint & q,
+                                                    const NumericalSample & y) const;
+
   /** Get the isoprobabilist transformation */
   IsoProbabilisticTransformation getIsoProbabilisticTransformation() const;
 
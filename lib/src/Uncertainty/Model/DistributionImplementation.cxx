@@ -29,6 +29,7 @@
 #include "Distribution.hxx"
 #include "Exception.hxx"
 #include "Log.hxx"
+#include "MutexLock.hxx"
 #include "Lapack.hxx"
 #include "IdentityMatrix.hxx"
 #include "Collection.hxx"
@@ -69,6 +70,90 @@ typedef Collection<Distribution>                                      Distributi
 
 static Factory<DistributionImplementation> RegisteredFactory("DistributionImplementation");
 
+/* Create a recursive mutex */
+DistributionImplementation::CacheMutex::CacheMutex()
+{
+  pthread_mutexattr_t attributes;
+  pthread_mutexattr_init(&attributes);
+  pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&mutex_, &attributes);
+  pthread_mutexattr_destroy(&attributes);
+}
+
+/* A copy gets its own mutex */
+DistributionImplementation::CacheMutex::CacheMutex(const CacheMutex & other)
+{
+  pthread_mutexattr_t attributes;
+  pthread_mutexattr_init(&attributes);
+  pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&mutex_, &attributes);
+  pthread_mutexattr_destroy(&attributes);
+}
+
+/* The mutex is not assigned */
+DistributionImplementation::CacheMutex & DistributionImplementation::CacheMutex::operator = (const CacheMutex & other)
+{
+  return *this;
+}
+
+DistributionImplementation::CacheMutex::~CacheMutex()
+{
+  pthread_mutex_destroy(&mutex_);
+}
+
+/* Take the cache mutex of the distribution */
+DistributionImplementation::CacheLock::CacheLock(const DistributionImplementation & distribution)
+  : mutex_(distribution.cacheMutex_.mutex_)
+{
+  const int rc(pthread_mutex_lock(&mutex_));
+  if (rc != 0) throw InternalException(HERE) << "Error: cannot lock the distribution cache mutex, rc=" << rc;
+}
+
+/* Release the cache mutex */
+DistributionImplementation::CacheLock::~CacheLock()
+{
+  pthread_mutex_unlock(&mutex_);
+}
+
+/* Atomic scalar */
+DistributionImplementation::AtomicScalar::AtomicScalar(const NumericalScalar value)
+  : value_(value)
+{
+  // Nothing to do
+}
+
+DistributionImplementation::AtomicScalar::AtomicScalar(const AtomicScalar & other)
+  : value_(other)
+{
+  // Nothing to do
+}
+
+DistributionImplementation::AtomicScalar & DistributionImplementation::AtomicScalar::operator = (const AtomicScalar & other)
+{
+  return operator = (NumericalScalar(other));
+}
+
+DistributionImplementation::AtomicScalar & DistributionImplementation::AtomicScalar::operator = (const NumericalScalar value)
+{
+#ifdef __GNUC__
+  __atomic_store(&value_, &value, __ATOMIC_RELAXED);
+#else
+  value_ = value;
+#endif
+  return *this;
+}
+
+DistributionImplementation::AtomicScalar::operator NumericalScalar () const
+{
+#ifdef __GNUC__
+  NumericalScalar value;
+  __atomic_load(&value_, &value, __ATOMIC_RELAXED);
+  return value;
+#else
+  return value_;
+#endif
+}
+
 /* Default constructor */
 DistributionImplementation::DistributionImplementation(const String & name)
   : PersistentObject(name),
@@ -88,6 +173,9 @@ DistributionImplementation::DistributionImplementation(const String & name)
     scalarQuantileCache_(0, 2),
     isAlreadyCreatedGeneratingFunction_(false),
     generatingFunction_(0),
+    isAlreadyCreatedConditionalDistributions_(false),
+    conditionalMarginals_(0),
+    conditionedDistributions_(0),
     dimension_(1),
     weight_(1.0),
     range_(),
@@ -160,6 +248,7 @@ void DistributionImplementation::setDimension(const UnsignedLong dim)
       isAlreadyComputedMean_ = false;
       isAlreadyComputedCovariance_ = false;
       isAlreadyComputedGaussNodesAndWeights_ = false;
+      isAlreadyCreatedConditionalDistributions_ = false;
       // Check if the current description is compatible with the new dimension
       if (description_.getSize() != dim)
         {
@@ -204,8 +293,9 @@ NumericalPoint DistributionImplementation::computeDDF(const NumericalPoint & poi
 {
   NumericalPoint ddf(dimension_);
   const NumericalScalar cdfPoint(computeCDF(point));
-  const NumericalScalar h(pow(cdfEpsilon_, 0.25));
-  const NumericalScalar idenom(1.0 / sqrt(cdfEpsilon_));
+  const NumericalScalar cdfEpsilon(cdfEpsilon_);
+  const NumericalScalar h(pow(cdfEpsilon, 0.25));
+  const NumericalScalar idenom(1.0 / sqrt(cdfEpsilon));
   for (UnsignedLong i = 0; i < dimension_; ++i)
     {
       NumericalPoint epsilon(dimension_, 0.0);
@@ -221,7 +311,7 @@ NumericalScalar DistributionImplementation::computePDF(const NumericalPoint & po
   const NumericalPoint epsilon(dimension_, pow(cdfEpsilon_, 1.0 / 3.0));
   pdfEpsilon_ = epsilon[0];
   // Centered finite differences of CDF
-  return (computeCDF(point + epsilon) - computeCDF(point - epsilon)) / (2.0 * pdfEpsilon_);
+  return (computeCDF(point + epsilon) - computeCDF(point - epsilon)) / (2.0 * epsilon[0]);
 }
 
 NumericalScalar DistributionImplementation::computeLogPDF(const NumericalPoint & point) const
@@ -296,13 +386,14 @@ NumericalComplex DistributionImplementation::computeCharacteristicFunction(const
       const NumericalScalar xMin(range_.getLowerBound()[0]);
       const NumericalScalar xMax(range_.getUpperBound()[0]);
       const NumericalScalar delta(xMax - xMin);
-      const UnsignedLong intervalsNumber(std::max(1, static_cast<int>(round(2 * x * delta / integrationNodesNumber_))));
+      const UnsignedLong integrationNodesNumber(legendreNodesAndWeights.getDimension());
+      const UnsignedLong intervalsNumber(std::max(1, static_cast<int>(round(2 * x * delta / integrationNodesNumber))));
       // Here, we should adopt a specific method for the case of highly oscilating integrand, i.e. large x
       const NumericalScalar halfLength(0.5 * delta / intervalsNumber);
       for (UnsignedLong n = 0; n < intervalsNumber; ++n)
         {
           const NumericalScalar a(xMin + 2.0 * n * halfLength);
-          for (UnsignedLong i = 0; i < integrationNodesNumber_; ++i)
+          for (UnsignedLong i = 0; i < integrationNodesNumber; ++i)
             {
               const NumericalScalar xi(a + (1.0 + legendreNodesAndWeights[0][i]) * halfLength);
               value += legendreNodesAndWeights[1][i] * computePDF(xi) * exp(NumericalComplex(0.0, x * xi));
@@ -379,26 +470,27 @@ NumericalComplex DistributionImplementation::computeGeneratingFunction(const Num
   const UnsignedLong size(support.getSize());
   NumericalComplex value(0.0);
   // If the distribution is integral, the generating function is either a polynomial if the support is finite, or can be well approximated by such a polynomial
-  if (isAlreadyCreatedGeneratingFunction_) value = generatingFunction_(z);
-  else
-    // If isIntegral, then we have to create the generating function as a polynomial
-    if (isIntegral())
-      {
-        NumericalPoint coefficients(size);
-        for (UnsignedLong i = 0; i < size; ++i) coefficients[i] = computePDF(support[i]);
-        generatingFunction_ = UniVariatePolynomial(coefficients);
-        isAlreadyCreatedGeneratingFunction_ = true;
-        value = generatingFunction_(z);
-      }
+  if (isIntegral())
+    {
+      CacheLock lock(*this);
+      if (!isAlreadyCreatedGeneratingFunction_)
+        {
+          NumericalPoint coefficients(size);
+          for (UnsignedLong i = 0; i < size; ++i) coefficients[i] = computePDF(support[i]);
+          generatingFunction_ = UniVariatePolynomial(coefficients);
+          isAlreadyCreatedGeneratingFunction_ = true;
+        }
+      value = generatingFunction_(z);
+    }
   // The distribution is discrete but not integral
-    else
-      {
-        for (UnsignedLong i = 0; i < size; ++i)
-          {
-            const NumericalScalar pt(support[i][0]);
-            value += computePDF(pt) * pow(z, pt);
-          }
-      }
+  else
+    {
+      for (UnsignedLong i = 0; i < size; ++i)
+        {
+          const NumericalScalar pt(support[i][0]);
+          value += computePDF(pt) * pow(z, pt);
+        }
+    }
   return value;
 }
 
@@ -610,18 +702,16 @@ NumericalScalar DistributionImplementation::computeConditionalPDF(const Numerica
   const UnsignedLong conditioningDimension(y.getDimension());
   if (conditioningDimension >= getDimension()) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional PDF with a conditioning point of dimension greater or equal to the distribution dimension.";
   // Special case for no conditioning or independent copula
-  if ((conditioningDimension == 0) || (hasIndependentCopula())) return Implementation(getMarginal(conditioningDimension))->computePDF(x);
+  Implementation marginalDistribution;
+  Implementation conditioningDistribution;
+  Implementation conditionedDistribution;
+  getConditionalDistributions(conditioningDimension, marginalDistribution, conditioningDistribution, conditionedDistribution);
+  if ((conditioningDimension == 0) || (hasIndependentCopula())) return marginalDistribution->computePDF(x);
   // General case
-  Indices conditioning(conditioningDimension);
-  for (UnsignedLong i = 0; i < conditioningDimension; ++i) conditioning[i] = i;
-  Indices conditioned(conditioning);
-  conditioned.add(conditioningDimension);
-  const Implementation conditioningDistribution(getMarginal(conditioning));
   const NumericalScalar pdfConditioning(conditioningDistribution->computePDF(y));
   if (pdfConditioning <= 0.0) return 0.0;
   NumericalPoint z(y);
   z.add(x);
-  const Implementation conditionedDistribution(getMarginal(conditioned));
   const NumericalScalar pdfConditioned(conditionedDistribution->computePDF(z));
   pdfEpsilon_ = conditionedDistribution->getPDFEpsilon() + conditioningDistribution->getPDFEpsilon();
   return pdfConditioned / pdfConditioning;
@@ -634,16 +724,14 @@ NumericalScalar DistributionImplementation::computeConditionalCDF(const Numerica
   const UnsignedLong conditioningDimension(y.getDimension());
   if (conditioningDimension >= getDimension()) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional CDF with a conditioning point of dimension greater or equal to the distribution dimension.";
   // Special case for no conditioning or independent copula
-  if ((conditioningDimension == 0) || (hasIndependentCopula())) return Implementation(getMarginal(conditioningDimension))->computeCDF(x);
+  Implementation marginalDistribution;
+  Implementation conditioningDistribution;
+  Implementation conditionedDistribution;
+  getConditionalDistributions(conditioningDimension, marginalDistribution, conditioningDistribution, conditionedDistribution);
+  if ((conditioningDimension == 0) || (hasIndependentCopula())) return marginalDistribution->computeCDF(x);
   // General case
-  Indices conditioning(conditioningDimension);
-  for (UnsignedLong i = 0; i < conditioningDimension; ++i) conditioning[i] = i;
-  Indices conditioned(conditioning);
-  conditioned.add(conditioningDimension);
-  const Implementation conditioningDistribution(getMarginal(conditioning));
   const NumericalScalar pdfConditioning(conditioningDistribution->computePDF(y));
   if (pdfConditioning <= 0.0) return 0.0;
-  const Implementation conditionedDistribution(getMarginal(conditioned));
   const NumericalScalar xMin(conditionedDistribution->getRange().getLowerBound()[conditioningDimension]);
   if (x <= xMin) return 0.0;
   const NumericalScalar xMax(conditionedDistribution->getRange().getUpperBound()[conditioningDimension]);
@@ -654,43 +742,73 @@ NumericalScalar DistributionImplementation::computeConditionalCDF(const Numerica
   pdfEpsilon_ = conditionedDistribution->getPDFEpsilon() + conditioningDistribution->getPDFEpsilon();
   const NumericalSample legendreNodesAndWeights(getGaussNodesAndWeights());
   const NumericalScalar halfLength(0.5 * (x - xMin));
-  cdfEpsilon_ = conditioningDistribution->getPDFEpsilon();
+  // The error is accumulated locally and published once, as the distribution may be shared between threads
+  NumericalScalar cdfEpsilon(conditioningDistribution->getPDFEpsilon());
   NumericalScalar value(0.0);
-  for (UnsignedLong i = 0; i < integrationNodesNumber_; ++i)
+  for (UnsignedLong i = 0; i < legendreNodesAndWeights.getDimension(); ++i)
     {
       const NumericalScalar xi(xMin + (1.0 + legendreNodesAndWeights[0][i]) * halfLength);
       z[conditioningDimension] = xi;
       value += legendreNodesAndWeights[1][i] * conditionedDistribution->computePDF(z);
-      cdfEpsilon_ += legendreNodesAndWeights[1][i] * conditionedDistribution->getPDFEpsilon();
+      cdfEpsilon += legendreNodesAndWeights[1][i] * conditionedDistribution->getPDFEpsilon();
     }
+  cdfEpsilon_ = cdfEpsilon;
   value *= (halfLength / pdfConditioning);
   return value;
 }
 
+/* Get the sub-distributions involved in the conditioning of Xi by X1, ..., Xi-1 */
+void DistributionImplementation::getConditionalDistributions(const UnsignedLong conditioningDimension,
+                                                             Implementation & marginalDistribution,
+                                                             Implementation & conditioningDistribution,
+                                                             Implementation & conditionedDistribution) const
+{
+  CacheLock lock(*this);
+  if (!isAlreadyCreatedConditionalDistributions_ || (conditionalMarginals_.getSize() != dimension_))
+    {
+      conditionalMarginals_ = Collection<Implementation>(dimension_);
+      conditionedDistributions_ = Collection<Implementation>(dimension_);
+      isAlreadyCreatedConditionalDistributions_ = true;
+    }
+  // Each sub-distribution is built only when needed, as some of them may be expensive or even not available
+  if (conditionalMarginals_[conditioningDimension].isNull()) conditionalMarginals_[conditioningDimension] = getMarginal(conditioningDimension);
+  marginalDistribution = conditionalMarginals_[conditioningDimension];
+  // No conditioning or independent copula, the marginal distribution is enough
+  if ((conditioningDimension == 0) || hasIndependentCopula()) return;
+  for (UnsignedLong k = conditioningDimension - 1; k <= conditioningDimension; ++k)
+    if (conditionedDistributions_[k].isNull())
+      {
+        Indices indices(k + 1);
+        indices.fill();
+        conditionedDistributions_[k] = getMarginal(indices);
+      }
+  conditioningDistribution = conditionedDistributions_[conditioningDimension - 1];
+  conditionedDistribution = conditionedDistributions_[conditioningDimension];
+}
+
 /* Compute the CDF of Xi | X1, ..., Xi-1. x = Xi, y = (X1,...,Xi-1) with reuse of expansive data */
 NumericalScalar DistributionImplementation::computeConditionalCDFForQuantile(const NumericalScalar x,
                                                                              const NumericalPoint & y,
-                                                                             const Implementation & conditioningDistribution,
+                                                                             const NumericalScalar pdfConditioning,
                                                                              const Implementation & conditionedDistribution,
-                                                                             const NumericalScalar xMin) const
+                                                                             const NumericalSample & nodesAndWeights,
+                                                                             const NumericalScalar xMin,
+                                                                             NumericalScalar & cdfEpsilon) const
 {
-  const UnsignedLong conditioningDimension(y.getDimension());
-  const NumericalScalar pdfConditioning(conditioningDistribution->computePDF(y));
+  cdfEpsilon = 0.0;
   if (pdfConditioning <= 0.0) return 0.0;
+  const UnsignedLong conditioningDimension(y.getDimension());
   // Numerical integration with respect to x
   NumericalPoint z(y);
   z.add(x);
-  pdfEpsilon_ = conditionedDistribution->getPDFEpsilon() + conditioningDistribution->getPDFEpsilon();
-  const NumericalSample legendreNodesAndWeights(getGaussNodesAndWeights());
   const NumericalScalar halfLength(0.5 * (x - xMin));
-  cdfEpsilon_ = conditioningDistribution->getPDFEpsilon();
   NumericalScalar value(0.0);
-  for (UnsignedLong i = 0; i < integrationNodesNumber_; ++i)
+  for (UnsignedLong i = 0; i < nodesAndWeights.getDimension(); ++i)
     {
-      const NumericalScalar xi(xMin + (1.0 + legendreNodesAndWeights[0][i]) * halfLength);
+      const NumericalScalar xi(xMin + (1.0 + nodesAndWeights[0][i]) * halfLength);
       z[conditioningDimension] = xi;
-      value += legendreNodesAndWeights[1][i] * conditionedDistribution->computePDF(z);
-      cdfEpsilon_ += legendreNodesAndWeights[1][i] * conditionedDistribution->getPDFEpsilon();
+      value += nodesAndWeights[1][i] * conditionedDistribution->computePDF(z);
+      cdfEpsilon += nodesAndWeights[1][i] * conditionedDistribution->getPDFEpsilon();
     }
   value *= (halfLength / pdfConditioning);
   return value;
@@ -699,92 +817,114 @@ NumericalScalar DistributionImplementation::computeConditionalCDFForQuantile(con
 /* Compute the PDF and CDF of Xi | X1, ..., Xi-1. x = Xi, y = (X1,...,Xi-1) */
 NumericalScalar DistributionImplementation::computeConditionalPDFAndCDF(const NumericalScalar x,
                                                                         const NumericalPoint & y,
-                                                                        NumericalScalar & cdf,
-                                                                        const Implementation & conditioningDistribution,
+                                                                        const NumericalScalar pdfConditioning,
                                                                         const Implementation & conditionedDistribution,
-                                                                        const NumericalScalar xMin) const
+                                                                        const NumericalSample & nodesAndWeights,
+                                                                        const NumericalScalar xMin,
+                                                                        NumericalScalar & cdf,
+                                                                        NumericalScalar & cdfEpsilon) const
 {
-  const UnsignedLong conditioningDimension(y.getDimension());
-  const NumericalScalar pdfConditioning(conditioningDistribution->computePDF(y));
-  if (pdfConditioning <= 0.0)
-    {
-      cdf = 0.0;
-      return 0.0;
-    }
-  // Numerical integration with respect to x
+  cdf = computeConditionalCDFForQuantile(x, y, pdfConditioning, conditionedDistribution, nodesAndWeights, xMin, cdfEpsilon);
+  if (pdfConditioning <= 0.0) return 0.0;
   NumericalPoint z(y);
   z.add(x);
-  const NumericalScalar pdfConditioned(conditionedDistribution->computePDF(z));
-  cdf = 0.0;
-  const NumericalSample legendreNodesAndWeights(getGaussNodesAndWeights());
-  const NumericalScalar halfLength(0.5 * (x - xMin));
-  cdfEpsilon_ = conditioningDistribution->getPDFEpsilon();
-  for (UnsignedLong i = 0; i < integrationNodesNumber_; ++i)
-    {
-      const NumericalScalar xi(xMin + (1.0 + legendreNodesAndWeights[0][i]) * halfLength);
-      z[conditioningDimension] = xi;
-      cdf += legendreNodesAndWeights[1][i] * conditionedDistribution->computePDF(z);
-      cdfEpsilon_ += legendreNodesAndWeights[1][i] * conditionedDistribution->getPDFEpsilon();
-    }
-  cdf *= (halfLength / pdfConditioning);
-  return pdfConditioned / pdfConditioning;
+  return conditionedDistribution->computePDF(z) / pdfConditioning;
 }
 
 /* Compute the quantile of Xi | X1, ..., Xi-1, i.e. x such that CDF(x|y) = q with x = Xi, y = (X1,...,Xi-1) */
 NumericalScalar DistributionImplementation::computeConditionalQuantile(const NumericalScalar q,
                                                                        const NumericalPoint & y) const
 {
+  // The generic algorithm is the one of a column reduced to a single point
+  return DistributionImplementation::computeConditionalQuantile(NumericalPoint(1, q), NumericalSample(1, y))[0];
+}
+
+/* Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once */
+NumericalPoint DistributionImplementation::computeConditionalQuantile(const NumericalPoint & q,
+                                                                      const NumericalSample & y) const
+{
+  const UnsignedLong size(q.getDimension());
+  if (y.getSize() != size) throw InvalidArgumentException(HERE) << "Error: cannot compute conditional quantiles with a number of probability levels=" << size << " different from the number of conditioning points=" << y.getSize();
   const UnsignedLong conditioningDimension(y.getDimension());
   if (conditioningDimension >= dimension_) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional quantile with a conditioning point of dimension greater or equal to the distribution dimension.";
-  if ((q < 0.0) || (q > 1.0)) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional quantile for a probability level outside of [0, 1]";
-  // Initialize the conditional quantile with the quantile of the i-th marginal distribution
-  const Implementation marginalDistribution(getMarginal(conditioningDimension));
-  NumericalScalar quantile(marginalDistribution->computeQuantile(q)[0]);
-  // Special case for bording values
-  if ((q == 0.0) || (q == 1.0)) return quantile;
+  for (UnsignedLong i = 0; i < size; ++i)
+    if ((q[i] < 0.0) || (q[i] > 1.0)) throw InvalidArgumentException(HERE) << "Error: cannot compute a conditional quantile for a probability level outside of [0, 1]";
+  Implementation marginalDistribution;
+  Implementation conditioningDistribution;
+  Implementation conditionedDistribution;
+  getConditionalDistributions(conditioningDimension, marginalDistribution, conditioningDistribution, conditionedDistribution);
+  // Initialize the conditional quantiles with the quantiles of the i-th marginal distribution
+  NumericalPoint quantile(size);
+  for (UnsignedLong i = 0; i < size; ++i) quantile[i] = marginalDistribution->computeQuantile(q[i])[0];
   // Special case when no contitioning or independent copula
   if ((conditioningDimension == 0) || hasIndependentCopula()) return quantile;
-  //NumericalScalar step(marginalDistribution->getDispersionIndicator());
-  Indices conditioning(conditioningDimension);
-  for (UnsignedLong i = 0; i < conditioningDimension; ++i) conditioning[i] = i;
-  Indices conditioned(conditioning);
-  conditioned.add(conditioningDimension);
-  const Implementation conditioningDistribution(getMarginal(conditioning));
-  const Implementation conditionedDistribution(getMarginal(conditioned));
   const NumericalScalar xMin(conditionedDistribution->getRange().getLowerBound()[conditioningDimension]);
   const NumericalScalar xMax(conditionedDistribution->getRange().getUpperBound()[conditioningDimension]);
-  // Start with the largest bracketing interval
-  NumericalScalar a(xMin);
-  NumericalScalar b(xMax);
-  Bool convergence(false);
-  NumericalScalar residual(0.0);
-  UnsignedLong iteration(0);
-  UnsignedLong maximumIteration(ResourceMap::GetAsUnsignedLong("DistributionImplementation-DefaultQuantileIteration"));
-  NumericalScalar quantileEpsilon(ResourceMap::GetAsUnsignedLong("DistributionImplementation-DefaultQuantileEpsilon"));
-  while (!convergence && (iteration < maximumIteration))
+  const NumericalSample nodesAndWeights(getGaussNodesAndWeights());
+  // The PDF of the conditioning part depends only on the conditioning point, it is computed once per point.
+  // The bording values keep the marginal quantiles
+  NumericalPoint pdfConditioning(size, 0.0);
+  Indices active(0);
+  for (UnsignedLong i = 0; i < size; ++i)
+    if ((q[i] > 0.0) && (q[i] < 1.0))
+      {
+        pdfConditioning[i] = conditioningDistribution->computePDF(y[i]);
+        active.add(i);
+      }
+  // Start with the largest bracketing intervals
+  NumericalPoint a(size, xMin);
+  NumericalPoint b(size, xMax);
+  NumericalPoint residual(size, 0.0);
+  const UnsignedLong maximumIteration(ResourceMap::GetAsUnsignedLong("DistributionImplementation-DefaultQuantileIteration"));
+  const NumericalScalar quantileEpsilon(ResourceMap::GetAsNumericalScalar("DistributionImplementation-DefaultQuantileEpsilon"));
+  NumericalScalar cdfEpsilonMax(0.0);
+  // All the points of the column move together, each iteration doing a Newton or a bisection step on each point not yet converged
+  for (UnsignedLong iteration = 0; (iteration < maximumIteration) && (active.getSize() > 0); ++iteration)
     {
-      NumericalScalar cdf(0.0);
-      const NumericalScalar pdf(computeConditionalPDFAndCDF(quantile, y, cdf, conditioningDistribution, conditionedDistribution, xMin));
-      // Do we have to perform a bisection step?
-      if ((pdf == 0.0) || (quantile > b) || (quantile < a))
-        {
-          quantile = 0.5 * (a + b);
-          cdf = computeConditionalCDFForQuantile(quantile, y, conditioningDistribution, conditionedDistribution, xMin);
-          if (cdf > q) b = quantile;
-          else a = quantile;
-        }
-      else
+      Indices stillActive(0);
+      for (UnsignedLong k = 0; k < active.getSize(); ++k)
         {
-          // No, so do a Newton step
-          residual = (q - cdf) / pdf;
-          quantile += residual;
+          const UnsignedLong i(active[k]);
+          const NumericalPoint yI(y[i]);
+          NumericalScalar cdf(0.0);
+          NumericalScalar cdfEpsilon(0.0);
+          const NumericalScalar pdf(computeConditionalPDFAndCDF(quantile[i], yI, pdfConditioning[i], conditionedDistribution, nodesAndWeights, xMin, cdf, cdfEpsilon));
+          // Do we have to perform a bisection step?
+          if ((pdf == 0.0) || (quantile[i] > b[i]) || (quantile[i] < a[i]))
+            {
+              quantile[i] = 0.5 * (a[i] + b[i]);
+              cdf = computeConditionalCDFForQuantile(quantile[i], yI, pdfConditioning[i], conditionedDistribution, nodesAndWeights, xMin, cdfEpsilon);
+              if (cdf > q[i]) b[i] = quantile[i];
+              else a[i] = quantile[i];
+              residual[i] = b[i] - a[i];
+            }
+          else
+            {
+              // No, so do a Newton step
+              residual[i] = (q[i] - cdf) / pdf;
+              quantile[i] += residual[i];
+            }
+          cdfEpsilonMax = std::max(cdfEpsilonMax, cdfEpsilon);
+          const Bool convergence(fabs(residual[i]) < quantileEpsilon * (1.0 + fabs(quantile[i])) || (fabs(cdf - q[i]) < 2.0 * cdfEpsilon) || (b[i] - a[i] < quantileEpsilon * (1.0 + fabs(quantile[i]))));
+          if (!convergence) stillActive.add(i);
         }
-      convergence = fabs(residual) < quantileEpsilon * (1.0 + fabs(quantile)) || (fabs(cdf - q) < 2.0 * cdfEpsilon_) || (b - a < quantileEpsilon * (1.0 + fabs(quantile)));
-      ++iteration;
+      active = stillActive;
     }
+  cdfEpsilon_ = cdfEpsilonMax + conditioningDistribution->getPDFEpsilon();
   return quantile;
 }
 
+/* Compute the quantiles of Xi | X1, ..., Xi-1 one conditioning point at a time */
+NumericalPoint DistributionImplementation::computeConditionalQuantileByPoint(const NumericalPoint & q,
+                                                                             const NumericalSample & y) const
+{
+  const UnsignedLong size(q.getDimension());
+  if (y.getSize() != size) throw InvalidArgumentException(HERE) << "Error: cannot compute conditional quantiles with a number of probability levels=" << size << " different from the number of conditioning points=" << y.getSize();
+  NumericalPoint result(size);
+  for (UnsignedLong i = 0; i < size; ++i) result[i] = computeConditionalQuantile(q[i], y[i]);
+  return result;
+}
+
 /* Scalar quantile cache initialization */
 void DistributionImplementation::initializeQuantileCache() const
 {
@@ -873,7 +1013,10 @@ NumericalScalar DistributionImplementation::computeScalarQuantile(const Numerica
                                                                   const NumericalScalar precision) const
 {
   // Cache initialization by bisection
-  if (!isAlreadyInitializedQuantileCache_) initializeQuantileCache();
+  {
+    CacheLock lock(*this);
+    if (!isAlreadyInitializedQuantileCache_) initializeQuantileCache();
+  }
   NumericalScalar quantileEpsilon(ResourceMap::GetAsNumericalScalar("DistributionImplementation-DefaultQuantileEpsilon"));
   LOGDEBUG(OSS() << "DistributionImplementation::computeScalarQuantile: prob=" << prob << " tail=" << (tail ? "true" : "false") << " precision=" << precision);
   if (getDimension() != 1) throw InvalidDimensionException(HERE) << "Error: the method computeScalarQuantile is only defined for 1D distributions";
@@ -1055,6 +1198,8 @@ void DistributionImplementation::setRange(const Interval & range)
 {
   if (range.getDimension() != dimension_) throw InvalidArgumentException(HERE) << "Error: the given range has a dimension incompatible with the dimension of the distribution.";
   range_ = range;
+  // The range is updated each time the parameters change, so are the sub-distributions
+  isAlreadyCreatedConditionalDistributions_ = false;
 }
 
 /* Compute the numerical range of the distribution given the parameters values */
@@ -1100,6 +1245,7 @@ void DistributionImplementation::computeMean() const
 /* Get the mean of the distribution */
 NumericalPoint DistributionImplementation::getMean() const
 {
+  CacheLock lock(*this);
   if (!isAlreadyComputedMean_) computeMean();
   return mean_;
 }
@@ -1235,6 +1381,7 @@ void DistributionImplementation::computeCovariance() const
 /* Get the covariance of the distribution */
 CovarianceMatrix DistributionImplementation::getCovariance() const
 {
+  CacheLock lock(*this);
   if (!isAlreadyComputedCovariance_) computeCovariance();
   return covariance_;
 }
@@ -1333,6 +1480,7 @@ UnsignedLong DistributionImplementation::getIntegrationNodesNumber() const
 
 void DistributionImplementation::setIntegrationNodesNumber(const UnsignedLong integrationNodesNumber) const
 {
+  CacheLock lock(*this);
   if (integrationNodesNumber != integrationNodesNumber_)
     {
       isAlreadyComputedMean_ = false;
@@ -1345,6 +1493,7 @@ void DistributionImplementation::setIntegrationNodesNumber(const UnsignedLong in
 /* Gauss nodes and weights accessor */
 NumericalSample DistributionImplementation::getGaussNodesAndWeights() const
 {
+  CacheLock lock(*this);
   if (!isAlreadyComputedGaussNodesAndWeights_) computeGaussNodesAndWeights();
   return gaussNodesAndWeights_;
 }
@@ -1352,6 +1501,7 @@ NumericalSample DistributionImplementation::getGaussNodesAndWeights() const
 /* Gauss nodes and weights accessor */
 NumericalPoint DistributionImplementation::getGaussNodesAndWeights(NumericalPoint & weights) const
 {
+  CacheLock lock(*this);
   if (!isAlreadyComputedGaussNodesAndWeights_) computeGaussNodesAndWeights();
   weights = gaussNodesAndWeights_[1];
   return gaussNodesAndWeights_[0];
@@ -1609,6 +1759,7 @@ void DistributionImplementation::computeStandardDistribution() const
 /* Get the standard distribution */
 DistributionImplementation::Implementation DistributionImplementation::getStandardDistribution() const
 {
+  CacheLock lock(*this);
   if (!isAlreadyComputedStandardDistribution_) computeStandardDistribution();
   return p_standardDistribution_;
 }
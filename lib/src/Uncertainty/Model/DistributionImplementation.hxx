@@ -39,6 +39,7 @@
 #include "PersistentCollection.hxx"
 #include "UniVariatePolynomial.hxx"
 #include "ResourceMap.hxx"
+#include "OTthread.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -285,6 +286,11 @@ public:
   virtual NumericalScalar computeConditionalQuantile(const NumericalScalar q,
                                                      const NumericalPoint & y) const;
 
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 for a whole set of conditioning points at once, i.e. the x[j] such that CDF(x[j]|y[j]) = q[j] with x = Xi, y = (X1,...,Xi-1).
+      The generic implementation inverts the whole column in a single root search */
+  virtual NumericalPoint computeConditionalQuantile(const NumericalPoint & q,
+                                                    const NumericalSample & y) const;
+
   /** Get the isoprobabilist transformation */
   virtual IsoProbabilisticTransformation getIsoProbabilisticTransformation() const;
 
@@ -417,21 +423,36 @@ protected:
                         const NumericalScalar xMax,
                         const UnsignedLong pointNumber) const;
 
-  /** Compute the PDF and CDF of Xi | X1, ..., Xi-1. x = Xi, y = (X1,...,Xi-1)
+  /** Compute the PDF and CDF of Xi | X1, ..., Xi-1. x = Xi, y = (X1,...,Xi-1), given the PDF of (X1,...,Xi-1) at y.
       Used to speed-up the computeConditionalQuantile() method */
   NumericalScalar computeConditionalPDFAndCDF(const NumericalScalar x,
                                               const NumericalPoint & y,
-                                              NumericalScalar & cdf,
-                                              const Implementation & conditioningDistribution,
+                                              const NumericalScalar pdfConditioning,
                                               const Implementation & conditionedDistribution,
-                                              const NumericalScalar xMin) const;
+                                              const NumericalSample & nodesAndWeights,
+                                              const NumericalScalar xMin,
+                                              NumericalScalar & cdf,
+                                              NumericalScalar & cdfEpsilon) const;
 
   /** Compute the CDF of Xi | X1, ..., Xi-1. x = Xi, y = (X1,...,Xi-1) with reuse of expansive data */
   NumericalScalar computeConditionalCDFForQuantile(const NumericalScalar x,
                                                    const NumericalPoint & y,
-                                                   const Implementation & conditioningDistribution,
+                                                   const NumericalScalar pdfConditioning,
                                                    const Implementation & conditionedDistribution,
-                                                   const NumericalScalar xMin) const;
+                                                   const NumericalSample & nodesAndWeights,
+                                                   const NumericalScalar xMin,
+                                                   NumericalScalar & cdfEpsilon) const;
+
+  /** Compute the quantiles of Xi | X1, ..., Xi-1 one conditioning point at a time, for the distributions with a closed-form conditional quantile */
+  NumericalPoint computeConditionalQuantileByPoint(const NumericalPoint & q,
+                                                   const NumericalSample & y) const;
+
+  /** Get the sub-distributions involved in the conditioning of Xi by X1, ..., Xi-1 with i = conditioningDimension + 1:
+      the marginal distribution of Xi, of (X1,...,Xi-1) and of (X1,...,Xi). They are built at the first request then cached */
+  void getConditionalDistributions(const UnsignedLong conditioningDimension,
+                                   Implementation & marginalDistribution,
+                                   Implementation & conditioningDistribution,
+                                   Implementation & conditionedDistribution) const;
 
   /** Compute the characteristic function of 1D distributions in a regular pattern with cache */
   virtual NumericalComplex computeCharacteristicFunction(const UnsignedLong index,
@@ -467,6 +488,47 @@ protected:
   /** Compute the standard distribution associated with the current distribution */
   virtual void computeStandardDistribution() const;
 
+  /** Recursive mutex owned by each distribution, a copy getting its own one */
+  class CacheMutex
+  {
+  public:
+    CacheMutex();
+    CacheMutex(const CacheMutex & other);
+    CacheMutex & operator = (const CacheMutex & other);
+    ~CacheMutex();
+    pthread_mutex_t mutex_;
+  }; /* class CacheMutex */
+
+  /** Scoped lock guarding the lazy computation of the mutable caches of a distribution.
+      All the const methods that fill a cache must hold it, so that a single
+      distribution can be evaluated concurrently by several threads. The
+      mutex is recursive as the computation of a cache often needs another one. */
+  class CacheLock
+  {
+  public:
+    CacheLock(const DistributionImplementation & distribution);
+    ~CacheLock();
+  private:
+    CacheLock(const CacheLock & other);
+    CacheLock & operator = (const CacheLock & other);
+    pthread_mutex_t & mutex_;
+  }; /* class CacheLock */
+
+  /** Scalar read and written atomically, for the precisions updated by the const evaluations */
+  class AtomicScalar
+  {
+  public:
+    AtomicScalar(const NumericalScalar value = 0.0);
+    AtomicScalar(const AtomicScalar & other);
+    AtomicScalar & operator = (const AtomicScalar & other);
+    AtomicScalar & operator = (const NumericalScalar value);
+    operator NumericalScalar () const;
+  private:
+    NumericalScalar value_;
+  }; /* class AtomicScalar */
+
+  mutable CacheMutex cacheMutex_;
+
   mutable NumericalPoint mean_;
   mutable CovarianceMatrix covariance_;
   mutable NumericalSample gaussNodesAndWeights_;
@@ -479,9 +541,10 @@ protected:
   mutable Bool isAlreadyComputedCovariance_;
   mutable Bool isAlreadyComputedGaussNodesAndWeights_;
 
-  /** Indicators for PDF and CDF absolute precision. By default, equals to DefaultPDFEpsilon, DefaultCDFEpsilon and DefaultQuantileEpsilon */
-  mutable NumericalScalar pdfEpsilon_;
-  mutable NumericalScalar cdfEpsilon_;
+  /** Indicators for PDF and CDF absolute precision. By default, equals to DefaultPDFEpsilon, DefaultCDFEpsilon and DefaultQuantileEpsilon.
+      The PDF and CDF ones are updated by the evaluations with the precision they reached, each update being a single atomic store */
+  mutable AtomicScalar pdfEpsilon_;
+  mutable AtomicScalar cdfEpsilon_;
   mutable NumericalScalar quantileEpsilon_;
 
   /** Standard distribution */
@@ -502,6 +565,12 @@ protected:
   mutable Bool isAlreadyCreatedGeneratingFunction_;
   mutable UniVariatePolynomial generatingFunction_;
 
+  /** Optimization for the generic conditional computations: the 1D marginal distributions
+      and the marginal distributions of the leading components (X1,...,Xi), built on demand */
+  mutable Bool isAlreadyCreatedConditionalDistributions_;
+  mutable Collection<Implementation> conditionalMarginals_;
+  mutable Collection<Implementation> conditionedDistributions_;
+
 private:
 
   // Structure used to wrap the computePDF() method for drawing purpose
@@ -32,7 +32,8 @@
 #include "OTconfig.hxx"
 #include "Log.hxx"
 #include "Os.hxx"
-#include "BootstrapExperiment.hxx"
+#include "RandomGenerator.hxx"
+#include "TBB.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -76,30 +77,61 @@ DistributionImplementationFactory::Implementation DistributionImplementationFact
   throw NotYetImplementedException(HERE);
 }
 
+/* Functor computing bootstrap estimates of the parameters, each one with its own random stream */
+struct BootstrapParametersFunctor
+{
+  const DistributionImplementationFactory & factory_;
+  const NumericalSample & sample_;
+  const RandomGenerator::UnsignedLongCollection & seeds_;
+  NumericalSample & parametersSample_;
+
+  BootstrapParametersFunctor(const DistributionImplementationFactory & factory,
+                             const NumericalSample & sample,
+                             const RandomGenerator::UnsignedLongCollection & seeds,
+                             NumericalSample & parametersSample)
+    : factory_(factory), sample_(sample), seeds_(seeds), parametersSample_(parametersSample) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    const UnsignedLong size(sample_.getSize());
+    for (UnsignedLong i = r.begin(); i != r.end(); ++i)
+      {
+        RandomGenerator::MersenneTwister generator(seeds_[i]);
+        const RandomGenerator::LocalStream stream(generator);
+        // Only the indices of the resample are drawn, the points are accessed through them by the factory
+        const RandomGenerator::UnsignedLongCollection drawnIndices(RandomGenerator::IntegerGenerate(size, size));
+        const Indices indices(drawnIndices.begin(), drawnIndices.end());
+        parametersSample_[i] = factory_.computeBootstrapParameters(sample_, indices);
+      }
+  }
+}; /* end struct BootstrapParametersFunctor */
+
 /* Build a distribution based on a sample and gives the covariance matrix of the estimate */
 DistributionImplementationFactory::Implementation DistributionImplementationFactory::build(const NumericalSample & sample,
                                                                                            CovarianceMatrix & covariance) const
 {
-  /* The bootstrap sampler */
-  BootstrapExperiment bootstrap(sample);
   /* Build the distribution based on the given sample */
-  DistributionImplementationFactory::Implementation distribution(build(sample));
-  const UnsignedLong bootstrapSize(ResourceMap::GetAsUnsignedLong("DistributionImplementationFactory-DefaultBootstrapSize"));
-  NumericalSample parametersSample(bootstrapSize, ParametersAsNumericalPoint(distribution->getParametersCollection()));
-  for (UnsignedLong i = 1; i < bootstrapSize; ++i)
-    {
-      /* Draw a bootstrap sample */
-      const NumericalSample bootstrapSample(bootstrap.generate());
-      /* Build the associated distribution */
-      const DistributionImplementation::Implementation newDistribution(build(bootstrapSample));
-      /* Add the parameters to the parameters sample */
-      parametersSample.add(ParametersAsNumericalPoint(newDistribution->getParametersCollection()));
-    }
+  const Implementation distribution(build(sample));
+  const UnsignedLong parametersDimension(ParametersAsNumericalPoint(distribution->getParametersCollection()).getDimension());
+  /* The seeds of the resamples are drawn in order from the global random stream, so the result does not depend on the scheduling of the resamples */
+  const RandomGenerator::UnsignedLongCollection seeds(RandomGenerator::IntegerGenerate(bootstrapSize_, 4294967295UL));
+  NumericalSample parametersSample(bootstrapSize_, parametersDimension);
+  const BootstrapParametersFunctor functor(*this, sample, seeds, parametersSample);
+  TBB::ParallelFor(0, bootstrapSize_, functor);
   /* Compute the bootstrap covariance */
   covariance = parametersSample.computeCovariance();
   return distribution;
 }
 
+/* Compute the parameters estimated on the bootstrap resample made of the points of the given sample with the given indices */
+NumericalPoint DistributionImplementationFactory::computeBootstrapParameters(const NumericalSample & sample,
+                                                                             const Indices & indices) const
+{
+  const UnsignedLong size(indices.getSize());
+  NumericalSample resample(size, sample.getDimension());
+  for (UnsignedLong i = 0; i < size; ++i) resample[i] = sample[indices[i]];
+  return ParametersAsNumericalPoint(build(resample)->getParametersCollection());
+}
 
 /* Build a distribution based on a set of parameters */
 DistributionImplementationFactory::Implementation DistributionImplementationFactory::build(const NumericalPointCollection & parameters) const
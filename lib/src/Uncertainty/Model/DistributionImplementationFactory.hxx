@@ -31,6 +31,7 @@
 #include "CovarianceMatrix.hxx"
 #include "PersistentObject.hxx"
 #include "ResourceMap.hxx"
+#include "Indices.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -85,6 +86,10 @@ protected:
   virtual NumericalPoint runRFactory(const NumericalSample & sample,
                                      const DistributionImplementation & distribution) const;
 
+  /* Compute the parameters estimated on the bootstrap resample made of the points of the given sample with the given indices */
+  virtual NumericalPoint computeBootstrapParameters(const NumericalSample & sample,
+                                                    const Indices & indices) const;
+
   /* Number of bootstrap resampling for ovariance estimation */
   UnsignedLong bootstrapSize_;
 
@@ -97,6 +102,8 @@ protected:
   /* Convert a parameters collection into a NumericalPoint */
   static NumericalPoint ParametersAsNumericalPoint(const NumericalPointWithDescriptionCollection & parametersCollection);
 
+  friend struct BootstrapParametersFunctor;
+
 }; /* class DistributionImplementationFactory */
 
 
@@ -34,6 +34,7 @@
 #include "Lapack.hxx"
 #include "IdentityMatrix.hxx"
 #include "ResourceMap.hxx"
+#include "SpecFunc.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -142,6 +143,14 @@ NumericalScalar EllipticalDistribution::computeDensityGenerator(const NumericalS
   throw NotYetImplementedException(HERE);
 }
 
+/* Compute the logarithm of the density generator */
+NumericalScalar EllipticalDistribution::computeLogDensityGenerator(const NumericalScalar betaSquare) const
+{
+  const NumericalScalar densityGenerator(computeDensityGenerator(betaSquare));
+  if (densityGenerator > 0.0) return log(densityGenerator);
+  return -SpecFunc::MaxNumericalScalar;
+}
+
 /* Compute the derivative of the density generator */
 NumericalScalar EllipticalDistribution::computeDensityGeneratorDerivative(const NumericalScalar betaSquare) const
 {
@@ -174,6 +183,38 @@ NumericalScalar EllipticalDistribution::computePDF(const NumericalPoint & point)
   return normalizationFactor_ * computeDensityGenerator(betaSquare);
 }
 
+/* Get the log-PDF of the distribution */
+NumericalScalar EllipticalDistribution::computeLogPDF(const NumericalPoint & point) const
+{
+  const NumericalPoint iLx(inverseCholesky_ * (point - mean_));
+  const NumericalScalar betaSquare(iLx.norm2());
+  return log(normalizationFactor_) + computeLogDensityGenerator(betaSquare);
+}
+
+/* Get the log-PDF of a sample. The whole sample is whitened by a single
+   matrix product instead of one matrix-vector product per point */
+NumericalSample EllipticalDistribution::computeLogPDF(const NumericalSample & sample) const
+{
+  const UnsignedLong size(sample.getSize());
+  const UnsignedLong dimension(getDimension());
+  if (sample.getDimension() != dimension) throw InvalidArgumentException(HERE) << "Error: the given sample has an invalid dimension. Expect a dimension " << dimension << ", got " << sample.getDimension();
+  NumericalSample result(size, 1);
+  if (size == 0) return result;
+  Matrix centered(dimension, size);
+  for (UnsignedLong j = 0; j < size; ++j)
+    for (UnsignedLong i = 0; i < dimension; ++i)
+      centered(i, j) = sample[j][i] - mean_[i];
+  const Matrix iLx(inverseCholesky_ * centered);
+  const NumericalScalar logNormalizationFactor(log(normalizationFactor_));
+  for (UnsignedLong j = 0; j < size; ++j)
+    {
+      NumericalScalar betaSquare(0.0);
+      for (UnsignedLong i = 0; i < dimension; ++i) betaSquare += iLx(i, j) * iLx(i, j);
+      result[j][0] = logNormalizationFactor + computeLogDensityGenerator(betaSquare);
+    }
+  return result;
+}
+
 /* Get the PDF gradient of the distribution */
 NumericalPoint EllipticalDistribution::computePDFGradient(const NumericalPoint & point) const
 {
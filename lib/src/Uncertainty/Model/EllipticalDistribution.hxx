@@ -78,6 +78,11 @@ public:
   using ContinuousDistribution::computePDF;
   NumericalScalar computePDF(const NumericalPoint & point) const;
 
+  /** Get the log-PDF of the distribution */
+  using ContinuousDistribution::computeLogPDF;
+  NumericalScalar computeLogPDF(const NumericalPoint & point) const;
+  NumericalSample computeLogPDF(const NumericalSample & sample) const;
+
   /** Get the PDF gradient of the distribution */
   NumericalPoint computePDFGradient(const NumericalPoint & point) const;
 
@@ -86,6 +91,9 @@ public:
    *  be written as p(x) = phi(t(x-mu)R^{-1}(x-mu))                      */
   virtual NumericalScalar computeDensityGenerator(const NumericalScalar betaSquare) const;
 
+  /** Compute the logarithm of the density generator */
+  virtual NumericalScalar computeLogDensityGenerator(const NumericalScalar betaSquare) const;
+
   /** Compute the derivative of the density generator */
   virtual NumericalScalar computeDensityGeneratorDerivative(const NumericalScalar betaSquare) const;
 
@@ -137,7 +137,7 @@ TimeSeries ProcessImplementation::getRealization() const
 ProcessSample ProcessImplementation::getSample(const UnsignedLong size) const
 {
   ProcessSample result(timeGrid_, size, dimension_);
-  for (UnsignedLong i = 0; i < size; ++i) result[i] = getRealization();
+  for (UnsignedLong i = 0; i < size; ++i) result.setTimeSeries(i, getRealization());
   return result;
 }
 
@@ -152,7 +152,7 @@ ProcessSample ProcessImplementation::getFuture(const UnsignedLong stepNumber,
 {
   if (size == 0) return ProcessSample(timeGrid_, 0, dimension_);
   ProcessSample result(size, getFuture(stepNumber));
-  for (UnsignedLong i = 1; i < size; ++i) result[i] = getFuture(stepNumber);
+  for (UnsignedLong i = 1; i < size; ++i) result.setTimeSeries(i, getFuture(stepNumber));
   return result;
 }
 
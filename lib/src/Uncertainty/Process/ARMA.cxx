@@ -29,6 +29,8 @@
 #include "Normal.hxx"
 #include "SpecFunc.hxx"
 #include "Collection.hxx"
+#include "ResourceMap.hxx"
+#include "TBB.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -299,6 +301,137 @@ TimeSeries ARMA::getRealization() const
   return TimeSeries(timeGrid_, newState.getX().split(p_));
 }
 
+/* Functor running the ARMA recurrence over a range of trajectories of a block.
+   The values are stored time after time, the trajectories being contiguous for a given time
+   stamp: the inner loops run along the trajectories and can be vectorized. */
+struct ARMASampleFunctor
+{
+  const NumericalPoint & ARCoefficients_;
+  const NumericalPoint & MACoefficients_;
+  const UnsignedLong p_;
+  const UnsignedLong q_;
+  const UnsignedLong dimension_;
+  const UnsignedLong length_;
+  const UnsignedLong count_;
+  const NumericalPoint & epsilon_;
+  NumericalPoint & x_;
+
+  ARMASampleFunctor(const NumericalPoint & ARCoefficients,
+                    const NumericalPoint & MACoefficients,
+                    const UnsignedLong p,
+                    const UnsignedLong q,
+                    const UnsignedLong dimension,
+                    const UnsignedLong length,
+                    const UnsignedLong count,
+                    const NumericalPoint & epsilon,
+                    NumericalPoint & x)
+    : ARCoefficients_(ARCoefficients), MACoefficients_(MACoefficients), p_(p), q_(q), dimension_(dimension)
+    , length_(length), count_(count), epsilon_(epsilon), x_(x) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    const UnsignedLong stride(count_ * dimension_);
+    const UnsignedLong begin(r.begin() * dimension_);
+    const UnsignedLong end(r.end() * dimension_);
+    for (UnsignedLong t = 0; t < length_; ++t)
+      {
+        NumericalScalar * current(&x_[(p_ + t) * stride]);
+        const NumericalScalar * noise(&epsilon_[(q_ + t) * stride]);
+        for (UnsignedLong rowIndex = 0; rowIndex < dimension_; ++rowIndex)
+          {
+            for (UnsignedLong k = begin + rowIndex; k < end; k += dimension_) current[k] = noise[k];
+            // AR part computation : - \sum_{i=0}^{p-1} A[i] * X_{t-i-1}
+            for (UnsignedLong i = 0; i < p_; ++i)
+              {
+                const NumericalScalar * past(&x_[(p_ + t - i - 1) * stride]);
+                for (UnsignedLong columnIndex = 0; columnIndex < dimension_; ++columnIndex)
+                  {
+                    const NumericalScalar coefficient(ARCoefficients_[(i * dimension_ + rowIndex) * dimension_ + columnIndex]);
+                    for (UnsignedLong k = begin; k < end; k += dimension_) current[k + rowIndex] -= coefficient * past[k + columnIndex];
+                  }
+              }
+            // MA part computation : \sum_{i=0}^{q-1} B[i] * \epsilon_{t-i-1}
+            for (UnsignedLong i = 0; i < q_; ++i)
+              {
+                const NumericalScalar * pastNoise(&epsilon_[(q_ + t - i - 1) * stride]);
+                for (UnsignedLong columnIndex = 0; columnIndex < dimension_; ++columnIndex)
+                  {
+                    const NumericalScalar coefficient(MACoefficients_[(i * dimension_ + rowIndex) * dimension_ + columnIndex]);
+                    for (UnsignedLong k = begin; k < end; k += dimension_) current[k + rowIndex] += coefficient * pastNoise[k + columnIndex];
+                  }
+              }
+          }
+      }
+  }
+}; /* end struct ARMASampleFunctor */
+
+/* Sample accessor */
+ProcessSample ARMA::getSample(const UnsignedLong size) const
+{
+  // Each trajectory is thermalized from the current state, then the state is updated with
+  // the end of the last trajectory, as if the realizations had been generated one by one.
+  // The noise is sampled block by block in order to bound the memory footprint, and the
+  // recurrence runs in parallel over the trajectories of each block.
+  const UnsignedLong steps(timeGrid_.getN());
+  const UnsignedLong nThermalization(getNThermalization());
+  const UnsignedLong length(nThermalization + steps);
+  const UnsignedLong blockSize(std::max(ResourceMap::GetAsUnsignedLong("ARMA-SampleBlockSize"), 1UL));
+  NumericalPoint ARCoefficients(p_ * dimension_ * dimension_);
+  for (UnsignedLong i = 0; i < p_; ++i)
+    for (UnsignedLong rowIndex = 0; rowIndex < dimension_; ++rowIndex)
+      for (UnsignedLong columnIndex = 0; columnIndex < dimension_; ++columnIndex)
+        ARCoefficients[(i * dimension_ + rowIndex) * dimension_ + columnIndex] = ARCoefficients_[i](rowIndex, columnIndex);
+  NumericalPoint MACoefficients(q_ * dimension_ * dimension_);
+  for (UnsignedLong i = 0; i < q_; ++i)
+    for (UnsignedLong rowIndex = 0; rowIndex < dimension_; ++rowIndex)
+      for (UnsignedLong columnIndex = 0; columnIndex < dimension_; ++columnIndex)
+        MACoefficients[(i * dimension_ + rowIndex) * dimension_ + columnIndex] = MACoefficients_[i](rowIndex, columnIndex);
+  const NumericalSample initialX(state_.getX());
+  const NumericalSample initialEpsilon(state_.getEpsilon());
+  ProcessSample result(timeGrid_, size, dimension_);
+  for (UnsignedLong first = 0; first < size; first += blockSize)
+    {
+      const UnsignedLong count(std::min(blockSize, size - first));
+      const UnsignedLong stride(count * dimension_);
+      // x[((p_ + t) * count + j) * dimension_ + k] is the kth component of the jth trajectory at time t,
+      // with the same convention for the noise with q_ instead of p_
+      NumericalPoint x((p_ + length) * stride);
+      NumericalPoint epsilon((q_ + length) * stride);
+      for (UnsignedLong t = 0; t < p_; ++t)
+        for (UnsignedLong j = 0; j < count; ++j)
+          for (UnsignedLong k = 0; k < dimension_; ++k) x[t * stride + j * dimension_ + k] = initialX[t][k];
+      for (UnsignedLong t = 0; t < q_; ++t)
+        for (UnsignedLong j = 0; j < count; ++j)
+          for (UnsignedLong k = 0; k < dimension_; ++k) epsilon[t * stride + j * dimension_ + k] = initialEpsilon[t][k];
+      const NumericalSample noise(noiseDistribution_.getSample(length * count));
+      UnsignedLong index(q_ * stride);
+      for (UnsignedLong i = 0; i < length * count; ++i)
+        for (UnsignedLong k = 0; k < dimension_; ++k)
+          {
+            epsilon[index] = noise[i][k];
+            ++index;
+          }
+      const ARMASampleFunctor functor(ARCoefficients, MACoefficients, p_, q_, dimension_, length, count, epsilon, x);
+      TBB::ParallelFor(0, count, functor);
+      // Only the values after the thermalization are kept
+      for (UnsignedLong j = 0; j < count; ++j)
+        for (UnsignedLong t = 0; t < steps; ++t)
+          for (UnsignedLong k = 0; k < dimension_; ++k) result(first + j, t, k) = x[(p_ + nThermalization + t) * stride + j * dimension_ + k];
+      // The state is the end of the last trajectory
+      if (first + count == size)
+        {
+          NumericalSample lastX(p_, dimension_);
+          for (UnsignedLong t = 0; t < p_; ++t)
+            for (UnsignedLong k = 0; k < dimension_; ++k) lastX[t][k] = x[(length + t) * stride + (count - 1) * dimension_ + k];
+          NumericalSample lastEpsilon(q_, dimension_);
+          for (UnsignedLong t = 0; t < q_; ++t)
+            for (UnsignedLong k = 0; k < dimension_; ++k) lastEpsilon[t][k] = epsilon[(length + t) * stride + (count - 1) * dimension_ + k];
+          setState(ARMAState(lastX, lastEpsilon));
+        }
+    }
+  return result;
+}
+
 // Prediction of the futur of an ARMA process
 // possible futur changes
 TimeSeries ARMA::getFuture(const UnsignedLong stepNumber) const
@@ -86,6 +86,9 @@ public:
   /** Realization accessor */
   TimeSeries getRealization() const;
 
+  /** Sample accessor: the trajectories are generated by blocks, the recurrence running over all the trajectories of a block at once */
+  ProcessSample getSample(const UnsignedLong size) const;
+
   /** Prediction of the N futur iterations of an ARMA process */
   using ProcessImplementation::getFuture;
   TimeSeries getFuture(const UnsignedLong stepNumber) const;
@@ -36,6 +36,7 @@
 #include "WhittleFactory.hxx"
 #include "Lapack.hxx"
 #include "ResourceMap.hxx"
+#include "DualNumber.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -478,6 +479,322 @@ int modifiedCholeskyDecomposition(SquareMatrix &matrix,
   return 0;
 }
 
+/*
+ * Solve the discrete Lyapunov equation P = T P T^{T} + R R^{T} giving the stationary covariance of the
+ * state of the univariate ARMA state space model, where T is the companion matrix with first column phi
+ * and R the vector (1, theta_1, ..., theta_{r-1}). The equation is solved as the linear system
+ * (I - T \otimes T) vec(P) = vec(R R^{T}) by a Gauss elimination with partial pivoting, written against
+ * a templated scalar type to be differentiable.
+ */
+template <class S>
+static Collection<S> ComputeStationaryStateCovariance(const Collection<S> & phi,
+                                                      const Collection<S> & r)
+{
+  const UnsignedLong stateDimension(phi.getSize());
+  const UnsignedLong size(stateDimension * stateDimension);
+  // T(i, k) = phi_i 1_{k=0} + 1_{k=i+1}
+  Collection<S> t(size, S(0.0));
+  for (UnsignedLong i = 0; i < stateDimension; ++i)
+    {
+      t[i * stateDimension] = phi[i];
+      if (i + 1 < stateDimension) t[i * stateDimension + i + 1] += S(1.0);
+    }
+  Collection<S> a(size * size, S(0.0));
+  Collection<S> b(size);
+  for (UnsignedLong i = 0; i < stateDimension; ++i)
+    for (UnsignedLong j = 0; j < stateDimension; ++j)
+      {
+        const UnsignedLong row(i * stateDimension + j);
+        b[row] = r[i] * r[j];
+        a[row * size + row] = S(1.0);
+        for (UnsignedLong k = 0; k < stateDimension; ++k)
+          for (UnsignedLong l = 0; l < stateDimension; ++l)
+            a[row * size + k * stateDimension + l] -= t[i * stateDimension + k] * t[j * stateDimension + l];
+      }
+  // Forward elimination
+  for (UnsignedLong k = 0; k < size; ++k)
+    {
+      UnsignedLong pivot(k);
+      for (UnsignedLong i = k + 1; i < size; ++i)
+        if (fabs(a[i * size + k]) > fabs(a[pivot * size + k])) pivot = i;
+      if (pivot != k)
+        {
+          for (UnsignedLong j = k; j < size; ++j) std::swap(a[k * size + j], a[pivot * size + j]);
+          std::swap(b[k], b[pivot]);
+        }
+      for (UnsignedLong i = k + 1; i < size; ++i)
+        {
+          const S factor(a[i * size + k] / a[k * size + k]);
+          for (UnsignedLong j = k + 1; j < size; ++j) a[i * size + j] -= factor * a[k * size + j];
+          b[i] -= factor * b[k];
+        }
+    }
+  // Back substitution
+  Collection<S> p(size);
+  for (UnsignedLong k = size; k > 0; --k)
+    {
+      S value(b[k - 1]);
+      for (UnsignedLong j = k; j < size; ++j) value -= a[(k - 1) * size + j] * p[j];
+      p[k - 1] = value / a[(k - 1) * size + k - 1];
+    }
+  return p;
+}
+
+/*
+ * Exact log-likelihood of a univariate ARMA(p, q) model with the white noise variance profiled out:
+ *   \log L = -\frac{n}{2}(\log(2\pi) + 1 + \log\hat{\sigma}^2) - \frac{1}{2}\sum_{t=1}^n\log F_t,  \hat{\sigma}^2 = \frac{1}{n}\sum_{t=1}^n\frac{v_t^2}{F_t}
+ * where the innovations v_t and their normalized variances F_t are given by the Kalman filter of the
+ * state space representation of dimension r = max(p, q + 1):
+ *   X_t = \alpha_t(0), \alpha_{t+1} = T\alpha_t + R\epsilon_{t+1}
+ * initialized with the stationary distribution of the state. Each step costs O(r^2) operations, and once
+ * the variance F_t has converged the gain is frozen and each step costs O(r) operations.
+ * The function is written against a templated scalar type, so that its gradient is obtained exactly by
+ * forward mode differentiation.
+ */
+template <class S>
+static S ComputeKalmanLogLikelihood(const Collection<S> & beta,
+                                    const UnsignedLong p,
+                                    const UnsignedLong q,
+                                    const NumericalPoint & values,
+                                    const NumericalScalar steadyStateEpsilon,
+                                    S & sigma2)
+{
+  const UnsignedLong stateDimension(std::max(p, q + 1));
+  // Sign conventions: X_t = \sum_i \phi_i X_{t-i} + E_t + \sum_j \theta_j E_{t-j}
+  Collection<S> phi(stateDimension, S(0.0));
+  for (UnsignedLong i = 0; i < p; ++i) phi[i] = -beta[i];
+  Collection<S> r(stateDimension, S(0.0));
+  r[0] = S(1.0);
+  for (UnsignedLong j = 0; j < q; ++j) r[j + 1] = beta[p + j];
+  Collection<S> covariance(ComputeStationaryStateCovariance(phi, r));
+  Collection<S> state(stateDimension, S(0.0));
+  Collection<S> gain(stateDimension);
+  Collection<S> product(stateDimension * stateDimension);
+  S sumSquares(0.0);
+  S sumLogF(0.0);
+  S f(covariance[0]);
+  S previousF(f);
+  const UnsignedLong size(values.getDimension());
+  UnsignedLong t(0);
+  // Full Kalman filter until the steady state is reached
+  for (; t < size; ++t)
+    {
+      f = covariance[0];
+      if ((t > 0) && (fabs(f - previousF) <= steadyStateEpsilon * f)) break;
+      previousF = f;
+      const S v(values[t] - state[0]);
+      sumSquares += v * v / f;
+      sumLogF += log(f);
+      // (T P)(i, j) = \phi_i P(0, j) + P(i + 1, j)
+      for (UnsignedLong i = 0; i < stateDimension; ++i)
+        for (UnsignedLong j = 0; j < stateDimension; ++j)
+          {
+            product[i * stateDimension + j] = phi[i] * covariance[j];
+            if (i + 1 < stateDimension) product[i * stateDimension + j] += covariance[(i + 1) * stateDimension + j];
+          }
+      // K = T P Z^{T} / F and a <- T a + K v
+      const S a0(state[0]);
+      for (UnsignedLong i = 0; i < stateDimension; ++i)
+        {
+          gain[i] = product[i * stateDimension] / f;
+          state[i] = phi[i] * a0 + (i + 1 < stateDimension ? state[i + 1] : S(0.0)) + gain[i] * v;
+        }
+      // P <- T P T^{T} + R R^{T} - K K^{T} F, with (T P T^{T})(i, j) = (T P)(i, 0) \phi_j + (T P)(i, j + 1)
+      for (UnsignedLong i = 0; i < stateDimension; ++i)
+        for (UnsignedLong j = 0; j < stateDimension; ++j)
+          {
+            S value(product[i * stateDimension] * phi[j] + r[i] * r[j] - gain[i] * gain[j] * f);
+            if (j + 1 < stateDimension) value += product[i * stateDimension + j + 1];
+            covariance[i * stateDimension + j] = value;
+          }
+    }
+  // Steady state: the gain and the variance of the innovations no longer change
+  if (t < size)
+    {
+      for (UnsignedLong i = 0; i < stateDimension; ++i) gain[i] = (phi[i] * covariance[0] + (i + 1 < stateDimension ? covariance[(i + 1) * stateDimension] : S(0.0))) / f;
+      const S logF(log(f));
+      for (; t < size; ++t)
+        {
+          const S v(values[t] - state[0]);
+          sumSquares += v * v / f;
+          sumLogF += logF;
+          const S a0(state[0]);
+          for (UnsignedLong i = 0; i < stateDimension; ++i) state[i] = phi[i] * a0 + (i + 1 < stateDimension ? state[i + 1] : S(0.0)) + gain[i] * v;
+        }
+    }
+  const NumericalScalar n(size);
+  sigma2 = sumSquares / n;
+  return -0.5 * (n * (log(2.0 * M_PI) + 1.0 + log(sigma2)) + sumLogF);
+}
+
+/* Spectral radius of the companion matrix of z^n + c_1 z^{n-1} + ... + c_n */
+static NumericalScalar ComputeCompanionSpectralRadius(const NumericalPoint & coefficients)
+{
+  const UnsignedLong n(coefficients.getDimension());
+  SquareMatrix matrix(n);
+  for (UnsignedLong i = 0; i < n; ++i) matrix(0, i) = -coefficients[i];
+  for (UnsignedLong i = 1; i < n; ++i) matrix(i, i - 1) = 1.0;
+  const Collection<NumericalComplex> eigenValues(matrix.computeEigenValues(false));
+  NumericalScalar s(std::norm(eigenValues[0]));
+  for (UnsignedLong i = 1; i < eigenValues.getSize() ; ++i) s = std::max(s, std::norm(eigenValues[i]));
+  return std::sqrt(s);
+}
+
+/* Data passed to cobyla for the univariate exact likelihood */
+struct ARMALikelihoodFactoryExactState
+{
+  const ARMALikelihoodFactory * p_factory_;
+  const NumericalPoint * p_values_;
+};
+
+/* objective function ==> exact likelihood of a univariate model */
+int ARMALikelihoodFactory::ComputeExactObjectiveAndConstraint(int n,
+                                                              int m,
+                                                              double *x,
+                                                              double *f,
+                                                              double *con,
+                                                              void *state)
+{
+  const NumericalScalar epsilon(ResourceMap::GetAsNumericalScalar("ARMALikelihoodFactory-RootEpsilon"));
+  const ARMALikelihoodFactoryExactState * exactState = static_cast<const ARMALikelihoodFactoryExactState *>(state);
+  const ARMALikelihoodFactory * factory = exactState->p_factory_;
+  const UnsignedLong p(factory->currentP_);
+  const UnsignedLong q(factory->currentQ_);
+  NumericalPoint beta(n);
+  for (UnsignedLong k = 0; k < static_cast<UnsignedLong>(n); ++k) beta[k] = x[k];
+  UnsignedLong constraintIndex(0);
+  // If not pure MA, the roots of the AR polynom must be outside of the unit circle
+  if (p > 0)
+    {
+      NumericalPoint arCoefficients(p);
+      for (UnsignedLong i = 0; i < p; ++i) arCoefficients[i] = beta[i];
+      const NumericalScalar radius(ComputeCompanionSpectralRadius(arCoefficients));
+      con[constraintIndex] = 1.0 - radius - epsilon;
+      ++constraintIndex;
+      // The stationary covariance does not exist outside of the stationarity domain, so the likelihood is
+      // evaluated at the AR coefficients scaled back to its boundary: a_i -> a_i c^i scales the roots by c
+      if (radius > 1.0 - epsilon)
+        {
+          const NumericalScalar scaling((1.0 - epsilon) / radius);
+          NumericalScalar factor(1.0);
+          for (UnsignedLong i = 0; i < p; ++i)
+            {
+              factor *= scaling;
+              beta[i] *= factor;
+            }
+        }
+    }
+  // If invertible and not pure AR, the same for the MA polynom
+  if (factory->getInvertible() && q > 0)
+    {
+      NumericalPoint maCoefficients(q);
+      for (UnsignedLong i = 0; i < q; ++i) maCoefficients[i] = beta[p + i];
+      con[constraintIndex] = 1.0 - ComputeCompanionSpectralRadius(maCoefficients) - epsilon;
+    }
+  NumericalScalar sigma2(0.0);
+  *f = -ComputeKalmanLogLikelihood(Collection<NumericalScalar>(beta.begin(), beta.end()), p, q, *(exactState->p_values_), ResourceMap::GetAsNumericalScalar("ARMALikelihoodFactory-KalmanSteadyStateEpsilon"), sigma2);
+  return 0;
+}
+
+/* Values of a univariate time series, checking the consistency of beta with the current orders */
+NumericalPoint ARMALikelihoodFactory::getUnivariateValues(const TimeSeries & timeSeries,
+                                                          const NumericalPoint & beta) const
+{
+  if (timeSeries.getDimension() != 1) throw InvalidDimensionException(HERE) << "Error: the exact likelihood is implemented for univariate time series only, here time series is of dimension " << timeSeries.getDimension();
+  if (beta.getDimension() != currentP_ + currentQ_) throw InvalidArgumentException(HERE) << "Error: expected coefficients of dimension " << currentP_ + currentQ_ << ", got dimension " << beta.getDimension();
+  const NumericalSample sample(timeSeries.getSample());
+  const UnsignedLong size(sample.getSize());
+  NumericalPoint values(size);
+  for (UnsignedLong i = 0; i < size; ++i) values[i] = sample[i][0];
+  return values;
+}
+
+/* Exact log-likelihood of a univariate ARMA model */
+NumericalScalar ARMALikelihoodFactory::computeExactLogLikelihood(const TimeSeries & timeSeries,
+                                                                 const NumericalPoint & beta) const
+{
+  const NumericalPoint values(getUnivariateValues(timeSeries, beta));
+  NumericalScalar sigma2(0.0);
+  return ComputeKalmanLogLikelihood(Collection<NumericalScalar>(beta.begin(), beta.end()), currentP_, currentQ_, values, ResourceMap::GetAsNumericalScalar("ARMALikelihoodFactory-KalmanSteadyStateEpsilon"), sigma2);
+}
+
+/* Gradient of the exact log-likelihood, one forward mode sweep per coefficient */
+NumericalPoint ARMALikelihoodFactory::computeExactLogLikelihoodGradient(const TimeSeries & timeSeries,
+                                                                        const NumericalPoint & beta) const
+{
+  typedef DualNumber<NumericalScalar> Dual;
+  const NumericalPoint values(getUnivariateValues(timeSeries, beta));
+  const NumericalScalar steadyStateEpsilon(ResourceMap::GetAsNumericalScalar("ARMALikelihoodFactory-KalmanSteadyStateEpsilon"));
+  const UnsignedLong dimension(beta.getDimension());
+  Collection<Dual> dualBeta(dimension);
+  for (UnsignedLong i = 0; i < dimension; ++i) dualBeta[i] = Dual(beta[i], 0.0);
+  NumericalPoint gradient(dimension);
+  for (UnsignedLong i = 0; i < dimension; ++i)
+    {
+      dualBeta[i].setDerivative(1.0);
+      Dual sigma2(0.0);
+      gradient[i] = ComputeKalmanLogLikelihood(dualBeta, currentP_, currentQ_, values, steadyStateEpsilon, sigma2).getDerivative();
+      dualBeta[i].setDerivative(0.0);
+    }
+  return gradient;
+}
+
+/* Univariate estimate based on the exact likelihood, starting from the given initial conditions or from the Whittle estimate */
+ARMA * ARMALikelihoodFactory::buildUnivariate(const TimeSeries & timeSeries) const
+{
+  const UnsignedLong n(currentP_ + currentQ_);
+  NumericalPoint beta(n);
+  if (hasInitializedARCoefficients_ && hasInitializedMACoefficients_)
+    {
+      // blockPhiTThetaTMatrix_ stores the coefficients with the sign conventions of Mauricio's papers
+      for (UnsignedLong k = 0; k < n; ++k) beta[k] = -blockPhiTThetaTMatrix_(k, 0);
+    }
+  else
+    {
+      ARMA * p_whittleARMA(WhittleFactory(currentP_, currentQ_, invertible_).build(timeSeries));
+      const ARMACoefficients arCoefficients(p_whittleARMA->getARCoefficients());
+      const ARMACoefficients maCoefficients(p_whittleARMA->getMACoefficients());
+      delete p_whittleARMA;
+      for (UnsignedLong k = 0; k < currentP_; ++k) beta[k] = arCoefficients[k](0, 0);
+      for (UnsignedLong k = 0; k < currentQ_; ++k) beta[currentP_ + k] = maCoefficients[k](0, 0);
+    }
+  const NumericalPoint values(getUnivariateValues(timeSeries, beta));
+  if (n > 0)
+    {
+      int m(0);
+      if (currentP_ > 0) ++m;
+      if (invertible_ && currentQ_ > 0) ++m;
+      NumericalScalar rhoBeg(ResourceMap::GetAsNumericalScalar("ARMALikelihoodFactory-DefaultRhoBeg"));
+      NumericalScalar rhoEnd(ResourceMap::GetAsNumericalScalar("ARMALikelihoodFactory-DefaultRhoEnd"));
+      int maxFun(static_cast<int>(ResourceMap::GetAsUnsignedLong("ARMALikelihoodFactory-DefaultMaxFun")));
+      cobyla_message message( verbose_ ? COBYLA_MSG_INFO : COBYLA_MSG_NONE );
+      ARMALikelihoodFactoryExactState state;
+      state.p_factory_ = this;
+      state.p_values_ = &values;
+      int returnCode(cobyla( n, m, &beta[0], rhoBeg, rhoEnd, message, &maxFun, ARMALikelihoodFactory::ComputeExactObjectiveAndConstraint, (void*) &state ));
+      if (returnCode != 0)
+        LOGWARN(OSS() << "Problem solving maximum likelihood problem by cobyla method, message=" << cobyla_rc_string[returnCode - COBYLA_MINRC]);
+    }
+  NumericalScalar sigma2(0.0);
+  ComputeKalmanLogLikelihood(Collection<NumericalScalar>(beta.begin(), beta.end()), currentP_, currentQ_, values, ResourceMap::GetAsNumericalScalar("ARMALikelihoodFactory-KalmanSteadyStateEpsilon"), sigma2);
+  ARMACoefficients phi(currentP_, 1);
+  for (UnsignedLong k = 0; k < currentP_; ++k)
+    {
+      SquareMatrix phi_k(1);
+      phi_k(0, 0) = beta[k];
+      phi[k] = phi_k;
+    }
+  ARMACoefficients theta(currentQ_, 1);
+  for (UnsignedLong k = 0; k < currentQ_; ++k)
+    {
+      SquareMatrix theta_k(1);
+      theta_k(0, 0) = beta[currentP_ + k];
+      theta[k] = theta_k;
+    }
+  const WhiteNoise whiteNoise(Normal(0.0, std::sqrt(sigma2)), timeSeries.getTimeGrid());
+  return ARMA(phi, theta, whiteNoise).clone();
+}
+
 /* String converter */
 String ARMALikelihoodFactory::__repr__() const
 {
@@ -522,7 +839,7 @@ ARMA * ARMALikelihoodFactory::build(const TimeSeries & timeSeries) const
     throw InvalidDimensionException(HERE) << "Error : expected time series of dimension " << dimension_
                                           << " here time series is of dimension " << dimension;
   if (dimension_ == 1)
-    return WhittleFactory(currentP_, currentQ_).build(timeSeries);
+    return buildUnivariate(timeSeries);
 
   // Calling the default initilization if no coefficients have been initialized
   if ((!hasInitializedARCoefficients_) || (!hasInitializedMACoefficients_) || (!hasInitializedCovarianceMatrix_))
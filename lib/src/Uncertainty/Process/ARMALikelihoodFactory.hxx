@@ -83,6 +83,16 @@ public:
   ARMA * build(const TimeSeries & timeSeries) const;
   ARMA * build(const ProcessSample & sample) const;
 
+  /** Exact log-likelihood of a univariate ARMA(p, q) model for the current orders, the white noise variance being profiled out.
+   *  beta = (a_1,...,a_p,b_1,...,b_q) gathers the coefficients of X_t + \sum_i a_i X_{t-i} = E_t + \sum_j b_j E_{t-j}.
+   *  It is computed by a Kalman filter, in a time linear with respect to the time series size */
+  NumericalScalar computeExactLogLikelihood(const TimeSeries & timeSeries,
+                                            const NumericalPoint & beta) const;
+
+  /** Gradient of the exact log-likelihood with respect to beta */
+  NumericalPoint computeExactLogLikelihoodGradient(const TimeSeries & timeSeries,
+                                                   const NumericalPoint & beta) const;
+
   /** Verbosity accessor */
   Bool getVerbose() const;
   void setVerbose(const Bool verbose);
@@ -153,6 +163,21 @@ private :
                                             double * con,
                                             void * state);
 
+  /** Univariate estimate based on the exact likelihood */
+  ARMA * buildUnivariate(const TimeSeries & timeSeries) const;
+
+  /** Values of a univariate time series, checking the consistency of beta with the current orders */
+  NumericalPoint getUnivariateValues(const TimeSeries & timeSeries,
+                                     const NumericalPoint & beta) const;
+
+  /** wrapper function passed to cobyla for the univariate exact likelihood */
+  static int ComputeExactObjectiveAndConstraint( int n,
+                                                 int m,
+                                                 double * x,
+                                                 double * f,
+                                                 double * con,
+                                                 void * state);
+
   /** Run the default initilization of coefficients / covariance for the optimization */
   void defaultInitialize() const;
 
@@ -338,13 +338,11 @@ TimeSeries SpectralNormalProcess::getRealization() const
           arrayCollection[i * twoNF + nFrequency_     + k] = resultRight[i];
         }
     } // Loop over the frequencies
-  // From the big collection, build the inverse FFT by blocks
+  // From the big collection, build the inverse FFT of all the blocks at once
+  fftAlgorithm_.inverseTransformBatch(arrayCollection, twoNF);
   NumericalSample sampleValues(twoNF , dimension_);
   for (UnsignedLong i = 0; i < dimension_; ++i)
-    {
-      const NumericalComplexCollection inverseFFTResult(fftAlgorithm_.inverseTransform(arrayCollection, i * twoNF, twoNF));
-      for (UnsignedLong k = 0; k < twoNF; ++k) sampleValues[k][i] = std::real(inverseFFTResult[k] * alpha_[k]);
-    }
+    for (UnsignedLong k = 0; k < twoNF; ++k) sampleValues[k][i] = std::real(arrayCollection[i * twoNF + k] * alpha_[k]);
   return TimeSeries(timeGrid_, sampleValues);
 }
 
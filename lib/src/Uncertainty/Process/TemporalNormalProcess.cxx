@@ -29,6 +29,9 @@
 #include "CovarianceMatrix.hxx"
 #include "Lapack.hxx"
 #include "DistFunc.hxx"
+#include "ResourceMap.hxx"
+#include "RandomGenerator.hxx"
+#include "TBB.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -43,7 +46,12 @@ TemporalNormalProcess::TemporalNormalProcess(const String & name)
   : ProcessImplementation(name),
     covarianceModel_(),
     choleskyFactorCovarianceMatrix_(0),
-    isInitialized_(false)
+    isInitialized_(false),
+    samplingMethod_(CHOLESKY),
+    circulantStandardDeviations_(0),
+    reflectionCoefficients_(0),
+    innovationStandardDeviations_(0),
+    fftAlgorithm_()
 {
   // Nothing to do
 }
@@ -55,7 +63,12 @@ TemporalNormalProcess::TemporalNormalProcess(const SecondOrderModel & model,
   : ProcessImplementation(name),
     covarianceModel_(model.getCovarianceModel()),
     choleskyFactorCovarianceMatrix_(0),
-    isInitialized_(false)
+    isInitialized_(false),
+    samplingMethod_(CHOLESKY),
+    circulantStandardDeviations_(0),
+    reflectionCoefficients_(0),
+    innovationStandardDeviations_(0),
+    fftAlgorithm_()
 {
   setTimeGrid(timeGrid);
   setDimension(model.getDimension());
@@ -68,7 +81,12 @@ TemporalNormalProcess::TemporalNormalProcess(const CovarianceModel & covarianceM
   : ProcessImplementation(name),
     covarianceModel_(covarianceModel),
     choleskyFactorCovarianceMatrix_(0),
-    isInitialized_(false)
+    isInitialized_(false),
+    samplingMethod_(CHOLESKY),
+    circulantStandardDeviations_(0),
+    reflectionCoefficients_(0),
+    innovationStandardDeviations_(0),
+    fftAlgorithm_()
 {
   setTimeGrid(timeGrid);
   setDimension(covarianceModel.getDimension());
@@ -83,8 +101,24 @@ TemporalNormalProcess * TemporalNormalProcess::clone() const
 void TemporalNormalProcess::initialize() const
 {
   // Initialization of the process
-  // Get the covariance matrix (its Cholesky factor)
+  // For scalar stationary covariance models, the covariance matrix over the regular grid
+  // is a Toeplitz matrix: it is sampled using a circulant embedding if it is non-negative,
+  // or else using the Levinson-Durbin recursion. The dense Cholesky factor is the last resort.
+  samplingMethod_ = CHOLESKY;
+  if ((dimension_ == 1) && (timeGrid_.getN() > 1) && covarianceModel_.isStationary() && ResourceMap::GetAsBool("TemporalNormalProcess-UseCirculantEmbedding"))
+    {
+      if (initializeCirculant()) samplingMethod_ = CIRCULANT;
+      else if (initializeLevinson()) samplingMethod_ = LEVINSON;
+    }
+  if (samplingMethod_ == CHOLESKY) initializeCholesky();
 
+  // The process has been initialized
+  isInitialized_ = true;
+}
+
+void TemporalNormalProcess::initializeCholesky() const
+{
+  // Get the covariance matrix (its Cholesky factor)
   CovarianceMatrix covarianceMatrix(covarianceModel_.discretizeCovariance(timeGrid_));
   const UnsignedLong fullSize(covarianceMatrix.getDimension());
   // Boolean flag to tell if the regularization is enough
@@ -119,9 +153,121 @@ void TemporalNormalProcess::initialize() const
 
   if (cumulatedScaling > 0.0)
     LOGWARN(OSS() <<  "Warning! Scaling up to "  << cumulatedScaling << " was needed in order to get an admissible covariance. ");
+}
 
-  // The process has been initialized
-  isInitialized_ = true;
+/* Smallest integer greater or equal to n with only 2, 3 and 5 as prime factors, for which the FFT is fast */
+static UnsignedLong FastFFTSize(const UnsignedLong n)
+{
+  UnsignedLong size(n);
+  while (true)
+    {
+      UnsignedLong remainder(size);
+      while (remainder % 2 == 0) remainder /= 2;
+      while (remainder % 3 == 0) remainder /= 3;
+      while (remainder % 5 == 0) remainder /= 5;
+      if (remainder == 1) return size;
+      ++size;
+    }
+}
+
+Bool TemporalNormalProcess::initializeCirculant() const
+{
+  // The Toeplitz covariance matrix of size N is embedded into a symmetric circulant matrix
+  // of size M >= 2(N-1), whose eigenvalues are given by the FFT of its first row.
+  // If they are non-negative, the embedding is a valid covariance and its first N
+  // components have exactly the expected distribution.
+  const UnsignedLong size(timeGrid_.getN());
+  const NumericalScalar timeStep(timeGrid_.getStep());
+  const UnsignedLong maximumPadding(ResourceMap::GetAsUnsignedLong("TemporalNormalProcess-MaximumCirculantPadding"));
+  const NumericalScalar epsilon(ResourceMap::GetAsNumericalScalar("TemporalNormalProcess-CirculantEpsilon"));
+  UnsignedLong embeddingSize(FastFFTSize(2 * (size - 1)));
+  // The lags beyond the grid are free parameters of the embedding. The covariance model is used
+  // there as long as it is defined, otherwise they are set to zero.
+  Bool isDefined(true);
+  // A larger embedding may be non-negative when the minimal one is not
+  for (UnsignedLong padding = 0; padding <= maximumPadding; ++padding)
+    {
+      NumericalComplexCollection firstRow(embeddingSize);
+      for (UnsignedLong lag = 0; 2 * lag <= embeddingSize; ++lag)
+        {
+          NumericalScalar covariance(0.0);
+          if (lag < size) covariance = covarianceModel_.computeCovariance(lag * timeStep)(0, 0);
+          else if (isDefined)
+            {
+              try
+                {
+                  covariance = covarianceModel_.computeCovariance(lag * timeStep)(0, 0);
+                }
+              catch (InvalidArgumentException & ex)
+                {
+                  isDefined = false;
+                }
+            }
+          firstRow[lag] = covariance;
+          if ((lag > 0) && (2 * lag < embeddingSize)) firstRow[embeddingSize - lag] = covariance;
+        }
+      const NumericalComplexCollection eigenValues(fftAlgorithm_.transform(firstRow));
+      NumericalScalar minimumEigenValue(eigenValues[0].real());
+      NumericalScalar maximumEigenValue(eigenValues[0].real());
+      for (UnsignedLong k = 1; k < embeddingSize; ++k)
+        {
+          minimumEigenValue = std::min(minimumEigenValue, eigenValues[k].real());
+          maximumEigenValue = std::max(maximumEigenValue, eigenValues[k].real());
+        }
+      if (minimumEigenValue >= -epsilon * maximumEigenValue)
+        {
+          // The tiny negative eigenvalues due to round-off are neglected
+          circulantStandardDeviations_ = NumericalPoint(embeddingSize);
+          for (UnsignedLong k = 0; k < embeddingSize; ++k) circulantStandardDeviations_[k] = sqrt(std::max(0.0, eigenValues[k].real()) / embeddingSize);
+          return true;
+        }
+      LOGINFO(OSS() << "The circulant embedding of size " << embeddingSize << " has a negative eigenvalue=" << minimumEigenValue << ", maximum eigenvalue=" << maximumEigenValue);
+      embeddingSize *= 2;
+    }
+  return false;
+}
+
+Bool TemporalNormalProcess::initializeLevinson() const
+{
+  // The Levinson-Durbin recursion computes the coefficients of the best linear prediction
+  // of the process at a time stamp given its past values, and the variance of the
+  // prediction error. Only the reflection coefficients are stored.
+  const UnsignedLong size(timeGrid_.getN());
+  const NumericalScalar timeStep(timeGrid_.getStep());
+  NumericalPoint covariances(size);
+  for (UnsignedLong lag = 0; lag < size; ++lag) covariances[lag] = covarianceModel_.computeCovariance(lag * timeStep)(0, 0);
+  NumericalPoint reflectionCoefficients(size);
+  NumericalPoint innovationStandardDeviations(size);
+  // Prediction coefficients phi[1..n] of the current order n
+  NumericalPoint phi(size);
+  NumericalScalar variance(covariances[0]);
+  if (!(variance > 0.0)) return false;
+  innovationStandardDeviations[0] = sqrt(variance);
+  for (UnsignedLong n = 1; n < size; ++n)
+    {
+      NumericalScalar numerator(covariances[n]);
+      for (UnsignedLong k = 1; k < n; ++k) numerator -= phi[k] * covariances[n - k];
+      const NumericalScalar kappa(numerator / variance);
+      for (UnsignedLong k = 1; 2 * k <= n; ++k)
+        {
+          const NumericalScalar phiK(phi[k]);
+          const NumericalScalar phiNK(phi[n - k]);
+          phi[k] = phiK - kappa * phiNK;
+          if (2 * k < n) phi[n - k] = phiNK - kappa * phiK;
+        }
+      phi[n] = kappa;
+      variance *= 1.0 - kappa * kappa;
+      if (!(variance > 0.0))
+        {
+          LOGINFO(OSS() << "The Levinson-Durbin recursion failed at order " << n << ", the covariance matrix is not positive definite");
+          return false;
+        }
+      reflectionCoefficients[n] = kappa;
+      innovationStandardDeviations[n] = sqrt(variance);
+    }
+  reflectionCoefficients_ = reflectionCoefficients;
+  innovationStandardDeviations_ = innovationStandardDeviations;
+  return true;
 }
 
 /* String converter */
@@ -150,6 +296,62 @@ String TemporalNormalProcess::__str__(const String & offset) const
 TimeSeries TemporalNormalProcess::getRealization() const
 {
   if (!isInitialized_) initialize();
+  if (samplingMethod_ == CIRCULANT) return getRealizationCirculant();
+  if (samplingMethod_ == LEVINSON) return getRealizationLevinson();
+  return getRealizationCholesky();
+}
+
+/* Realization based on the circulant embedding */
+TimeSeries TemporalNormalProcess::getRealizationCirculant() const
+{
+  const UnsignedLong size(timeGrid_.getN());
+  const UnsignedLong embeddingSize(circulantStandardDeviations_.getDimension());
+  // Complex Normal Fourier coefficients with the circulant eigenvalues as variances
+  NumericalComplexCollection coefficients(embeddingSize);
+  for (UnsignedLong k = 0; k < embeddingSize; ++k)
+    {
+      const NumericalScalar realPart(DistFunc::rNormal());
+      const NumericalScalar imaginaryPart(DistFunc::rNormal());
+      coefficients[k] = circulantStandardDeviations_[k] * NumericalComplex(realPart, imaginaryPart);
+    }
+  // The real part of the transform is a realization of the circulant process
+  const NumericalComplexCollection field(fftAlgorithm_.transform(coefficients));
+  NumericalSample values(size, 1);
+  for (UnsignedLong index = 0; index < size; ++index) values[index][0] = field[index].real();
+  return TimeSeries(timeGrid_, values);
+}
+
+/* Realization based on the Levinson-Durbin recursion */
+TimeSeries TemporalNormalProcess::getRealizationLevinson() const
+{
+  const UnsignedLong size(timeGrid_.getN());
+  NumericalPoint phi(size);
+  NumericalPoint values(size);
+  values[0] = innovationStandardDeviations_[0] * DistFunc::rNormal();
+  for (UnsignedLong n = 1; n < size; ++n)
+    {
+      // Update the prediction coefficients to order n
+      const NumericalScalar kappa(reflectionCoefficients_[n]);
+      for (UnsignedLong k = 1; 2 * k <= n; ++k)
+        {
+          const NumericalScalar phiK(phi[k]);
+          const NumericalScalar phiNK(phi[n - k]);
+          phi[k] = phiK - kappa * phiNK;
+          if (2 * k < n) phi[n - k] = phiNK - kappa * phiK;
+        }
+      phi[n] = kappa;
+      NumericalScalar prediction(0.0);
+      for (UnsignedLong k = 1; k <= n; ++k) prediction += phi[k] * values[n - k];
+      values[n] = prediction + innovationStandardDeviations_[n] * DistFunc::rNormal();
+    }
+  NumericalSample sample(size, 1);
+  for (UnsignedLong index = 0; index < size; ++index) sample[index][0] = values[index];
+  return TimeSeries(timeGrid_, sample);
+}
+
+/* Realization based on the Cholesky factor */
+TimeSeries TemporalNormalProcess::getRealizationCholesky() const
+{
   // Constantes values
   const UnsignedLong size(getTimeGrid().getN());
   const UnsignedLong fullSize(choleskyFactorCovarianceMatrix_.getDimension());
@@ -193,12 +395,188 @@ TimeSeries TemporalNormalProcess::getRealization() const
   return TimeSeries(timeGrid_, gaussianSample);
 }
 
+/* Functor sampling blocks of trajectories, each block using its own random generator */
+struct TemporalNormalProcessSampleFunctor
+{
+  const UnsignedLong samplingMethod_;
+  const RegularGrid & timeGrid_;
+  const UnsignedLong dimension_;
+  const SquareMatrix & choleskyFactor_;
+  const NumericalPoint & circulantStandardDeviations_;
+  const NumericalPoint & reflectionCoefficients_;
+  const NumericalPoint & innovationStandardDeviations_;
+  const FFT & fftAlgorithm_;
+  const RandomGenerator::UnsignedLongCollection & seeds_;
+  const UnsignedLong blockSize_;
+  ProcessSample & sample_;
+
+  TemporalNormalProcessSampleFunctor(const UnsignedLong samplingMethod,
+                                     const RegularGrid & timeGrid,
+                                     const UnsignedLong dimension,
+                                     const SquareMatrix & choleskyFactor,
+                                     const NumericalPoint & circulantStandardDeviations,
+                                     const NumericalPoint & reflectionCoefficients,
+                                     const NumericalPoint & innovationStandardDeviations,
+                                     const FFT & fftAlgorithm,
+                                     const RandomGenerator::UnsignedLongCollection & seeds,
+                                     const UnsignedLong blockSize,
+                                     ProcessSample & sample)
+    : samplingMethod_(samplingMethod), timeGrid_(timeGrid), dimension_(dimension)
+    , choleskyFactor_(choleskyFactor), circulantStandardDeviations_(circulantStandardDeviations)
+    , reflectionCoefficients_(reflectionCoefficients), innovationStandardDeviations_(innovationStandardDeviations)
+    , fftAlgorithm_(fftAlgorithm), seeds_(seeds), blockSize_(blockSize), sample_(sample) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    for (UnsignedLong block = r.begin(); block != r.end(); ++block)
+      {
+        RandomGenerator::MersenneTwister generator(seeds_[block]);
+        const UnsignedLong first(block * blockSize_);
+        const UnsignedLong last(std::min(first + blockSize_, sample_.getSize()));
+        if (samplingMethod_ == TemporalNormalProcess::CIRCULANT) sampleCirculant(generator, first, last);
+        else if (samplingMethod_ == TemporalNormalProcess::LEVINSON) sampleLevinson(generator, first, last);
+        else sampleCholesky(generator, first, last);
+      }
+  }
+
+  /* The real and imaginary parts of the transform are two independent realizations */
+  void sampleCirculant(RandomGenerator::MersenneTwister & generator,
+                       const UnsignedLong first,
+                       const UnsignedLong last) const
+  {
+    const UnsignedLong size(timeGrid_.getN());
+    const UnsignedLong embeddingSize(circulantStandardDeviations_.getDimension());
+    FFT::NumericalComplexCollection coefficients(embeddingSize);
+    for (UnsignedLong i = first; i < last; i += 2)
+      {
+        for (UnsignedLong k = 0; k < embeddingSize; ++k)
+          {
+            const NumericalScalar realPart(DistFunc::rNormal(generator));
+            const NumericalScalar imaginaryPart(DistFunc::rNormal(generator));
+            coefficients[k] = circulantStandardDeviations_[k] * NumericalComplex(realPart, imaginaryPart);
+          }
+        const FFT::NumericalComplexCollection field(fftAlgorithm_.transform(coefficients));
+        for (UnsignedLong index = 0; index < size; ++index) sample_(i, index, 0) = field[index].real();
+        if (i + 1 == last) break;
+        for (UnsignedLong index = 0; index < size; ++index) sample_(i + 1, index, 0) = field[index].imag();
+      }
+  }
+
+  /* The prediction coefficients are updated once for the whole block, and the
+     predictions are computed for all the trajectories of the block at once */
+  void sampleLevinson(RandomGenerator::MersenneTwister & generator,
+                      const UnsignedLong first,
+                      const UnsignedLong last) const
+  {
+    const UnsignedLong size(timeGrid_.getN());
+    const UnsignedLong count(last - first);
+    NumericalPoint phi(size);
+    // values[n * count + j] is the value at time stamp n of the jth trajectory of the block
+    NumericalPoint values(size * count);
+    for (UnsignedLong j = 0; j < count; ++j) values[j] = innovationStandardDeviations_[0] * DistFunc::rNormal(generator);
+    for (UnsignedLong n = 1; n < size; ++n)
+      {
+        const NumericalScalar kappa(reflectionCoefficients_[n]);
+        for (UnsignedLong k = 1; 2 * k <= n; ++k)
+          {
+            const NumericalScalar phiK(phi[k]);
+            const NumericalScalar phiNK(phi[n - k]);
+            phi[k] = phiK - kappa * phiNK;
+            if (2 * k < n) phi[n - k] = phiNK - kappa * phiK;
+          }
+        phi[n] = kappa;
+        NumericalScalar * current(&values[n * count]);
+        const NumericalScalar sigma(innovationStandardDeviations_[n]);
+        for (UnsignedLong j = 0; j < count; ++j) current[j] = sigma * DistFunc::rNormal(generator);
+        for (UnsignedLong k = 1; k <= n; ++k)
+          {
+            const NumericalScalar phiK(phi[k]);
+            const NumericalScalar * past(&values[(n - k) * count]);
+            for (UnsignedLong j = 0; j < count; ++j) current[j] += phiK * past[j];
+          }
+      }
+    for (UnsignedLong j = 0; j < count; ++j)
+      for (UnsignedLong n = 0; n < size; ++n) sample_(first + j, n, 0) = values[n * count + j];
+  }
+
+  /* The Cholesky factor is applied to all the trajectories of the block through a single matrix/matrix product */
+  void sampleCholesky(RandomGenerator::MersenneTwister & generator,
+                      const UnsignedLong first,
+                      const UnsignedLong last) const
+  {
+    const UnsignedLong size(timeGrid_.getN());
+    const UnsignedLong fullSize(choleskyFactor_.getDimension());
+    const UnsignedLong count(last - first);
+    // The columns of the matrix are the standard Normal vectors of the trajectories
+    NumericalPoint gaussianPoints(fullSize * count);
+    for (UnsignedLong index = 0; index < fullSize * count; ++index) gaussianPoints[index] = DistFunc::rNormal(generator);
+    char side('L');
+    int lside(1);
+    char uplo('L');
+    int luplo(1);
+    char trans('N');
+    int ltrans(1);
+    char diag('N');
+    int ldiag(1);
+    int m(fullSize);
+    int n(count);
+    double alpha(1.0);
+    int lda(fullSize);
+    int ldb(fullSize);
+    DTRMM_F77(&side, &uplo, &trans, &diag, &m, &n, &alpha, const_cast<double*>(&((*choleskyFactor_.getImplementation())[0])), &lda, &gaussianPoints[0], &ldb, &lside, &luplo, &ltrans, &ldiag);
+    for (UnsignedLong j = 0; j < count; ++j)
+      {
+        UnsignedLong position(j * fullSize);
+        for (UnsignedLong index = 0; index < size; ++index)
+          for (UnsignedLong dimensionIndex = 0; dimensionIndex < dimension_; ++dimensionIndex)
+            {
+              sample_(first + j, index, dimensionIndex) = gaussianPoints[position];
+              ++position;
+            }
+      }
+  }
+}; /* end struct TemporalNormalProcessSampleFunctor */
+
+/* Sample accessor */
+ProcessSample TemporalNormalProcess::getSample(const UnsignedLong size) const
+{
+  if (!isInitialized_) initialize();
+  // The trajectories are generated by blocks of fixed size sharing the precomputations. Each block
+  // uses its own random generator, seeded from the global one, so the sample depends neither on
+  // the number of threads nor on the order in which the blocks are processed.
+  const UnsignedLong blockSize(std::max(ResourceMap::GetAsUnsignedLong("TemporalNormalProcess-SampleBlockSize"), 1UL));
+  const UnsignedLong blockNumber((size + blockSize - 1) / blockSize);
+  const RandomGenerator::UnsignedLongCollection seeds(RandomGenerator::IntegerGenerate(blockNumber, 4294967295UL));
+  ProcessSample result(timeGrid_, size, dimension_);
+  const TemporalNormalProcessSampleFunctor functor(samplingMethod_, timeGrid_, dimension_, choleskyFactorCovarianceMatrix_, circulantStandardDeviations_, reflectionCoefficients_, innovationStandardDeviations_, fftAlgorithm_, seeds, blockSize, result);
+  TBB::ParallelFor(0, blockNumber, functor);
+  return result;
+}
+
 /* Covariance model accessor */
 CovarianceModel TemporalNormalProcess::getCovarianceModel() const
 {
   return covarianceModel_;
 }
 
+/* FFT algorithm accessors */
+FFT TemporalNormalProcess::getFFTAlgorithm() const
+{
+  return fftAlgorithm_;
+}
+
+void TemporalNormalProcess::setFFTAlgorithm(const FFT & fft)
+{
+  fftAlgorithm_ = fft;
+}
+
+/* Sampling method accessor */
+UnsignedLong TemporalNormalProcess::getSamplingMethod() const
+{
+  if (!isInitialized_) initialize();
+  return samplingMethod_;
+}
+
 /* Check if the process is stationary */
 Bool TemporalNormalProcess::isStationary() const
 {
@@ -218,6 +596,11 @@ void TemporalNormalProcess::save(Advocate & adv) const
   adv.saveAttribute("covarianceModel_", covarianceModel_);
   adv.saveAttribute("choleskyFactorCovarianceMatrix_", choleskyFactorCovarianceMatrix_);
   adv.saveAttribute("isInitialized_", isInitialized_);
+  adv.saveAttribute("samplingMethod_", samplingMethod_);
+  adv.saveAttribute("circulantStandardDeviations_", circulantStandardDeviations_);
+  adv.saveAttribute("reflectionCoefficients_", reflectionCoefficients_);
+  adv.saveAttribute("innovationStandardDeviations_", innovationStandardDeviations_);
+  adv.saveAttribute("fftAlgorithm_", fftAlgorithm_);
 }
 
 /* Method load() reloads the object from the StorageManager */
@@ -227,6 +610,11 @@ void TemporalNormalProcess::load(Advocate & adv)
   adv.loadAttribute("covarianceModel_", covarianceModel_);
   adv.loadAttribute("choleskyFactorCovarianceMatrix_", choleskyFactorCovarianceMatrix_);
   adv.loadAttribute("isInitialized_", isInitialized_);
+  adv.loadAttribute("samplingMethod_", samplingMethod_);
+  adv.loadAttribute("circulantStandardDeviations_", circulantStandardDeviations_);
+  adv.loadAttribute("reflectionCoefficients_", reflectionCoefficients_);
+  adv.loadAttribute("innovationStandardDeviations_", innovationStandardDeviations_);
+  adv.loadAttribute("fftAlgorithm_", fftAlgorithm_);
 }
 
 END_NAMESPACE_OPENTURNS
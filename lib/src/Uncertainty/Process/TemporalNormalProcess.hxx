@@ -29,6 +29,7 @@
 #include "SquareMatrix.hxx"
 #include "SecondOrderModel.hxx"
 #include "CovarianceModel.hxx"
+#include "FFT.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -45,6 +46,10 @@ class TemporalNormalProcess
 public:
 
   /** Some typedefs to ease reading */
+  typedef FFT::NumericalComplexCollection NumericalComplexCollection;
+
+  /** Algorithms used to sample the process */
+  enum SamplingMethod { CHOLESKY = 0, CIRCULANT, LEVINSON };
 
   /** Default constructor */
   TemporalNormalProcess(const String & name = DefaultName);
@@ -71,9 +76,19 @@ public:
   /** Realization accessor */
   TimeSeries getRealization() const;
 
+  /** Sample accessor: the realizations are generated by blocks using independent random streams */
+  ProcessSample getSample(const UnsignedLong size) const;
+
   /** Covariance model accessor */
   CovarianceModel getCovarianceModel() const;
 
+  /** FFT algorithm accessors */
+  FFT getFFTAlgorithm() const;
+  void setFFTAlgorithm(const FFT & fft);
+
+  /** Sampling method accessor */
+  UnsignedLong getSamplingMethod() const;
+
   /** Check if the process is stationary */
   Bool isStationary() const;
 
@@ -91,6 +106,24 @@ protected:
   /** Initialization of the process */
   void initialize() const;
 
+  /** Initialization of the Cholesky factor of the covariance matrix */
+  void initializeCholesky() const;
+
+  /** Initialization of the circulant embedding of a stationary covariance */
+  Bool initializeCirculant() const;
+
+  /** Initialization of the Levinson-Durbin recursion of a stationary covariance */
+  Bool initializeLevinson() const;
+
+  /** Realization based on the Cholesky factor */
+  TimeSeries getRealizationCholesky() const;
+
+  /** Realization based on the circulant embedding */
+  TimeSeries getRealizationCirculant() const;
+
+  /** Realization based on the Levinson-Durbin recursion */
+  TimeSeries getRealizationLevinson() const;
+
 private:
 
   /** Covariance model */
@@ -102,6 +135,21 @@ private:
   /** Flag to manage process initialization */
   mutable Bool isInitialized_;
 
+  /** Sampling method selected at initialization */
+  mutable UnsignedLong samplingMethod_;
+
+  /** Standard deviations of the Fourier coefficients of the circulant embedding */
+  mutable NumericalPoint circulantStandardDeviations_;
+
+  /** Reflection coefficients of the Levinson-Durbin recursion */
+  mutable NumericalPoint reflectionCoefficients_;
+
+  /** Standard deviations of the innovations of the Levinson-Durbin recursion */
+  mutable NumericalPoint innovationStandardDeviations_;
+
+  /** FFT algorithm */
+  FFT fftAlgorithm_;
+
 }; /* class TemporalNormalProcess */
 
 END_NAMESPACE_OPENTURNS
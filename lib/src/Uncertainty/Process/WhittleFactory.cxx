@@ -33,6 +33,7 @@
 #include "Log.hxx"
 #include "Normal.hxx"
 #include "UniVariatePolynomial.hxx"
+#include "TBB.hxx"
 
 BEGIN_NAMESPACE_OPENTURNS
 
@@ -53,7 +54,8 @@ WhittleFactory::WhittleFactory(const String & name)
     timeGrid_(),
     m_(0),
     spectralDensity_(),
-    sigma2_(0.0),
+    frequencyPowers_(0),
+    maximumOrder_(0),
     verbose_(false),
     isHistoryEnabled_(true),
     history_(0),
@@ -73,7 +75,8 @@ WhittleFactory::WhittleFactory(const UnsignedLong p,
     timeGrid_(),
     m_(0),
     spectralDensity_(),
-    sigma2_(0.0),
+    frequencyPowers_(0),
+    maximumOrder_(0),
     verbose_(false),
     isHistoryEnabled_(true),
     history_(0),
@@ -94,7 +97,8 @@ WhittleFactory::WhittleFactory(const Indices & p,
     timeGrid_(),
     m_(0),
     spectralDensity_(),
-    sigma2_(0.0),
+    frequencyPowers_(0),
+    maximumOrder_(0),
     verbose_(false),
     isHistoryEnabled_(true),
     history_(0),
@@ -150,36 +154,79 @@ void WhittleFactory::computeSpectralDensity(const SpectralModel & spectralModel)
       spectralDensity_[k] = estimatedValue;
       normalizedFrequencies_[k] = M_PI * frequency / fMax;
     }
+  // The powers of exp(-i\lambda_j) needed by the AR and MA polynomials are computed once for all the orders
+  maximumOrder_ = 0;
+  for (UnsignedLong i = 0; i < p_.getSize(); ++i) maximumOrder_ = std::max(maximumOrder_, p_[i]);
+  for (UnsignedLong i = 0; i < q_.getSize(); ++i) maximumOrder_ = std::max(maximumOrder_, q_[i]);
+  frequencyPowers_ = Collection< NumericalComplex >(m_ * maximumOrder_);
+  UnsignedLong index(0);
+  for (UnsignedLong j = 0; j < m_; ++j)
+    {
+      const NumericalComplex y(std::polar(1.0, -normalizedFrequencies_[j]));
+      NumericalComplex z(1.0, 0.0);
+      for (UnsignedLong i = 0; i < maximumOrder_; ++i)
+        {
+          z *= y;
+          frequencyPowers_[index] = z;
+          ++index;
+        }
+    }
 }
 
-NumericalScalar WhittleFactory::computeLogLikelihood(const NumericalPoint & theta) const
+NumericalScalar WhittleFactory::computeLogLikelihood(const NumericalPoint & theta,
+                                                     const UnsignedLong p,
+                                                     const UnsignedLong q,
+                                                     NumericalScalar & sigma2) const
 {
   NumericalScalar logTerm(0.0);
   NumericalScalar ratioTerm(0.0);
   for (UnsignedLong j = 0; j < m_; ++j)
     {
-      const NumericalScalar frequency(normalizedFrequencies_[j]);
       // Gj computation
-      const UnsignedLong n(std::max(currentP_, currentQ_));
+      const UnsignedLong shift(j * maximumOrder_);
       NumericalComplex numerator(1.0, 0.0);
       NumericalComplex denominator(1.0, 0.0);
-      NumericalComplex y(std::polar(1.0, -frequency));
-      NumericalComplex z(1.0, 0.0);
-      for (UnsignedLong i = 0; i < n; ++i)
-        {
-          z *= y;
-          if (i < currentQ_) numerator += theta[currentP_ + i] * z;
-          if (i < currentP_) denominator += theta[i] * z;
-        }
+      for (UnsignedLong i = 0; i < q; ++i) numerator += theta[p + i] * frequencyPowers_[shift + i];
+      for (UnsignedLong i = 0; i < p; ++i) denominator += theta[i] * frequencyPowers_[shift + i];
       const NumericalScalar gJ(std::norm(numerator) / std::norm(denominator));
       // Whittle likelihood update
       logTerm += log(gJ);
       ratioTerm += spectralDensity_[j] / gJ;
     }
-  sigma2_ = ratioTerm / m_;
+  sigma2 = ratioTerm / m_;
   return -logTerm - m_ * log(ratioTerm);
 }
 
+/* Data passed to cobyla: the orders are given explicitely so that several orders can be estimated concurrently */
+struct WhittleFactoryOptimizationState
+{
+  const WhittleFactory * p_factory_;
+  UnsignedLong p_;
+  UnsignedLong q_;
+  NumericalScalar epsilon_;
+};
+
+/* Minimum squared module of the roots of the polynom 1 + c_1 z + ... + c_n z^n */
+static NumericalScalar MinimumRootModule(const NumericalPoint & theta,
+                                         const UnsignedLong shift,
+                                         const UnsignedLong n)
+{
+  NumericalPoint coefficients(n + 1, 1.0);
+  for (UnsignedLong i = 0; i < n; ++i) coefficients[i + 1] = theta[i + shift];
+  const UniVariatePolynomial polynom(coefficients);
+  // For constant polynom, assume root 0
+  if (polynom.getDegree() == 0) return 0.0;
+  // The degree can be less than n if the leading coefficients are zero
+  const Collection<NumericalComplex> roots(polynom.getRoots());
+  NumericalScalar minRootModule(std::norm(roots[0]));
+  for (UnsignedLong i = 1; i < roots.getSize(); ++i)
+    {
+      const NumericalScalar rootModule(std::norm(roots[i]));
+      if (rootModule < minRootModule) minRootModule = rootModule;
+    }
+  return minRootModule;
+}
+
 /* objective function ==> function to be optimized */
 int WhittleFactory::ComputeObjectiveAndConstraint(int n,
                                                   int m,
@@ -188,60 +235,27 @@ int WhittleFactory::ComputeObjectiveAndConstraint(int n,
                                                   double *con,
                                                   void *state)
 {
-  const NumericalScalar epsilon(ResourceMap::GetAsNumericalScalar("WhittleFactory-RootEpsilon"));
+  const WhittleFactoryOptimizationState * optimizationState = static_cast<const WhittleFactoryOptimizationState *>(state);
+  const NumericalScalar epsilon(optimizationState->epsilon_);
 
   NumericalPoint theta(n);
   for (UnsignedLong k = 0; k < static_cast<UnsignedLong>(n); ++k) theta[k] = x[k];
 
-  WhittleFactory * factory = static_cast<WhittleFactory *>(state);
-  *f = -factory->computeLogLikelihood( theta );
+  const WhittleFactory * factory = optimizationState->p_factory_;
   // AR dimension
-  const UnsignedLong p(factory->getCurrentP());
-  const UnsignedLong q(factory->getCurrentQ());
+  const UnsignedLong p(optimizationState->p_);
+  const UnsignedLong q(optimizationState->q_);
+  NumericalScalar sigma2(0.0);
+  *f = -factory->computeLogLikelihood( theta, p, q, sigma2 );
   UnsignedLong constraintIndex(0);
   // If not pure MA, check the roots of the AR polynom
   if (p > 0)
     {
-      NumericalPoint arCoefficients(p + 1, 1.0);
-      for (UnsignedLong i = 0; i < p; ++i) arCoefficients[i + 1] = theta[i];
-      UniVariatePolynomial polynom(arCoefficients);
-      // Check the roots only if the polynom is not constant
-      if (polynom.getDegree() > 0)
-        {
-          Collection<NumericalComplex> roots(polynom.getRoots());
-          NumericalScalar minRootModule(std::norm(roots[0]));
-          for (UnsignedLong i = 1; i < p; ++i)
-            {
-              const NumericalScalar rootModule(std::norm(roots[i]));
-              if (rootModule < minRootModule) minRootModule = rootModule;
-            }
-          con[constraintIndex] = minRootModule - 1.0 - epsilon;
-        }
-      // For constant polynom, assume root 0
-      else con[constraintIndex] = -1.0 - epsilon;
+      con[constraintIndex] = MinimumRootModule(theta, 0, p) - 1.0 - epsilon;
       ++constraintIndex;
     }
   // If invertible and not pure AR, check the roots of the MA polynom
-  if (factory->getInvertible() && q > 0)
-    {
-      NumericalPoint maCoefficients(q + 1, 1.0);
-      for (UnsignedLong i = 0; i < q; ++i) maCoefficients[i + 1] = theta[i + p];
-      UniVariatePolynomial polynom(maCoefficients);
-      // Check the roots only if the polynom is not constant
-      if (polynom.getDegree() > 0)
-        {
-          Collection<NumericalComplex> roots(polynom.getRoots());
-          NumericalScalar minRootModule(std::norm(roots[0]));
-          for (UnsignedLong i = 1; i < q; ++i)
-            {
-              const NumericalScalar rootModule(std::norm(roots[i]));
-              if (rootModule < minRootModule) minRootModule = rootModule;
-            }
-          con[constraintIndex] = minRootModule - 1.0 - epsilon;
-        }
-      // For constant polynom, assume root 0
-      else con[constraintIndex] = -1.0 - epsilon;
-    }
+  if (factory->getInvertible() && q > 0) con[constraintIndex] = MinimumRootModule(theta, p, q) - 1.0 - epsilon;
   return 0;
 }
 
@@ -363,95 +377,227 @@ ARMA * WhittleFactory::build(const ProcessSample & sample) const
   return build(sample, informationCriteria);
 }
 
-/* Do the likelihood maximization */
+/* Functor estimating the orders of a given level of the (p, q) grid */
+struct WhittleFactoryOrderFunctor
+{
+  const WhittleFactory & factory_;
+  const Indices & levelIndices_;
+  Collection< NumericalPoint > & thetas_;
+  NumericalPoint & sigma2s_;
+  NumericalPoint & logLikelihoods_;
+
+  WhittleFactoryOrderFunctor(const WhittleFactory & factory,
+                             const Indices & levelIndices,
+                             Collection< NumericalPoint > & thetas,
+                             NumericalPoint & sigma2s,
+                             NumericalPoint & logLikelihoods)
+    : factory_(factory), levelIndices_(levelIndices), thetas_(thetas), sigma2s_(sigma2s), logLikelihoods_(logLikelihoods) {}
+
+  void operator() (const TBB::BlockedRange<UnsignedLong> & r) const
+  {
+    for (UnsignedLong i = r.begin(); i != r.end(); ++i) factory_.estimateOrder(levelIndices_[i], thetas_, sigma2s_, logLikelihoods_);
+  }
+}; /* end struct WhittleFactoryOrderFunctor */
+
+/* Do the likelihood maximization
+ * The (p, q) grid is explored by levels of constant pIndex + qIndex. The orders of a level are
+ * estimated concurrently, each one being warm-started from the estimates of its neighbours
+ * (pIndex - 1, qIndex) and (pIndex, qIndex - 1) of the previous level. The exploration stops
+ * when the best corrected AIC has not been improved during WhittleFactory-MaximumNonImprovingLevels
+ * levels, if this parameter is positive.
+ */
 ARMA * WhittleFactory::maximizeLogLikelihood(NumericalPoint & informationCriteria) const
 {
   // First, clean the history
   resetHistory();
   const UnsignedLong sizeP(p_.getSize());
   const UnsignedLong sizeQ(q_.getSize());
+  const UnsignedLong size(sizeP * sizeQ);
+  const UnsignedLong maximumNonImprovingLevels(ResourceMap::GetAsUnsignedLong("WhittleFactory-MaximumNonImprovingLevels"));
+
+  // Estimates for all the orders, stored in the same order as the starting points
+  Collection< NumericalPoint > thetas(size);
+  NumericalPoint sigma2s(size);
+  NumericalPoint logLikelihoods(size);
+  NumericalSample criteria(size, 3);
+
+  const UnsignedLong levelNumber(sizeP + sizeQ - 1);
+  NumericalScalar bestCriterion(SpecFunc::MaxNumericalScalar);
+  UnsignedLong nonImprovingLevels(0);
+  UnsignedLong level(0);
+  while (level < levelNumber)
+    {
+      Indices levelIndices(0);
+      const UnsignedLong pIndexMin(level < sizeQ ? 0 : level - sizeQ + 1);
+      const UnsignedLong pIndexMax(std::min(level, sizeP - 1));
+      for (UnsignedLong pIndex = pIndexMin; pIndex <= pIndexMax; ++pIndex) levelIndices.add(pIndex * sizeQ + level - pIndex);
+      const WhittleFactoryOrderFunctor functor(*this, levelIndices, thetas, sigma2s, logLikelihoods);
+      TBB::ParallelFor(0, levelIndices.getSize(), functor);
+      ++level;
+      // Check if the level improved the best model
+      Bool improved(false);
+      for (UnsignedLong i = 0; i < levelIndices.getSize(); ++i)
+        {
+          const UnsignedLong index(levelIndices[i]);
+          criteria[index] = computeInformationCriteria(logLikelihoods[index], thetas[index].getDimension());
+          if (criteria[index][0] < bestCriterion)
+            {
+              bestCriterion = criteria[index][0];
+              improved = true;
+            }
+        }
+      if (improved) nonImprovingLevels = 0;
+      else ++nonImprovingLevels;
+      if ((maximumNonImprovingLevels > 0) && (nonImprovingLevels >= maximumNonImprovingLevels))
+        {
+          if (verbose_) LOGINFO(OSS() << "No improvement of the information criterion during " << nonImprovingLevels << " levels, the remaining orders are pruned");
+          break;
+        }
+    } // Loop over the levels
 
-  // Best parameters
+  // Best parameters, selected in the (p, q) lexicographic order to get the same choice in case of ties whatever the scheduling
   NumericalPoint bestTheta(0);
   NumericalScalar bestSigma2(0.0);
   NumericalPoint bestInformationCriteria(3, SpecFunc::MaxNumericalScalar);
   UnsignedLong bestP(0);
   UnsignedLong bestQ(0);
-
-  UnsignedLong pointIndex(0);
+  UnsignedLong index(0);
   for (UnsignedLong pIndex = 0; pIndex < sizeP; ++pIndex)
     {
-      currentP_ = p_[pIndex];
       for (UnsignedLong qIndex = 0; qIndex < sizeQ; ++qIndex)
         {
-          currentQ_ = q_[qIndex];
-
-          if (verbose_) LOGINFO(OSS() << "Current parameters p=" << currentP_ << ", q=" << currentQ_);
-          // Dimension of the optimization problem
-          int n(currentP_ + currentQ_);
-          int m(0);
-          // Check the minimum root module of the AR polynom only if not pure MA process
-          if (currentP_ > 0) ++m;
-          // Check the minimum root module of the MA polynom only if not pure AR process and if invertible
-          if (invertible_ && currentQ_ > 0) ++m;
-          // Current parameters vector
-          NumericalPoint theta(startingPoints_[pointIndex]);
-
-          // Optimize only if there is some ARMA parameters to estimate
-          if (n > 0)
-            {
-              // use attributes to pass the data
-
-              // Cobyla parameters
-              // cobyla rhobeg ==>  a reasonable initial change to the variables
-              // cobyla rhoend ==> the required accuracy for the variables
-              // if the cobyla will be the default method, then we must add these variables in the ResourceMap
-              // maxfun ==> on input, the maximum number of function evaluations on output, the number of function evaluations done
-              NumericalScalar rhoBeg(ResourceMap::GetAsNumericalScalar("WhittleFactory-DefaultRhoBeg"));
-              NumericalScalar rhoEnd(ResourceMap::GetAsNumericalScalar("WhittleFactory-DefaultRhoEnd"));
-              int maxFun(static_cast<int>(ResourceMap::GetAsUnsignedLong("WhittleFactory-DefaultMaxFun")));
-              // verbosity level
-              cobyla_message message( verbose_ ? COBYLA_MSG_INFO : COBYLA_MSG_NONE );
-
-              // call cobyla algo
-              int returnCode(cobyla( n, m, &theta[0], rhoBeg, rhoEnd, message, &maxFun, WhittleFactory::ComputeObjectiveAndConstraint, (void*) this ));
-              if (returnCode != 0)
-                LOGWARN(OSS() << "Problem solving maximum likelihood problem by cobyla method, message=" << cobyla_rc_string[returnCode - COBYLA_MINRC]);
-            }
-          // Compute the information criteria
-          // First, the corrected AIC
-          const NumericalScalar logLikelihood(computeLogLikelihood(theta));
-          NumericalPoint currentInformationCriteria(3);
-          if (m_ > static_cast<UnsignedLong>(n + 2)) currentInformationCriteria[0] = -2.0 * logLikelihood + 2.0 * (n + 1) * m_ / (m_ - n - 2);
-          else
+          // Skip the pruned orders
+          if (pIndex + qIndex < level)
             {
-              LOGWARN(OSS() << "Warning! Unable to compute the corrected AIC criteria, too few data (" << m_ << ") for the model complexity (" << n + 1);
-              currentInformationCriteria[0] = SpecFunc::MaxNumericalScalar;
+              const NumericalPoint currentInformationCriteria(criteria[index]);
+              if (verbose_) LOGINFO(OSS(false) << "Estimate for p=" << p_[pIndex] << ", q=" << q_[qIndex] << ": theta=" << thetas[index] << ", sigma2=" << sigma2s[index] << ", information criteria=" << currentInformationCriteria);
+              if (isHistoryEnabled_) history_.add(WhittleFactoryState(p_[pIndex], thetas[index], sigma2s[index], currentInformationCriteria, timeGrid_));
+              // Keep the best model according to the first criteria
+              if (currentInformationCriteria[0] < bestInformationCriteria[0])
+                {
+                  bestInformationCriteria = currentInformationCriteria;
+                  bestSigma2 = sigma2s[index];
+                  bestTheta = thetas[index];
+                  bestP = p_[pIndex];
+                  bestQ = q_[qIndex];
+                }
             }
-          // Second, the AIC
-          currentInformationCriteria[1] = -2.0 * logLikelihood + 2.0 * (n + 1);
-          // Third, the BIC
-          currentInformationCriteria[2] = -2.0 * logLikelihood + 2.0 * (n + 1) * log(m_);
-          if (verbose_) LOGINFO(OSS(false) << "Current estimate: theta=" << theta << ", sigma2=" << sigma2_ << ", Current information criteria=" << currentInformationCriteria);
-          if (isHistoryEnabled_) history_.add(WhittleFactoryState(currentP_, theta, sigma2_, currentInformationCriteria, timeGrid_));
-          // Keep the best model according to the first criteria
-          if (currentInformationCriteria[0] < bestInformationCriteria[0])
-            {
-              bestInformationCriteria = currentInformationCriteria;
-              bestSigma2 = sigma2_;
-              bestTheta = theta;
-              bestP = currentP_;
-              bestQ = currentQ_;
-            }
-          if (verbose_) LOGINFO(OSS(false) << "Best so far: p=" << bestP << ", q=" << bestQ << ", theta=" << bestTheta << ", sigma2=" << bestSigma2 << ", information criteria=" << bestInformationCriteria);
-          ++pointIndex;
+          ++index;
         } // Loop over q
     } // Loop over p
+  if (verbose_) LOGINFO(OSS(false) << "Best model: p=" << bestP << ", q=" << bestQ << ", theta=" << bestTheta << ", sigma2=" << bestSigma2 << ", information criteria=" << bestInformationCriteria);
+  currentP_ = bestP;
+  currentQ_ = bestQ;
   // Return the best information criteria
   informationCriteria = bestInformationCriteria;
   return WhittleFactoryState(bestP, bestTheta, bestSigma2, bestInformationCriteria, timeGrid_).getARMA().clone();
 }
 
+/* Extend the coefficients of an ARMA(pFrom, qFrom) model to an ARMA(p, q) model with p >= pFrom and q >= qFrom using zero coefficients */
+static NumericalPoint ExtendCoefficients(const NumericalPoint & theta,
+                                         const UnsignedLong pFrom,
+                                         const UnsignedLong qFrom,
+                                         const UnsignedLong p,
+                                         const UnsignedLong q)
+{
+  NumericalPoint extended(p + q);
+  for (UnsignedLong i = 0; i < pFrom; ++i) extended[i] = theta[i];
+  for (UnsignedLong i = 0; i < qFrom; ++i) extended[p + i] = theta[pFrom + i];
+  return extended;
+}
+
+/* Log likelihood maximization for the orders of the given index in the (p, q) grid */
+void WhittleFactory::estimateOrder(const UnsignedLong index,
+                                   Collection< NumericalPoint > & thetas,
+                                   NumericalPoint & sigma2s,
+                                   NumericalPoint & logLikelihoods) const
+{
+  const UnsignedLong sizeQ(q_.getSize());
+  const UnsignedLong pIndex(index / sizeQ);
+  const UnsignedLong qIndex(index % sizeQ);
+  const UnsignedLong p(p_[pIndex]);
+  const UnsignedLong q(q_[qIndex]);
+  if (verbose_) LOGINFO(OSS() << "Current parameters p=" << p << ", q=" << q);
+  // Dimension of the optimization problem
+  int n(p + q);
+  int m(0);
+  // Check the minimum root module of the AR polynom only if not pure MA process
+  if (p > 0) ++m;
+  // Check the minimum root module of the MA polynom only if not pure AR process and if invertible
+  if (invertible_ && q > 0) ++m;
+  // Current parameters vector
+  NumericalPoint theta(startingPoints_[index]);
+  NumericalScalar sigma2(0.0);
+
+  // Optimize only if there is some ARMA parameters to estimate
+  if (n > 0)
+    {
+      // Warm start: the estimates of the neighbouring lower orders, extended by zero coefficients,
+      // have the same likelihood as the corresponding models
+      NumericalScalar startingLogLikelihood(computeLogLikelihood(theta, p, q, sigma2));
+      if ((pIndex > 0) && (p_[pIndex - 1] <= p))
+        {
+          const UnsignedLong neighbourIndex(index - sizeQ);
+          if (logLikelihoods[neighbourIndex] > startingLogLikelihood)
+            {
+              theta = ExtendCoefficients(thetas[neighbourIndex], p_[pIndex - 1], q, p, q);
+              startingLogLikelihood = logLikelihoods[neighbourIndex];
+            }
+        }
+      if ((qIndex > 0) && (q_[qIndex - 1] <= q))
+        {
+          const UnsignedLong neighbourIndex(index - 1);
+          if (logLikelihoods[neighbourIndex] > startingLogLikelihood)
+            {
+              theta = ExtendCoefficients(thetas[neighbourIndex], p, q_[qIndex - 1], p, q);
+              startingLogLikelihood = logLikelihoods[neighbourIndex];
+            }
+        }
+
+      // Cobyla parameters
+      // cobyla rhobeg ==>  a reasonable initial change to the variables
+      // cobyla rhoend ==> the required accuracy for the variables
+      // maxfun ==> on input, the maximum number of function evaluations on output, the number of function evaluations done
+      NumericalScalar rhoBeg(ResourceMap::GetAsNumericalScalar("WhittleFactory-DefaultRhoBeg"));
+      NumericalScalar rhoEnd(ResourceMap::GetAsNumericalScalar("WhittleFactory-DefaultRhoEnd"));
+      int maxFun(static_cast<int>(ResourceMap::GetAsUnsignedLong("WhittleFactory-DefaultMaxFun")));
+      // verbosity level
+      cobyla_message message( verbose_ ? COBYLA_MSG_INFO : COBYLA_MSG_NONE );
+      WhittleFactoryOptimizationState state;
+      state.p_factory_ = this;
+      state.p_ = p;
+      state.q_ = q;
+      state.epsilon_ = ResourceMap::GetAsNumericalScalar("WhittleFactory-RootEpsilon");
+
+      // call cobyla algo
+      int returnCode(cobyla( n, m, &theta[0], rhoBeg, rhoEnd, message, &maxFun, WhittleFactory::ComputeObjectiveAndConstraint, (void*) &state ));
+      if (returnCode != 0)
+        LOGWARN(OSS() << "Problem solving maximum likelihood problem by cobyla method for p=" << p << ", q=" << q << ", message=" << cobyla_rc_string[returnCode - COBYLA_MINRC]);
+    }
+  logLikelihoods[index] = computeLogLikelihood(theta, p, q, sigma2);
+  sigma2s[index] = sigma2;
+  thetas[index] = theta;
+}
+
+/* Compute the information criteria (AICc, AIC, BIC) associated with a log-likelihood */
+NumericalPoint WhittleFactory::computeInformationCriteria(const NumericalScalar logLikelihood,
+                                                          const UnsignedLong n) const
+{
+  NumericalPoint informationCriteria(3);
+  // First, the corrected AIC
+  if (m_ > n + 2) informationCriteria[0] = -2.0 * logLikelihood + 2.0 * (n + 1) * m_ / (m_ - n - 2);
+  else
+    {
+      LOGWARN(OSS() << "Warning! Unable to compute the corrected AIC criteria, too few data (" << m_ << ") for the model complexity (" << n + 1);
+      informationCriteria[0] = SpecFunc::MaxNumericalScalar;
+    }
+  // Second, the AIC
+  informationCriteria[1] = -2.0 * logLikelihood + 2.0 * (n + 1);
+  // Third, the BIC
+  informationCriteria[2] = -2.0 * logLikelihood + 2.0 * (n + 1) * log(m_);
+  return informationCriteria;
+}
+
 /* Starting points accessor */
 void WhittleFactory::setStartingPoints(const Collection< NumericalPoint > & startingPoints)
 {
@@ -101,12 +101,27 @@ public:
 
 private :
 
-  /** Likelihood function ==> Compute the reduced form of the likelihood */
-  NumericalScalar computeLogLikelihood(const NumericalPoint & theta) const;
+  friend struct WhittleFactoryOrderFunctor;
+
+  /** Likelihood function ==> Compute the reduced form of the likelihood for the given orders */
+  NumericalScalar computeLogLikelihood(const NumericalPoint & theta,
+                                       const UnsignedLong p,
+                                       const UnsignedLong q,
+                                       NumericalScalar & sigma2) const;
 
   /** Log likelihood maximization, shared among the different build() methods */
   ARMA * maximizeLogLikelihood(NumericalPoint & InformationCriterion) const;
 
+  /** Log likelihood maximization for the orders of the given index in the (p, q) grid */
+  void estimateOrder(const UnsignedLong index,
+                     Collection< NumericalPoint > & thetas,
+                     NumericalPoint & sigma2s,
+                     NumericalPoint & logLikelihoods) const;
+
+  /** Compute the information criteria (AICc, AIC, BIC) associated with a log-likelihood */
+  NumericalPoint computeInformationCriteria(const NumericalScalar logLikelihood,
+                                            const UnsignedLong n) const;
+
   /** Compute the spectral density at the relevant normalized frequencies */
   void computeSpectralDensity(const SpectralModel & spectralModel) const;
 
@@ -140,8 +155,11 @@ private :
   /** only used to pass data to be used in computeLogLikeliHood */
   mutable NumericalPoint spectralDensity_;
 
-  /** only used to pass data to be used in computeLogLikeliHood */
-  mutable NumericalScalar sigma2_;
+  /** Powers exp(-i k lambda_j), k=1,...,maximumOrder_ of the normalized frequencies, shared by all the orders */
+  mutable Collection< NumericalComplex > frequencyPowers_;
+
+  /** Maximum of the AR and MA orders - Used to pass data to be used in computeLogLikeliHood */
+  mutable UnsignedLong maximumOrder_;
 
   /** Verbosity control */
   Bool verbose_;
@@ -130,6 +130,38 @@ int main(int argc, char *argv[])
       Process result(factory.build(timeSeries));
       fullprint << "Estimated ARMA=" << result << std::endl;
 
+      // Univariate case: exact likelihood computed by a Kalman filter
+      ARMACoefficients arCoefficients1(1, 1);
+      ARMACoefficients maCoefficients1(1, 1);
+      SquareMatrix coefficient(1);
+      coefficient(0, 0) = -0.6;
+      arCoefficients1[0] = coefficient;
+      coefficient(0, 0) = 0.3;
+      maCoefficients1[0] = coefficient;
+      ARMA myARMA1(arCoefficients1, maCoefficients1, WhiteNoise(Normal(0.0, 0.5)));
+      myARMA1.setTimeGrid(RegularGrid(0.0, 1.0, 2000));
+      const TimeSeries timeSeries1(myARMA1.getRealization());
+      ARMALikelihoodFactory factory1(1, 1, 1);
+      NumericalPoint beta(2);
+      beta[0] = -0.6;
+      beta[1] = 0.3;
+      const NumericalPoint gradient(factory1.computeExactLogLikelihoodGradient(timeSeries1, beta));
+      NumericalScalar gradientError(0.0);
+      for (UnsignedLong i = 0; i < 2; ++i)
+        {
+          NumericalPoint betaPlus(beta);
+          betaPlus[i] += 1.0e-5;
+          NumericalPoint betaMinus(beta);
+          betaMinus[i] -= 1.0e-5;
+          const NumericalScalar finiteDifference((factory1.computeExactLogLikelihood(timeSeries1, betaPlus) - factory1.computeExactLogLikelihood(timeSeries1, betaMinus)) / 2.0e-5);
+          gradientError = std::max(gradientError, fabs(gradient[i] - finiteDifference));
+        }
+      fullprint << "exact log-likelihood gradient ok=" << (gradientError < 1.0e-4) << std::endl;
+      const ARMA estimated1(*factory1.build(timeSeries1));
+      const NumericalScalar arError(fabs(estimated1.getARCoefficients()[0](0, 0) - beta[0]));
+      const NumericalScalar maError(fabs(estimated1.getMACoefficients()[0](0, 0) - beta[1]));
+      fullprint << "univariate estimate ok=" << ((arError < 0.1) && (maError < 0.1)) << std::endl;
+
     }
   catch (TestFailed & ex)
     {
@@ -138,6 +138,10 @@ int main(int argc, char *argv[])
       UnsignedLong size = 3;
       fullprint << "Some futures=" << process2.getFuture(stepNumber, size) << std::endl;
 
+      // Some realizations, generated all at once
+      fullprint << "Some realizations=" << process3.getSample(size) << std::endl;
+      fullprint << "State after the realizations=" << process3.getState() << std::endl;
+
     }
   catch (TestFailed & ex)
     {
@@ -0,0 +1,129 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  t_AutomaticDifferentiation_std.cxx
+ *  @brief The test file of the automatic differentiation
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#include "OT.hxx"
+#include "OTtestcode.hxx"
+
+using namespace OT;
+using namespace OT::Test;
+
+/* A function written against a templated scalar type */
+struct TestFunction
+{
+  template <class S>
+  Collection<S> operator() (const Collection<S> & x) const
+  {
+    Collection<S> y(2);
+    y[0] = sin(x[0]) * exp(x[1]) + pow(x[0], 3.0) / x[1];
+    y[1] = sqrt(x[0] * x[0] + x[1] * x[1]) - log(x[1]) * atan(x[0]);
+    return y;
+  }
+};
+
+int main(int argc, char *argv[])
+{
+  TESTPREAMBLE;
+  OStream fullprint(std::cout);
+
+  try
+    {
+      // The same function as an analytical function
+      Description input(2);
+      input[0] = "x0";
+      input[1] = "x1";
+      Description output(2);
+      output[0] = "y0";
+      output[1] = "y1";
+      Description formulas(2);
+      formulas[0] = "sin(x0) * exp(x1) + x0^3 / x1";
+      formulas[1] = "sqrt(x0 * x0 + x1 * x1) - log(x1) * atan(x0)";
+      NumericalMathFunction analytical(input, output, formulas);
+
+      NumericalMathFunction templated(bindTemplate(TestFunction(), 2, 2));
+      NumericalPoint point(2);
+      point[0] = 0.7;
+      point[1] = 1.3;
+      fullprint << "value=" << templated(point) << std::endl;
+      fullprint << "analytical value=" << analytical(point) << std::endl;
+      const Matrix gradient(templated.gradient(point));
+      fullprint << "gradient=" << gradient << std::endl;
+      const Matrix analyticalGradient(analytical.gradient(point));
+      fullprint << "analytical gradient=" << analyticalGradient << std::endl;
+      const SymmetricTensor hessian(templated.hessian(point));
+      fullprint << "hessian=" << hessian << std::endl;
+      const SymmetricTensor analyticalHessian(analytical.hessian(point));
+      fullprint << "analytical hessian=" << analyticalHessian << std::endl;
+
+      // Compare with finite differences
+      const CenteredFiniteDifferenceGradient finiteDifferenceGradient(1.0e-5, templated.getEvaluationImplementation());
+      const Matrix referenceGradient(finiteDifferenceGradient.gradient(point));
+      const CenteredFiniteDifferenceHessian finiteDifferenceHessian(1.0e-4, templated.getEvaluationImplementation());
+      const SymmetricTensor referenceHessian(finiteDifferenceHessian.hessian(point));
+      NumericalScalar gradientError(0.0);
+      NumericalScalar analyticalGradientError(0.0);
+      NumericalScalar hessianError(0.0);
+      NumericalScalar analyticalHessianError(0.0);
+      for (UnsignedLong j = 0; j < 2; ++j)
+        for (UnsignedLong i = 0; i < 2; ++i)
+          {
+            gradientError = std::max(gradientError, fabs(gradient(i, j) - referenceGradient(i, j)));
+            analyticalGradientError = std::max(analyticalGradientError, fabs(analyticalGradient(i, j) - referenceGradient(i, j)));
+            for (UnsignedLong k = 0; k < 2; ++k)
+              {
+                hessianError = std::max(hessianError, fabs(hessian(i, k, j) - referenceHessian(i, k, j)));
+                analyticalHessianError = std::max(analyticalHessianError, fabs(analyticalHessian(i, k, j) - referenceHessian(i, k, j)));
+              }
+          }
+      fullprint << "gradient ok=" << (gradientError < 1.0e-8) << " analytical gradient ok=" << (analyticalGradientError < 1.0e-8) << std::endl;
+      fullprint << "hessian ok=" << (hessianError < 1.0e-5) << " analytical hessian ok=" << (analyticalHessianError < 1.0e-5) << std::endl;
+
+      // Hessian-vector product
+      NumericalPoint direction(2);
+      direction[0] = 1.0;
+      direction[1] = -2.0;
+      const AutomaticDifferentiationHessian<TestFunction> hessianImplementation(TestFunction(), 2, 2);
+      const Matrix product(hessianImplementation.hessianVectorProduct(point, direction));
+      NumericalScalar productError(0.0);
+      for (UnsignedLong j = 0; j < 2; ++j)
+        for (UnsignedLong i = 0; i < 2; ++i)
+          productError = std::max(productError, fabs(product(i, j) - (hessian(i, 0, j) * direction[0] + hessian(i, 1, j) * direction[1])));
+      fullprint << "hessian vector product ok=" << (productError < 1.0e-12) << std::endl;
+
+      // Forward mode with dual numbers: directional derivative
+      Collection< DualNumber<NumericalScalar> > dualPoint(2);
+      dualPoint[0] = DualNumber<NumericalScalar>(point[0], direction[0]);
+      dualPoint[1] = DualNumber<NumericalScalar>(point[1], direction[1]);
+      const Collection< DualNumber<NumericalScalar> > dualValue(TestFunction()(dualPoint));
+      NumericalScalar directionalError(0.0);
+      for (UnsignedLong j = 0; j < 2; ++j)
+        directionalError = std::max(directionalError, fabs(dualValue[j].getDerivative() - (gradient(0, j) * direction[0] + gradient(1, j) * direction[1])));
+      fullprint << "directional derivative ok=" << (directionalError < 1.0e-12) << std::endl;
+    }
+  catch (TestFailed & ex)
+    {
+      std::cerr << ex << std::endl;
+      return ExitCode::Error;
+    }
+
+  return ExitCode::Success;
+}
@@ -193,6 +193,53 @@ int main(int argc, char *argv[])
       anotherSample = distribution.getSample(size);
       fullprint << "anotherSample mean=" << anotherSample.computeMean() << std::endl;
       fullprint << "anotherSample covariance=" << anotherSample.computeCovariance() << std::endl;
+      // Conditional quantiles of the last component for a set of conditioning points
+      const UnsignedLong conditioningSize(5);
+      NumericalSample conditioningSample(conditioningSize, dim - 1);
+      NumericalPoint levels(conditioningSize);
+      for (UnsignedLong i = 0; i < conditioningSize; ++i)
+        {
+          levels[i] = (i + 0.5) / conditioningSize;
+          for (UnsignedLong j = 0; j < dim - 1; ++j) conditioningSample[i][j] = mean[j] + (0.5 * i - 1.0) * sigma[j];
+        }
+      // Closed form of the Normal conditional distribution: with z the reduced conditioning point, the reduced last component
+      // has a mean equal to R21.R11^(-1).z and a variance equal to 1 - R21.R11^(-1).R12
+      const NumericalScalar det(1.0 - correlation(0, 1) * correlation(0, 1));
+      const NumericalScalar beta0((correlation(0, 2) - correlation(0, 1) * correlation(1, 2)) / det);
+      const NumericalScalar beta1((correlation(1, 2) - correlation(0, 1) * correlation(0, 2)) / det);
+      const NumericalScalar conditionalSigma(sqrt(1.0 - beta0 * correlation(0, 2) - beta1 * correlation(1, 2)));
+      NumericalPoint conditionalQuantilesExact(conditioningSize);
+      for (UnsignedLong i = 0; i < conditioningSize; ++i)
+        {
+          const NumericalScalar z0((conditioningSample[i][0] - mean[0]) / sigma[0]);
+          const NumericalScalar z1((conditioningSample[i][1] - mean[1]) / sigma[1]);
+          conditionalQuantilesExact[i] = mean[2] + sigma[2] * (beta0 * z0 + beta1 * z1 + conditionalSigma * DistFunc::qNormal(levels[i]));
+        }
+      const NumericalPoint conditionalQuantiles(distribution.computeConditionalQuantile(levels, conditioningSample));
+      fullprint << "conditional quantiles        =" << conditionalQuantiles << std::endl;
+      fullprint << "conditional quantiles (exact)=" << conditionalQuantilesExact << std::endl;
+      // The generic algorithm inverts the whole column in a single root search
+      const NumericalPoint genericQuantiles(distribution.DistributionImplementation::computeConditionalQuantile(levels, conditioningSample));
+      NumericalScalar error(0.0);
+      NumericalScalar errorRef(0.0);
+      NumericalScalar errorScalar(0.0);
+      NumericalScalar errorGeneric(0.0);
+      NumericalScalar errorGenericScalar(0.0);
+      for (UnsignedLong i = 0; i < conditioningSize; ++i)
+        {
+          error = std::max(error, fabs(conditionalQuantiles[i] - conditionalQuantilesExact[i]));
+          errorRef = std::max(errorRef, fabs(distributionRef.computeConditionalQuantile(levels[i], conditioningSample[i]) - conditionalQuantilesExact[i]));
+          errorScalar = std::max(errorScalar, fabs(distribution.computeConditionalQuantile(levels[i], conditioningSample[i]) - conditionalQuantilesExact[i]));
+          errorGeneric = std::max(errorGeneric, fabs(genericQuantiles[i] - conditionalQuantilesExact[i]));
+          errorGenericScalar = std::max(errorGenericScalar, fabs(distribution.DistributionImplementation::computeConditionalQuantile(levels[i], conditioningSample[i]) - conditionalQuantilesExact[i]));
+        }
+      fullprint << "conditional quantiles ok=" << (error < 1.0e-8) << std::endl;
+      fullprint << "conditional quantiles (ref) ok=" << (errorRef < 1.0e-8) << std::endl;
+      fullprint << "scalar conditional quantiles ok=" << (errorScalar < 1.0e-8) << std::endl;
+      fullprint << "generic conditional quantiles ok=" << (errorGeneric < 1.0e-8) << std::endl;
+      fullprint << "generic scalar conditional quantiles ok=" << (errorGenericScalar < 1.0e-8) << std::endl;
+      if (std::max(std::max(error, errorRef), errorScalar) >= 1.0e-8) throw TestFailed(OSS() << "wrong conditional quantiles, error=" << error << ", error (ref)=" << errorRef << ", error (scalar)=" << errorScalar);
+      if (std::max(errorGeneric, errorGenericScalar) >= 1.0e-8) throw TestFailed(OSS() << "wrong generic conditional quantiles, error=" << errorGeneric << ", error (scalar)=" << errorGenericScalar);
     }
   catch (TestFailed & ex)
     {
@@ -108,6 +108,28 @@ int main(int argc, char *argv[])
               }
           }
       } // rBeta
+      {
+        // rBeta, array version
+        UnsignedLong nR(5);
+        NumericalPoint p1(3);
+        p1[0] = 1.0;
+        p1[1] = 0.2;
+        p1[2] = 2.6;
+        NumericalPoint p2(3);
+        p2[0] = 2.6;
+        p2[1] = 0.5;
+        p2[2] = 5.0;
+        for (UnsignedLong i = 0; i < p1.getDimension(); ++i)
+          {
+            const RandomGeneratorState state(RandomGenerator::GetState());
+            const NumericalPoint values(DistFunc::rBeta(p1[i], p2[i], nR));
+            fullprint << "rBeta(" << p1[i] << ", " << p2[i] << ", " << nR << ")=" << values << std::endl;
+            RandomGenerator::SetState(state);
+            Bool same(true);
+            for (UnsignedLong iR = 0; iR < nR; ++iR) same = same && (values[iR] == DistFunc::rBeta(p1[i], p2[i]));
+            fullprint << "same as scalar rBeta(" << p1[i] << ", " << p2[i] << ")=" << same << std::endl;
+          }
+      } // rBeta, array version
     }
   catch (TestFailed & ex)
     {
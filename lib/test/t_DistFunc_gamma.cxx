@@ -87,6 +87,18 @@ int main(int argc, char *argv[])
               }
           }
       } // rGamma
+      {
+        // rGamma, array version
+        UnsignedLong nR(5);
+        NumericalScalar k(0.2);
+        const RandomGeneratorState state(RandomGenerator::GetState());
+        const NumericalPoint values(DistFunc::rGamma(k, nR));
+        fullprint << "rGamma(" << k << ", " << nR << ")=" << values << std::endl;
+        RandomGenerator::SetState(state);
+        Bool same(true);
+        for (UnsignedLong iR = 0; iR < nR; ++iR) same = same && (values[iR] == DistFunc::rGamma(k));
+        fullprint << "same as scalar rGamma(" << k << ")=" << same << std::endl;
+      } // rGamma, array version
     }
   catch (TestFailed & ex)
     {
@@ -66,6 +66,17 @@ int main(int argc, char *argv[])
             fullprint << "rNormal()=" << DistFunc::rNormal() << std::endl;
           }
       } // rNormal
+      {
+        // rNormal, array version
+        UnsignedLong nR(10);
+        const RandomGeneratorState state(RandomGenerator::GetState());
+        const NumericalPoint values(DistFunc::rNormal(nR));
+        fullprint << "rNormal(" << nR << ")=" << values << std::endl;
+        RandomGenerator::SetState(state);
+        Bool same(true);
+        for (UnsignedLong iR = 0; iR < nR; ++iR) same = same && (values[iR] == DistFunc::rNormal());
+        fullprint << "same as scalar rNormal()=" << same << std::endl;
+      } // rNormal, array version
     }
   catch (TestFailed & ex)
     {
@@ -0,0 +1,145 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  t_Distribution_concurrent.cxx
+ *  @brief The test file of the concurrent evaluation of a shared distribution
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#include "OT.hxx"
+#include "OTtestcode.hxx"
+
+using namespace OT;
+using namespace OT::Test;
+
+#define NB_THREADS 8
+
+/* The evaluations done by each thread on the shared distribution */
+struct EvaluationTask
+{
+  const Distribution * p_distribution_;
+  const NumericalSample * p_points_;
+  const NumericalPoint * p_levels_;
+  NumericalSample result_;
+};
+
+static NumericalSample evaluate(const Distribution & distribution,
+                                const NumericalSample & points,
+                                const NumericalPoint & levels)
+{
+  const UnsignedLong size(points.getSize());
+  const UnsignedLong dimension(distribution.getDimension());
+  NumericalSample result(size, 4);
+  for (UnsignedLong i = 0; i < size; ++i)
+    {
+      result[i][0] = distribution.computePDF(points[i]);
+      result[i][1] = distribution.computeCDF(points[i]);
+      if (dimension == 1)
+        {
+          result[i][2] = distribution.computeQuantile(levels[i])[0];
+          result[i][3] = std::abs(distribution.computeCharacteristicFunction(points[i][0]));
+        }
+      else
+        {
+          NumericalPoint y(dimension - 1);
+          for (UnsignedLong j = 0; j < dimension - 1; ++j) y[j] = points[i][j];
+          result[i][2] = distribution.getImplementation()->computeConditionalCDF(points[i][dimension - 1], y);
+        }
+    }
+  return result;
+}
+
+void * threadFunc(void * arg)
+{
+  EvaluationTask * task = (EvaluationTask *) arg;
+  task->result_ = evaluate(*task->p_distribution_, *task->p_points_, *task->p_levels_);
+  return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+  TESTPREAMBLE;
+  OStream fullprint(std::cout);
+  setRandomGenerator();
+
+  try
+    {
+      Collection<Distribution> distributions(0);
+      Collection<Distribution> mixtureAtoms(0);
+      mixtureAtoms.add(Uniform(-1.0, 2.0));
+      mixtureAtoms.add(Exponential(2.0, 0.5));
+      mixtureAtoms.add(Normal(1.0, 0.5));
+      distributions.add(RandomMixture(mixtureAtoms));
+      distributions.add(KernelMixture(Normal(), NumericalPoint(1, 0.3), Normal().getSample(50)));
+      distributions.add(LogNormal(0.5, 0.3, 0.0));
+      NumericalPoint theta(3);
+      theta[0] = 1.5;
+      theta[1] = 2.0;
+      theta[2] = 3.0;
+      distributions.add(Dirichlet(theta));
+      Collection<Distribution> marginals(0);
+      marginals.add(Normal());
+      marginals.add(Gamma(2.0, 1.0, 0.0));
+      marginals.add(Beta(2.0, 5.0, -1.0, 1.0));
+      CorrelationMatrix R(3);
+      R(0, 1) = 0.5;
+      R(0, 2) = 0.25;
+      R(1, 2) = -0.3;
+      distributions.add(ComposedDistribution(marginals, NormalCopula(R)));
+
+      const UnsignedLong size(50);
+      NumericalPoint levels(size);
+      for (UnsignedLong i = 0; i < size; ++i) levels[i] = (i + 0.5) / size;
+      for (UnsignedLong n = 0; n < distributions.getSize(); ++n)
+        {
+          // The points are drawn before any evaluation as the generator is not thread-safe
+          const Distribution distribution(distributions[n]);
+          NumericalSample points(distribution.getSample(size));
+          // The reference values are computed by a fresh copy of the distribution
+          const Distribution reference(distribution.getImplementation()->clone());
+          const NumericalSample referenceResult(evaluate(reference, points, levels));
+          // All the threads share the same fresh distribution, caches included
+          const Distribution shared(distribution.getImplementation()->clone());
+          EvaluationTask tasks[NB_THREADS];
+          pthread_t threadsIds[NB_THREADS];
+          for (UnsignedLong i = 0; i < NB_THREADS; ++i)
+            {
+              tasks[i].p_distribution_ = &shared;
+              tasks[i].p_points_ = &points;
+              tasks[i].p_levels_ = &levels;
+              if (pthread_create(&threadsIds[i], NULL, threadFunc, (void *) &tasks[i]) != 0) throw TestFailed("Threads creation failed!");
+            }
+          for (UnsignedLong i = 0; i < NB_THREADS; ++i)
+            if (pthread_join(threadsIds[i], NULL) != 0) throw TestFailed("Threads join failed!");
+          NumericalScalar error(0.0);
+          for (UnsignedLong i = 0; i < NB_THREADS; ++i)
+            for (UnsignedLong j = 0; j < size; ++j)
+              for (UnsignedLong k = 0; k < 4; ++k)
+                error = std::max(error, fabs(tasks[i].result_[j][k] - referenceResult[j][k]) / (1.0 + fabs(referenceResult[j][k])));
+          fullprint << distribution.getImplementation()->getClassName() << " concurrent evaluation ok=" << (error < 1.0e-8) << std::endl;
+          if (error >= 1.0e-8) fullprint << "error=" << error << std::endl;
+        }
+    }
+  catch (TestFailed & ex)
+    {
+      std::cerr << ex << std::endl;
+      return ExitCode::Error;
+    }
+
+  return ExitCode::Success;
+}
@@ -57,6 +57,17 @@ int main(int argc, char *argv[])
       fullprint << "Default exponential=" << estimatedExponential << std::endl;
       estimatedExponential = factory.buildAsExponential(distribution.getParametersCollection());
       fullprint << "Exponential from parameters=" << estimatedExponential << std::endl;
+      // Bootstrap covariance of the parameters
+      estimatedDistribution = factory.build(sample, covariance);
+      const NumericalScalar lambda(estimatedDistribution.getParametersCollection()[0][0]);
+      // Compare the bootstrap variance of lambda to its asymptotic variance
+      fullprint << "bootstrap variance of lambda ok=" << (fabs(covariance(0, 0) / (lambda * lambda / size) - 1.0) < 0.5 ? "true" : "false") << std::endl;
+      CovarianceMatrix covariance2;
+      RandomGenerator::SetSeed(0);
+      factory.build(sample, covariance);
+      RandomGenerator::SetSeed(0);
+      factory.build(sample, covariance2);
+      fullprint << "bootstrap covariance reproducible=" << (covariance == covariance2 ? "true" : "false") << std::endl;
     }
   catch (TestFailed & ex)
     {
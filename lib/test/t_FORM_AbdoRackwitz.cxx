@@ -107,6 +107,23 @@ int main(int argc, char *argv[])
       fullprint << "importance factors=" << printNumericalPoint(result.getImportanceFactors(), digits) << std::endl;
       fullprint << "importance factors (classical)=" << printNumericalPoint(result.getImportanceFactors(true), digits) << std::endl;
       fullprint << "Hasofer reliability index=" << std::setprecision(digits) << result.getHasoferReliabilityIndex() << std::endl;
+
+      /* Same analysis with a block line search, started from several points */
+      AbdoRackwitzSpecificParameters blockSpecific;
+      blockSpecific.setLineSearchBlockSize(4);
+      myAlgorithm.setSpecificParameters(blockSpecific);
+      NumericalSample startingSample(3, mean);
+      startingSample[1][0] = 45.0;
+      startingSample[2][1] = 2.0;
+      FORM myMultiStartAlgo(myAlgorithm, myEvent, mean);
+      myMultiStartAlgo.setPhysicalStartingSample(startingSample);
+      const UnsignedLong callsNumber(myFunction.getEvaluationCallsNumber());
+      myMultiStartAlgo.run();
+      /* The starts evaluate their own clones of the function, only the check of the origin uses the event function */
+      fullprint << "multi-start calls of the event function=" << myFunction.getEvaluationCallsNumber() - callsNumber << std::endl;
+      FORMResult multiStartResult(myMultiStartAlgo.getResult());
+      fullprint << "multi-start event probability=" << multiStartResult.getEventProbability() << std::endl;
+      fullprint << "multi-start standard space design point=" << printNumericalPoint(multiStartResult.getStandardSpaceDesignPoint(), digits) << std::endl;
     }
   catch (TestFailed & ex)
     {
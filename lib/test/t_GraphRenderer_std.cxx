@@ -0,0 +1,154 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  t_GraphRenderer_std.cxx
+ *  @brief The test file of class GraphRenderer for standard methods
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-07-16 15:59:45 +0200 (Mon, 16 Jul 2012)
+ */
+#include <fstream>
+#include "OT.hxx"
+#include "OTtestcode.hxx"
+
+using namespace OT;
+using namespace OT::Test;
+
+static UnsignedLong countOccurrences(const String & text,
+                                     const String & pattern)
+{
+  UnsignedLong count(0);
+  String::size_type position(text.find(pattern));
+  while (position != String::npos)
+    {
+      ++count;
+      position = text.find(pattern, position + pattern.size());
+    }
+  return count;
+}
+
+static String readFile(const String & fileName)
+{
+  std::ifstream file(fileName.c_str());
+  return String(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+int main(int argc, char *argv[])
+{
+  TESTPREAMBLE;
+  OStream fullprint(std::cout);
+  setRandomGenerator();
+
+  try
+    {
+      // A graph mixing curves, clouds, bar plots and staircases
+      Normal distribution(2);
+      NumericalSample sample(distribution.getSample(20000));
+      Graph myGraph("Mixed graph", "x", "y", true, "topright");
+      myGraph.add(Cloud(sample, "blue", "fsquare", "Cloud"));
+      NumericalSample curveData(100, 2);
+      NumericalSample barData(10, 2);
+      for (UnsignedLong i = 0; i < 100; ++i)
+        {
+          curveData[i][0] = -4.0 + 8.0 * i / 99.0;
+          curveData[i][1] = sin(curveData[i][0]);
+          if (i < 10)
+            {
+              barData[i][0] = 0.5;
+              barData[i][1] = 0.1 * i;
+            }
+        }
+      myGraph.add(Curve(curveData, "red", "dashed", 2, "Curve"));
+      myGraph.add(BarPlot(barData, -4.0, "green", "shaded", "solid", "BarPlot"));
+      myGraph.add(Staircase(curveData, "orange", "solid", "s", "Staircase"));
+      GraphRenderer renderer(*myGraph.getImplementation(), 640, 480);
+      String svg(renderer.toSVG());
+      fullprint << "SVG header=" << svg.substr(0, 5) << std::endl;
+      fullprint << "SVG closed=" << (svg.find("</svg>") != String::npos) << std::endl;
+      fullprint << "SVG title=" << (svg.find("Mixed graph") != String::npos) << std::endl;
+      // The cloud is downsampled to the device resolution
+      fullprint << "SVG cloud downsampled=" << (countOccurrences(svg, "<polygon") < sample.getSize()) << std::endl;
+      String pdf(renderer.toPDF());
+      fullprint << "PDF header=" << pdf.substr(0, 5) << std::endl;
+      fullprint << "PDF closed=" << (pdf.find("%%EOF") != String::npos) << std::endl;
+      // The shaded bar plot is drawn with a transparent fill
+      fullprint << "PDF transparency=" << (pdf.find("/ca 0.35") != String::npos) << std::endl;
+
+      // Pie and contour
+      NumericalPoint pieData(4);
+      Description pieLabels(4);
+      for (UnsignedLong i = 0; i < 4; ++i)
+        {
+          pieData[i] = i + 1.0;
+          pieLabels[i] = OSS() << "part" << i;
+        }
+      Graph pieGraph("Pie", "", "", false, "");
+      pieGraph.add(Pie(pieData, pieLabels));
+      String pieSVG(GraphRenderer(*pieGraph.getImplementation()).toSVG());
+      fullprint << "Pie labels=" << countOccurrences(pieSVG, ">part") << std::endl;
+
+      const UnsignedLong nX(21);
+      const UnsignedLong nY(21);
+      NumericalSample x(nX, 1);
+      NumericalSample y(nY, 1);
+      for (UnsignedLong i = 0; i < nX; ++i) x[i][0] = -2.0 + 4.0 * i / (nX - 1.0);
+      for (UnsignedLong j = 0; j < nY; ++j) y[j][0] = -2.0 + 4.0 * j / (nY - 1.0);
+      NumericalSample z(nX * nY, 1);
+      for (UnsignedLong j = 0; j < nY; ++j)
+        for (UnsignedLong i = 0; i < nX; ++i)
+          z[i + j * nX][0] = x[i][0] * x[i][0] + y[j][0] * y[j][0];
+      NumericalPoint levels(3);
+      Description levelLabels(3);
+      for (UnsignedLong k = 0; k < 3; ++k)
+        {
+          levels[k] = k + 1.0;
+          levelLabels[k] = OSS() << "level" << k;
+        }
+      Graph contourGraph("Contour", "x", "y", true, "");
+      contourGraph.add(Contour(x, y, z, levels, levelLabels, true, "Contour"));
+      String contourSVG(GraphRenderer(*contourGraph.getImplementation()).toSVG());
+      fullprint << "Contour labels=" << countOccurrences(contourSVG, ">level") << std::endl;
+
+      // Render all the graphs into files at once
+      Graph::GraphCollection graphs(3);
+      graphs[0] = myGraph;
+      graphs[1] = pieGraph;
+      graphs[2] = contourGraph;
+      Description fileNames(3);
+      fileNames[0] = "GraphRenderer_mixed.svg";
+      fileNames[1] = "GraphRenderer_pie.svg";
+      fileNames[2] = "GraphRenderer_contour.svg";
+      GraphRenderer::DrawGraphs(graphs, fileNames);
+      for (UnsignedLong i = 0; i < fileNames.getSize(); ++i)
+        fullprint << fileNames[i] << " header=" << readFile(fileNames[i]).substr(0, 5) << std::endl;
+
+      // The graph draw method uses the native renderer for SVG output
+      myGraph.draw("GraphRenderer_draw", 640, 480, GraphImplementation::SVG);
+      fullprint << "draw header=" << readFile(myGraph.getSVG()).substr(0, 5) << std::endl;
+      // Without R, all the formats reduce to the native ones
+      ResourceMap::Set("R-executable-command", "");
+      myGraph.draw("GraphRenderer_all", 640, 480, GraphImplementation::ALL);
+      fullprint << "draw all headers=" << readFile(myGraph.getSVG()).substr(0, 5) << " " << readFile(myGraph.getImplementation()->getPDF()).substr(0, 5) << std::endl;
+    }
+  catch (TestFailed & ex)
+    {
+      std::cerr << ex << std::endl;
+      return ExitCode::Error;
+    }
+
+  return ExitCode::Success;
+}
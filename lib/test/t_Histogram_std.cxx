@@ -146,6 +146,27 @@ int main(int argc, char *argv[])
             }
         }
 
+      // Large histogram with bins of various widths
+      {
+        const UnsignedLong binNumber(500);
+        Histogram::HistogramPairCollection largeCollection(binNumber);
+        for (UnsignedLong i = 0; i < binNumber; ++i) largeCollection[i] = HistogramPair(0.5 + (i % 3), 1.0 + (i % 5));
+        const Histogram largeDistribution(0.0, largeCollection);
+        const RandomGeneratorState state(RandomGenerator::GetState());
+        const NumericalSample largeSample(largeDistribution.getSample(100));
+        RandomGenerator::SetState(state);
+        Bool sameAsRealizations(true);
+        for (UnsignedLong i = 0; i < 100; ++i) sameAsRealizations = sameAsRealizations && (largeSample[i] == largeDistribution.getRealization());
+        fullprint << "large histogram sample same as realizations=" << (sameAsRealizations ? "true" : "false") << std::endl;
+        NumericalScalar quantileError(0.0);
+        for (UnsignedLong i = 0; i < 100; ++i)
+          {
+            const NumericalScalar q(RandomGenerator::Generate());
+            quantileError = std::max(quantileError, fabs(q - largeDistribution.computeCDF(largeDistribution.computeQuantile(q))));
+          }
+        fullprint << "large histogram quantile ok=" << (quantileError < 1.0e-12 ? "true" : "false") << std::endl;
+      }
+
       // Specific to this distribution
     }
   catch (TestFailed & ex)
@@ -88,6 +88,20 @@ int main(int argc, char *argv[])
           compactStrategy.store(sample[i]);
         }
       fullprint << "Compact strategy sample (small storage)=" << compactStrategy.getSample() << std::endl;
+      // History using the Spill strategy, blocks written to disk
+      Spill spillStrategy(size / 3);
+      for (UnsignedLong i = 0; i < size; ++i)
+        {
+          spillStrategy.store(sample[i]);
+        }
+      fullprint << "Spill strategy sample=" << spillStrategy.getSample() << std::endl;
+      fullprint << "Spill strategy block number=" << spillStrategy.getBlockNumber() << " block 1=" << spillStrategy.getBlock(1) << std::endl;
+      // A copy keeps its own history
+      Spill spillCopy(spillStrategy);
+      spillCopy.store(sample[0]);
+      spillCopy.store(sample[1]);
+      fullprint << "Spill strategy size=" << spillStrategy.getSize() << " copy size=" << spillCopy.getSize() << " copy block number=" << spillCopy.getBlockNumber() << std::endl;
+      fullprint << "Spill strategy block 2=" << spillStrategy.getBlock(2) << " copy block 3=" << spillCopy.getBlock(3) << std::endl;
     }
   catch (TestFailed & ex)
     {
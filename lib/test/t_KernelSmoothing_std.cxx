@@ -115,6 +115,36 @@ int main(int argc, char *argv[])
                 }
             }
         }
+      // Test for the binned computations on a large sample
+      const NumericalSample largeSample(Normal().getSample(2000));
+      KernelSmoothing smoother;
+      const NumericalScalar hBinned(smoother.computePluginBandwidth(largeSample)[0]);
+      ResourceMap::SetAsUnsignedLong("KernelSmoothing-BinNumber", 2000);
+      const NumericalScalar hExact(smoother.computePluginBandwidth(largeSample)[0]);
+      fullprint << "binned plugin bandwidth ok=" << (fabs(hBinned - hExact) < 1.0e-3 * hExact) << std::endl;
+      const KernelMixture mixture(Normal(), smoother.computeSilvermanBandwidth(largeSample), largeSample);
+      const NumericalSample gridPDF(mixture.computePDF(-4.0, 4.0, 129));
+      const NumericalSample gridCDF(mixture.computeCDF(-4.0, 4.0, 129));
+      NumericalSample gridPoints(129, 1);
+      NumericalScalar gridPDFError(0.0);
+      NumericalScalar gridCDFError(0.0);
+      for (UnsignedLong i = 0; i < 129; ++i)
+        {
+          gridPoints[i][0] = gridPDF[i][0];
+          gridPDFError = std::max(gridPDFError, fabs(gridPDF[i][1] - mixture.computePDF(gridPoints[i])));
+          gridCDFError = std::max(gridCDFError, fabs(gridCDF[i][1] - mixture.computeCDF(gridPoints[i])));
+        }
+      fullprint << "binned grid pdf ok=" << (gridPDFError < 1.0e-4) << " binned grid cdf ok=" << (gridCDFError < 1.0e-4) << std::endl;
+      const NumericalSample samplePDF(mixture.computePDF(gridPoints));
+      const NumericalSample sampleCDF(mixture.computeCDF(gridPoints));
+      NumericalScalar samplePDFError(0.0);
+      NumericalScalar sampleCDFError(0.0);
+      for (UnsignedLong i = 0; i < 129; ++i)
+        {
+          samplePDFError = std::max(samplePDFError, fabs(samplePDF[i][0] - gridPDF[i][1]));
+          sampleCDFError = std::max(sampleCDFError, fabs(sampleCDF[i][0] - gridCDF[i][1]));
+        }
+      fullprint << "binned sample pdf ok=" << (samplePDFError < 1.0e-4) << " binned sample cdf ok=" << (sampleCDFError < 1.0e-4) << std::endl;
     }
   catch (TestFailed & ex)
     {
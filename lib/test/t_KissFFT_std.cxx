@@ -69,6 +69,46 @@ int main(int argc, char *argv[])
       const NumericalComplexCollection inverseTransformedCollection(myFFT.inverseTransform(transformedCollection));
       fullprint << "FFT back=" << inverseTransformedCollection << std::endl;
 
+      // Real transformation, odd and even sizes
+      for (UnsignedLong realSize = 15; realSize <= 16; ++realSize)
+        {
+          Collection<NumericalScalar> realCollection(realSize);
+          NumericalComplexCollection complexCollection(realSize);
+          for (UnsignedLong index = 0; index < realSize; ++index)
+            {
+              realCollection[index] = sin(0.7 * index) + 0.1 * index;
+              complexCollection[index] = realCollection[index];
+            }
+          const NumericalComplexCollection realTransformed(myFFT.transform(realCollection));
+          const NumericalComplexCollection complexTransformed(myFFT.transform(complexCollection));
+          const Collection<NumericalScalar> realBack(myFFT.inverseTransformReal(realTransformed));
+          NumericalScalar transformError(0.0);
+          NumericalScalar backError(0.0);
+          for (UnsignedLong index = 0; index < realSize; ++index)
+            {
+              transformError = std::max(transformError, std::abs(realTransformed[index] - complexTransformed[index]));
+              backError = std::max(backError, std::abs(realBack[index] - realCollection[index]));
+            }
+          fullprint << "size=" << realSize << " real FFT ok=" << (transformError < 1.0e-12) << " real FFT back ok=" << (backError < 1.0e-12) << std::endl;
+        }
+
+      // Batch transformation of 3 consecutive sequences, performed in place
+      NumericalComplexCollection batch(3 * size);
+      for (UnsignedLong index = 0; index < 3 * size; ++index) batch[index] = NumericalComplex(cos(0.3 * index), sin(0.5 * index));
+      const NumericalComplexCollection initialBatch(batch);
+      myFFT.transformBatch(batch, size);
+      NumericalScalar batchError(0.0);
+      for (UnsignedLong first = 0; first < 3 * size; first += size)
+        {
+          const NumericalComplexCollection sequenceTransformed(myFFT.transform(initialBatch, first, size));
+          for (UnsignedLong index = 0; index < size; ++index) batchError = std::max(batchError, std::abs(batch[first + index] - sequenceTransformed[index]));
+        }
+      fullprint << "FFT batch ok=" << (batchError < 1.0e-12) << std::endl;
+      myFFT.inverseTransformBatch(batch, size);
+      batchError = 0.0;
+      for (UnsignedLong index = 0; index < 3 * size; ++index) batchError = std::max(batchError, std::abs(batch[index] - initialBatch[index]));
+      fullprint << "FFT batch back ok=" << (batchError < 1.0e-12) << std::endl;
+
 
     }
   catch (TestFailed & ex)
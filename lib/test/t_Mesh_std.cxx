@@ -115,6 +115,21 @@ int main(int argc, char *argv[])
         mesh2D.draw().draw("mesh2D");
         p[0] = 1.3;
         p[1] = 0.8;
+        NumericalPoint coordinates;
+        const UnsignedLong index(mesh2D.locate(p, coordinates));
+        fullprint << "p=" << p << " is in simplex=" << index << " with barycentric coordinates=" << coordinates << std::endl;
+        // Batch location compared to a check against each simplex
+        const NumericalSample sample(ComposedDistribution(Collection<Distribution>(2, Uniform(-0.5, 2.5))).getSample(100));
+        NumericalSample sampleCoordinates;
+        const Indices indices(mesh2D.locate(sample, sampleCoordinates));
+        Bool locateOk(true);
+        for (UnsignedLong i = 0; i < sample.getSize(); ++i)
+          {
+            UnsignedLong reference(0);
+            while ((reference < simplicies.getSize()) && !mesh2D.checkPointInSimplex(sample[i], reference)) ++reference;
+            locateOk = locateOk && (indices[i] == reference);
+          }
+        fullprint << "batch locate ok=" << locateOk << std::endl;
       }
     }
   catch (TestFailed & ex)
@@ -73,6 +73,40 @@ int main(int argc, char *argv[])
       /* Stream out the result */
       fullprint << "MonteCarlo result=" << myAlgo.getResult() << std::endl;
 
+      /* Perform the simulation with several blocks in flight */
+      RandomGenerator::SetSeed(0);
+      myAlgo.setConcurrentBlockNumber(4);
+      myAlgo.run();
+      const SimulationResult result4(myAlgo.getResult());
+      fullprint << "MonteCarlo result with 4 concurrent blocks=" << result4 << std::endl;
+
+      /* The result does not depend on the number of blocks in flight, as long as there are several of them */
+      RandomGenerator::SetSeed(0);
+      myAlgo.setConcurrentBlockNumber(7);
+      myAlgo.run();
+      const SimulationResult result7(myAlgo.getResult());
+      fullprint << "Same result with 7 concurrent blocks=" << ((result7.getProbabilityEstimate() == result4.getProbabilityEstimate()) && (result7.getOuterSampling() == result4.getOuterSampling())) << std::endl;
+      /* The blocks past the convergence are not merged */
+      fullprint << "Convergence history size=" << myAlgo.getConvergenceStrategy().getSample().getSize() << std::endl;
+
+      /* An analytical function cannot be evaluated concurrently, so the blocks are computed one after the other with the same random streams */
+      Description inputVariables(dim);
+      inputVariables[0] = "E";
+      inputVariables[1] = "F";
+      inputVariables[2] = "L";
+      inputVariables[3] = "I";
+      NumericalMathFunction analyticalFunction(inputVariables, Description(1, "d"), Description(1, "-(F*L*L*L)/(3*E*I)"));
+      MonteCarlo analyticalAlgo(Event(RandomVector(analyticalFunction, vect), Less(), -3.0));
+      analyticalAlgo.setMaximumOuterSampling(4000);
+      analyticalAlgo.setBlockSize(8);
+      analyticalAlgo.setMaximumCoefficientOfVariation(0.0);
+      analyticalAlgo.setMaximumStandardDeviation(0.0025);
+      analyticalAlgo.setConcurrentBlockNumber(4);
+      RandomGenerator::SetSeed(0);
+      analyticalAlgo.run();
+      const SimulationResult analyticalResult(analyticalAlgo.getResult());
+      fullprint << "Same result with an analytical function=" << ((analyticalResult.getProbabilityEstimate() == result4.getProbabilityEstimate()) && (analyticalResult.getOuterSampling() == result4.getOuterSampling())) << std::endl;
+
     }
   catch (TestFailed & ex)
     {
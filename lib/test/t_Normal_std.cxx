@@ -107,6 +107,11 @@ int main(int argc, char *argv[])
           fullprint << "ddf (FD)=" << clean(ddfFD) << std::endl;
           NumericalScalar LPDF = distribution.computeLogPDF( point );
           fullprint << "log pdf=" << LPDF << std::endl;
+          // The log pdf of a sample stays finite far in the tails
+          NumericalSample logPDFSample(0, distribution.getDimension());
+          logPDFSample.add(point);
+          logPDFSample.add(point * 100.0);
+          fullprint << "log pdf (sample)=" << distribution.computeLogPDF( logPDFSample ) << std::endl;
           NumericalScalar PDF = distribution.computePDF( point );
           fullprint << "pdf     =" << PDF << std::endl;
           if (dim == 1)
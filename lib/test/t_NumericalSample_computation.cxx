@@ -103,6 +103,66 @@ int main(int argc, char *argv[])
       fullprint << "Pearson correlation=" << RPearson << std::endl;
       CorrelationMatrix RSpearman(normalSample.computeSpearmanCorrelation());
       fullprint << "Spearman correlation=" << RSpearman << std::endl;
+      CorrelationMatrix RKendallExact(dim);
+      for (UnsignedLong i = 0; i < dim; i++)
+        {
+          for (UnsignedLong j = 0; j < i; j++)
+            {
+              RKendallExact(i, j) = 2.0 * asin(R(i, j)) / M_PI;
+            }
+        }
+      fullprint << "Kendall tau (exact)=" << RKendallExact << std::endl;
+      CorrelationMatrix RKendall(normalSample.computeKendallTau());
+      fullprint << "Kendall tau=" << RKendall << std::endl;
+      // Rounded sample, with many ties
+      for (UnsignedLong i = 0; i < size; i++)
+        {
+          for (UnsignedLong j = 0; j < dim; j++)
+            {
+              normalSample[i][j] = round(2.0 * normalSample[i][j]);
+            }
+        }
+      CorrelationMatrix RKendallTies(normalSample.computeKendallTau());
+      fullprint << "Kendall tau (ties)=" << RKendallTies << std::endl;
+      // Reference tau-b computed pair by pair
+      NumericalScalar maximumError(0.0);
+      for (UnsignedLong i = 0; i < dim; i++)
+        {
+          for (UnsignedLong j = 0; j < i; j++)
+            {
+              NumericalScalar concordant(0.0);
+              NumericalScalar discordant(0.0);
+              NumericalScalar tiesI(0.0);
+              NumericalScalar tiesJ(0.0);
+              for (UnsignedLong k = 0; k < size; k++)
+                {
+                  for (UnsignedLong l = 0; l < k; l++)
+                    {
+                      const NumericalScalar deltaI(normalSample[k][i] - normalSample[l][i]);
+                      const NumericalScalar deltaJ(normalSample[k][j] - normalSample[l][j]);
+                      if ((deltaI == 0.0) && (deltaJ == 0.0)) continue;
+                      if (deltaI == 0.0) tiesI += 1.0;
+                      else if (deltaJ == 0.0) tiesJ += 1.0;
+                      else if (deltaI * deltaJ > 0.0) concordant += 1.0;
+                      else discordant += 1.0;
+                    }
+                }
+              const NumericalScalar reference((concordant - discordant) / sqrt((concordant + discordant + tiesI) * (concordant + discordant + tiesJ)));
+              maximumError = std::max(maximumError, std::abs(RKendallTies(i, j) - reference));
+            }
+        }
+      fullprint << "Kendall tau (ties) matches the pairwise tau-b=" << (maximumError < 1.0e-12) << std::endl;
+      // Known tau-b values, with ties and a constant component
+      NumericalSample tiedSample(8, 3);
+      const NumericalScalar tiedData[8][2] = {{1, 2}, {2, 1}, {2, 3}, {3, 3}, {4, 2}, {5, 6}, {5, 5}, {6, 4}};
+      for (UnsignedLong k = 0; k < 8; k++)
+        {
+          tiedSample[k][0] = tiedData[k][0];
+          tiedSample[k][1] = tiedData[k][1];
+          tiedSample[k][2] = 5.0;
+        }
+      const CorrelationMatrix tiedTau(tiedSample.computeKendallTau());
+      fullprint << "Kendall tau (known values)=" << ((std::abs(tiedTau(1, 0) - 7.0 / 13.0) < 1.0e-14) && (tiedTau(2, 0) == 0.0) && (tiedTau(2, 1) == 0.0)) << std::endl;
     }
   catch (TestFailed & ex)
     {
@@ -97,6 +97,28 @@ int main(int argc, char *argv[])
       fullprint << "psample 3 mean=" << psample3.computeMean() << std::endl;
       fullprint << "psample 3 temporal mean=" << psample3.computeTemporalMean() << std::endl;
 
+      // Direct access to the values
+      psample3(1, 2, 0) = -1.0;
+      fullprint << "psample3(1, 2, 0)=" << psample3(1, 2, 0) << std::endl;
+
+      // Binary export, then append, then import
+      const FileName fileName(Path::BuildTemporaryFileName("ProcessSample_std.bin.XXXXXX"));
+      psample3.exportToBinaryFile(fileName);
+      psample2.exportToBinaryFile(fileName, true);
+      ProcessSample psample4(ProcessSample::ImportFromBinaryFile(fileName));
+      fullprint << "imported size=" << psample4.getSize() << ", dimension=" << psample4.getDimension() << ", time grid=" << psample4.getTimeGrid() << std::endl;
+      fullprint << "imported psample4[1]=" << psample4[1] << std::endl;
+      fullprint << "imported mean=" << psample4.computeMean() << std::endl;
+      fullprint << "imported median=" << psample4.computeQuantilePerComponent(0.5) << std::endl;
+      fullprint << "imported temporal mean=" << psample4.computeTemporalMean() << std::endl;
+      // The modification of an imported sample does not modify the file
+      psample4(0, 0, 0) = 10.0;
+      fullprint << "modified psample4(0, 0, 0)=" << psample4(0, 0, 0) << std::endl;
+      fullprint << "stored value=" << ProcessSample::ImportFromBinaryFile(fileName)(0, 0, 0) << std::endl;
+      // Probability for a time series to enter a domain
+      fullprint << "P(some value >= 5)=" << psample4.computeEventProbability(Interval(NumericalPoint(1, 5.0), NumericalPoint(1, 100.0))) << std::endl;
+      remove(fileName.c_str());
+
 
 
 
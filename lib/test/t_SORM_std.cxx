@@ -107,6 +107,22 @@ int main(int argc, char *argv[])
       fullprint << "importance factors (classical)=" << printNumericalPoint(result.getImportanceFactors(true), digits) << std::endl;
       fullprint << "Hasofer reliability index=" << std::setprecision(digits) << result.getHasoferReliabilityIndex() << std::endl;
 
+      /* Same analysis using the quasi-Newton approximation of the hessian */
+      myAlgo.setQuasiNewtonHessian(true);
+      /* Without refinement, the hessian is the SR1 approximation along the path of the nearest point algorithm */
+      ResourceMap::SetAsUnsignedLong("SORMResult-QuasiNewtonRefinementNumber", 0);
+      myAlgo.run();
+      SORMResult quasiNewtonResult(myAlgo.getResult());
+      fullprint << "quasi-Newton (no refinement) Breitung event probability=" << std::setprecision(digits) << quasiNewtonResult.getEventProbabilityBreitung() << std::endl;
+      fullprint << "quasi-Newton (no refinement) sorted curvatures=" << printNumericalPoint(quasiNewtonResult.getSortedCurvatures(), digits) << std::endl;
+      /* With fewer refined directions than the dimension, only the main principal directions are exact */
+      ResourceMap::SetAsUnsignedLong("SORMResult-QuasiNewtonRefinementNumber", 2);
+      myAlgo.run();
+      quasiNewtonResult = myAlgo.getResult();
+      fullprint << "quasi-Newton (2 refined directions) Breitung event probability=" << std::setprecision(digits) << quasiNewtonResult.getEventProbabilityBreitung() << std::endl;
+      fullprint << "quasi-Newton (2 refined directions) sorted curvatures=" << printNumericalPoint(quasiNewtonResult.getSortedCurvatures(), digits) << std::endl;
+      ResourceMap::SetAsUnsignedLong("SORMResult-QuasiNewtonRefinementNumber", 5);
+
     }
   catch (TestFailed & ex)
     {
@@ -74,6 +74,46 @@ int main(int argc, char *argv[])
       fullprint << "Total order Sobol indice of Y|X3 = " << totalOrderIndices[2] << std::endl;
       fullprint << "Second order Sobol indice of Y|X1,X3 = " << secondOrderIndices(0, 2) << std::endl;
 
+      // Exact indices of the Ishigami function with a=7 and b=0.1
+      const NumericalScalar a(7.0);
+      const NumericalScalar b(0.1);
+      const NumericalScalar pi4(pow(M_PI, 4.0));
+      const NumericalScalar variance(0.125 * a * a + 0.2 * b * pi4 + b * b * pi4 * pi4 / 18.0 + 0.5);
+      const NumericalScalar exactFirstOrder1(0.5 * (1.0 + 0.2 * b * pi4) * (1.0 + 0.2 * b * pi4) / variance);
+      const NumericalScalar exactTotalOrder3(8.0 * b * b * pi4 * pi4 / (225.0 * variance));
+      const NumericalScalar exactSecondOrder13(exactTotalOrder3);
+      fullprint << "Exact first order Sobol indice of Y|X1 = " << exactFirstOrder1 << std::endl;
+      fullprint << "Exact total order Sobol indice of Y|X3 = " << exactTotalOrder3 << std::endl;
+      fullprint << "Exact second order Sobol indice of Y|X1,X3 = " << exactSecondOrder13 << std::endl;
+      if ((fabs(firstOrderIndices[0] - exactFirstOrder1) > 0.02) || (fabs(totalOrderIndices[2] - exactTotalOrder3) > 0.02) || (fabs(secondOrderIndices(0, 2) - exactSecondOrder13) > 0.05))
+        throw TestFailed("the Sobol indices are too far from the exact ones");
+
+      // Bootstrap confidence intervals
+      sensitivitySobol.setBootstrapSize(50);
+      Interval firstOrderInterval(sensitivitySobol.getFirstOrderIndicesInterval(0, 0.9));
+      Interval totalOrderInterval(sensitivitySobol.getTotalOrderIndicesInterval(0, 0.9));
+      fullprint << "First order Sobol indice of Y|X1 in [" << firstOrderInterval.getLowerBound()[0] << ", " << firstOrderInterval.getUpperBound()[0] << "]" << std::endl;
+      fullprint << "Total order Sobol indice of Y|X3 in [" << totalOrderInterval.getLowerBound()[2] << ", " << totalOrderInterval.getUpperBound()[2] << "]" << std::endl;
+      // The intervals must contain the estimates, and the exact values at a high enough level
+      sensitivitySobol.setBootstrapSize(200);
+      const Interval firstOrderInterval99(sensitivitySobol.getFirstOrderIndicesInterval(0, 0.99));
+      const Interval totalOrderInterval99(sensitivitySobol.getTotalOrderIndicesInterval(0, 0.99));
+      const Bool firstOrderContained((firstOrderInterval.getLowerBound()[0] <= firstOrderIndices[0]) && (firstOrderIndices[0] <= firstOrderInterval.getUpperBound()[0]) && (firstOrderInterval99.getLowerBound()[0] <= exactFirstOrder1) && (exactFirstOrder1 <= firstOrderInterval99.getUpperBound()[0]));
+      const Bool totalOrderContained((totalOrderInterval.getLowerBound()[2] <= totalOrderIndices[2]) && (totalOrderIndices[2] <= totalOrderInterval.getUpperBound()[2]) && (totalOrderInterval99.getLowerBound()[2] <= exactTotalOrder3) && (exactTotalOrder3 <= totalOrderInterval99.getUpperBound()[2]));
+      fullprint << "First order intervals contain the estimate and the exact value=" << firstOrderContained << std::endl;
+      fullprint << "Total order intervals contain the estimate and the exact value=" << totalOrderContained << std::endl;
+      if (!firstOrderContained || !totalOrderContained) throw TestFailed("the bootstrap intervals do not contain the exact Sobol indices");
+
+      // The indices do not depend on a large constant added to the output, the moments being centered
+      Description shiftedFormula(1, "1.0e8+" + formula[0]);
+      SensitivityAnalysis shiftedSobol(sample1, sample2, NumericalMathFunction(inputName, outputName, shiftedFormula));
+      shiftedSobol.setBlockSize(17);
+      const NumericalPoint shiftedFirstOrderIndices(shiftedSobol.getFirstOrderIndices());
+      const NumericalPoint shiftedTotalOrderIndices(shiftedSobol.getTotalOrderIndices());
+      const Bool sameShifted((fabs(shiftedFirstOrderIndices[0] - firstOrderIndices[0]) < 1.0e-5) && (fabs(shiftedTotalOrderIndices[2] - totalOrderIndices[2]) < 1.0e-5));
+      fullprint << "Same indices with a shifted output=" << sameShifted << std::endl;
+      if (!sameShifted) throw TestFailed("the Sobol indices depend on the mean of the output");
+
     }
   catch (TestFailed & ex)
     {
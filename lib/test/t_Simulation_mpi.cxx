@@ -0,0 +1,211 @@
+//                                               -*- C++ -*-
+/**
+ *  @file  t_Simulation_mpi.cxx
+ *  @brief The test file of the dealing of the simulation blocks between processes
+ *
+ *  Copyright (C) 2005-2013 EDF-EADS-Phimeca
+ *
+ *  This library is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  @author schueller
+ *  @date   2012-02-17 19:35:43 +0100 (Fri, 17 Feb 2012)
+ */
+#include "OT.hxx"
+#include "OTtestcode.hxx"
+
+using namespace OT;
+using namespace OT::Test;
+
+/* Give access to the dealing of the blocks between processes */
+template <class T>
+class BlockDealer
+  : public T
+{
+public:
+  BlockDealer(const Event & event)
+    : T(event)
+  {
+    this->setMaximumOuterSampling(6);
+    this->setBlockSize(10);
+  }
+
+  NumericalPoint deal(const RandomGenerator::UnsignedLongCollection & seeds,
+                      const UnsignedLong rank,
+                      const UnsignedLong size)
+  {
+    return this->computeBlockEstimates(seeds, rank, size);
+  }
+};
+
+/* All the processes share the permutations of the LHS cells */
+class LHSBlockDealer
+  : public BlockDealer<LHS>
+{
+public:
+  LHSBlockDealer(const Event & event,
+                 const Indices & keys)
+    : BlockDealer<LHS>(event)
+  {
+    keys_ = keys;
+  }
+};
+
+/* Emulate the given number of processes, each one with its own instance of the algorithm, and check that the gathered estimators are the ones of a single process */
+template <class T>
+Bool checkDealing(OStream & fullprint,
+                  const String & name,
+                  const Event & event,
+                  const RandomGenerator::UnsignedLongCollection & seeds,
+                  const UnsignedLong size)
+{
+  const MPICommunicator communicator(MPICommunicator::GetCommWorld());
+  T single(event);
+  const NumericalPoint reference(single.deal(seeds, 0, 1));
+  NumericalPoint gathered(reference.getDimension(), 0.0);
+  for (UnsignedLong rank = 0; rank < size; ++rank)
+    {
+      T process(event);
+      gathered += process.deal(seeds, rank, size);
+    }
+  gathered = communicator.allReduceSum(gathered);
+  const Bool same(gathered == reference);
+  fullprint << name << " same block estimators with " << size << " processes=" << same << std::endl;
+  return same;
+}
+
+Bool checkLHSDealing(OStream & fullprint,
+                     const Event & event,
+                     const Indices & keys,
+                     const RandomGenerator::UnsignedLongCollection & seeds,
+                     const UnsignedLong size)
+{
+  LHSBlockDealer single(event, keys);
+  const NumericalPoint reference(single.deal(seeds, 0, 1));
+  NumericalPoint gathered(reference.getDimension(), 0.0);
+  for (UnsignedLong rank = 0; rank < size; ++rank)
+    {
+      LHSBlockDealer process(event, keys);
+      gathered += process.deal(seeds, rank, size);
+    }
+  const Bool same(gathered == reference);
+  fullprint << "LHS same block estimators with " << size << " processes=" << same << std::endl;
+  return same;
+}
+
+/* The algorithms whose state evolves from block to block keep drawing their blocks from the global stream within a single process */
+template <class T>
+Bool checkSingleProcessPath(OStream & fullprint,
+                            const String & name,
+                            const Event & event)
+{
+  SimulationResult results[2];
+  const UnsignedLong concurrentBlockNumbers[2] = {1, 4};
+  for (UnsignedLong i = 0; i < 2; ++i)
+    {
+      T algo(event);
+      algo.setMaximumOuterSampling(12);
+      algo.setBlockSize(10);
+      algo.setMaximumCoefficientOfVariation(0.0);
+      algo.setConcurrentBlockNumber(concurrentBlockNumbers[i]);
+      RandomGenerator::SetSeed(0);
+      algo.run();
+      results[i] = algo.getResult();
+    }
+  const Bool same((results[0].getProbabilityEstimate() == results[1].getProbabilityEstimate()) && (results[0].getVarianceEstimate() == results[1].getVarianceEstimate()) && (results[0].getOuterSampling() == results[1].getOuterSampling()));
+  fullprint << name << " same result with 1 and 4 concurrent blocks=" << same << std::endl;
+  return same;
+}
+
+int main(int argc, char *argv[])
+{
+  TESTPREAMBLE;
+  OStream fullprint(std::cout);
+  setRandomGenerator();
+
+  try
+    {
+      /* Without MPI, the global communicator holds a single process */
+      const MPICommunicator communicator(MPICommunicator::GetCommWorld());
+      fullprint << "rank=" << communicator.getRank() << " size=" << communicator.getSize() << std::endl;
+      NumericalPoint values(3);
+      values[0] = 1.5;
+      values[1] = -2.0;
+      values[2] = 0.25;
+      fullprint << "allReduceSum=" << communicator.allReduceSum(values) << std::endl;
+      NumericalPoint broadcastValues(values);
+      communicator.broadcast(broadcastValues);
+      fullprint << "broadcast=" << broadcastValues << std::endl;
+
+      /* The event */
+      Description inputVariables(4);
+      inputVariables[0] = "E";
+      inputVariables[1] = "F";
+      inputVariables[2] = "L";
+      inputVariables[3] = "I";
+      NumericalMathFunction myFunction(inputVariables, Description(1, "d"), Description(1, "-(F*L*L*L)/(3*E*I)"));
+      NumericalPoint mean(4);
+      mean[0] = 50.0;
+      mean[1] =  1.0;
+      mean[2] = 10.0;
+      mean[3] =  5.0;
+      Normal myDistribution(mean, NumericalPoint(4, 1.0), IdentityMatrix(4));
+      RandomVector vect(myDistribution);
+      RandomVector output(myFunction, vect);
+      Event myEvent(output, Less(), -3.0);
+
+      Bool ok(true);
+      /* The blocks dealt to several processes give the same estimators as a single process, the processes skipping the blocks of the others */
+      RandomGenerator::SetSeed(0);
+      const RandomGenerator::UnsignedLongCollection seeds(RandomGenerator::IntegerGenerate(6, 4294967295UL));
+      const Indices keys(LHSExperiment::ComputePermutationKeys(4));
+      for (UnsignedLong size = 1; size <= 4; ++size)
+        {
+          ok = checkDealing< BlockDealer<MonteCarlo> >(fullprint, "MonteCarlo", myEvent, seeds, size) && ok;
+          ok = checkLHSDealing(fullprint, myEvent, keys, seeds, size) && ok;
+          ok = checkDealing< BlockDealer<QuasiMonteCarlo> >(fullprint, "QuasiMonteCarlo", myEvent, seeds, size) && ok;
+          ok = checkDealing< BlockDealer<RandomizedQuasiMonteCarlo> >(fullprint, "RandomizedQuasiMonteCarlo", myEvent, seeds, size) && ok;
+        }
+
+      /* Within a single process, the Monte Carlo blocks in flight use the same streams as the dealt blocks */
+      BlockDealer<MonteCarlo> dealer(myEvent);
+      const NumericalPoint estimates(dealer.deal(seeds, 0, 1));
+      NumericalScalar blockMean(0.0);
+      for (UnsignedLong i = 0; i < 6; ++i) blockMean += estimates[2 * i] / 6.0;
+      MonteCarlo myAlgo(myEvent);
+      myAlgo.setMaximumOuterSampling(6);
+      myAlgo.setBlockSize(10);
+      myAlgo.setMaximumCoefficientOfVariation(0.0);
+      myAlgo.setConcurrentBlockNumber(6);
+      RandomGenerator::SetSeed(0);
+      myAlgo.run();
+      const Bool sameMonteCarlo((myAlgo.getResult().getOuterSampling() == 6) && (fabs(myAlgo.getResult().getProbabilityEstimate() - blockMean) < 1.0e-14));
+      fullprint << "MonteCarlo same result as the dealt blocks=" << sameMonteCarlo << std::endl;
+      ok = ok && sameMonteCarlo;
+
+      /* The algorithms whose blocks are not independent do not switch to seeded streams */
+      ok = checkSingleProcessPath<LHS>(fullprint, "LHS", myEvent) && ok;
+      ok = checkSingleProcessPath<QuasiMonteCarlo>(fullprint, "QuasiMonteCarlo", myEvent) && ok;
+      ok = checkSingleProcessPath<RandomizedQuasiMonteCarlo>(fullprint, "RandomizedQuasiMonteCarlo", myEvent) && ok;
+
+      if (!ok) throw TestFailed("the dealing of the blocks between processes changes the result");
+    }
+  catch (TestFailed & ex)
+    {
+      std::cerr << ex << std::endl;
+      return ExitCode::Error;
+    }
+
+
+  return ExitCode::Success;
+}
@@ -25,6 +25,7 @@
 #include <sstream>
 
 #include "OTconfig.hxx"
+#include <fstream>
 #include "OT.hxx"
 #include "OTtestcode.hxx"
 
@@ -936,6 +937,11 @@ int main(int argc, char *argv[])
       study.add("userDefinedCovarianceModel", userDefinedCovarianceModel);
       study.add("userDefinedStationaryCovarianceModel", userDefinedStationaryCovarianceModel);
 
+      // HistoryStrategy
+      Spill spill(2);
+      for (UnsignedLong i = 0; i < 7; ++i) spill.store(NumericalPoint(2, i));
+      study.add("spill", spill);
+
 
 
       fullprint << "Save the study..." << std::endl;
@@ -1063,6 +1069,51 @@ int main(int argc, char *argv[])
       compare<UserDefinedCovarianceModel>( userDefinedCovarianceModel, study2 );
       compare<UserDefinedStationaryCovarianceModel>( userDefinedStationaryCovarianceModel, study2 );
 
+      // HistoryStrategy, the blocks written to the file of the loaded strategy
+      {
+        Spill loadedSpill;
+        study2.fillObject("spill", loadedSpill);
+        fullprint << "saved  Spill sample = " << spill.getSample() << std::endl;
+        fullprint << "loaded Spill sample = " << loadedSpill.getSample() << " block number=" << loadedSpill.getBlockNumber() << std::endl;
+      }
+
+      // A process sample saved in the former format, as a collection of time series
+      {
+        const char formerFileName[] = "myFormerStudy.xml";
+        std::ofstream formerFile(formerFileName);
+        formerFile << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                   << "<openturns-study version=\"1\">\n"
+                   << "  <object class=\"PersistentCollection&lt;NumericalScalar&gt;\" id=\"1\" size=\"6\" StudyVisible=\"false\" StudyLabel=\"\">\n"
+                   << "    <numericalscalar index=\"0\">0</numericalscalar>\n"
+                   << "    <numericalscalar index=\"1\">1</numericalscalar>\n"
+                   << "    <numericalscalar index=\"2\">0.5</numericalscalar>\n"
+                   << "    <numericalscalar index=\"3\">2</numericalscalar>\n"
+                   << "    <numericalscalar index=\"4\">1</numericalscalar>\n"
+                   << "    <numericalscalar index=\"5\">3</numericalscalar>\n"
+                   << "  </object>\n"
+                   << "  <object class=\"TimeSeriesImplementation\" id=\"2\" start_=\"0\" timeStep_=\"0.5\" n_=\"3\" dimension_=\"1\" StudyVisible=\"false\" StudyLabel=\"\">\n"
+                   << "    <object member=\"data_\" id=\"1\"/>\n"
+                   << "  </object>\n"
+                   << "  <object class=\"PersistentCollection&lt;TimeSeries&gt;\" id=\"3\" size=\"2\" StudyVisible=\"false\" StudyLabel=\"\">\n"
+                   << "    <object index=\"0\" id=\"2\"/>\n"
+                   << "    <object index=\"1\" id=\"2\"/>\n"
+                   << "  </object>\n"
+                   << "  <object class=\"RegularGrid\" id=\"4\" start_=\"0\" step_=\"0.5\" n_=\"3\" StudyVisible=\"false\" StudyLabel=\"\"/>\n"
+                   << "  <object class=\"ProcessSample\" id=\"5\" dimension_=\"1\" StudyVisible=\"true\" StudyLabel=\"processSample\">\n"
+                   << "    <object member=\"timeGrid_\" id=\"4\"/>\n"
+                   << "    <object member=\"data_\" id=\"3\"/>\n"
+                   << "  </object>\n"
+                   << "</openturns-study>\n";
+        formerFile.close();
+        Study formerStudy;
+        formerStudy.setStorageManager(XMLStorageManager(formerFileName));
+        formerStudy.load();
+        ProcessSample processSample;
+        formerStudy.fillObject("processSample", processSample);
+        fullprint << "loaded former ProcessSample = " << processSample << std::endl;
+        Os::Remove(formerFileName);
+      }
+
       // cleanup
       Os::Remove(fileName);
     }
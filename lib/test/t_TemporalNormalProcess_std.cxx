@@ -69,6 +69,28 @@ int main(int argc, char *argv[])
       TemporalNormalProcess myProcess1(myCovModel, myTimeGrid);
       fullprint << "myProcess1 = " << myProcess1 << std::endl;
       fullprint << "mean over " << size << " realizations= " << myProcess1.getSample(size).computeMean() << std::endl;
+      fullprint << "sampling method=" << myProcess1.getSamplingMethod() << std::endl;
+
+      /* Stationary covariance with a smooth covariance function */
+      const UnsignedLong nLarge(50);
+      RegularGrid myLargeTimeGrid(tmin, step, nLarge);
+      UserDefinedStationaryCovarianceModel::CovarianceMatrixCollection covarianceCollection(nLarge);
+      for (UnsignedLong i = 0; i < nLarge; ++i)
+        {
+          CovarianceMatrix covariance(1);
+          covariance(0, 0) = exp(-0.5 * pow(i * step, 2.0));
+          covarianceCollection[i] = covariance;
+        }
+      UserDefinedStationaryCovarianceModel mySmoothModel(myLargeTimeGrid, covarianceCollection);
+      TemporalNormalProcess myProcess2(mySmoothModel, myLargeTimeGrid);
+      fullprint << "sampling method=" << myProcess2.getSamplingMethod() << std::endl;
+      fullprint << "mean over " << size << " realizations= " << myProcess2.getSample(size).computeMean().getTemporalMean() << std::endl;
+
+      /* Force the use of the Cholesky factor */
+      ResourceMap::SetAsBool("TemporalNormalProcess-UseCirculantEmbedding", false);
+      TemporalNormalProcess myProcess3(myCovModel, myTimeGrid);
+      fullprint << "sampling method=" << myProcess3.getSamplingMethod() << std::endl;
+      fullprint << "mean over " << size << " realizations= " << myProcess3.getSample(size).computeMean() << std::endl;
 
     }
   catch (TestFailed & ex)
@@ -82,6 +82,34 @@ int main(int argc, char *argv[])
       for (UnsignedLong i = 0; i < 6; ++i) fullprint << "standard moment n=" << i << ", value=" << distribution.getStandardMoment(i) << std::endl;
       fullprint << "Standard representative=" << distribution.getStandardRepresentative()->__str__() << std::endl;
 
+      // Large support with non-uniform weights
+      {
+        const UnsignedLong supportSize(1000);
+        NumericalSample support(supportSize, 1);
+        NumericalPoint weights(supportSize);
+        for (UnsignedLong i = 0; i < supportSize; ++i)
+          {
+            support[i][0] = i;
+            weights[i] = (i % 7) + 1.0;
+          }
+        const UserDefined largeDistribution(support, weights);
+        const RandomGeneratorState state(RandomGenerator::GetState());
+        const NumericalSample largeSample(largeDistribution.getSample(100));
+        RandomGenerator::SetState(state);
+        Bool sameAsRealizations(true);
+        for (UnsignedLong i = 0; i < 100; ++i) sameAsRealizations = sameAsRealizations && (largeSample[i] == largeDistribution.getRealization());
+        fullprint << "large support sample same as realizations=" << (sameAsRealizations ? "true" : "false") << std::endl;
+        Bool quantileOk(true);
+        for (UnsignedLong i = 0; i < 100; ++i)
+          {
+            const NumericalScalar q(RandomGenerator::Generate());
+            const NumericalPoint quantile(largeDistribution.computeQuantile(q));
+            // The quantile is the first atom such that CDF(atom) >= q
+            quantileOk = quantileOk && (largeDistribution.computeCDF(quantile) >= q) && ((quantile[0] == 0.0) || (largeDistribution.computeCDF(quantile - NumericalPoint(1, 1.0)) < q));
+          }
+        fullprint << "large support quantile ok=" << (quantileOk ? "true" : "false") << std::endl;
+      }
+
       NumericalSample sample(4, 3);
       for (UnsignedLong i = 0; i < 4; ++i)
         {
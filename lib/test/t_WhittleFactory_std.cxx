@@ -92,6 +92,16 @@ int main(int argc, char *argv[])
       //fullprint << "Estimated ARMA=" << result2.__str__() << std::endl;
       //fullprint << "Information criteria=" << informationCriteria.__str__() << std::endl;
       //fullprint << "History=" << factory.getHistory().__str__()  << std::endl;
+      fullprint << "History size=" << factory.getHistory().getSize() << std::endl;
+      /* The selected model is the best one of the history */
+      NumericalScalar bestCriterion(SpecFunc::MaxNumericalScalar);
+      for (UnsignedLong i = 0; i < factory.getHistory().getSize(); ++i) bestCriterion = std::min(bestCriterion, factory.getHistory()[i].getInformationCriteria()[0]);
+      fullprint << "Best model selected=" << (informationCriteria[0] == bestCriterion) << std::endl;
+      /* Prune the orders as soon as a level of the (p, q) grid does not improve the information criterion */
+      ResourceMap::SetAsUnsignedLong("WhittleFactory-MaximumNonImprovingLevels", 1);
+      Process result3(factory.build(sample, informationCriteria));
+      const UnsignedLong prunedSize(factory.getHistory().getSize());
+      fullprint << "Pruned history size ok=" << ((prunedSize > 0) && (prunedSize <= pIndices.getSize() * qIndices.getSize())) << std::endl;
 
     }
   catch (TestFailed & ex)
@@ -0,0 +1,9 @@
+// SWIG file GraphRenderer.i
+// @author schueller
+// @date   2012-04-18 17:56:46 +0200 (Wed, 18 Apr 2012)
+
+%{
+#include "GraphRenderer.hxx"
+%}
+
+%include GraphRenderer.hxx
@@ -74,6 +74,9 @@ class OpenTURNSPythonFunction :
     Functions to overload:
     _exec(X): single evaluation, X is a sequence of scalars
     _exec_sample(X): multiple evaluations, X is a 2-d sequence of scalars
+
+    Note: numpy.asarray(X) gives a view on X without copy in _exec_sample, and
+    returning a 2-d numpy array of floats avoids any per-value conversion.
     """
     def __init__(self, n=0, p=0) :
         try:
@@ -117,6 +120,10 @@ class OpenTURNSPythonFunction :
 
     def __call__(self, X) :
         Y = None
+        if isinstance( X, memoryview ):
+            # The library passes the points as a read-only view on its own storage,
+            # valid only during the call. The sample is built from it in one block.
+            return self._exec_sample( openturns.typ.NumericalSample( X ) )
         try:
             pt = openturns.typ.NumericalPoint( X )
         except TypeError:
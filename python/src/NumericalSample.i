@@ -19,7 +19,7 @@
 }
 
 %typemap(typecheck,precedence=OT_TYPECHECK_NUMERICALSAMPLE) const NumericalSample & {
-  $1 = SWIG_IsOK(SWIG_ConvertPtr($input, NULL, $1_descriptor, 0)) || OT::isAPythonSequenceOf<OT::_PySequence_>( $input );
+  $1 = SWIG_IsOK(SWIG_ConvertPtr($input, NULL, $1_descriptor, 0)) || OT::isAPythonBufferOfNumericalScalar( $input, 2 ) || OT::isAPythonSequenceOf<OT::_PySequence_>( $input );
 }
 
 %apply const NumericalSample & { const OT::NumericalSample & };
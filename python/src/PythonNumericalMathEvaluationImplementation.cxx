@@ -263,23 +263,56 @@ NumericalSample PythonNumericalMathEvaluationImplementation::operator() (const N
     {
       callsNumber_ += toDoSize;
 
-      PyObject * inTuple = PyTuple_New( toDoSize );
-
-      for ( UnsignedLong i = 0; i < toDoSize; ++ i )
+      // Gather the points to evaluate into a contiguous block
+      NumericalSample inToDo( toDoSize == size ? inS : NumericalSample( toDoSize, inDim ) );
+      if ( toDoSize < size )
+        for ( UnsignedLong i = 0; i < toDoSize; ++ i ) inToDo[i] = inS[toDo[i]];
+
+      PyObject * result = NULL;
+      // The callables built on OpenTURNSPythonFunction receive a read-only memoryview on the
+      // values, without one Python float per value. The others keep receiving nested tuples.
+      if ( PyObject_HasAttrString( pyObj_, const_cast<char *>( "_exec_sample" ) ) )
         {
-          PyObject * eltTuple = PyTuple_New( inDim );
-          for ( UnsignedLong j = 0; j < inDim; ++ j ) PyTuple_SetItem( eltTuple, j, convert< NumericalScalar, _PyFloat_ > ( inS[toDo[i]][j] ) );
-          PyTuple_SetItem( inTuple, i, eltTuple );
+          const PythonSampleView inView( inToDo );
+          result = PyObject_CallFunctionObjArgs( pyObj_, inView.get(), NULL );
+        }
+      else
+        {
+          PyObject * inTuple = PyTuple_New( toDoSize );
+          for ( UnsignedLong i = 0; i < toDoSize; ++ i )
+            {
+              PyObject * eltTuple = PyTuple_New( inDim );
+              for ( UnsignedLong j = 0; j < inDim; ++ j ) PyTuple_SetItem( eltTuple, j, convert< NumericalScalar, _PyFloat_ > ( inToDo( i, j ) ) );
+              PyTuple_SetItem( inTuple, i, eltTuple );
+            }
+          result = PyObject_CallFunctionObjArgs( pyObj_, inTuple, NULL );
+          Py_XDECREF( inTuple );
         }
-
-      PyObject * result = PyObject_CallFunctionObjArgs( pyObj_, inTuple, NULL );
 
       if ( result == NULL )
         {
           handleException();
         }
 
-      if ( PySequence_Check( result ) )
+      // Arrays of doubles (numpy...) are read directly through the buffer protocol
+      Py_buffer outView;
+      if ( getPythonBufferOfNumericalScalar( result, outView, 2 ) )
+        {
+          const UnsignedLong lengthResult = outView.shape[0];
+          const UnsignedLong lengthElt = outView.shape[1];
+          if ( ( lengthResult != toDoSize ) || ( lengthElt != outDim ) )
+            {
+              PyBuffer_Release( &outView );
+              Py_XDECREF( result );
+              throw InvalidArgumentException(HERE) << "Python NumericalMathFunction returned an array with incorrect shape (got ("
+                                                   << lengthResult << ", " << lengthElt << "), expected (" << toDoSize << ", " << outDim << "))";
+            }
+          for (UnsignedLong i = 0; i < toDoSize; ++i)
+            for (UnsignedLong j = 0; j < outDim; ++j)
+              outS( toDo[i], j ) = getPythonBufferValue( outView, i, j );
+          PyBuffer_Release( &outView );
+        }
+      else if ( PySequence_Check( result ) )
         {
           const UnsignedLong lengthResult = PySequence_Size( result );
           if ( lengthResult == toDoSize )
@@ -320,7 +353,6 @@ NumericalSample PythonNumericalMathEvaluationImplementation::operator() (const N
             }
         }
 
-      Py_XDECREF( inTuple );
       Py_XDECREF( result  );
     }
 
@@ -380,6 +380,12 @@ isAPythonSequenceOf(PyObject * pyObj)
       for( UnsignedLong i = 0; ok && (i < size); ++i )
         {
           PyObject * elt = PySequence_ITEM( pyObj, i );
+          // Some sequences (multi-dimensional memoryviews) do not give access to their items
+          if ( elt == NULL )
+            {
+              PyErr_Clear();
+              return 0;
+            }
           int elt_ok = isAPython<PYTHON_Type>( elt );
           ok *= elt_ok;
           Py_XDECREF( elt );
@@ -422,6 +428,11 @@ buildCollectionFromPySequence(PyObject * pyObj, int sz = 0)
 {
   check<_PySequence_>( pyObj );
   PyObject * newPyObj = PySequence_Fast( pyObj, "" );
+  if ( newPyObj == NULL )
+    {
+      PyErr_Clear();
+      throw InvalidArgumentException(HERE) << "Object passed as argument is not a " << namePython<_PySequence_>() << " giving access to its items";
+    }
 
   const UnsignedLong size = PySequence_Fast_GET_SIZE( newPyObj );
   if ((sz != 0) && (sz != (int)size))
@@ -456,6 +467,51 @@ buildCollectionFromPySequence(PyObject * pyObj, int sz = 0)
 
 
 
+/* Buffer protocol
+ * Numpy arrays, memoryviews and the like expose their values as a block of memory, possibly
+ * strided, which is read here without creating one Python object per value. Only the
+ * blocks of native doubles with the given number of dimensions are accepted.
+ */
+static inline
+int
+getPythonBufferOfNumericalScalar(PyObject * pyObj, Py_buffer & view, const int ndim)
+{
+  if ( ! PyObject_CheckBuffer( pyObj ) ) return 0;
+  if ( PyObject_GetBuffer( pyObj, &view, PyBUF_STRIDES | PyBUF_FORMAT ) < 0 )
+    {
+      PyErr_Clear();
+      return 0;
+    }
+  const char * format = view.format;
+  const int one = 1;
+  const Bool isLittleEndian = *reinterpret_cast<const char *>( &one ) == 1;
+  if ( ( format != NULL ) && ( ( format[0] == '@' ) || ( format[0] == '=' ) || ( format[0] == ( isLittleEndian ? '<' : '>' ) ) ) ) ++ format;
+  const int ok = ( view.ndim == ndim ) && ( view.itemsize == sizeof( NumericalScalar ) ) && ( format != NULL ) && ( String( format ) == "d" );
+  if ( ! ok ) PyBuffer_Release( &view );
+  return ok;
+}
+
+static inline
+int
+isAPythonBufferOfNumericalScalar(PyObject * pyObj, const int ndim)
+{
+  Py_buffer view;
+  if ( ! getPythonBufferOfNumericalScalar( pyObj, view, ndim ) ) return 0;
+  PyBuffer_Release( &view );
+  return 1;
+}
+
+static inline
+NumericalScalar
+getPythonBufferValue(const Py_buffer & view, const UnsignedLong i, const UnsignedLong j = 0)
+{
+  const char * p_value = static_cast<const char *>( view.buf ) + i * view.strides[0];
+  if ( view.ndim > 1 ) p_value += j * view.strides[1];
+  return *reinterpret_cast<const NumericalScalar *>( p_value );
+}
+
+
+
 template <>
 struct traitsPythonType< NumericalPoint >
 {
@@ -467,6 +523,15 @@ inline
 NumericalPoint
 convert< _PySequence_, NumericalPoint >(PyObject * pyObj)
 {
+  Py_buffer view;
+  if ( getPythonBufferOfNumericalScalar( pyObj, view, 1 ) )
+    {
+      const UnsignedLong dimension = view.shape[0];
+      NumericalPoint point( dimension );
+      for ( UnsignedLong i = 0; i < dimension; ++ i ) point[i] = getPythonBufferValue( view, i );
+      PyBuffer_Release( &view );
+      return point;
+    }
   Pointer<Collection<NumericalScalar> > ptr = buildCollectionFromPySequence<NumericalScalar>( pyObj );
   return NumericalPoint( *ptr );
 }
@@ -514,6 +579,18 @@ inline
 NumericalSample
 convert< _PySequence_, NumericalSample >(PyObject * pyObj)
 {
+  Py_buffer view;
+  if ( getPythonBufferOfNumericalScalar( pyObj, view, 2 ) )
+    {
+      const UnsignedLong size = view.shape[0];
+      const UnsignedLong dimension = view.shape[1];
+      NumericalSample sample( size, dimension );
+      for ( UnsignedLong i = 0; i < size; ++ i )
+        for ( UnsignedLong j = 0; j < dimension; ++ j )
+          sample( i, j ) = getPythonBufferValue( view, i, j );
+      PyBuffer_Release( &view );
+      return sample;
+    }
   Pointer<Collection<NumericalPoint> > ptr = buildCollectionFromPySequence<NumericalPoint>( pyObj );
   return NumericalSample( *ptr );
 }
@@ -973,6 +1050,68 @@ convert< _PySequence_, WhittleFactoryState >(PyObject * pyObj)
 }
 
 
+/* Read-only memoryview on the values of a sample, exposed without copy through the buffer protocol
+ * It is meant to be passed to a Python callable: the view is released when this object is
+ * destroyed, so the callable must not keep a reference to it after it has returned.
+ */
+class PythonSampleView
+{
+public:
+  explicit PythonSampleView(const NumericalSample & sample)
+    : sample_(sample)
+    , emptyValue_(0.0)
+    , pyObj_(NULL)
+  {
+    shape_[0] = sample_.getSize();
+    shape_[1] = sample_.getDimension();
+    strides_[0] = shape_[1] * sizeof( NumericalScalar );
+    strides_[1] = sizeof( NumericalScalar );
+    // The memoryview does not accept a NULL address, even for an empty block
+    const NumericalScalar * p_data = ( shape_[0] * shape_[1] > 0 ) ? &sample_( 0, 0 ) : &emptyValue_;
+    Py_buffer view;
+    PyBuffer_FillInfo( &view, NULL, const_cast<NumericalScalar *>( p_data ), shape_[0] * strides_[0], 1, PyBUF_FULL_RO );
+    view.format = const_cast<char *>( "d" );
+    view.ndim = 2;
+    view.itemsize = sizeof( NumericalScalar );
+    view.shape = shape_;
+    view.strides = strides_;
+    pyObj_ = PyMemoryView_FromBuffer( &view );
+    if ( pyObj_ == NULL )
+      {
+        PyErr_Clear();
+        throw InternalException(HERE) << "Cannot build a memoryview on a sample of size=" << shape_[0] << " and dimension=" << shape_[1];
+      }
+  }
+
+  ~PythonSampleView()
+  {
+#if PY_VERSION_HEX >= 0x03020000
+    // Make any reference kept by the callable unusable instead of dangling
+    PyObject * result = PyObject_CallMethod( pyObj_, const_cast<char *>( "release" ), const_cast<char *>( "()" ) );
+    if ( result == NULL ) PyErr_Clear();
+    Py_XDECREF( result );
+#endif
+    Py_XDECREF( pyObj_ );
+  }
+
+  PyObject * get() const
+  {
+    return pyObj_;
+  }
+
+private:
+  PythonSampleView(const PythonSampleView & other);
+  PythonSampleView & operator = (const PythonSampleView & other);
+
+  const NumericalSample sample_;
+  const NumericalScalar emptyValue_;
+  Py_ssize_t shape_[2];
+  Py_ssize_t strides_[2];
+  PyObject * pyObj_;
+}; /* class PythonSampleView */
+
+
+
 inline
 void handleException()
 {
@@ -0,0 +1,10 @@
+// SWIG file Spill.i
+// @author schueller
+// @date   2012-01-02 11:44:01 +0100 (Mon, 02 Jan 2012)
+
+%{
+#include "Spill.hxx"
+%}
+
+%include Spill.hxx
+namespace OT{ %extend Spill { Spill(const Spill & other) { return new OT::Spill(other); } } }
@@ -46,6 +46,7 @@
 %include Pairs.i
 %include Pie.i
 %include Staircase.i
+%include GraphRenderer.i
 
 /* At last we include template definitions */
 %include BaseGraphTemplateDefs.i
@@ -43,6 +43,7 @@
 %include Full.i  
 %include Last.i  
 %include Null.i  
+%include Spill.i
 %include ConfidenceInterval.i
 %include LinearModel.i  
 %include LinearModelFactory.i  
@@ -45,6 +45,12 @@ try :
     for i in range(size):
         compactStrategy.store(sample[i])
     print "Compact strategy sample (small storage)=", repr(compactStrategy.getSample())
+    # History using the Spill strategy, blocks written to disk
+    spillStrategy = Spill(divmod(size, 3)[0])
+    for i in range(size):
+        spillStrategy.store(sample[i])
+    print "Spill strategy sample=", repr(spillStrategy.getSample())
+    print "Spill strategy block number=", spillStrategy.getBlockNumber()
 
 except :
     import sys
@@ -114,6 +114,14 @@ try :
     print "NumericalPoint", PYNMF( a0 ), "= PYNMF( array", a0, ")"
     print "NumericalSample", PYNMF( a1 ), "= PYNMF( array", a1, ")"
 
+    # Check vectorized Python function / NumericalMathFunction interoperability
+    def aFuncSample( X ):
+        return asarray( X ).sum( axis = 1 ).reshape( ( -1, 1 ) )
+
+    PYNMF = PythonFunction(4, 1, func_sample = aFuncSample)
+
+    print "NumericalSample", PYNMF( a1 ), "= PYNMF( array", a1, ")"
+
     # Check 2-d array which nested dim is size=1 / NumericalMathFunction interoperability
     def aFunc2( x ):
         return [ 2.0 * x[0] ]